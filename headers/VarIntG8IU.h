@@ -15,13 +15,14 @@
  * https://github.com/maximecaron/SIMD-Based-Posting-lists
  * with minor modifications by D. Lemire.
  */
-#ifndef __SSSE3__
+#if !defined(__SSSE3__) && !defined(__aarch64__)
 #pragma message "Disabling varintg8iu due to lack of SSSE3 support, try adding -mssse3"
 #else
 #ifndef VARINTG8IU_H__
 #define VARINTG8IU_H__
-#include <emmintrin.h>
 #include "codecs.h"
+#include "cpufeatures.h"
+#include "varintg8iu_avx2.h"
 #ifdef __GNUC__
 #define PREDICT_FALSE(x) (__builtin_expect(x, 0))
 #define PREDICT_TRUE(x) (__builtin_expect(!!(x), 1))
@@ -29,16 +30,14 @@
 #define PREDICT_FALSE(x) x
 #define PREDICT_TRUE(x) x
 #endif
-typedef char v16qi __attribute__ ((vector_size (16)));
 
-class VarIntG8IU: public IntegerCODEC {
-
-public:
-
-    // For all possible values of the
-    // descriptor we build a table of any shuffle sequence
-    // that might be needed at decode time.
-    VarIntG8IU() {
+/**
+ * The shuffle masks (and the number of integers) for each of the 256
+ * descriptors. They do not depend on the instance, so we build them once.
+ */
+struct VarIntG8IUTables {
+    VarIntG8IUTables() :
+        maskOutputSize(), mask() {
         for (int desc = 0; desc <= 255; desc++) {
             int bitmask = 0x00000001;
             int bitindex = 0;
@@ -62,7 +61,7 @@ public:
             for (int i = 0; i < complete; i++) {
                 for (int n = 0; n < 4; n++) {
                     if (n < ithSize[i]) {
-                        mask[desc][k] = j;
+                        mask[desc][k] = static_cast<char> (j);
                         j = j + 1;
                     } else {
                         mask[desc][k] = -1;
@@ -70,10 +69,23 @@ public:
                     k = k + 1;
                 }
             }
-
+            for (; k < 32; k++)
+                mask[desc][k] = -1;
         }
+    }
+
+    int maskOutputSize[256];
+    __attribute__ ((aligned (32))) char mask[256][32];
 
+    static const VarIntG8IUTables & get() {
+        static const VarIntG8IUTables tables;
+        return tables;
     }
+};
+
+class VarIntG8IU: public IntegerCODEC {
+
+public:
 
     void encodeArray(const uint32_t *in, const size_t length,
             uint32_t *out, size_t &nvalue) {
@@ -84,13 +96,19 @@ public:
         nvalue = nvalue * 4;
 
         size_t compressed_size = 0;
-        while (srclength > 0 && nvalue >= 9) {
+        while (srclength > 0) {
+            if (nvalue < 9)
+                throw NotEnoughStorage(maxCompressedWords(length));
             compressed_size += encodeBlock(src, srclength, dst, nvalue);
         }
         //Ouput might not be a multiple of 4 so we make it so
         nvalue = ((compressed_size + 3 )/ 4);
     }
 
+    /**
+     * On processors with AVX2, all groups but the last one are decoded by
+     * avx2::varintg8iuDecode, two at a time.
+     */
     const uint32_t * decodeArray(const uint32_t *in,
             const size_t length, uint32_t *out, size_t &nvalue) {
         size_t srclength = length * 4;
@@ -99,7 +117,18 @@ public:
         uint32_t * dst = out;
         nvalue = nvalue * 4;
 
-        uint32_t uncompressSize = 0;
+        size_t uncompressSize = 0;
+#ifdef FASTPFOR_X86
+        if (cpuSupportsAVX2() && (srclength >= 2 * 9)) {
+            const VarIntG8IUTables & tables = VarIntG8IUTables::get();
+            const size_t groups = srclength / 9 - 1;
+            uncompressSize = avx2::varintg8iuDecode(src, groups, dst,
+                    tables.mask, tables.maskOutputSize);
+            src += 9 * groups;
+            srclength -= 9 * groups;
+            dst += uncompressSize;
+        }
+#endif
         while (srclength >= 9) {
             uncompressSize += decodeBlock(src, srclength, dst, nvalue);
         }
@@ -108,57 +137,61 @@ public:
                 + 3) & ~3);
     }
 
+    // 9 bytes for every pair of integers, at worst
+    virtual size_t maxCompressedWords(const size_t length) const {
+        return (9 * ((length + 1) / 2) + 3) / 4;
+    }
+
+    // a group of 9 bytes holds as many integers as its descriptor has zeros
+    virtual size_t decodedLength(const uint32_t * in, const size_t length) {
+        const int * const maskOutputSize = VarIntG8IUTables::get().maskOutputSize;
+        const unsigned char * src = reinterpret_cast<const unsigned char *> (in);
+        size_t answer = 0;
+        for (size_t srclength = length * 4; srclength >= 9; srclength -= 9, src += 9)
+            answer += maskOutputSize[*src];
+        return answer;
+    }
+
     virtual std::string name() const {
         return string("VarIntG8IU");
     }
+    virtual shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new VarIntG8IU(*this));
+    }
 
 
 
 
 
-
+    /**
+     * The integers are copied 4 bytes at a time to a zeroed group, each
+     * one overwriting the unused bytes of the previous one, so we only
+     * branch on whether the next integer fits.
+     */
     int encodeBlock(const uint32_t*& src, size_t& srclength,
             unsigned char*& dest, size_t& dstlength) {
-        unsigned char desc = 0xFF;
-        unsigned char bitmask = 0x01;
-        uint32_t buffer[8];
-        int ithSize[8];
-        int length = 0;
-        int numInt = 0;
+        unsigned char group[8 + 4] = { 0 };// the last integer may spill
+        uint32_t desc = 0xFF;
+        uint32_t length = 0;
 
         while (srclength > 0) {
-            //size_t n;
-            const uint32_t* temp = src;
-            int byteNeeded = getNumByteNeeded(*temp);
+            const uint32_t value = *src;
+            const uint32_t byteNeeded = getNumByteNeeded(value);
 
             if (PREDICT_FALSE(length + byteNeeded > 8)) {
                 break;
             }
 
-            //flip the correct bit in desc
-            bitmask = bitmask << (byteNeeded - 1);
-            desc = desc ^ bitmask;
-            bitmask = bitmask << 1;
-
-            ithSize[numInt] = byteNeeded;
+            memcpy(group + length, &value, sizeof(value));
             length += byteNeeded;
-            buffer[numInt] = *temp;
+            //flip the bit of the last byte in desc
+            desc ^= 1U << (length - 1);
             src = src + 1;
             srclength -= 4;
-            numInt++;
         }
 
-        
-        dest[0] = desc;
-        int written = 1;
-        for (int i = 0; i < numInt; i++) {
-            int size = ithSize[i];
-            uint32_t value = buffer[i];
-            for (int j = 0; j < size; j++) {
-                dest[written] = value >> (j * 8);
-                written++;
-            }
-        }
+        dest[0] = static_cast<unsigned char> (desc);
+        memcpy(dest + 1, group, 8);
         dest += 9;
         dstlength -= 9;
         return 9;
@@ -170,35 +203,25 @@ public:
      */
     int decodeBlock(const unsigned char*& src, size_t& srclength,
             uint32_t*& dest, size_t& dstlength) const {
-
-        const unsigned char* pdesc = src;
-        unsigned char desc = *pdesc;
+        const VarIntG8IUTables & tables = VarIntG8IUTables::get();
+        const unsigned char desc = *src;
         src += 1;
         srclength -= 1;
 
-        const unsigned char* peek = src;
-        v16qi data;
-        if (PREDICT_TRUE(srclength >= 16)) {
-            // read 16 byte of data only if we need
-            // to avoid cache miss
-            data = __builtin_ia32_lddqu(reinterpret_cast<const char*> (peek));
-        } else {
-            static char buff[16];
-            memcpy(buff, peek, 8);
-            data = __builtin_ia32_lddqu(buff);
-        }
+        // the 8 bytes of data
+        const __m128i data = _mm_loadl_epi64(reinterpret_cast<const __m128i *> (src));
 
         // load de required mask
-        v16qi shf = __builtin_ia32_lddqu(mask[desc]);
-        v16qi result = __builtin_ia32_pshufb128(data, shf);
-        char* dst = reinterpret_cast<char*> (dest);
-        __builtin_ia32_storedqu(dst, result);
-        int readSize = maskOutputSize[desc];
+        const __m128i shf = _mm_load_si128(reinterpret_cast<const __m128i *> (tables.mask[desc]));
+        const __m128i result = _mm_shuffle_epi8(data, shf);
+        __m128i * dst = reinterpret_cast<__m128i *> (dest);
+        _mm_storeu_si128(dst, result);
+        const int readSize = tables.maskOutputSize[desc];
 
         if (PREDICT_TRUE( readSize >= 4)) {
-            v16qi shf2 = __builtin_ia32_lddqu(mask[desc] + 16);
-            v16qi result2 = __builtin_ia32_pshufb128(data, shf2);
-            __builtin_ia32_storedqu(dst + (16), result2);
+            const __m128i shf2 = _mm_load_si128(reinterpret_cast<const __m128i *> (tables.mask[desc] + 16));
+            const __m128i result2 = _mm_shuffle_epi8(data, shf2);
+            _mm_storeu_si128(dst + 1, result2);
         }
         // pop 8 input char
         src += 8;
@@ -213,23 +236,10 @@ public:
 
 private:
 
-    int maskOutputSize[256];
-    char mask[256][32];
-
-    int getNumByteNeeded(const uint32_t value) {
-        if (value > 0x000000FF) {
-            if (value > 0x0000FFFF) {
-                if (value > 0x00FFFFFF) {
-                    return 4;
-                } else {
-                    return 3;
-                }
-            } else {
-                return 2;
-            }
-        } else {
-            return 1;
-        }
+    static uint32_t getNumByteNeeded(const uint32_t value) {
+        static const uint8_t bytes[33] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+                2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+        return bytes[gccbits(value)];
     }
 
 };
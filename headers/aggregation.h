@@ -0,0 +1,90 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef AGGREGATION_H_
+#define AGGREGATION_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+#include "simdbitpacking.h"
+
+/**
+ * Sum, minimum, maximum and count of integers, as the aggregate methods
+ * of the codecs (SIMDBinaryPacking, SIMDGlobalBinaryPacking,
+ * SIMDFastPFor) compute them on compressed arrays.
+ */
+struct Aggregate {
+    Aggregate() :
+        sum(0), min(0xFFFFFFFFU), max(0), count(0) {
+    }
+
+    void add(const uint32_t v) {
+        sum += v;
+        min = v < min ? v : min;
+        max = v > max ? v : max;
+        ++count;
+    }
+
+    void add(const uint32_t * in, const size_t length) {
+        for (size_t i = 0; i < length; ++i)
+            add(in[i]);
+    }
+
+    Aggregate & operator+=(const Aggregate & o) {
+        if (o.count == 0)
+            return *this;
+        sum += o.sum;
+        min = o.min < min ? o.min : min;
+        max = o.max > max ? o.max : max;
+        count += o.count;
+        return *this;
+    }
+
+    bool operator==(const Aggregate & o) const {
+        return (sum == o.sum) && (min == o.min) && (max == o.max) && (count == o.count);
+    }
+
+    uint64_t sum;
+    uint32_t min;// 0xFFFFFFFF if there is no integer
+    uint32_t max;
+    uint64_t count;
+};
+
+/**
+ * Adds to a the integers of howmany consecutive blocks of 128 integers
+ * packed with bit bits by SIMD_fastpack_32 (bit * 4 words per block,
+ * aligned). The integers are unpacked into registers and reduced there
+ * (sum in 32-bit lanes, flushed to 64-bit lanes once per block, min and
+ * max with SSE4.1 instructions): nothing is written to memory.
+ *
+ * The implementation (src/aggregation.cpp) is compiled with -msse4.1 and,
+ * in the avx2 namespace, with -mavx2 (src/aggregation_avx2.cpp).
+ */
+void SIMD_aggregate_32(const __m128i * in, const uint32_t bit, const size_t howmany,
+        Aggregate & a);
+namespace avx2 {
+void SIMD_aggregate_32(const __m128i * in, const uint32_t bit, const size_t howmany,
+        Aggregate & a);
+}
+
+// SIMD_aggregate_32 with the best build for this processor
+inline void SIMD_fastaggregate_32(const __m128i * in, const uint32_t bit,
+        const size_t howmany, Aggregate & a) {
+    if (cpuSupportsAVX2()) {
+        avx2::SIMD_aggregate_32(in, bit, howmany, a);
+    } else if (cpuSupportsSSE41()) {
+        SIMD_aggregate_32(in, bit, howmany, a);
+    } else {
+        __attribute__ ((aligned (16))) uint32_t buffer[128];
+        for (size_t k = 0; k < howmany; ++k, in += bit) {
+            SIMD_fastunpack_32(in, buffer, bit);
+            a.add(buffer, 128);
+        }
+    }
+}
+
+#endif /* AGGREGATION_H_ */
@@ -0,0 +1,163 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef APPENDABLELIST_H_
+#define APPENDABLELIST_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "memutil.h"
+#include "simdbinarypacking.h"
+
+using namespace std;
+
+/**
+ * A compressed array we can append to (e.g., a posting list receiving new
+ * postings) without re-encoding it: the array is a sequence of pages,
+ * each one with its own length header. Every SealSize (CODEC::BlockSize)
+ * integers, the open tail page gets compressed with CODEC and sealed: it
+ * is never touched again. So append(values, n) costs O(n): the integers
+ * are copied to the tail page and, for every SealSize of them, a page
+ * is compressed once.
+ *
+ * Format (data(), compressedWords() words):
+ *    for each sealed page: SealSize, its number of words w, the w words
+ *    (CODEC::encodeArray),
+ *    the tail page: its number of integers n < SealSize, n, the n
+ *    integers (not compressed).
+ *
+ * As with SIMDBinaryPacking, the pages are compressed with the alignment
+ * they have in the list: load the words of a list at a 16-byte boundary.
+ */
+template<class CODEC = SIMDBinaryPacking>
+class AppendableList {
+public:
+    enum {
+        HeaderSize = 2,
+        SealSize = CODEC::BlockSize
+    };
+
+    AppendableList() :
+        words(HeaderSize, 0), length(0), tailstart(0), codec() {
+    }
+
+    void append(const uint32_t * values, size_t n) {
+        while (n > 0) {
+            const size_t chunk = min<size_t> (n, SealSize - words[tailstart]);
+            words.insert(words.end(), values, values + chunk);
+            words[tailstart] += static_cast<uint32_t> (chunk);
+            words[tailstart + 1] += static_cast<uint32_t> (chunk);
+            length += chunk;
+            values += chunk;
+            n -= chunk;
+            if (words[tailstart] == SealSize)
+                seal();
+        }
+    }
+
+    void push_back(const uint32_t value) {
+        append(&value, 1);
+    }
+
+    // number of integers
+    size_t size() const {
+        return length;
+    }
+
+    /**
+     * Writes the size() integers to out, which should be aligned (as for
+     * CODEC::decodeArray) and have room for size() integers.
+     */
+    void decode(uint32_t * out) const {
+        decode(data(), compressedWords(), out);
+    }
+
+    const uint32_t * data() const {
+        return words.data();
+    }
+    size_t compressedWords() const {
+        return words.size();
+    }
+    size_t memoryUsage() const {
+        return words.capacity() * sizeof(uint32_t);
+    }
+
+    void clear() {
+        words.assign(HeaderSize, 0);
+        length = 0;
+        tailstart = 0;
+    }
+
+    /**
+     * Continues the list in (length words, as given by data() and
+     * compressedWords()): the sealed pages are copied as they are.
+     */
+    void load(const uint32_t * in, const size_t inlength) {
+        words.assign(in, in + inlength);
+        length = 0;
+        tailstart = 0;
+        while (tailstart < words.size()) {
+            if ((words.size() - tailstart < HeaderSize) || (words[tailstart + 1]
+                    > words.size() - tailstart - HeaderSize))
+                throw logic_error("AppendableList: truncated page");
+            const size_t next = tailstart + HeaderSize + words[tailstart + 1];
+            if (words[tailstart] != SealSize) {
+                if ((words[tailstart] != words[tailstart + 1]) || (next != words.size()))
+                    throw logic_error("AppendableList: bad tail page");
+                break;
+            }
+            length += SealSize;
+            tailstart = next;
+        }
+        if (tailstart == words.size())
+            words.resize(tailstart + HeaderSize, 0);
+        length += words[tailstart];
+    }
+
+    // number of integers in the list in (length words)
+    static size_t decodedLength(const uint32_t * in, const size_t inlength) {
+        size_t answer = 0;
+        for (const uint32_t * page = in; page < in + inlength; page += HeaderSize + page[1])
+            answer += page[0];
+        return answer;
+    }
+
+    // writes the integers of the list in (length words) to out (aligned)
+    static void decode(const uint32_t * in, const size_t inlength, uint32_t * out) {
+        CODEC c;
+        for (const uint32_t * page = in; page < in + inlength; page += HeaderSize + page[1]) {
+            size_t nvalue = page[0];
+            if (page[0] == SealSize)
+                c.decodeArray(page + HeaderSize, page[1], out, nvalue);
+            else
+                memcpy(out, page + HeaderSize, page[0] * sizeof(uint32_t));
+            out += page[0];
+        }
+    }
+
+private:
+    // compresses the full tail page, a new empty one follows
+    void seal() {
+        __attribute__ ((aligned (16))) uint32_t buffer[SealSize];
+        memcpy(buffer, &words[tailstart + HeaderSize], SealSize * sizeof(uint32_t));
+        words.resize(tailstart + HeaderSize + codec.maxCompressedWords(SealSize));
+        size_t nvalue = words.size() - tailstart - HeaderSize;
+        codec.encodeArray(buffer, SealSize, &words[tailstart + HeaderSize], nvalue);
+        words[tailstart + 1] = static_cast<uint32_t> (nvalue);
+        tailstart += HeaderSize + nvalue;
+        words.resize(tailstart + HeaderSize);
+        words[tailstart] = 0;
+        words[tailstart + 1] = 0;
+    }
+
+    vector<uint32_t, cacheallocator> words;
+    size_t length;
+    size_t tailstart;// where the tail page starts in words
+    CODEC codec;
+};
+
+#endif /* APPENDABLELIST_H_ */
@@ -0,0 +1,28 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef AVXBITPACKING_H_
+#define AVXBITPACKING_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+
+/**
+ * 256-bit counterparts of the functions in simdbitpacking.h. They work
+ * on blocks of 256 integers (8 interleaved lanes of 32 integers) and
+ * a block packed with "bit" bits uses 8 * bit 32-bit words.
+ *
+ * The implementation (src/avxbitpacking.cpp) is compiled with -mavx2 while
+ * the rest of the library is not, so callers must check cpuSupportsAVX2()
+ * first. Loads and stores are unaligned. They are x86 only.
+ */
+#ifdef FASTPFOR_X86
+void avxpack(const uint32_t * __restrict__ in,__m256i * __restrict__ out, uint32_t bit);
+void avxpackwithoutmask(const uint32_t * __restrict__ in,__m256i * __restrict__ out, uint32_t bit);
+void avxunpack(const __m256i * __restrict__ in,uint32_t * __restrict__ out, uint32_t bit);
+#endif
+
+#endif /* AVXBITPACKING_H_ */
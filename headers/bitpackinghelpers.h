@@ -363,5 +363,23 @@ const uint32_t * unpackblock(const uint32_t * source, uint32_t * out,
     return source;
 }
 
+/**
+ * Returns the integer at position index of data packed with fastpack or
+ * fastpackwithoutmask (any number of consecutive groups of 32 integers
+ * packed with the same bit width), without unpacking.
+ */
+inline uint32_t fastselect(const uint32_t * in, const uint32_t bit, const size_t index) {
+    if (bit == 0)
+        return 0;
+    if (bit == 32)
+        return in[index];
+    const uint64_t pos = static_cast<uint64_t> (index) * bit;
+    const uint32_t * const word = in + (pos >> 5);
+    const uint32_t offset = static_cast<uint32_t> (pos & 31);
+    uint32_t answer = word[0] >> offset;
+    if (offset + bit > 32)
+        answer |= word[1] << (32 - offset);
+    return answer & ((1U << bit) - 1);
+}
 
 #endif /* BITPACKINGHELPERS_H_ */
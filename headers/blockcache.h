@@ -0,0 +1,246 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef BLOCKCACHE_H_
+#define BLOCKCACHE_H_
+
+#include <mutex>
+#include <unordered_map>
+#include "common.h"
+
+using namespace std;
+
+/**
+ * Cache of decoded blocks (e.g., the chunks of DeltaSkipIndex, already
+ * inverse-delta'd), keyed by (list identifier, block index), so that the
+ * lists of popular terms are not decoded again by every query.
+ *
+ * The cache never uses more than about budgetbytes (the integers plus
+ * EntryOverhead bytes per block). It is cut into shards, each with its own
+ * lock and its share of the budget, so that threads rarely wait on each
+ * other. Within a shard, we evict with the CLOCK algorithm: a hit sets the
+ * reference bit of the block, the hand clears the bits it passes and
+ * evicts the first block whose bit is not set.
+ *
+ * Blocks are copied in and out: a block stays valid in the caller's buffer
+ * even if another thread evicts it.
+ *
+ * DecodedBlockCache cache(64 << 20);
+ * ...
+ * size_t n = cache.fetch(term, c, out, [&](uint32_t * o) {
+ *     dsi.decodeChunk(compressed, c, o);
+ *     return DeltaSkipIndex<>::chunkLength(compressed, c);
+ * });
+ */
+class DecodedBlockCache {
+public:
+    enum {
+        EntryOverhead = 64// bytes per block besides the integers (slot, hash table)
+    };
+
+    DecodedBlockCache(const size_t budgetbytes, uint32_t numberofshards = 16) :
+        shards() {
+        if (numberofshards == 0)
+            numberofshards = 1;
+        for (uint32_t s = 0; s < numberofshards; ++s)
+            shards.push_back(unique_ptr<Shard> (new Shard(budgetbytes / numberofshards)));
+    }
+
+    /**
+     * If block (list, block) is in the cache, copies it to out, sets nvalue
+     * to its number of integers and returns true.
+     */
+    bool lookup(const uint32_t list, const uint32_t block, uint32_t * out, size_t & nvalue) {
+        const uint64_t k = key(list, block);
+        Shard & s = shardOf(k);
+        lock_guard<mutex> lock(s.m);
+        unordered_map<uint64_t, size_t>::const_iterator i = s.index.find(k);
+        if (i == s.index.end()) {
+            ++s.misses;
+            return false;
+        }
+        ++s.hits;
+        Slot & slot = s.slots[i->second];
+        slot.referenced = true;
+        nvalue = slot.values.size();
+        if (nvalue > 0)
+            memcpy(out, &slot.values[0], nvalue * sizeof(uint32_t));
+        return true;
+    }
+
+    /**
+     * Copies the nvalue integers of in to the cache as block (list, block),
+     * evicting other blocks if needed. Blocks larger than the budget of a
+     * shard are not cached.
+     */
+    void insert(const uint32_t list, const uint32_t block, const uint32_t * in,
+            const size_t nvalue) {
+        const uint64_t k = key(list, block);
+        Shard & s = shardOf(k);
+        const size_t cost = nvalue * sizeof(uint32_t) + EntryOverhead;
+        if (cost > s.budget)
+            return;
+        lock_guard<mutex> lock(s.m);
+        unordered_map<uint64_t, size_t>::iterator i = s.index.find(k);
+        if (i != s.index.end()) {// another thread beat us to it
+            s.slots[i->second].referenced = true;
+            return;
+        }
+        while (s.used + cost > s.budget)
+            s.evictOne();
+        size_t where;
+        if (s.freeslots.empty()) {
+            where = s.slots.size();
+            s.slots.push_back(Slot());
+        } else {
+            where = s.freeslots.back();
+            s.freeslots.pop_back();
+        }
+        Slot & slot = s.slots[where];
+        slot.key = k;
+        slot.values.assign(in, in + nvalue);
+        slot.referenced = false;
+        slot.used = true;
+        s.index[k] = where;
+        s.used += cost;
+    }
+
+    /**
+     * Copies block (list, block) to out and returns its number of
+     * integers. On a miss, decode(out) should write the block to out and
+     * return its number of integers; we then cache it.
+     */
+    template<class Decoder>
+    size_t fetch(const uint32_t list, const uint32_t block, uint32_t * out, Decoder decode) {
+        size_t nvalue;
+        if (lookup(list, block, out, nvalue))
+            return nvalue;
+        nvalue = decode(out);
+        insert(list, block, out, nvalue);
+        return nvalue;
+    }
+
+    // forgets all blocks (the counters are kept)
+    void clear() {
+        for (size_t s = 0; s < shards.size(); ++s) {
+            lock_guard<mutex> lock(shards[s]->m);
+            shards[s]->clear();
+        }
+    }
+
+    uint64_t hits() const {
+        return sum(&Shard::hits);
+    }
+    uint64_t misses() const {
+        return sum(&Shard::misses);
+    }
+    uint64_t evictions() const {
+        return sum(&Shard::evictions);
+    }
+    double hitRate() const {
+        const uint64_t h = hits(), total = h + misses();
+        return total == 0 ? 0 : static_cast<double> (h) / static_cast<double> (total);
+    }
+    // bytes charged to the budget
+    size_t memoryUsage() const {
+        return sum(&Shard::used);
+    }
+    // number of blocks in the cache
+    size_t size() const {
+        size_t answer = 0;
+        for (size_t s = 0; s < shards.size(); ++s) {
+            lock_guard<mutex> lock(shards[s]->m);
+            answer += shards[s]->index.size();
+        }
+        return answer;
+    }
+
+private:
+    DecodedBlockCache(const DecodedBlockCache &);
+    DecodedBlockCache & operator=(const DecodedBlockCache &);
+
+    struct Slot {
+        Slot() :
+            key(0), values(), referenced(false), used(false) {
+        }
+        uint64_t key;
+        vector<uint32_t> values;
+        bool referenced;
+        bool used;
+    };
+
+    struct Shard {
+        Shard(const size_t b) :
+            m(), index(), slots(), freeslots(), hand(0), budget(b), used(0), hits(0),
+                    misses(0), evictions(0) {
+        }
+
+        // requires at least one block in the shard
+        void evictOne() {
+            while (true) {
+                if (hand >= slots.size())
+                    hand = 0;
+                Slot & slot = slots[hand++];
+                if (!slot.used)
+                    continue;
+                if (slot.referenced) {
+                    slot.referenced = false;
+                    continue;
+                }
+                used -= slot.values.size() * sizeof(uint32_t) + EntryOverhead;
+                index.erase(slot.key);
+                slot.used = false;
+                vector<uint32_t> ().swap(slot.values);
+                freeslots.push_back(hand - 1);
+                ++evictions;
+                return;
+            }
+        }
+
+        void clear() {
+            index.clear();
+            slots.clear();
+            freeslots.clear();
+            hand = 0;
+            used = 0;
+        }
+
+        mutable mutex m;
+        unordered_map<uint64_t, size_t> index;// key to slot
+        vector<Slot> slots;
+        vector<size_t> freeslots;
+        size_t hand;// of the clock
+        const size_t budget;
+        size_t used;
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+    };
+
+    static uint64_t key(const uint32_t list, const uint32_t block) {
+        return (static_cast<uint64_t> (list) << 32) | block;
+    }
+
+    Shard & shardOf(const uint64_t k) {
+        uint64_t h = k * 0x9E3779B97F4A7C15ULL;
+        return *shards[(h >> 32) % shards.size()];
+    }
+
+    template<class T>
+    T sum(T Shard::* counter) const {
+        T answer = 0;
+        for (size_t s = 0; s < shards.size(); ++s) {
+            lock_guard<mutex> lock(shards[s]->m);
+            answer += (*shards[s]).*counter;
+        }
+        return answer;
+    }
+
+    vector<unique_ptr<Shard> > shards;
+};
+
+#endif /* BLOCKCACHE_H_ */
@@ -13,6 +13,9 @@
 #include "bitpackingunaligned.h"
 #include "bitpackingaligned.h"
 #include "util.h"
+#include "variablebyte.h"
+#include "deltabitpacking.h"
+#include "narrowunpacking.h"
 
 /**
  * This is 32-bit *aligned* binary packing, designed from the
@@ -93,11 +96,22 @@ public:
         return in;
     }
 
+    // the 16 bit widths take 3 words
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (3 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         ostringstream convert;
         convert << "BinaryPacking" << MiniBlockSize;
         return convert.str();
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new BinaryPacking(*this));
+    }
 
 };
 
@@ -176,11 +190,21 @@ public:
         return in;
     }
 
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (1 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         ostringstream convert;
         convert << "FastBinaryPacking" << MiniBlockSize;
         return convert.str();
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new FastBinaryPacking(*this));
+    }
 
 };
 
@@ -196,19 +220,40 @@ public:
 
     void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
             size_t &nvalue) {
+        encodeWithGap(in, length, out, nvalue, 0);
+    }
+
+    void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        encodeWithGap(in, length, out, nvalue, deltaGap(SIMDmode, length));
+    }
+
+    /**
+     * If gap > 0, we encode the deltas (see computeDeltas), computing
+     * them one block at a time.
+     */
+    void encodeWithGap(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap) {
         checkifdivisibleby(length, BlockSize);
+        const uint32_t * const initin(in);
         const uint32_t * const initout(out);
         *out++ = length;
         uint32_t Bs[HowManyMiniBlocks];
+        uint32_t deltas[BlockSize];
         for (const uint32_t * const final = in + length; in + BlockSize
                 <= final; in += BlockSize) {
+            const uint32_t * block = in;
+            if (gap > 0) {
+                computeDeltas(in, BlockSize, deltas, gap, in - initin);
+                block = deltas;
+            }
             for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
-                Bs[i] = maxbits(in + i * MiniBlockSize,
-                        in + (i + 1) * MiniBlockSize);
+                Bs[i] = maxbits(block + i * MiniBlockSize,
+                        block + (i + 1) * MiniBlockSize);
             *out++ = (Bs[0] << 24) | (Bs[1] << 16) | (Bs[2] << 8)
                 | Bs[3];
             for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
-                fastpackwithoutmask(in + i * MiniBlockSize, out,
+                fastpackwithoutmask(block + i * MiniBlockSize, out,
                             Bs[i]);
                     out += Bs[i];
             }
@@ -236,13 +281,218 @@ public:
         return in;
     }
 
+    /**
+     * Same as decodeArray, but to uint16_t or uint8_t (T): the integers
+     * are unpacked straight to the narrow type (see fastunpack_narrow).
+     * Throws logic_error if a miniblock has integers that do not fit in T.
+     */
+    template<class T>
+    const uint32_t * decodeNarrow(const uint32_t *in, const size_t /*length*/,
+            T *out, size_t & nvalue) const {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        for (size_t block = 0; block < actuallength / BlockSize; ++block) {
+            const uint32_t header = *in++;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, out += MiniBlockSize) {
+                const uint32_t b = static_cast<uint8_t>(header >> (24 - 8 * i));
+                if (b > narrowBits<T>())
+                    throw logic_error("BP32: the integers do not fit in the output type");
+                fastunpack_narrow(in, out, b);
+                in += b;
+            }
+        }
+        nvalue = actuallength;
+        return in;
+    }
+
+    /**
+     * Returns the integer at position index (out[index] after decodeArray)
+     * without decoding the array: we skip blocks using their bit widths
+     * and extract the single integer.
+     */
+    uint32_t select(const uint32_t *in, const size_t index) const {
+        const uint32_t actuallength = *in++;
+        if (index >= actuallength)
+            throw out_of_range("BP32::select: index out of range");
+        in = skipBlocks(in, index / BlockSize);
+        const uint32_t inblock = static_cast<uint32_t>(index % BlockSize);
+        const uint32_t * packed = in + 1;
+        for (uint32_t i = 0; i < inblock / MiniBlockSize; ++i)
+            packed += bitWidth(in[0], i);
+        return fastselect(packed, bitWidth(in[0], inblock / MiniBlockSize),
+                inblock % MiniBlockSize);
+    }
+
+    /**
+     * Writes the integers at positions [begin, end) to out, only unpacking
+     * the miniblocks that overlap the range.
+     */
+    void decodeRange(const uint32_t *in, const size_t begin, const size_t end,
+            uint32_t *out) const {
+        const uint32_t actuallength = *in++;
+        if ((begin > end) || (end > actuallength))
+            throw out_of_range("BP32::decodeRange: bad range");
+        if (begin == end)
+            return;
+        in = skipBlocks(in, begin / BlockSize);
+        uint32_t buffer[MiniBlockSize];
+        size_t pos = begin / BlockSize * BlockSize;
+        while (pos < end) {
+            const uint32_t header = *in++;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, pos += MiniBlockSize) {
+                const uint32_t b = bitWidth(header, i);
+                if ((pos + MiniBlockSize > begin) && (pos < end)) {
+                    fastunpack(in, buffer, b);
+                    const size_t from = pos < begin ? begin - pos : 0;
+                    const size_t to = pos + MiniBlockSize > end ? end - pos : MiniBlockSize;
+                    memcpy(out, buffer + from, (to - from) * sizeof(uint32_t));
+                    out += to - from;
+                }
+                in += b;
+            }
+        }
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (1 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         return "BP32";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new BP32(*this));
+    }
+
+private:
+    static uint32_t bitWidth(const uint32_t header, const uint32_t i) {
+        return static_cast<uint8_t>(header >> (24 - 8 * i));
+    }
+
+    static const uint32_t * skipBlocks(const uint32_t * in, size_t howmany) {
+        for (; howmany > 0; --howmany) {
+            const uint32_t header = *in++;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                in += bitWidth(header, i);
+        }
+        return in;
+    }
 
 };
 
 
+/**
+ * BP32 for sorted arrays: the codec does the delta coding itself (D1)
+ * so it expects the original integers, not the deltas. The input is
+ * not modified and the decoder computes the prefix sum while unpacking
+ * (fastunpackd1), instead of making a second pass over the output.
+ *
+ * Any length is supported: the last (incomplete) block is delta coded
+ * and written with variable byte.
+ */
+class DeltaBP32: public IntegerCODEC {
+public:
+    static const uint32_t MiniBlockSize = 32;
+    static const uint32_t HowManyMiniBlocks = 4;
+    static const uint32_t BlockSize = HowManyMiniBlocks * MiniBlockSize;
+
+    DeltaBP32() : tailcodec() {}
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        const uint32_t * const initout(out);
+        *out++ = length;
+        uint32_t Bs[HowManyMiniBlocks];
+        uint32_t deltas[BlockSize];
+        uint32_t base = 0;
+        const uint32_t * const final = in + length / BlockSize * BlockSize;
+        for (; in < final; in += BlockSize) {
+            for (uint32_t k = 0; k < BlockSize; ++k) {
+                deltas[k] = in[k] - base;
+                base = in[k];
+            }
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                Bs[i] = maxbits(deltas + i * MiniBlockSize,
+                        deltas + (i + 1) * MiniBlockSize);
+            *out++ = (Bs[0] << 24) | (Bs[1] << 16) | (Bs[2] << 8)
+                | Bs[3];
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                fastpackwithoutmask(deltas + i * MiniBlockSize, out,
+                            Bs[i]);
+                    out += Bs[i];
+            }
+        }
+        const uint32_t taillength = static_cast<uint32_t>(length % BlockSize);
+        for (uint32_t k = 0; k < taillength; ++k) {
+            deltas[k] = in[k] - base;
+            base = in[k];
+        }
+        uint32_t * const tailsize = out++;
+        size_t tailnvalue = 0;
+        tailcodec.encodeArray(deltas, taillength, out, tailnvalue);
+        *tailsize = static_cast<uint32_t>(tailnvalue);
+        out += tailnvalue;
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        const uint32_t * const initout(out);
+        const uint32_t * const finalout(out + actuallength / BlockSize * BlockSize);
+        uint32_t Bs[HowManyMiniBlocks];
+        uint32_t base = 0;
+        for (; out < finalout;) {
+            Bs[0] = static_cast<uint8_t>(in[0] >> 24);
+            Bs[1] = static_cast<uint8_t>(in[0] >> 16);
+            Bs[2] = static_cast<uint8_t>(in[0] >> 8);
+            Bs[3] = static_cast<uint8_t>(in[0]);
+            ++in;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, out += MiniBlockSize) {
+                fastunpackd1(in, out, Bs[i], base);
+                in += Bs[i];
+            }
+        }
+        const uint32_t tailsize = *in++;
+        size_t tailnvalue = actuallength - (out - initout);
+        in = tailcodec.decodeArray(in, tailsize, out, tailnvalue);
+        for (size_t k = 0; k < tailnvalue; ++k)
+            out[k] = base += out[k];
+        nvalue = actuallength;
+        return in;
+    }
+
+    // blocks, then the size of the tail and the tail
+    size_t maxCompressedWords(const size_t length) const {
+        return 2 + length / BlockSize * (1 + BlockSize)
+                + tailcodec.maxCompressedWords(length % BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    bool codesDeltas() const {
+        return true;
+    }
+
+    string name() const {
+        return "DeltaBP32";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new DeltaBP32(*this));
+    }
+
+private:
+    VariableByte tailcodec;
+};
+
+
 /**
  * This is the original unaligned binary packing. You can
  * force alignment on 32-bit boundaries with the "align" template
@@ -342,6 +592,19 @@ public:
         return reinterpret_cast<const uint32_t *> (padTo32bits(inbyte));
     }
 
+    /**
+     * Per block, 12 bytes for the bit widths (at most), the miniblocks
+     * and, if align is true, up to 3 bytes of padding before each miniblock.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t bytesperblock = HowManyMiniBlocks * bits32 / 8
+                + (align ? 3 * HowManyMiniBlocks : 0) + 4 * BlockSize;
+        return 1 + (1 + length / BlockSize * bytesperblock + 3) / 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         ostringstream convert;
         convert << "ByteAlignedPacking" << MiniBlockSize;
@@ -357,6 +620,9 @@ public:
         }
         return convert.str();
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new ByteAlignedPacking(*this));
+    }
 
 };
 
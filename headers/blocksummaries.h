@@ -0,0 +1,144 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef BLOCKSUMMARIES_H_
+#define BLOCKSUMMARIES_H_
+
+#include "common.h"
+
+/**
+ * Per-block summaries that SIMDBinaryPacking and SIMDFastPFor can write
+ * after their length word (see their encodeWithSummaries), for dynamic
+ * pruning (WAND, Block-Max WAND): for each block of BlockSize integers,
+ * the largest value (the last one for sorted arrays, i.e., the largest
+ * document identifier) and, optionally, the largest value of a parallel
+ * array (impacts, frequencies). They are read with BlockSummaryView,
+ * without touching the compressed blocks; decodeRange then decodes the
+ * blocks that are worth it.
+ *
+ * Format:
+ *    Marker, BlockSize, number of blocks, words per block (1 or 2),
+ *    for each block: largest value [, largest impact].
+ *
+ * Marker cannot start the blocks of SIMDBinaryPacking (a padding cookie
+ * or bit widths of at most 32) nor the pages of SIMDFastPFor (a word
+ * offset within the page), so that the codecs can tell whether there are
+ * summaries. Arrays encoded without summaries are unchanged, and so are
+ * empty arrays: they never have summaries (there is nothing after their
+ * length word to test for Marker).
+ */
+class BlockSummaries {
+public:
+    enum {
+        BlockSize = 128,
+        HeaderSize = 4
+    };
+    static const uint32_t Marker = 0xFFFFFFF0U;
+
+    static size_t words(const size_t length, const bool impacts) {
+        return HeaderSize + length / BlockSize * (impacts ? 2 : 1);
+    }
+
+    /**
+     * Writes the summaries of the length first integers of in (and of
+     * impacts, if not NULL) to out, returns the end of the summaries. If
+     * sorted, the largest value of a block is its last one.
+     */
+    static uint32_t * write(const uint32_t * in, const size_t length,
+            const uint32_t * impacts, const bool sorted, uint32_t * out) {
+        const size_t numberofblocks = length / BlockSize;
+        *out++ = Marker;
+        *out++ = BlockSize;
+        *out++ = static_cast<uint32_t> (numberofblocks);
+        *out++ = impacts == NULL ? 1 : 2;
+        for (size_t k = 0; k < numberofblocks; ++k) {
+            const uint32_t * const block = in + k * BlockSize;
+            *out++ = sorted ? block[BlockSize - 1] : *max_element(block, block + BlockSize);
+            if (impacts != NULL)
+                *out++ = *max_element(impacts + k * BlockSize, impacts + (k + 1) * BlockSize);
+        }
+        return out;
+    }
+
+    /**
+     * in points after the length word of an array of length integers:
+     * returns where the compressed blocks start.
+     */
+    static const uint32_t * skip(const uint32_t * in, const size_t length) {
+        if ((length == 0) || (in[0] != Marker))
+            return in;
+        return in + HeaderSize + in[2] * in[3];
+    }
+};
+
+/**
+ * The summaries of an array compressed by SIMDBinaryPacking or SIMDFastPFor
+ * (in points to the start of the compressed array, at its length word).
+ * empty() if the array was encoded without summaries.
+ */
+class BlockSummaryView {
+public:
+    BlockSummaryView(const uint32_t * in) :
+        summaries(NULL), numberofblocks(0), wordsperblock(1) {
+        if ((in[0] > 0) && (in[1] == BlockSummaries::Marker)) {
+            numberofblocks = in[3];
+            wordsperblock = in[4];
+            summaries = in + 1 + BlockSummaries::HeaderSize;
+        }
+    }
+
+    bool empty() const {
+        return summaries == NULL;
+    }
+    // number of blocks, the integers of block k are at [k * BlockSize, (k + 1) * BlockSize)
+    size_t size() const {
+        return numberofblocks;
+    }
+    static size_t blockSize() {
+        return BlockSummaries::BlockSize;
+    }
+    bool hasImpacts() const {
+        return wordsperblock == 2;
+    }
+    uint32_t maxValue(const size_t k) const {
+        return summaries[k * wordsperblock];
+    }
+    uint32_t maxImpact(const size_t k) const {
+        return summaries[k * wordsperblock + 1];
+    }
+
+    /**
+     * For sorted arrays: the first block, from block from on, whose largest
+     * value is at least target (size() if there is none). We gallop, then
+     * search by bisection.
+     */
+    size_t nextGEQ(const uint32_t target, size_t from = 0) const {
+        size_t step = 1;
+        size_t hi = from;
+        while ((hi < numberofblocks) && (maxValue(hi) < target)) {
+            from = hi + 1;
+            hi += step;
+            step *= 2;
+        }
+        hi = min(hi, numberofblocks);
+        while (from < hi) {
+            const size_t mid = from + (hi - from) / 2;
+            if (maxValue(mid) < target)
+                from = mid + 1;
+            else
+                hi = mid;
+        }
+        return from;
+    }
+
+private:
+    const uint32_t * summaries;
+    size_t numberofblocks;
+    size_t wordsperblock;
+};
+
+#endif /* BLOCKSUMMARIES_H_ */
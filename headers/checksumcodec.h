@@ -0,0 +1,232 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef CHECKSUMCODEC_H_
+#define CHECKSUMCODEC_H_
+
+#include <mutex>
+#include <unordered_set>
+#include "common.h"
+#include "codecs.h"
+#include "compositecodec.h"
+#include "variablebyte.h"
+#include "streamcodec.h"
+#include "crc32c.h"
+
+/**
+ * Thrown when a page of a ChecksumCodec array is truncated or does not
+ * match its checksum.
+ */
+class CorruptedPage: public std::runtime_error {
+public:
+    size_t page;// index of the page in the array
+    CorruptedPage(const size_t p) :
+        runtime_error("corrupted page " + std::to_string(p)), page(p) {
+    }
+};
+
+/**
+ * Thrown when the header of a ChecksumCodec array (length, number of pages,
+ * page size) does not match its checksum or is inconsistent.
+ */
+class CorruptedHeader: public std::runtime_error {
+public:
+    CorruptedHeader() :
+        runtime_error("corrupted header") {
+    }
+};
+
+/**
+ * Compresses arrays one page at a time (PageSize integers, see
+ * streamFrameSize) and follows each page with its CRC32C (see crc32c.h,
+ * the crc32 instruction when we have SSE4.2), so that corrupted data is
+ * reported (CorruptedPage) instead of decoded to garbage. The header has
+ * its own CRC32C (CorruptedHeader), as a wrong page count or length would
+ * have us read or write out of bounds.
+ *
+ * Each page is checksummed right after it is encoded and right before
+ * it is decoded, while it is in cache: we read the compressed data from
+ * memory once, not once for the checksums and once for the codec.
+ *
+ * With OnFirstTouch, we only check a page the first time it is decoded
+ * (the pages checked are remembered by address, and shared with the
+ * clones: call forgetVerifiedPages if the memory gets reused). verify
+ * checks an array without decoding it.
+ *
+ * Format:
+ *    length, number of pages, page size, the CRC32C of these 3 words,
+ *    for each page: its number of compressed words w, the w words
+ *    (CompositeCodec<CODEC, VariableByte>), the CRC32C of these w + 1
+ *    words, starting from the page number.
+ *
+ * As with SIMDBinaryPacking, if you move the data around, you should
+ * preserve the alignment.
+ */
+template<class CODEC = SIMDFastPFor>
+class ChecksumCodec: public IntegerCODEC {
+public:
+    enum {
+        HeaderSize = 4,
+        PageOverhead = 2 // the number of words and the checksum
+    };
+    enum Verification {
+        Always, OnFirstTouch, Never
+    };
+
+    ChecksumCodec(const Verification v = Always) :
+        verification(v), PageSize(streamFrameSize(CODEC())), codec(), verified(
+                new VerifiedPages()) {
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        const size_t required = maxCompressedWords(length);
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        const size_t numberofpages = (length + PageSize - 1) / PageSize;
+        out[0] = static_cast<uint32_t> (length);
+        out[1] = static_cast<uint32_t> (numberofpages);
+        out[2] = PageSize;
+        out[3] = headerChecksum(out);
+        uint32_t * o = out + HeaderSize;
+        for (size_t p = 0; p < numberofpages; ++p) {
+            const size_t thissize = min<size_t> (PageSize, length - p * PageSize);
+            size_t thisnvalue = out + nvalue - o - PageOverhead;
+            codec.encodeArray(in + p * PageSize, thissize, o + 1, thisnvalue);
+            o[0] = static_cast<uint32_t> (thisnvalue);
+            o[1 + thisnvalue] = checksum(o, p);
+            o += thisnvalue + PageOverhead;
+        }
+        nvalue = o - out;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t & nvalue) {
+        checkHeader(in, length);
+        const size_t mynvalue = in[0];
+        if (mynvalue > nvalue)
+            throw NotEnoughStorage(mynvalue);
+        const uint32_t * const end = in + length;
+        const uint32_t * page = in + HeaderSize;
+        for (size_t p = 0; p < in[1]; ++p) {
+            check(page, end, p, verification);
+            size_t thissize = min<size_t> (PageSize, mynvalue - p * PageSize);
+            codec.decodeArray(page + 1, page[0], out + p * PageSize, thissize);
+            page += page[0] + PageOverhead;
+        }
+        nvalue = mynvalue;
+        return page;
+    }
+
+    /**
+     * Checks all the pages of the compressed array in (length words)
+     * without decoding them: true if none is corrupted.
+     */
+    bool verify(const uint32_t * in, const size_t length) const {
+        const uint32_t * const end = in + length;
+        const uint32_t * page = in + HeaderSize;
+        try {
+            checkHeader(in, length);
+            for (size_t p = 0; p < in[1]; ++p) {
+                check(page, end, p, Always);
+                page += page[0] + PageOverhead;
+            }
+        } catch (const CorruptedPage &) {
+            return false;
+        } catch (const CorruptedHeader &) {
+            return false;
+        } catch (const logic_error &) {// another page size
+            return false;
+        }
+        return true;
+    }
+
+    // with OnFirstTouch, the pages will be checked again
+    void forgetVerifiedPages() {
+        lock_guard<mutex> lock(verified->m);
+        verified->pages.clear();
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t numberofpages = (length + PageSize - 1) / PageSize;
+        size_t answer = HeaderSize + numberofpages * PageOverhead;
+        if (numberofpages > 0)
+            answer += (numberofpages - 1) * codec.maxCompressedWords(PageSize)
+                    + codec.maxCompressedWords(length - (numberofpages - 1) * PageSize);
+        return answer;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "Checksum<" + codec.name() + ">";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new ChecksumCodec(*this));
+    }
+
+    const Verification verification;
+    const uint32_t PageSize;
+
+private:
+    struct VerifiedPages {
+        VerifiedPages() :
+            m(), pages() {
+        }
+        mutex m;
+        unordered_set<const uint32_t *> pages;
+    };
+
+    // CRC32C of the number of words and the words of the page
+    static uint32_t checksum(const uint32_t * page, const size_t p) {
+        return crc32c(page, (page[0] + 1) * sizeof(uint32_t), static_cast<uint32_t> (p));
+    }
+
+    // CRC32C of the length, the number of pages and the page size
+    static uint32_t headerChecksum(const uint32_t * in) {
+        return crc32c(in, (HeaderSize - 1) * sizeof(uint32_t));
+    }
+
+    /**
+     * Throws CorruptedHeader if the header of in (length words) is
+     * corrupted, logic_error if it was written with another page size.
+     */
+    void checkHeader(const uint32_t * in, const size_t length) const {
+        if ((length < HeaderSize) || (headerChecksum(in) != in[3])
+                || (in[1] != (static_cast<size_t> (in[0]) + in[2] - 1) / max<uint32_t> (1, in[2])))
+            throw CorruptedHeader();
+        if (in[2] != PageSize)
+            throw logic_error("ChecksumCodec: page size does not match");
+    }
+
+    // throws CorruptedPage if page p (ending before end) is corrupted
+    void check(const uint32_t * page, const uint32_t * end, const size_t p,
+            const Verification v) const {
+        if ((end - page < PageOverhead) || (page[0] > static_cast<size_t> (end - page)
+                - PageOverhead))
+            throw CorruptedPage(p);
+        if (v == Never)
+            return;
+        if (v == OnFirstTouch) {
+            lock_guard<mutex> lock(verified->m);
+            if (verified->pages.count(page) > 0)
+                return;
+        }
+        if (checksum(page, p) != page[1 + page[0]])
+            throw CorruptedPage(p);
+        if (v == OnFirstTouch) {
+            lock_guard<mutex> lock(verified->m);
+            verified->pages.insert(page);
+        }
+    }
+
+    CompositeCodec<CODEC, VariableByte> codec;
+    shared_ptr<VerifiedPages> verified;
+};
+
+#endif /* CHECKSUMCODEC_H_ */
@@ -20,6 +20,7 @@
 #include "fastpfor.h"
 #include "simdfastpfor.h"
 #include "variablebyte.h"
+#include "streamvbyte.h"
 #include "compositecodec.h"
 #include "blockpacking.h"
 #include "pfor.h"
@@ -27,12 +28,30 @@
 #include "VarIntG8IU.h"
 #include "simdbinarypacking.h"
 #include "snappydelta.h"
+#include "hybridcodec.h"
+#include "runlength.h"
+#include "horizontalscan.h"
+#include "simdframeofreference.h"
+#include "zigzagdelta.h"
+#include "shortlistcodec.h"
+#include "cpufeatures.h"
 
 using namespace std;
 
+/**
+ * What CODECFactory::estimate expects from a codec on some data.
+ */
+struct CodecEstimate {
+    string name;// as in CODECFactory
+    double bitsperint;
+    double decodespeed;// millions of integers per second (rough)
+};
+
 class CODECFactory {
 public:
     static map<string, shared_ptr<IntegerCODEC> > scodecmap;
+    // "zigzag-" followed by the name of a codec of scodecmap
+    static map<string, shared_ptr<IntegerCODEC> > szigzagmap;
 
     // hacked for convenience
     static vector<shared_ptr<IntegerCODEC> > allSchemes() {
@@ -51,7 +70,22 @@ public:
         return ans;
     }
 
+    /**
+     * The processor is checked once (cpuid) and the codecs use the
+     * fastest build of the kernels it supports (see simdbitpacking.h).
+     * The compressed format does not depend on the processor, except
+     * for the 256-bit codecs which are only offered with AVX2.
+     *
+     * The instances are shared: many threads can decode with them at
+     * the same time, but a thread encoding should use its own clone().
+     *
+     * Any codec can be given zigzag deltas (see ZigZagDeltaCodec) by
+     * prefixing its name with "zigzag-" (e.g., "zigzag-simdfastpfor");
+     * these combinations are not listed by allNames and allSchemes.
+     */
     static shared_ptr<IntegerCODEC> & getFromName(string name) {
+        if (szigzagmap.find(name) != szigzagmap.end())
+            return szigzagmap[name];
         if (scodecmap.find(name) == scodecmap.end()) {
             cerr << "name " << name << " does not refer to a CODEC." << endl;
             cerr << "possible choices:" << endl;
@@ -64,35 +98,198 @@ public:
         return scodecmap[name];
     }
 
-};
+    /**
+     * Estimates the compression of the main codecs on this data (as given
+     * to encodeArray, so deltas if you code sorted arrays) without trying
+     * them: we look at sampleblocks blocks of 1024 integers spread over the
+     * array and use the bit widths of each group of 128 integers with the
+     * cost models of the codecs (see SIMDFastPFor::getBestBFromData and
+     * HybridCodec::bestScheme). The decoding speeds are typical values
+     * measured with the "codecs" benchmark on a recent x64 processor.
+     */
+    static vector<CodecEstimate> estimate(const uint32_t * data, const size_t length,
+            const size_t sampleblocks = 16) {
+        const size_t SampleBlock = 1024, MiniBlock = 128;
+        const size_t totalblocks = (length + SampleBlock - 1) / SampleBlock;
+        const size_t howmany = min(totalblocks, sampleblocks);
+        double packingbits = 0, pforbits = 0, hybridbits = 0, forbits = 0,
+                simple8bbits = 0, vbytebytes = 0, g8iubytes = 0;
+        size_t sampled = 0;
+        HybridCodec hybrid;
+        Simple8b<true> simple8b;
+        for (size_t s = 0; s < howmany; ++s) {
+            const size_t start = s * totalblocks / howmany * SampleBlock;
+            const size_t end = min(length, start + SampleBlock);
+            size_t simplewords;
+            simple8b.fakeencodeArray(data + start, end - start, simplewords);
+            simple8bbits += 32.0 * simplewords;
+            for (size_t m = start; m < end; m += MiniBlock) {
+                const size_t thissize = min(MiniBlock, end - m);
+                uint32_t freqs[33] = { 0 };
+                for (size_t k = m; k < m + thissize; ++k)
+                    freqs[asmbits(data[k])]++;
+                uint32_t maxb = 32;
+                while ((maxb > 0) && (freqs[maxb] == 0))
+                    maxb--;
+                for (uint32_t w = 0; w <= 32; ++w) {
+                    vbytebytes += freqs[w] * max<uint32_t> (1, (w + 6) / 7);
+                    g8iubytes += freqs[w] * max<uint32_t> (1, (w + 7) / 8);
+                }
+                if (thissize < MiniBlock) {// the codecs use VariableByte here
+                    const double tail = 8.0 * freqs[0];
+                    packingbits += tail;
+                    pforbits += tail;
+                    hybridbits += tail;
+                    forbits += tail;
+                    for (uint32_t w = 1; w <= 32; ++w) {
+                        const double bits = 8.0 * freqs[w] * ((w + 6) / 7);
+                        packingbits += bits;
+                        pforbits += bits;
+                        hybridbits += bits;
+                        forbits += bits;
+                    }
+                    continue;
+                }
+                packingbits += maxb * MiniBlock + 8;
+                const uint32_t minimum = *min_element(data + m, data + m + MiniBlock);
+                const uint32_t maximum = *max_element(data + m, data + m + MiniBlock);
+                forbits += gccbits(maximum - minimum) * MiniBlock + 40;
+                // as in SIMDFastPFor::getBestBFromData
+                uint32_t bestcost = maxb * MiniBlock + 16;
+                uint32_t cexcept = 0;
+                for (uint32_t b = maxb; b-- > 0;) {
+                    cexcept += freqs[b + 1];
+                    const uint32_t thiscost = cexcept * (8 + maxb - b) + b * MiniBlock + 24;
+                    bestcost = min(bestcost, thiscost);
+                }
+                pforbits += bestcost;
+                uint32_t b, bits;
+                hybrid.bestScheme(data + m, b, bits);
+                hybridbits += bits + 2;
+            }
+            sampled += end - start;
+        }
+        vector<CodecEstimate> answer;
+        if (sampled == 0)
+            return answer;
+        answer.push_back(CodecEstimate {"simdbinarypacking", packingbits / sampled, 1500});
+        answer.push_back(CodecEstimate {"simdfastpfor", pforbits / sampled, 1200});
+        answer.push_back(CodecEstimate {"hybrid", hybridbits / sampled, 1100});
+        answer.push_back(CodecEstimate {"simdframeofreference", forbits / sampled, 1400});
+        answer.push_back(CodecEstimate {"simple8b", simple8bbits / sampled, 400});
+#ifdef VARINTG8IU_H__
+        answer.push_back(CodecEstimate {"varintg8iu", 8.0 * g8iubytes * 9 / 8 / sampled, 800});
+#endif
+        answer.push_back(CodecEstimate {"streamvbyte", (8.0 * g8iubytes + 2.0 * sampled) / sampled, 1400});
+        answer.push_back(CodecEstimate {"vbyte", 8.0 * vbytebytes / sampled, 200});
+        answer.push_back(CodecEstimate {"copy", 32, 2000});
+        return answer;
+    }
 
-map<string, shared_ptr<IntegerCODEC> > CODECFactory::scodecmap = {
-   {   "fastbinarypacking8", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<8> ,
-                VariableByte>)},
-    {   "fastbinarypacking16", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<16> ,
-                VariableByte>)},
-    {   "fastbinarypacking32", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<32> ,
-                VariableByte>)},
-    {   "BP32", shared_ptr<IntegerCODEC> (new CompositeCodec<BP32 ,
+    /**
+     * Picks a codec for this data (see estimate) that minimizes
+     *     bits per integer + bitspernanosecond * nanoseconds per integer (decoding),
+     * so bitspernanosecond is how many bits per integer you are willing to
+     * pay to save one nanosecond per integer when decoding. The default (0)
+     * asks for the best compression.
+     */
+    static shared_ptr<IntegerCODEC> & recommend(const uint32_t * data, const size_t length,
+            const double bitspernanosecond = 0) {
+        return getFromName(recommendName(data, length, bitspernanosecond));
+    }
+
+    // the name (as in CODECFactory) of the codec recommend picks
+    static string recommendName(const uint32_t * data, const size_t length,
+            const double bitspernanosecond = 0) {
+        const vector<CodecEstimate> estimates = estimate(data, length);
+        string bestname = "copy";
+        double bestscore = numeric_limits<double>::max();
+        for (const CodecEstimate & e : estimates) {
+            const double score = e.bitsperint + bitspernanosecond * 1000.0 / e.decodespeed;
+            if (score < bestscore) {
+                bestscore = score;
+                bestname = e.name;
+            }
+        }
+        return bestname;
+    }
+
+    static map<string, shared_ptr<IntegerCODEC> > initializefactory() {
+        map<string, shared_ptr<IntegerCODEC> > cmap = {
+            {   "fastbinarypacking8", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<8> ,
                         VariableByte>)},
-    {   "vsencoding", shared_ptr<IntegerCODEC> (new vsencoding::VSEncodingBlocks(1U << 16))},
-    {  "fastpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<FastPFor , VariableByte> ())},
-    {  "simdfastpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDFastPFor , VariableByte> ())},
-    {  "simplepfor", shared_ptr<IntegerCODEC> (new CompositeCodec<SimplePFor<> , VariableByte> ())},
-    {   "pfor", shared_ptr<IntegerCODEC> (new CompositeCodec<PFor , VariableByte> ())},
-    {   "pfor2008", shared_ptr<IntegerCODEC> (new CompositeCodec<PFor2008 , VariableByte> ())},
-    {   "newpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<NewPFor<4, Simple16<false>> , VariableByte> ())},
-    {   "optpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<OPTPFor<4, Simple16<false> > , VariableByte> ())},
-    {   "vbyte", shared_ptr<IntegerCODEC> (new VariableByte())},
-    {   "simple8b", shared_ptr<IntegerCODEC> (new Simple8b<true> ())},
+            {   "fastbinarypacking16", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<16> ,
+                        VariableByte>)},
+            {   "fastbinarypacking32", shared_ptr<IntegerCODEC> (new CompositeCodec<FastBinaryPacking<32> ,
+                        VariableByte>)},
+            {   "BP32", shared_ptr<IntegerCODEC> (new CompositeCodec<BP32 ,
+                                VariableByte>)},
+            {   "vsencoding", shared_ptr<IntegerCODEC> (new vsencoding::VSEncodingBlocks(1U << 16))},
+            {  "fastpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<FastPFor , VariableByte> ())},
+            {  "simdfastpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDFastPFor , VariableByte> ())},
+            {  "simplepfor", shared_ptr<IntegerCODEC> (new CompositeCodec<SimplePFor<> , VariableByte> ())},
+            {   "pfor", shared_ptr<IntegerCODEC> (new CompositeCodec<PFor , VariableByte> ())},
+            {   "pfor2008", shared_ptr<IntegerCODEC> (new CompositeCodec<PFor2008 , VariableByte> ())},
+            {   "newpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<NewPFor<4, Simple16<false>> , VariableByte> ())},
+            {   "optpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<OPTPFor<4, Simple16<false> > , VariableByte> ())},
+            // same format, b estimated from the histogram with 3 trials per block
+            {   "fastoptpfor", shared_ptr<IntegerCODEC> (new CompositeCodec<OPTPFor<4, Simple16<false>, 3> , VariableByte> ())},
+            {   "vbyte", shared_ptr<IntegerCODEC> (new VariableByte())},
+            {   "simple8b", shared_ptr<IntegerCODEC> (new Simple8b<true> ())},
 #ifdef VARINTG8IU_H__
-    {   "varintg8iu", shared_ptr<IntegerCODEC> (new VarIntG8IU ())},
+            {   "varintg8iu", shared_ptr<IntegerCODEC> (new VarIntG8IU ())},
 #endif
 #ifdef USESNAPPY
-    {   "snappy", shared_ptr<IntegerCODEC> (new JustSnappy ())},
+            {   "snappy", shared_ptr<IntegerCODEC> (new JustSnappy ())},
+#endif
+            {  "simdbinarypacking", shared_ptr<IntegerCODEC>(new CompositeCodec<SIMDBinaryPacking,VariableByte>())},
+            // no padding, no alignment: the compressed data can be moved around
+            {  "unalignedsimdbinarypacking", shared_ptr<IntegerCODEC>(new CompositeCodec<UnalignedSIMDBinaryPacking,StreamVByte>())},
+            {  "hybrid", shared_ptr<IntegerCODEC>(new CompositeCodec<HybridCodec,VariableByte>())},
+            // for runs of constant gaps (dense posting lists, ranges of identifiers)
+            {  "runlength", shared_ptr<IntegerCODEC>(new CompositeCodec<RunLengthCodec,VariableByte>())},
+            {  "horizontalscan", shared_ptr<IntegerCODEC>(new HorizontalScanCodec())},
+            {  "simdframeofreference", shared_ptr<IntegerCODEC>(new CompositeCodec<SIMDFrameOfReference,VariableByte>())},
+            // the same with Stream VByte for the tails
+            {  "streamvbyte", shared_ptr<IntegerCODEC>(new StreamVByte())},
+            {  "fastpfor+streamvbyte", shared_ptr<IntegerCODEC> (new CompositeCodec<FastPFor , StreamVByte> ())},
+            {  "simdfastpfor+streamvbyte", shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDFastPFor , StreamVByte> ())},
+            {  "simdbinarypacking+streamvbyte", shared_ptr<IntegerCODEC>(new CompositeCodec<SIMDBinaryPacking,StreamVByte>())},
+            {  "hybrid+streamvbyte", shared_ptr<IntegerCODEC>(new CompositeCodec<HybridCodec,StreamVByte>())},
+            // short arrays (and the tails) packed at one bit width, see LengthAwareCodec
+            {  "shortlist", shared_ptr<IntegerCODEC>(new ShortListCodec())},
+            {  "fastpfor+shortlist", shared_ptr<IntegerCODEC>(new LengthAwareCodec<FastPFor>())},
+            {  "simdfastpfor+shortlist", shared_ptr<IntegerCODEC>(new LengthAwareCodec<SIMDFastPFor>())},
+            {  "simdbinarypacking+shortlist", shared_ptr<IntegerCODEC>(new LengthAwareCodec<SIMDBinaryPacking>())},
+            // these two do the delta coding themselves: they expect sorted arrays
+            {  "simddeltabinarypacking", shared_ptr<IntegerCODEC>(new SIMDDeltaBinaryPacking())},
+            {  "deltabp32", shared_ptr<IntegerCODEC>(new DeltaBP32())},
+            {   "copy", shared_ptr<IntegerCODEC> (new JustCopy())}
+        };
+        // the 256-bit codecs are only offered when the processor supports AVX2
+#ifdef FASTPFOR_X86
+        if (cpuSupportsAVX2()) {
+            cmap["simdfastpfor256"] = shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDFastPFor256 , VariableByte> ());
+            cmap["simdbinarypacking256"] = shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDBinaryPacking256 , VariableByte> ());
+            cmap["simdfastpfor256+streamvbyte"] = shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDFastPFor256 , StreamVByte> ());
+            cmap["simdbinarypacking256+streamvbyte"] = shared_ptr<IntegerCODEC> (new CompositeCodec<SIMDBinaryPacking256 , StreamVByte> ());
+        }
 #endif
-    {  "simdbinarypacking", shared_ptr<IntegerCODEC>(new CompositeCodec<SIMDBinaryPacking,VariableByte>())},
-    {   "copy", shared_ptr<IntegerCODEC> (new JustCopy())}
+        return cmap;
+    }
+
+    // all the maps are filled before main, so that getFromName never writes to them
+    static map<string, shared_ptr<IntegerCODEC> > initializezigzag() {
+        map<string, shared_ptr<IntegerCODEC> > cmap;
+        for (auto i = scodecmap.begin(); i != scodecmap.end(); ++i)
+            cmap["zigzag-" + i->first] = shared_ptr<IntegerCODEC> (new ZigZagDeltaCodec(
+                    i->second->clone()));
+        return cmap;
+    }
+
 };
 
+map<string, shared_ptr<IntegerCODEC> > CODECFactory::scodecmap = CODECFactory::initializefactory();
+map<string, shared_ptr<IntegerCODEC> > CODECFactory::szigzagmap = CODECFactory::initializezigzag();
+
 #endif /* CODECFACTORY_H_ */
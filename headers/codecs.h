@@ -12,6 +12,28 @@
 #include "common.h"
 #include "util.h"
 #include "bitpackinghelpers.h"
+#include "memutil.h"
+#include "codecstats.h"
+
+/**
+ * Writes to out the n deltas starting at in[0], in[0] being at
+ * position "position" in the whole array. The deltas are
+ * in[k] - in[k - gap] (or in[k] if there is no such integer):
+ * gap = 1 matches Delta::delta and gap = 4 matches Delta::deltaSIMD.
+ */
+inline void computeDeltas(const uint32_t * in, const size_t n, uint32_t * out,
+        const uint32_t gap, const size_t position) {
+    size_t k = 0;
+    for (; (k < n) && (position + k < gap); ++k)
+        out[k] = in[k];
+    for (; k < n; ++k)
+        out[k] = in[k] - in[k - gap];
+}
+
+// the gap that Delta::encode uses for an array of this length
+inline uint32_t deltaGap(const bool SIMDmode, const size_t length) {
+    return (SIMDmode && (length >= 5)) ? 4 : 1;
+}
 
 class NotEnoughStorage: public std::runtime_error {
 public:
@@ -23,6 +45,99 @@ public:
     ;
 };
 
+/**
+ * One of the arrays given to IntegerCODEC::encodeBatch.
+ */
+struct ListDescriptor {
+    const uint32_t * data;
+    size_t length;
+};
+
+/**
+ * The batch format (see IntegerCODEC::encodeBatch) is
+ *    number of arrays, length of each array,
+ *    where each compressed array ends (in words, from the start of the payload),
+ *    payload (the compressed arrays, one after the other).
+ *
+ * The following functions write and read this format, given a function
+ * coding a single array: codec implementations can use them with their
+ * own (non-virtual) coding functions.
+ */
+template<class ItemEncoder>
+void encodeBatchWith(ItemEncoder encodeItem, const ListDescriptor * lists,
+        const size_t howmany, uint32_t * out, size_t & nvalue) {
+    if (1 + 2 * howmany > nvalue)
+        throw NotEnoughStorage(1 + 2 * howmany);
+    out[0] = static_cast<uint32_t> (howmany);
+    uint32_t * const lengths = out + 1;
+    uint32_t * const ends = lengths + howmany;
+    uint32_t * const payload = ends + howmany;
+    size_t used = 0;
+    for (size_t i = 0; i < howmany; ++i) {
+        lengths[i] = static_cast<uint32_t> (lists[i].length);
+        size_t thisnvalue = nvalue - (payload - out) - used;
+        encodeItem(lists[i].data, lists[i].length, payload + used, thisnvalue);
+        used += thisnvalue;
+        ends[i] = static_cast<uint32_t> (used);
+    }
+    nvalue = (payload - out) + used;
+}
+
+/**
+ * Since the arrays are decoded one after the other, most of them start at
+ * addresses that are not 16-byte aligned, unlike what the SIMD codecs
+ * expect. If alignoutput is true, those are decoded to an aligned buffer
+ * first, and copied.
+ */
+template<class ItemDecoder>
+const uint32_t * decodeBatchWith(ItemDecoder decodeItem, const uint32_t * in,
+        uint32_t * out, size_t & nvalue, const bool alignoutput) {
+    const size_t howmany = in[0];
+    const uint32_t * const lengths = in + 1;
+    const uint32_t * const ends = lengths + howmany;
+    const uint32_t * const payload = ends + howmany;
+    size_t total = 0, longest = 0;
+    for (size_t i = 0; i < howmany; ++i) {
+        total += lengths[i];
+        longest = max<size_t>(longest, lengths[i]);
+    }
+    if (total > nvalue)
+        throw NotEnoughStorage(total);
+    vector<uint32_t, cacheallocator> buffer(alignoutput ? longest + 1024 : 0);
+    size_t start = 0;
+    for (size_t i = 0; i < howmany; ++i) {
+        size_t thisnvalue = lengths[i];
+        if (alignoutput && needPaddingTo128Bits(out)) {
+            decodeItem(payload + start, ends[i] - start, &buffer[0], thisnvalue);
+            memcpy(out, &buffer[0], min<size_t>(thisnvalue, lengths[i]) * sizeof(uint32_t));
+        } else
+            decodeItem(payload + start, ends[i] - start, out, thisnvalue);
+        if (thisnvalue != lengths[i])
+            throw runtime_error("decodeBatch: corrupted batch");
+        out += thisnvalue;
+        start = ends[i];
+    }
+    nvalue = total;
+    return payload + start;
+}
+
+template<class ItemDecoder>
+void decodeFromBatchWith(ItemDecoder decodeItem, const uint32_t * in,
+        const size_t i, uint32_t * out, size_t & nvalue) {
+    const size_t howmany = in[0];
+    if (i >= howmany)
+        throw out_of_range("decodeFromBatch: no such array");
+    const uint32_t * const lengths = in + 1;
+    const uint32_t * const ends = lengths + howmany;
+    const uint32_t * const payload = ends + howmany;
+    if (lengths[i] > nvalue)
+        throw NotEnoughStorage(lengths[i]);
+    const size_t start = i > 0 ? ends[i - 1] : 0;
+    nvalue = lengths[i];
+    decodeItem(payload + start, ends[i] - start, out, nvalue);
+}
+
+
 class IntegerCODEC {
 public:
 
@@ -58,6 +173,111 @@ public:
     virtual ~IntegerCODEC() {
     }
 
+    /**
+     * Same result as delta coding in (as with Delta::encode) then calling
+     * encodeArray, except that in is not modified. Block codecs override
+     * this to compute the deltas block by block while encoding (no copy,
+     * no extra pass). The default implementation makes a copy, except for
+     * the codecs that do the delta coding themselves (see codesDeltas).
+     */
+    virtual void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        if (codesDeltas()) {
+            encodeArray(in, length, out, nvalue);
+            return;
+        }
+        vector<uint32_t, cacheallocator> deltas(length);
+        if (length > 0)
+            computeDeltas(in, length, &deltas[0], deltaGap(SIMDmode, length), 0);
+        encodeArray(deltas.data(), length, out, nvalue);
+    }
+
+    /**
+     * True for the codecs that expect sorted arrays and do the delta coding
+     * themselves (e.g., SIMDDeltaBinaryPacking): encodeDeltaArray and
+     * Delta::encode give them the integers as they are, and Delta::decode
+     * does not compute the prefix sum again.
+     */
+    virtual bool codesDeltas() const {
+        return false;
+    }
+
+    /**
+     * An upper bound on the number of words that encodeArray (or
+     * encodeDeltaArray) uses to compress length integers: an output buffer
+     * of this size is always enough. Codecs override it with a bound
+     * derived from their format; the default is the generous allowance that
+     * compress used to make.
+     */
+    virtual size_t maxCompressedWords(const size_t length) const {
+        return 2 * length + 1024;
+    }
+
+    /**
+     * Returns how many integers decodeArray writes when decoding the
+     * length words at in, reading only the headers. For formats that do
+     * not record it exactly (e.g., CompositeCodec, Simple16<false>) we get
+     * an upper bound, so the value can always be used to size the output.
+     * The default implementation decodes the data to find out.
+     */
+    virtual size_t decodedLength(const uint32_t * in, const size_t length) {
+        vector<uint32_t, cacheallocator> buffer(4 * length + 1024);
+        for (;;) {
+            size_t nvalue = buffer.size();
+            try {
+                decodeArray(in, length, &buffer[0], nvalue);
+                return nvalue;
+            } catch (NotEnoughStorage & nes) {
+                buffer.resize(nes.required + 1024);
+            }
+        }
+    }
+
+    /**
+     * Compresses the howmany arrays to out (see encodeBatchWith for the
+     * format), nvalue gets the number of words used. Meant for many short
+     * arrays: codecs can override it to save per-array costs (e.g.,
+     * CompositeCodec skips the parts that would be empty).
+     */
+    virtual void encodeBatch(const ListDescriptor * lists, const size_t howmany,
+            uint32_t * out, size_t & nvalue) {
+        encodeBatchWith([this](const uint32_t * in, const size_t length,
+                uint32_t * o, size_t & n) {encodeArray(in, length, o, n);},
+                lists, howmany, out, nvalue);
+    }
+
+    /**
+     * Decodes all arrays of a batch to out, one after the other (use
+     * batchLength to find where each one starts). nvalue gets the total
+     * number of integers; as with decodeArray, out may need some slack.
+     */
+    virtual const uint32_t * decodeBatch(const uint32_t * in, uint32_t * out,
+            size_t & nvalue) {
+        return decodeBatchWith([this](const uint32_t * i, const size_t length,
+                uint32_t * o, size_t & n) {decodeArray(i, length, o, n);},
+                in, out, nvalue, true);
+    }
+
+    /**
+     * Decodes only the array i of a batch.
+     */
+    virtual void decodeFromBatch(const uint32_t * in, const size_t i,
+            uint32_t * out, size_t & nvalue) {
+        decodeFromBatchWith([this](const uint32_t * j, const size_t length,
+                uint32_t * o, size_t & n) {decodeArray(j, length, o, n);},
+                in, i, out, nvalue);
+    }
+
+    // number of arrays in a batch
+    static size_t batchSize(const uint32_t * in) {
+        return in[0];
+    }
+
+    // number of integers in array i of a batch
+    static size_t batchLength(const uint32_t * in, const size_t i) {
+        return in[1 + i];
+    }
+
     /**
      * Will compress the content of a vector into
      * another vector.
@@ -65,7 +285,7 @@ public:
      * This is offered for convenience. It might be slow.
      */
     virtual vector<uint32_t> compress(const vector<uint32_t> & data) {
-        vector < uint32_t > compresseddata(data.size() * 2 + 1024);// allocate plenty of memory
+        vector < uint32_t > compresseddata(maxCompressedWords(data.size()));
         size_t memavailable = compresseddata.size();
         encodeArray(&data[0], data.size(), &compresseddata[0], memavailable);
         compresseddata.resize(memavailable);
@@ -74,34 +294,49 @@ public:
 
     /**
      * Will uncompress the content of a vector into
-     * another vector. Some CODECs know exactly how much data to uncompress,
-     * others need to uncompress it all to know how data there is to uncompress...
-     * So it useful to have a hint (expected_uncompressed_size) that tells how
-     * much data there will be to uncompress. Otherwise, the code will
-     * try to guess, but the result is uncertain and inefficient. You really
-     * ought to keep track of how many symbols you had compressed.
+     * another vector. If you do not know how many integers were compressed
+     * (expected_uncompressed_size = 0), we ask decodedLength.
      *
      * For convenience. Might be slow.
      */
     virtual vector<uint32_t> uncompress(
             const vector<uint32_t> & compresseddata,
             size_t expected_uncompressed_size = 0) {
-        vector < uint32_t > data(expected_uncompressed_size);// allocate plenty of memory
+        if (compresseddata.empty())
+            return vector<uint32_t> ();
+        if (expected_uncompressed_size == 0)
+            expected_uncompressed_size = decodedLength(&compresseddata[0],
+                    compresseddata.size());
+        // some decoders write a little past the last integer
+        vector < uint32_t > data(expected_uncompressed_size + 1024);
         size_t memavailable = data.size();
         try {
             decodeArray(&compresseddata[0], compresseddata.size(), &data[0],
                     memavailable);
-        } catch (NotEnoughStorage & nes) {
+        } catch (NotEnoughStorage & nes) {// the hint was wrong
+            codeccounters::storageRetry();
             data.resize(nes.required + 1024);
+            memavailable = data.size();
             decodeArray(&compresseddata[0], compresseddata.size(), &data[0],
                     memavailable);
-
         }
         data.resize(memavailable);
         return data;
     }
 
     virtual string name() const = 0;
+
+    /**
+     * Returns a new instance with the same parameters. Decoding through
+     * a shared instance is thread-safe (decodeArray does not modify the
+     * instance), but encoding may use scratch buffers held by the
+     * instance: give each encoding thread its own clone. The codecs of
+     * this library all override it; the default (for codecs written
+     * before clone existed) throws.
+     */
+    virtual shared_ptr<IntegerCODEC> clone() const {
+        throw std::logic_error("clone not supported");
+    }
 };
 
 /******************
@@ -128,9 +363,18 @@ public:
         nvalue = length;
         return in + length;
     }
+    size_t maxCompressedWords(const size_t length) const {
+        return length;
+    }
+    size_t decodedLength(const uint32_t * /*in*/, const size_t length) {
+        return length;
+    }
     string name() const {
         return "JustCopy";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new JustCopy(*this));
+    }
 };
 
 /********
@@ -165,10 +409,19 @@ public:
         }
         return in;
     }
+    size_t maxCompressedWords(const size_t length) const {
+        return 2 + length;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
 
     string name() const {
         return "PackedCODEC";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new PackedCODEC(*this));
+    }
 };
 
 #endif /* CODECS_H_ */
@@ -0,0 +1,240 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef CODECS64_H_
+#define CODECS64_H_
+
+#include "common.h"
+#include "util.h"
+#include "codecs.h"
+
+using namespace std;
+
+// number of bits needed to store v (0 for v = 0)
+inline uint32_t bits64(const uint64_t v) {
+    return v == 0 ? 0 : 64 - __builtin_clzll(v);
+}
+
+/**
+ * The same interface as IntegerCODEC, for 64-bit integers. The compressed
+ * data is still made of 32-bit words.
+ */
+class IntegerCODEC64 {
+public:
+    /**
+     * As with IntegerCODEC::encodeArray: nvalue is the room available in
+     * out (in 32-bit words) and it gets the number of words used.
+     */
+    virtual void encodeArray(const uint64_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue) = 0;
+
+    /**
+     * As with IntegerCODEC::decodeArray: nvalue is the room available in
+     * out (in 64-bit integers) and it gets the number of integers decoded.
+     */
+    virtual const uint32_t * decodeArray(const uint32_t *in,
+            const size_t length, uint64_t *out, size_t &nvalue) = 0;
+
+    virtual ~IntegerCODEC64() {
+    }
+
+    /**
+     * An upper bound on the number of words that encodeArray uses (see
+     * IntegerCODEC::maxCompressedWords).
+     */
+    virtual size_t maxCompressedWords(const size_t length) const {
+        return 3 * length + 1024;
+    }
+
+    // for convenience, might be slow
+    virtual vector<uint32_t> compress(const vector<uint64_t> & data) {
+        vector<uint32_t> compresseddata(maxCompressedWords(data.size()));
+        size_t memavailable = compresseddata.size();
+        encodeArray(data.data(), data.size(), compresseddata.data(), memavailable);
+        compresseddata.resize(memavailable);
+        return compresseddata;
+    }
+
+    // for convenience, might be slow
+    virtual vector<uint64_t> uncompress(const vector<uint32_t> & compresseddata,
+            const size_t expected_uncompressed_size) {
+        if (compresseddata.empty())
+            return vector<uint64_t> ();
+        // some decoders write a little past the last integer
+        vector<uint64_t> data(expected_uncompressed_size + 1024);
+        size_t memavailable = data.size();
+        decodeArray(compresseddata.data(), compresseddata.size(), data.data(),
+                memavailable);
+        data.resize(memavailable);
+        return data;
+    }
+
+    virtual string name() const = 0;
+
+    // see IntegerCODEC::clone
+    virtual shared_ptr<IntegerCODEC64> clone() const = 0;
+};
+
+/**
+ * This just copies the data, no compression.
+ */
+class JustCopy64: public IntegerCODEC64 {
+public:
+    void encodeArray(const uint64_t * in, const size_t length, uint32_t * out,
+            size_t &nvalue) {
+        if (2 * length > nvalue)
+            throw NotEnoughStorage(2 * length);
+        memcpy(out, in, sizeof(uint64_t) * length);
+        nvalue = 2 * length;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint64_t *out, size_t & nvalue) {
+        if (length / 2 > nvalue)
+            throw NotEnoughStorage(length / 2);
+        memcpy(out, in, sizeof(uint64_t) * (length / 2));
+        nvalue = length / 2;
+        return in + length / 2 * 2;
+    }
+    size_t maxCompressedWords(const size_t length) const {
+        return 2 * length;
+    }
+    string name() const {
+        return "JustCopy64";
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new JustCopy64(*this));
+    }
+};
+
+/**
+ * Same format as VariableByte: 7 bits per byte, the last byte of an
+ * integer has its most significant bit set. We use up to 10 bytes.
+ */
+class VariableByte64: public IntegerCODEC64 {
+public:
+    void encodeArray(const uint64_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        if (maxCompressedWords(length) > nvalue) {// check more carefully
+            size_t required = 0;
+            for (size_t k = 0; k < length; ++k)
+                required += max<uint32_t> (1, (bits64(in[k]) + 6) / 7);
+            if ((required + 3) / 4 > nvalue)
+                throw NotEnoughStorage((required + 3) / 4);
+        }
+        uint8_t * bout = reinterpret_cast<uint8_t *> (out);
+        const uint8_t * const initbout = bout;
+        for (size_t k = 0; k < length; ++k) {
+            uint64_t val = in[k];
+            while (val >= 128) {
+                *bout++ = static_cast<uint8_t> (val & 127);
+                val >>= 7;
+            }
+            *bout++ = static_cast<uint8_t> (val | 128);
+        }
+        while (needPaddingTo32Bits(bout))
+            *bout++ = 0;
+        nvalue = (bout - initbout) / 4;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint64_t *out, size_t & nvalue) {
+        const uint8_t * inbyte = reinterpret_cast<const uint8_t *> (in);
+        const uint8_t * const endbyte = reinterpret_cast<const uint8_t *> (in
+                + length);
+        const uint64_t * const initout(out);
+        const uint64_t * const endout(out + nvalue);
+        while (endbyte > inbyte) {
+            uint64_t v = 0;
+            for (uint32_t shift = 0; endbyte > inbyte; shift += 7) {
+                const uint8_t c = *inbyte++;
+                v += static_cast<uint64_t> (c & 127) << shift;
+                if (c & 128) {
+                    if (out == endout)
+                        throw NotEnoughStorage(nvalue + 1);
+                    *out++ = v;
+                    break;
+                }
+            }
+        }
+        nvalue = out - initout;
+        return reinterpret_cast<const uint32_t *> (padTo32bits(inbyte));
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return (10 * length + 3) / 4;
+    }
+    string name() const {
+        return "VariableByte64";
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new VariableByte64(*this));
+    }
+};
+
+/**
+ * As CompositeCodec: Codec1 gets the bulk of the array (a multiple of
+ * Codec1::BlockSize), Codec2 the rest.
+ */
+template<class Codec1, class Codec2>
+class CompositeCodec64: public IntegerCODEC64 {
+public:
+    CompositeCodec64() :
+        codec1(), codec2() {
+    }
+    Codec1 codec1;
+    Codec2 codec2;
+
+    void encodeArray(const uint64_t * in, const size_t length, uint32_t * out,
+            size_t &nvalue) {
+        const size_t roundedlength = length / Codec1::BlockSize
+                * Codec1::BlockSize;
+        size_t nvalue1 = nvalue;
+        codec1.encodeArray(in, roundedlength, out, nvalue1);
+        if (roundedlength < length) {
+            size_t nvalue2 = nvalue - nvalue1;
+            codec2.encodeArray(in + roundedlength, length - roundedlength,
+                    out + nvalue1, nvalue2);
+            nvalue = nvalue1 + nvalue2;
+        } else {
+            nvalue = nvalue1;
+        }
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint64_t *out, size_t & nvalue) {
+        size_t nvalue1 = nvalue;
+        const uint32_t *in2 = codec1.decodeArray(in, length, out, nvalue1);
+        if (length + in > in2) {
+            size_t nvalue2 = nvalue - nvalue1;
+            const uint32_t *in3 = codec2.decodeArray(in2, length - (in2 - in),
+                    out + nvalue1, nvalue2);
+            nvalue = nvalue1 + nvalue2;
+            return in3;
+        }
+        nvalue = nvalue1;
+        return in2;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t roundedlength = length / Codec1::BlockSize
+                * Codec1::BlockSize;
+        return codec1.maxCompressedWords(roundedlength) + (roundedlength < length
+                ? codec2.maxCompressedWords(length - roundedlength) : 0);
+    }
+
+    string name() const {
+        ostringstream convert;
+        convert << codec1.name() << "+" << codec2.name();
+        return convert.str();
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new CompositeCodec64(*this));
+    }
+};
+
+#endif /* CODECS64_H_ */
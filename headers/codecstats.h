@@ -0,0 +1,222 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef CODECSTATS_H_
+#define CODECSTATS_H_
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include "common.h"
+#include "util.h"
+
+/**
+ * What the codecs did, as counted by CodecCounters<true>: the blocks of
+ * FastPFor and SIMDFastPFor (with the bit width b chosen for each block
+ * and its exceptions), the tails that CompositeCodec gave to its second
+ * codec (e.g., VariableByte), and the calls to uncompress that had to
+ * decode again after NotEnoughStorage.
+ */
+struct CodecStats {
+    CodecStats() :
+        encodedblocks(0), encodedexceptions(0), bitwidths(), decodedblocks(0),
+                patchedexceptions(0), tailarrays(0), tailintegers(0), storageretries(0) {
+    }
+
+    CodecStats & operator+=(const CodecStats & o) {
+        encodedblocks += o.encodedblocks;
+        encodedexceptions += o.encodedexceptions;
+        for (size_t k = 0; k < bitwidths.histo.size(); ++k)
+            bitwidths.histo[k] += o.bitwidths.histo[k];
+        decodedblocks += o.decodedblocks;
+        patchedexceptions += o.patchedexceptions;
+        tailarrays += o.tailarrays;
+        tailintegers += o.tailintegers;
+        storageretries += o.storageretries;
+        return *this;
+    }
+
+    void display(const string & prefix = "") {
+        cout << prefix << "encoded blocks " << encodedblocks << ", exceptions "
+                << encodedexceptions << endl;
+        cout << prefix << "decoded blocks " << decodedblocks << ", patched exceptions "
+                << patchedexceptions << endl;
+        cout << prefix << "tails " << tailarrays << ", integers " << tailintegers << endl;
+        cout << prefix << "uncompress retries " << storageretries << endl;
+        cout << prefix << "bit widths of the encoded blocks:" << endl;
+        bitwidths.display(prefix);
+    }
+
+    uint64_t encodedblocks;
+    uint64_t encodedexceptions;
+    BitWidthHistoGram bitwidths;// the b of the encoded blocks
+    uint64_t decodedblocks;
+    uint64_t patchedexceptions;
+    uint64_t tailarrays;
+    uint64_t tailintegers;
+    uint64_t storageretries;
+};
+
+/**
+ * The counters of the codecs. The codecs call codeccounters (below), which
+ * is CodecCounters<true> if CODEC_STATS is defined and CodecCounters<false>
+ * otherwise: its functions are empty, so the instrumentation costs nothing
+ * unless it is compiled in (e.g., the inmemorybenchmarkstats target).
+ *
+ * Each thread counts on its own (relaxed atomics, no lock prefix on the
+ * hot paths, and the decoders count once per page); snapshot() adds up
+ * the counters of all threads, including those that have exited.
+ */
+template<bool Enabled>
+class CodecCounters {
+public:
+    static void encodedBlock(const uint32_t /*b*/, const uint32_t /*cexcept*/) {
+    }
+    static void decodedBlocks(const uint64_t /*blocks*/, const uint64_t /*patched*/) {
+    }
+    static void tail(const size_t /*integers*/) {
+    }
+    static void storageRetry() {
+    }
+    static CodecStats snapshot() {
+        return CodecStats();
+    }
+    static void reset() {
+    }
+};
+
+template<>
+class CodecCounters<true> {
+public:
+    static void encodedBlock(const uint32_t b, const uint32_t cexcept) {
+        ThreadCounters & c = local();
+        add(c.encodedblocks, 1);
+        add(c.encodedexceptions, cexcept);
+        add(c.bitwidths[b], 1);
+    }
+    static void decodedBlocks(const uint64_t blocks, const uint64_t patched) {
+        ThreadCounters & c = local();
+        add(c.decodedblocks, blocks);
+        add(c.patchedexceptions, patched);
+    }
+    static void tail(const size_t integers) {
+        ThreadCounters & c = local();
+        add(c.tailarrays, 1);
+        add(c.tailintegers, integers);
+    }
+    static void storageRetry() {
+        add(local().storageretries, 1);
+    }
+
+    static CodecStats snapshot() {
+        Registry & r = registry();
+        lock_guard<mutex> lock(r.m);
+        CodecStats answer = r.retired;
+        for (const ThreadCounters * c : r.live)
+            answer += c->read();
+        return answer;
+    }
+
+    // the counters of the other threads are cleared as they go
+    static void reset() {
+        Registry & r = registry();
+        lock_guard<mutex> lock(r.m);
+        r.retired = CodecStats();
+        for (ThreadCounters * c : r.live)
+            c->clear();
+    }
+
+private:
+    typedef atomic<uint64_t> Counter;
+
+    // only the owner thread writes, so a load and a store will do
+    static void add(Counter & c, const uint64_t n) {
+        c.store(c.load(memory_order_relaxed) + n, memory_order_relaxed);
+    }
+
+    struct ThreadCounters {
+        ThreadCounters() :
+            encodedblocks(), encodedexceptions(), bitwidths(), decodedblocks(),
+                    patchedexceptions(), tailarrays(), tailintegers(), storageretries() {
+            clear();
+            Registry & r = registry();
+            lock_guard<mutex> lock(r.m);
+            r.live.insert(this);
+        }
+        ~ThreadCounters() {
+            Registry & r = registry();
+            lock_guard<mutex> lock(r.m);
+            r.retired += read();
+            r.live.erase(this);
+        }
+        ThreadCounters(const ThreadCounters &) = delete;
+        ThreadCounters & operator=(const ThreadCounters &) = delete;
+
+        CodecStats read() const {
+            CodecStats s;
+            s.encodedblocks = encodedblocks.load(memory_order_relaxed);
+            s.encodedexceptions = encodedexceptions.load(memory_order_relaxed);
+            for (uint32_t k = 0; k <= 32; ++k)
+                s.bitwidths.histo[k] = static_cast<double> (bitwidths[k].load(
+                        memory_order_relaxed));
+            s.decodedblocks = decodedblocks.load(memory_order_relaxed);
+            s.patchedexceptions = patchedexceptions.load(memory_order_relaxed);
+            s.tailarrays = tailarrays.load(memory_order_relaxed);
+            s.tailintegers = tailintegers.load(memory_order_relaxed);
+            s.storageretries = storageretries.load(memory_order_relaxed);
+            return s;
+        }
+
+        void clear() {
+            encodedblocks.store(0, memory_order_relaxed);
+            encodedexceptions.store(0, memory_order_relaxed);
+            for (uint32_t k = 0; k <= 32; ++k)
+                bitwidths[k].store(0, memory_order_relaxed);
+            decodedblocks.store(0, memory_order_relaxed);
+            patchedexceptions.store(0, memory_order_relaxed);
+            tailarrays.store(0, memory_order_relaxed);
+            tailintegers.store(0, memory_order_relaxed);
+            storageretries.store(0, memory_order_relaxed);
+        }
+
+        Counter encodedblocks;
+        Counter encodedexceptions;
+        Counter bitwidths[33];
+        Counter decodedblocks;
+        Counter patchedexceptions;
+        Counter tailarrays;
+        Counter tailintegers;
+        Counter storageretries;
+    };
+
+    struct Registry {
+        Registry() :
+            m(), live(), retired() {
+        }
+        mutex m;
+        set<ThreadCounters *> live;
+        CodecStats retired;// the threads that have exited
+    };
+
+    static Registry & registry() {
+        static Registry r;
+        return r;
+    }
+
+    static ThreadCounters & local() {
+        static thread_local ThreadCounters c;
+        return c;
+    }
+};
+
+#ifdef CODEC_STATS
+typedef CodecCounters<true> codeccounters;
+#else
+typedef CodecCounters<false> codeccounters;
+#endif
+
+#endif /* CODECSTATS_H_ */
@@ -10,7 +10,6 @@
 // C headers (sorted)
 #include <errno.h>
 #include <fcntl.h>
-#include <immintrin.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -29,6 +28,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -39,6 +39,16 @@
 #include <string>
 #include <unordered_map>
 
+// the SIMD intrinsics: SSE and AVX on x86, their NEON version on ARM
+#if defined(__x86_64__) || defined(__i386__)
+#define FASTPFOR_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include "neonsse.h"
+#else
+#error FastPFor needs x86 (SSSE3) or aarch64 (NEON)
+#endif
+
 
 
 #endif /* COMMON_H_ */
@@ -10,6 +10,8 @@
 #include "common.h"
 #include "util.h"
 #include "codecs.h"
+#include "aggregation.h"
+#include "narrowunpacking.h"
 
 /**
  * This is a useful class for CODEC that only compress
@@ -33,6 +35,7 @@ public:
         if (roundedlength < length) {
             ASSERT(nvalue >= nvalue1, nvalue << " " << nvalue1);
             size_t nvalue2 = nvalue - nvalue1;
+            codeccounters::tail(length - roundedlength);
             codec2.encodeArray(in + roundedlength, length - roundedlength,
                     out + nvalue1, nvalue2);
             nvalue = nvalue1 + nvalue2;
@@ -40,6 +43,68 @@ public:
             nvalue = nvalue1;
         }
     }
+    /**
+     * Codec1 gets the bulk of the array (as long as the array has
+     * more than 4 integers, it computes the same deltas as
+     * for the whole array), we compute the deltas of the tail.
+     */
+    void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        const size_t roundedlength = length / Codec1::BlockSize
+                * Codec1::BlockSize;
+        size_t nvalue1 = nvalue;
+        codec1.encodeDeltaArray(in, roundedlength, out, nvalue1, SIMDmode);
+
+        if (roundedlength < length) {
+            ASSERT(nvalue >= nvalue1, nvalue << " " << nvalue1);
+            size_t nvalue2 = nvalue - nvalue1;
+            codeccounters::tail(length - roundedlength);
+            vector<uint32_t, cacheallocator> tail(length - roundedlength);
+            computeDeltas(in + roundedlength, tail.size(), &tail[0],
+                    deltaGap(SIMDmode, length), roundedlength);
+            codec2.encodeArray(&tail[0], tail.size(), out + nvalue1, nvalue2);
+            nvalue = nvalue1 + nvalue2;
+        } else {
+            nvalue = nvalue1;
+        }
+    }
+    /**
+     * In a batch, we know the length of each array, so we do not call
+     * codec1 on arrays shorter than Codec1::BlockSize (nor codec2 on
+     * arrays without a tail): no header is written for them.
+     */
+    void encodeBatch(const ListDescriptor * lists, const size_t howmany,
+            uint32_t * out, size_t & nvalue) {
+        encodeBatchWith([this](const uint32_t * in, const size_t length,
+                uint32_t * o, size_t & n) {encodeBatchItem(in, length, o, n);},
+                lists, howmany, out, nvalue);
+    }
+
+    /**
+     * The arrays are decoded one after the other, but SIMD codecs want
+     * an aligned output: we decode those falling at misaligned addresses
+     * to a buffer first.
+     */
+    const uint32_t * decodeBatch(const uint32_t * in, uint32_t * out,
+            size_t & nvalue) {
+        size_t longest = 0;
+        for (size_t i = 0; i < batchSize(in); ++i)
+            longest = max(longest, batchLength(in, i));
+        vector<uint32_t, cacheallocator> buffer(longest / Codec1::BlockSize
+                * Codec1::BlockSize);
+        uint32_t * const aligned = buffer.empty() ? NULL : &buffer[0];
+        return decodeBatchWith([this, aligned](const uint32_t * i, const size_t length,
+                uint32_t * o, size_t & n) {decodeBatchItem(i, length, o, n, aligned);},
+                in, out, nvalue, false);
+    }
+
+    void decodeFromBatch(const uint32_t * in, const size_t i, uint32_t * out,
+            size_t & nvalue) {
+        decodeFromBatchWith([this](const uint32_t * j, const size_t length,
+                uint32_t * o, size_t & n) {decodeBatchItem(j, length, o, n);},
+                in, i, out, nvalue);
+    }
+
     const uint32_t * decodeArray(const uint32_t *in, const size_t length,
             uint32_t *out, size_t & nvalue) {
         const uint32_t * const initin(in);
@@ -58,11 +123,138 @@ public:
         assert(initin + length >= in2);
         return in2;
     }
+    /**
+     * Decodes howmany arrays (in[i] of length[i] words to out[i], with room
+     * for nvalue[i] integers) with Codec1::decodeMany (which interleaves
+     * them, see SIMDBinaryPacking and SIMDFastPFor), then the tails.
+     */
+    void decodeMany(const uint32_t * const * in, const size_t * length,
+            uint32_t * const * out, size_t * nvalue, const size_t howmany) {
+        vector<size_t> capacity(nvalue, nvalue + howmany);
+        vector<const uint32_t *> ends(howmany);
+        codec1.decodeMany(in, out, nvalue, howmany, ends.data());
+        for (size_t i = 0; i < howmany; ++i) {
+            if (in[i] + length[i] > ends[i]) {
+                size_t nvalue2 = capacity[i] - nvalue[i];
+                codec2.decodeArray(ends[i], length[i] - (ends[i] - in[i]), out[i] + nvalue[i],
+                        nvalue2);
+                nvalue[i] += nvalue2;
+            }
+        }
+    }
+
+    /**
+     * Adds the integers of the compressed array in (length words) to a with
+     * Codec1::aggregate (no decoding, see SIMDBinaryPacking and
+     * SIMDFastPFor), then the tail (fewer than Codec1::BlockSize integers)
+     * is decoded to the stack and added.
+     */
+    void aggregate(const uint32_t * in, const size_t length, Aggregate & a) {
+        const uint32_t * const end = codec1.aggregate(in, a);
+        if (in + length > end) {
+            uint32_t tail[Codec1::BlockSize];
+            size_t nvalue2 = Codec1::BlockSize;
+            codec2.decodeArray(end, length - (end - in), tail, nvalue2);
+            a.add(tail, nvalue2);
+        }
+    }
+
+    /**
+     * Decodes the compressed array in (length words) to uint16_t or uint8_t
+     * (T) with Codec1::decodeNarrow (see SIMDBinaryPacking, BP32 and
+     * FastPFor), the tail is decoded to the stack and narrowed. Throws
+     * logic_error if the integers do not fit in T.
+     */
+    template<class T>
+    const uint32_t * decodeNarrow(const uint32_t * in, const size_t length, T * out,
+            size_t & nvalue) {
+        size_t mynvalue1 = nvalue;
+        const uint32_t * const in2 = codec1.decodeNarrow(in, length, out, mynvalue1);
+        if (in + length > in2) {
+            uint32_t tail[Codec1::BlockSize];
+            size_t nvalue2 = Codec1::BlockSize;
+            const uint32_t * const in3 = codec2.decodeArray(in2, length - (in2 - in), tail,
+                    nvalue2);
+            if (mynvalue1 + nvalue2 > nvalue)
+                throw NotEnoughStorage(mynvalue1 + nvalue2);
+            narrowCopy(tail, nvalue2, out + mynvalue1,
+                    "CompositeCodec: the integers do not fit in the output type");
+            nvalue = mynvalue1 + nvalue2;
+            return in3;
+        }
+        nvalue = mynvalue1;
+        return in2;
+    }
+
+    void encodeBatchItem(const uint32_t * in, const size_t length,
+            uint32_t * out, size_t & nvalue) {
+        const size_t roundedlength = length / Codec1::BlockSize
+                * Codec1::BlockSize;
+        size_t nvalue1 = 0;
+        if (roundedlength > 0) {
+            nvalue1 = nvalue;
+            codec1.encodeArray(in, roundedlength, out, nvalue1);
+        }
+        size_t nvalue2 = 0;
+        if (roundedlength < length) {
+            nvalue2 = nvalue - nvalue1;
+            codeccounters::tail(length - roundedlength);
+            codec2.encodeArray(in + roundedlength, length - roundedlength,
+                    out + nvalue1, nvalue2);
+        }
+        nvalue = nvalue1 + nvalue2;
+    }
+
+    /**
+     * nvalue is the exact number of integers. If aligned is not NULL and
+     * out is not aligned, codec1 decodes to aligned (which has room for
+     * the array), and we copy.
+     */
+    void decodeBatchItem(const uint32_t * in, const size_t length,
+            uint32_t * out, size_t & nvalue, uint32_t * aligned = NULL) {
+        const size_t roundedlength = nvalue / Codec1::BlockSize
+                * Codec1::BlockSize;
+        const uint32_t * in2 = in;
+        size_t nvalue1 = 0;
+        if (roundedlength > 0) {
+            nvalue1 = roundedlength;
+            if ((aligned != NULL) && needPaddingTo128Bits(out)) {
+                in2 = codec1.decodeArray(in, length, aligned, nvalue1);
+                memcpy(out, aligned, nvalue1 * sizeof(uint32_t));
+            } else
+                in2 = codec1.decodeArray(in, length, out, nvalue1);
+        }
+        size_t nvalue2 = 0;
+        if (roundedlength < nvalue) {
+            nvalue2 = nvalue - roundedlength;
+            codec2.decodeArray(in2, length - (in2 - in), out + nvalue1, nvalue2);
+        }
+        nvalue = nvalue1 + nvalue2;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t roundedlength = length / Codec1::BlockSize
+                * Codec1::BlockSize;
+        return codec1.maxCompressedWords(roundedlength) + (roundedlength < length
+                ? codec2.maxCompressedWords(length - roundedlength) : 0);
+    }
+
+    /**
+     * We do not know where codec1 ends without decoding, so we only
+     * read its header: the tail adds less than Codec1::BlockSize integers.
+     */
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        return codec1.decodedLength(in, length) + Codec1::BlockSize - 1;
+    }
+
     string name() const {
         ostringstream convert;
         convert << codec1.name() << "+" << codec2.name();
         return convert.str();
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new CompositeCodec(*this));
+    }
 };
 
 #endif /* COMPOSITECODEC_H_ */
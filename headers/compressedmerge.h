@@ -0,0 +1,494 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef COMPRESSEDMERGE_H_
+#define COMPRESSEDMERGE_H_
+
+#include "common.h"
+#include "skipindex.h"
+#include "intersection.h"
+#include "fastpfor.h"
+
+/**
+ * Union of sorted arrays of distinct integers (e.g., posting lists).
+ *
+ * The functions write the union to out and return its size. Because the
+ * SIMD kernel stores 4 integers at a time, out should have room for both
+ * arrays plus 4 integers.
+ */
+
+/**
+ * Scalar merge, used for the short arrays and the tail of unionSIMD.
+ */
+inline size_t unionScalar(const uint32_t * A, const size_t lenA,
+        const uint32_t * B, const size_t lenB, uint32_t * out) {
+    size_t i = 0, j = 0, count = 0;
+    while ((i < lenA) && (j < lenB)) {
+        if (A[i] < B[j])
+            out[count++] = A[i++];
+        else if (B[j] < A[i])
+            out[count++] = B[j++];
+        else {
+            out[count++] = A[i];
+            ++i;
+            ++j;
+        }
+    }
+    count = copy(A + i, A + lenA, out + count) - out;
+    return copy(B + j, B + lenB, out + count) - out;
+}
+
+/**
+ * a and b get the smallest and the largest integer of each lane. The
+ * sign bits are flipped, so that the signed comparison orders the
+ * unsigned integers.
+ */
+inline void mergeMinMax(__m128i & a, __m128i & b) {
+    const __m128i swap = _mm_and_si128(_mm_xor_si128(a, b), _mm_cmpgt_epi32(a, b));
+    a = _mm_xor_si128(a, swap);
+    b = _mm_xor_si128(b, swap);
+}
+
+/**
+ * Bitonic merge network: a and b are sorted (with their sign bits
+ * flipped), on return a has the 4 smallest of their 8 integers and b the
+ * 4 largest, sorted.
+ */
+inline void mergeNetwork(__m128i & a, __m128i & b) {
+    b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0,1,2,3));
+    mergeMinMax(a, b);
+    // lanes 2 apart, then 1 apart, in both registers at once
+    __m128i x = _mm_unpacklo_epi64(a, b), y = _mm_unpackhi_epi64(a, b);
+    mergeMinMax(x, y);
+    a = _mm_unpacklo_epi32(x, y);
+    b = _mm_unpackhi_epi32(x, y);
+    x = _mm_unpacklo_epi64(a, b);
+    y = _mm_unpackhi_epi64(a, b);
+    mergeMinMax(x, y);
+    a = _mm_unpacklo_epi32(x, y);
+    b = _mm_unpackhi_epi32(x, y);
+}
+
+/**
+ * Stores the integers of v (sign bits flipped) that differ from the one
+ * before them (the last of previous for the first one) and returns how
+ * many. out needs room for 4 integers.
+ */
+inline size_t storeDistinct(const __m128i v, const __m128i previous, uint32_t * out,
+        const IntersectionShuffleTable & table) {
+    const __m128i repeated = _mm_cmpeq_epi32(v, _mm_alignr_epi8(v, previous, 12));
+    const int mask = ~_mm_movemask_ps(_mm_castsi128_ps(repeated)) & 15;
+    _mm_storeu_si128(reinterpret_cast<__m128i *> (out), _mm_shuffle_epi8(_mm_xor_si128(v,
+            _mm_set1_epi32(static_cast<int> (1U << 31))), _mm_load_si128(
+            reinterpret_cast<const __m128i *> (table.masks[mask]))));
+    return __builtin_popcount(mask);
+}
+
+/**
+ * Merges the arrays 4 integers at a time with the merge network, loading
+ * the next 4 integers from the array whose next integer is smallest, and
+ * drops the integers equal to the one before them with a shuffle (the
+ * integers found in both arrays).
+ *
+ * Reference: Chhugani et al., Efficient implementation of sorting on
+ * multi-core SIMD CPU architecture, VLDB 2008.
+ */
+inline size_t unionSIMD(const uint32_t * A, const size_t lenA,
+        const uint32_t * B, const size_t lenB, uint32_t * out) {
+    if ((lenA < 4) || (lenB < 4))
+        return unionScalar(A, lenA, B, lenB, out);
+    const IntersectionShuffleTable & table = IntersectionShuffleTable::get();
+    const __m128i flip = _mm_set1_epi32(static_cast<int> (1U << 31));
+    __m128i a = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *> (A)), flip);
+    __m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *> (B)), flip);
+    // differs from the first integer
+    __m128i previous = _mm_set1_epi32(static_cast<int> (~(min(A[0], B[0]) ^ (1U << 31))));
+    size_t i = 4, j = 4, count = 0;
+    while (true) {
+        mergeNetwork(a, b);
+        count += storeDistinct(a, previous, out + count, table);
+        previous = a;
+        a = b;
+        if ((i < lenA) && ((j == lenB) || (A[i] <= B[j]))) {
+            if (i + 4 > lenA)
+                break;
+            b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *> (A + i)), flip);
+            i += 4;
+        } else {
+            if (j + 4 > lenB)
+                break;
+            b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *> (B + j)), flip);
+            j += 4;
+        }
+    }
+    // the integers of a, fewer than 4 integers of one array, the rest of the other
+    const bool shortA = lenA - i < 4;
+    const uint32_t * const S = shortA ? A + i : B + j;
+    const size_t lenS = shortA ? lenA - i : lenB - j;
+    const uint32_t * const L = shortA ? B + j : A + i;
+    const size_t lenL = shortA ? lenB - j : lenA - i;
+    uint32_t rest[4], merged[8];
+    const size_t m = unionScalar(rest, storeDistinct(a, previous, rest, table), S, lenS, merged);
+    // only their first integers can repeat the last one we stored
+    const uint32_t last = out[count - 1];
+    const size_t from = (m > 0) && (merged[0] == last) ? 1 : 0;
+    const size_t fromL = (lenL > 0) && (L[0] == last) ? 1 : 0;
+    return count + unionScalar(merged + from, m - from, L + fromL, lenL - fromL, out + count);
+}
+
+/**
+ * What CompressedMerge needs to copy a chunk of DeltaSkipIndex<CODEC> (a
+ * CompositeCodec<CODEC, VariableByte> array) without decoding it:
+ *
+ * relocate copies the compressed chunk in (length words) to out, where the
+ * SIMD codecs might need another padding, and returns the number of words
+ * written;
+ *
+ * lowerFirst subtracts amount from the first integer of the compressed
+ * chunk in place (the first delta, when the chunk gets a larger base).
+ * The smaller integer fits in the bits of the old one.
+ *
+ * They return 0 and false when they cannot: this generic version always
+ * does, so CompressedMerge decodes the chunks and encodes them again.
+ */
+template<class CODEC>
+struct ChunkEditor {
+    static size_t relocate(const uint32_t * /*in*/, const size_t /*length*/, uint32_t * /*out*/) {
+        return 0;
+    }
+    static bool lowerFirst(uint32_t * /*in*/, const uint32_t /*amount*/) {
+        return false;
+    }
+};
+
+// the low b bits
+inline uint32_t lowBitsMask(const uint32_t b) {
+    return b == 32 ? ~0U : (1U << b) - 1;
+}
+
+template<>
+struct ChunkEditor<SIMDBinaryPacking> {
+    // the length (and summaries), the padding, then blocks that stay aligned
+    static size_t relocate(const uint32_t * in, const size_t length, uint32_t * out) {
+        const uint32_t * const header = BlockSummaries::skip(in + 1, in[0]);
+        const uint32_t * const blocks = padTo128bits(header);
+        memcpy(out, in, (header - in) * sizeof(uint32_t));
+        uint32_t * o = out + (header - in);
+        while (needPaddingTo128Bits(o))
+            *o++ = SIMDBinaryPacking::CookiePadder;
+        memcpy(o, blocks, (in + length - blocks) * sizeof(uint32_t));
+        return o + (in + length - blocks) - out;
+    }
+
+    static bool lowerFirst(uint32_t * in, const uint32_t amount) {
+        // no block (the chunk went to VariableByte), or summaries we would have to update
+        if ((in[0] == 0) || (BlockSummaries::skip(in + 1, in[0]) != in + 1))
+            return false;
+        uint32_t * const header = padTo128bits(in + 1);
+        // SIMD_fastpack_32 puts the first integer in the low bits of the first word
+        const uint32_t mask = lowBitsMask(header[0] >> 24);
+        uint32_t & word = header[SIMDBinaryPacking::HowManyMiniBlocks / 4];
+        word = (word & ~mask) | (((word & mask) - amount) & mask);
+        return true;
+    }
+};
+
+template<>
+struct ChunkEditor<FastPFor> {
+    // FastPFor does not pad
+    static size_t relocate(const uint32_t * in, const size_t length, uint32_t * out) {
+        memcpy(out, in, length * sizeof(uint32_t));
+        return length;
+    }
+
+    /**
+     * The low b bits of the first integer are the low bits of the first
+     * packed word; if its position is the first exception, its high bits
+     * are the first integer packed with maxbits - b bits.
+     */
+    static bool lowerFirst(uint32_t * in, const uint32_t amount) {
+        if (in[0] == 0)
+            return false;
+        uint32_t * const page = in + 1;
+        uint32_t * const meta = page + page[0];
+        const uint8_t * const bytes = reinterpret_cast<const uint8_t *> (meta + 1);
+        const uint32_t b = bytes[0];
+        uint32_t value = page[1] & lowBitsMask(b);
+        uint32_t * exception = NULL;
+        uint32_t k = 0;
+        if ((bytes[1] > 0) && (bytes[3] == 0)) {
+            k = bytes[2] - b;
+            uint32_t * e = meta + 1 + (meta[0] + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+            const uint32_t bitmap = *e++;
+            for (uint32_t j = 1; j < k; ++j)
+                if ((bitmap & (1U << (j - 1))) != 0)
+                    e += 1 + (e[0] + 31) / 32 * j;
+            exception = e + 1;
+            value |= (exception[0] & lowBitsMask(k)) << b;
+        }
+        value -= amount;
+        page[1] = (page[1] & ~lowBitsMask(b)) | (value & lowBitsMask(b));
+        if (exception != NULL)
+            exception[0] = (exception[0] & ~lowBitsMask(k)) | (value >> b);
+        return true;
+    }
+};
+
+/**
+ * Union of lists compressed with DeltaSkipIndex (e.g., the posting lists
+ * of two index segments we compact), written as a list compressed with
+ * DeltaSkipIndex (in its ExplicitChunks layout) without decoding all of
+ * the lists.
+ *
+ * A chunk whose integers are all smaller than what is left of the other
+ * list is copied as it is: ChunkEditor relocates it and lowers its first
+ * delta (its base becomes the last integer we wrote). Only where the lists
+ * overlap do we decode the chunks and merge them (unionSIMD), the merged
+ * integers being compressed by chunks of ChunkSize; the chunk before a
+ * copied one may be shorter. With time-partitioned segments, most chunks
+ * do not overlap.
+ *
+ * The lists should be sorted arrays of distinct integers, compressed with
+ * the chunk size of the DeltaSkipIndex instance. An instance keeps
+ * buffers: use one per thread.
+ */
+template<class CODEC = SIMDBinaryPacking>
+class CompressedMerge {
+public:
+    typedef DeltaSkipIndex<CODEC> SkipIndex;
+    typedef ChunkEditor<CODEC> Editor;
+
+    CompressedMerge(SkipIndex & s) :
+        dsi(s), inputA(s.ChunkSize), inputB(s.ChunkSize), pending(3 * s.ChunkSize + 4),
+                pendinglength(0), payload(), payloadlength(0), bases(), offsets(), starts(),
+                last(0), written(0), copied(0), encoded(0) {
+    }
+
+    /**
+     * Writes the union of the compressed lists A and B to out, nvalue being
+     * the room we have (we throw NotEnoughStorage otherwise), then the
+     * number of words written.
+     */
+    void merge(const uint32_t * A, const uint32_t * B, uint32_t * out, size_t & nvalue) {
+        inputA.reset(A, dsi.ChunkSize);
+        inputB.reset(B, dsi.ChunkSize);
+        pendinglength = 0;
+        payloadlength = 0;
+        bases.clear();
+        offsets.clear();
+        starts.clear();
+        last = 0;
+        written = 0;
+        copied = 0;
+        encoded = 0;
+        while (!inputA.done() && !inputB.done()) {
+            if (tryCopy(inputA, inputB) || tryCopy(inputB, inputA))
+                continue;
+            mergeChunks();
+        }
+        drain(inputA);
+        drain(inputB);
+        flush(pendinglength);
+        write(out, nvalue);
+    }
+
+    // the chunks the last merge copied, and those it encoded
+    size_t copiedChunks() const {
+        return copied;
+    }
+    size_t encodedChunks() const {
+        return encoded;
+    }
+
+private:
+    CompressedMerge(const CompressedMerge &);
+    CompressedMerge & operator=(const CompressedMerge &);
+
+    // where we are in a list, with its current chunk once decoded
+    struct Input {
+        Input(const size_t chunksize) :
+            in(NULL), chunk(0), pos(0), decoded(false), values(chunksize) {
+        }
+
+        void reset(const uint32_t * compressed, const uint32_t chunksize) {
+            if (SkipIndex::maxChunkLength(compressed) != chunksize)
+                throw logic_error("CompressedMerge: chunk size does not match");
+            in = compressed;
+            chunk = 0;
+            pos = 0;
+            decoded = false;
+        }
+
+        bool done() const {
+            return chunk == SkipIndex::numberOfChunks(in);
+        }
+        size_t length() const {
+            return SkipIndex::chunkLength(in, chunk);
+        }
+        uint32_t largest() const {
+            return SkipIndex::chunkMax(in, chunk);
+        }
+        void load(SkipIndex & dsi) {
+            if (!decoded)
+                dsi.decodeChunk(in, chunk, &values[0]);
+            decoded = true;
+        }
+        void nextChunk() {
+            ++chunk;
+            pos = 0;
+            decoded = false;
+        }
+
+        // we keep a pointer to the list
+        Input(const Input &);
+        Input & operator=(const Input &);
+
+        const uint32_t * in;
+        size_t chunk;
+        size_t pos;// integers of the chunk already merged
+        bool decoded;
+        vector<uint32_t, cacheallocator> values;
+    };
+
+    // copies the chunk of x if all its integers are smaller than what is left of y
+    bool tryCopy(Input & x, Input & y) {
+        if (x.pos > 0)
+            return false;
+        if (x.largest() >= SkipIndex::chunkBase(y.in, y.chunk)) {
+            y.load(dsi);
+            if (x.largest() >= y.values[y.pos])
+                return false;
+        }
+        copyChunk(x);
+        return true;
+    }
+
+    void copyChunk(Input & x) {
+        flush(pendinglength);
+        const size_t thissize = x.length();
+        const size_t words = SkipIndex::compressedChunkLength(x.in, x.chunk);
+        reserve(words + 4);
+        size_t thisnvalue = Editor::relocate(SkipIndex::compressedChunk(x.in, x.chunk), words,
+                &payload[payloadlength]);
+        if ((thisnvalue > 0) && Editor::lowerFirst(&payload[payloadlength], last
+                - SkipIndex::chunkBase(x.in, x.chunk))) {
+            ++copied;
+        } else {
+            x.load(dsi);
+            reserve(dsi.maxChunkWords(thissize));
+            thisnvalue = payload.size() - payloadlength;
+            dsi.encodeChunk(&x.values[0], thissize, last, &payload[payloadlength], thisnvalue);
+            ++encoded;
+        }
+        addChunk(thissize, thisnvalue, x.largest());
+        x.nextChunk();
+    }
+
+    // merges the integers of both chunks up to the end of the first one to end
+    void mergeChunks() {
+        inputA.load(dsi);
+        inputB.load(dsi);
+        const uint32_t upto = min(inputA.largest(), inputB.largest());
+        const uint32_t * const a = inputA.values.data();
+        const uint32_t * const b = inputB.values.data();
+        const size_t enda = upper_bound(a + inputA.pos, a + inputA.length(), upto) - a;
+        const size_t endb = upper_bound(b + inputB.pos, b + inputB.length(), upto) - b;
+        pendinglength += unionSIMD(a + inputA.pos, enda - inputA.pos, b + inputB.pos,
+                endb - inputB.pos, &pending[pendinglength]);
+        inputA.pos = enda;
+        inputB.pos = endb;
+        if (enda == inputA.length())
+            inputA.nextChunk();
+        if (endb == inputB.length())
+            inputB.nextChunk();
+        while (pendinglength >= dsi.ChunkSize)
+            flush(dsi.ChunkSize);
+    }
+
+    // what is left of x once the other list is done
+    void drain(Input & x) {
+        if (!x.done() && (x.pos > 0)) {
+            const size_t left = x.length() - x.pos;
+            memcpy(&pending[pendinglength], &x.values[x.pos], left * sizeof(uint32_t));
+            pendinglength += left;
+            x.nextChunk();
+            while (pendinglength >= dsi.ChunkSize)
+                flush(dsi.ChunkSize);
+        }
+        while (!x.done())
+            copyChunk(x);
+    }
+
+    // encodes the first howmany pending integers as a chunk
+    void flush(const size_t howmany) {
+        if (howmany == 0)
+            return;
+        reserve(dsi.maxChunkWords(howmany));
+        size_t thisnvalue = payload.size() - payloadlength;
+        dsi.encodeChunk(&pending[0], howmany, last, &payload[payloadlength], thisnvalue);
+        ++encoded;
+        addChunk(howmany, thisnvalue, pending[howmany - 1]);
+        pendinglength -= howmany;
+        memmove(&pending[0], &pending[howmany], pendinglength * sizeof(uint32_t));
+    }
+
+    void addChunk(const size_t thissize, const size_t words, const uint32_t largest) {
+        bases.push_back(last);
+        offsets.push_back(static_cast<uint32_t> (payloadlength));
+        starts.push_back(static_cast<uint32_t> (written));
+        payloadlength += words;
+        written += thissize;
+        last = largest;
+    }
+
+    // room for words more words in the payload (which stays aligned on 64 bytes)
+    void reserve(const size_t words) {
+        if (payloadlength + words > payload.size())
+            payload.resize(max(2 * payload.size(), payloadlength + words));
+    }
+
+    // the header, the skip table and the chunk positions, then the payload on 16 bytes
+    void write(uint32_t * out, size_t & nvalue) const {
+        const size_t numberofchunks = bases.size();
+        uint32_t * const starttable = out + SkipIndex::HeaderSize + 2 * numberofchunks;
+        uint32_t * const target = padTo128bits(starttable + numberofchunks);
+        const size_t required = (target - out) + payloadlength;
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        out[0] = static_cast<uint32_t> (written);
+        out[1] = static_cast<uint32_t> (numberofchunks);
+        out[2] = dsi.ChunkSize | SkipIndex::ExplicitChunks;
+        out[3] = last;
+        out[4] = static_cast<uint32_t> (payloadlength);
+        for (size_t c = 0; c < numberofchunks; ++c) {
+            out[SkipIndex::HeaderSize + 2 * c] = bases[c];
+            out[SkipIndex::HeaderSize + 2 * c + 1] = offsets[c];
+            starttable[c] = starts[c];
+        }
+        fill(starttable + numberofchunks, target, 0);
+        if (payloadlength > 0)
+            memcpy(target, &payload[0], payloadlength * sizeof(uint32_t));
+        nvalue = required;
+    }
+
+    SkipIndex & dsi;
+    Input inputA;
+    Input inputB;
+    vector<uint32_t, cacheallocator> pending;// merged integers, not yet in a chunk
+    size_t pendinglength;
+    vector<uint32_t, cacheallocator> payload;
+    size_t payloadlength;
+    vector<uint32_t> bases;
+    vector<uint32_t> offsets;
+    vector<uint32_t> starts;
+    uint32_t last;// the last integer in a chunk
+    size_t written;// the integers in a chunk
+    size_t copied;
+    size_t encoded;
+};
+
+#endif /* COMPRESSEDMERGE_H_ */
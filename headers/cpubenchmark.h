@@ -60,6 +60,22 @@ static __inline__ unsigned long long stopRDTSCP (void) {
     return rdtsc();
 }
 
+#elif defined(__aarch64__)
+
+// the virtual counter (it ticks at a fixed frequency, not with the cycles)
+inline unsigned long long rdtsc() {
+    unsigned long long answer;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(answer));
+    return answer;
+}
+static __inline__ unsigned long long startRDTSC (void) {
+    return rdtsc();
+}
+
+static __inline__ unsigned long long stopRDTSCP (void) {
+    return rdtsc();
+}
+
 #elif ( defined(__arm__) || defined(__ppc__) || defined(__ppc64__) )
 
 // for PPC we should be able to use tbl, but I could not find
@@ -0,0 +1,74 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef CPUFEATURES_H_
+#define CPUFEATURES_H_
+
+#include "common.h"
+
+/**
+ * Runtime detection of the instruction sets. The library is compiled
+ * for the lowest common denominator (SSSE3) except for the kernels that
+ * are also built for more recent instruction sets; these functions tell
+ * us which ones we may call. The answer is computed once (cpuid).
+ */
+#ifdef FASTPFOR_X86
+inline bool cpuSupportsSSE41() {
+    static const bool answer = __builtin_cpu_supports("sse4.1");
+    return answer;
+}
+
+// for the crc32 instruction (CRC32C)
+inline bool cpuSupportsSSE42() {
+    static const bool answer = __builtin_cpu_supports("sse4.2");
+    return answer;
+}
+
+inline bool cpuSupportsAVX2() {
+    static const bool answer = __builtin_cpu_supports("avx2");
+    return answer;
+}
+
+// AVX-512 F, BW and VL (Skylake-X and later), as we compile the kernels
+inline bool cpuSupportsAVX512() {
+    static const bool answer = __builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl");
+    return answer;
+}
+#else
+/**
+ * On ARM, the SSE4.1 kernels are built with NEON (see neonsse.h): NEON is
+ * part of aarch64. The SSE4.2, AVX2 and AVX-512 kernels are x86 only.
+ */
+inline bool cpuSupportsSSE41() {
+    return true;
+}
+
+inline bool cpuSupportsSSE42() {
+    return false;
+}
+
+inline bool cpuSupportsAVX2() {
+    return false;
+}
+
+inline bool cpuSupportsAVX512() {
+    return false;
+}
+#endif
+
+// name of the best instruction set we have kernels for
+inline std::string bestInstructionSet() {
+#ifdef FASTPFOR_X86
+    if (cpuSupportsAVX2())
+        return "avx2";
+    return "ssse3";
+#else
+    return "neon";
+#endif
+}
+
+#endif /* CPUFEATURES_H_ */
@@ -0,0 +1,55 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef CRC32C_H_
+#define CRC32C_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+
+/**
+ * CRC32C (Castagnoli polynomial, as in iSCSI, ext4 or RocksDB) of the
+ * bytes at data, continuing from crc (the CRC32C of the previous bytes):
+ * crc32c(b, m, crc32c(a, n)) is the CRC32C of a followed by b.
+ *
+ * The hardware version (src/crc32c.cpp, compiled with -msse4.2) uses the
+ * crc32 instruction on three interleaved streams, which it combines, so
+ * that it is not bound by the latency of the instruction. It is x86 only:
+ * on ARM, we use the table.
+ */
+uint32_t crc32cHardware(const void * data, const size_t bytes, const uint32_t crc);
+
+// one byte at a time, with a table
+inline uint32_t crc32cSoftware(const void * data, const size_t bytes, const uint32_t crc) {
+    struct Table {
+        Table() {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t x = i;
+                for (uint32_t k = 0; k < 8; ++k)
+                    x = (x & 1) != 0 ? (x >> 1) ^ 0x82F63B78U : x >> 1;
+                values[i] = x;
+            }
+        }
+        uint32_t values[256];
+    };
+    static const Table table;
+    const uint8_t * p = static_cast<const uint8_t *> (data);
+    uint32_t c = ~crc;
+    for (size_t i = 0; i < bytes; ++i)
+        c = table.values[(c ^ p[i]) & 0xFF] ^ (c >> 8);
+    return ~c;
+}
+
+inline uint32_t crc32c(const void * data, const size_t bytes, const uint32_t crc = 0) {
+#ifdef FASTPFOR_X86
+    if (cpuSupportsSSE42())
+        return crc32cHardware(data, bytes, crc);
+#endif
+    return crc32cSoftware(data, bytes, crc);
+}
+
+#endif /* CRC32C_H_ */
@@ -9,6 +9,9 @@
 #ifndef CVSTOMAROPUCVS_H_
 #define CVSTOMAROPUCVS_H_
 #include "common.h"
+#include "util.h"
+
+#include <unistd.h>
 
 using namespace std;
 
@@ -70,6 +73,7 @@ public:
 private:
 
     inline void tokenize(const string& str) {
+        currentData.clear();
         string::size_type lastPos = str.find_first_not_of(mDelimiterPlusSpace,
                 0);
         string::size_type pos = str.find_first_of(mDelimiter, lastPos);
@@ -92,24 +96,195 @@ private:
 
 };
 
+/**
+ * A field of a memory-mapped CSV file: we point into the file rather than
+ * copying the string.
+ */
+struct CSVField {
+    const char * begin;
+    size_t length;
+
+    bool operator==(const CSVField & o) const {
+        return (length == o.length) && (memcmp(begin, o.begin, length) == 0);
+    }
+    // the order of std::string
+    bool operator<(const CSVField & o) const {
+        const int c = memcmp(begin, o.begin, min(length, o.length));
+        return c != 0 ? c < 0 : length < o.length;
+    }
+    string str() const {
+        return string(begin, length);
+    }
+};
+
+struct CSVFieldHash {
+    size_t operator()(const CSVField & f) const {
+        uint64_t h = 0x9E3779B97F4A7C15ULL ^ f.length;
+        size_t k = 0;
+        for (; k + 8 <= f.length; k += 8) {
+            uint64_t w;
+            memcpy(&w, f.begin + k, 8);
+            h = (h ^ w) * 0xBF58476D1CE4E5B9ULL;
+            h ^= h >> 29;
+        }
+        uint64_t w = 0;
+        memcpy(&w, f.begin + k, f.length - k);
+        h = (h ^ w) * 0x94D049BB133111EBULL;
+        return static_cast<size_t> (h ^ (h >> 31));
+    }
+};
+
+/**
+ * A hash table of CSVField (open addressing, linear probing) for the
+ * histograms and the mappings of CSVFlatFile. The entries are stored
+ * contiguously, in insertion order, so that we can merge the tables and
+ * sort their entries cheaply; each slot keeps 32 bits of the hash value,
+ * so that we seldom look at a key that does not match.
+ */
+class CSVDictionary {
+public:
+    struct Entry {
+        CSVField key;
+        uint64_t hash;
+        size_t value;
+    };
+    typedef vector<Entry>::const_iterator const_iterator;
+
+    CSVDictionary() :
+        entries(), slots() {
+    }
+
+    size_t size() const {
+        return entries.size();
+    }
+    const_iterator begin() const {
+        return entries.begin();
+    }
+    const_iterator end() const {
+        return entries.end();
+    }
+
+    // the value of key, inserted (as 0) if need be
+    size_t & operator[](const CSVField & key) {
+        if (slots.empty())
+            rehash(64);
+        const uint64_t h = CSVFieldHash()(key);
+        const size_t s = findSlot(key, h);
+        if (slots[s] != 0)
+            return entries[static_cast<uint32_t> (slots[s]) - 1].value;
+        if (2 * (entries.size() + 1) > slots.size()) {
+            rehash(max<size_t> (64, 2 * slots.size()));
+            return (*this)[key];
+        }
+        entries.push_back(Entry { key, h, 0 });
+        slots[s] = (h & 0xFFFFFFFF00000000ULL) | entries.size();
+        return entries.back().value;
+    }
+
+    // NULL if the key is absent
+    const size_t * find(const CSVField & key) const {
+        if (slots.empty())
+            return NULL;
+        const size_t s = findSlot(key, CSVFieldHash()(key));
+        return slots[s] == 0 ? NULL : &entries[static_cast<uint32_t> (slots[s]) - 1].value;
+    }
+
+    /**
+     * Sorts the entries (with comp, on the entries) and replaces each value
+     * by the rank of its entry.
+     */
+    template<class Compare>
+    void rank(Compare comp) {
+        sort(entries.begin(), entries.end(), comp);
+        for (size_t i = 0; i < entries.size(); ++i)
+            entries[i].value = i;
+        rehash(slots.size());
+    }
+
+    void clear() {
+        vector<Entry> ().swap(entries);
+        vector<uint64_t> ().swap(slots);
+    }
+
+private:
+    size_t findSlot(const CSVField & key, const uint64_t h) const {
+        const size_t mask = slots.size() - 1;
+        size_t s = static_cast<size_t> (h) & mask;
+        while (slots[s] != 0) {
+            if (((slots[s] ^ h) >> 32) == 0) {
+                const Entry & e = entries[static_cast<uint32_t> (slots[s]) - 1];
+                if (e.key == key)
+                    return s;
+            }
+            s = (s + 1) & mask;
+        }
+        return s;
+    }
+
+    void rehash(const size_t capacity) {
+        slots.assign(capacity, 0);
+        const size_t mask = capacity - 1;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            size_t s = static_cast<size_t> (entries[i].hash) & mask;
+            while (slots[s] != 0)
+                s = (s + 1) & mask;
+            slots[s] = (entries[i].hash & 0xFFFFFFFF00000000ULL) | (i + 1);
+        }
+    }
+
+    vector<Entry> entries;
+    vector<uint64_t> slots;// 32 bits of the hash value, then 1 + the index of the entry
+};
+
+/**
+ * Maps a table stored as a CSV file to integers (one per attribute value,
+ * column by column) following the frequencies of the values (the most
+ * frequent value is 0) or their lexicographical order.
+ *
+ * The file is memory mapped and tokenized in place (the fields are
+ * CSVField, looked up in hash tables), with a SSE2 search for the commas
+ * and the line ends. The two passes over the file (the normalization, then
+ * the rows) are done on several threads, each thread taking a chunk of
+ * lines, with its own histograms which we merge afterward.
+ *
+ * The lines are read as CSVReader does: we skip the empty lines and the
+ * lines starting with '#', and the empty fields.
+ */
 class CSVFlatFile {
 public:
 
-    typedef map<string, size_t> maptype;
-    typedef map<string, size_t> umaptype;
+    typedef CSVDictionary maptype;
+    typedef CSVDictionary umaptype;
 
     enum {
         FREQNORMALISATION, DOMAINNORMALISATION
     };
-    CSVFlatFile(const char * filename, const int normtype) :
-        in(), mainreader(NULL), mapping(), NumberOfLines(0) {
+    CSVFlatFile(const char * filename, const int normtype, uint32_t threads = 0) :
+        fd(-1), mapped(NULL), mappedbytes(0), cursor(0), rows(), currentrow(0),
+                numberofthreads(threads > 0 ? threads : max<uint32_t> (1,
+                        thread::hardware_concurrency())), mapping(), NumberOfLines(0) {
         cout << "# computing normalization of file " << filename << endl;
-        if (normtype == FREQNORMALISATION)
-            computeFreqNormalization(filename);
-        else if (normtype == DOMAINNORMALISATION)
-            computeDomainNormalization(filename);
-        in.open(filename);
-        mainreader.linkStream(&in);
+        if (!openFile(filename))
+            return;
+        computeHisto(mapping);
+        parallelFor(mapping.size(), [&](size_t k) {
+            if (normtype == FREQNORMALISATION) {
+                // by decreasing frequency (then in reverse lexicographical order)
+                mapping[k].rank([](const CSVDictionary::Entry & x, const CSVDictionary::Entry & y) {
+                    return x.value != y.value ? x.value > y.value : y.key < x.key;});
+            } else {
+                mapping[k].rank([](const CSVDictionary::Entry & x, const CSVDictionary::Entry & y) {
+                    return x.key < y.key;});
+            }
+        }, numberofthreads);
+        cursor = 0;
+    }
+
+    ~CSVFlatFile() {
+        if (mapped != NULL)
+            munmap(const_cast<char *> (mapped), mappedbytes);
+        if (fd >= 0)
+            ::close(fd);
     }
 
     size_t getNumberOfRows() const {
@@ -184,123 +359,215 @@ public:
     void clear() {
         mapping.clear();
     }
+    // we are done with the rows (the file stays mapped for the dictionaries)
     void close() {
-        in.close();
+        cursor = mappedbytes;
+        vector<uint32_t> ().swap(rows);
+        currentrow = 0;
     }
 
     //size_t getCardinalityOfColumn(size_t k) {return mapping[k].size();}
+    /**
+     * The next row, as integers. The rows are converted a block at a time
+     * on several threads. (A missing field is mapped to 0.)
+     */
     template<class C>
     bool nextRow(C & container) {
-        if (mainreader.hasNext()) {
-            const vector<string> & row = mainreader.nextRow();
-            for (size_t k = 0; k < row.size(); ++k) {
-                container[k] = mapping[k][row[k]];
-            }
-            return true;
-        } else
-            return false;
+        const size_t c = mapping.size();
+        if (currentrow * c >= rows.size()) {
+            if (!loadRows())
+                return false;
+        }
+        for (size_t k = 0; k < c; ++k)
+            container[k] = rows[currentrow * c + k];
+        ++currentrow;
+        return true;
     }
 
-    void computeHisto(ifstream & fsin, vector<umaptype> & histograms) {
-        NumberOfLines = 0;
-        CSVReader csvfile(&fsin);
-        if (csvfile.hasNext()) {
-            ++NumberOfLines;
-            const vector<string> & row = csvfile.nextRow();
-            histograms.resize(row.size());
-            for (size_t k = 0; k < row.size(); ++k) {
-                histograms[k][row[k]] = 1;
-            }
-        } else {
-            cerr
-                    << "could open the file, but couldn't even read the first line"
-                    << endl;
-            return;
+    /**
+     * The first byte of the first character among a and b in [p, end), or
+     * end. We compare 16 bytes at a time (SSE2).
+     */
+    static const char * findEither(const char * p, const char * end, const char a,
+            const char b) {
+        const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+        for (; p + 16 <= end; p += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *> (p));
+            const int m = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va),
+                    _mm_cmpeq_epi8(v, vb)));
+            if (m != 0)
+                return p + __builtin_ctz(m);
         }
-        while (csvfile.hasNext()) {
-            ++NumberOfLines;
-            const vector<string> & row = csvfile.nextRow();
-            for (size_t k = 0; k < row.size(); ++k) {
-                histograms[k][row[k]] += 1;
+        for (; p < end; ++p)
+            if ((*p == a) || (*p == b))
+                return p;
+        return end;
+    }
+
+    /**
+     * Calls f(fields) for each line in [begin, end) that is not empty or a
+     * comment, with the fields as CSVReader tokenizes them.
+     */
+    template<class Function>
+    static void forEachLine(const char * begin, const char * end, Function f) {
+        vector<CSVField> fields;
+        const char * p = begin;
+        while (p < end) {
+            fields.clear();
+            const bool comment = (*p == '#');
+            const char * fieldstart = p;
+            for (;;) {
+                const char * q = comment ? findEither(p, end, '\n', '\n')
+                        : findEither(p, end, ',', '\n');
+                if (q > fieldstart) {
+                    const bool last = (q == end) || (*q == '\n');
+                    const char * fieldend = q;
+                    // the last field loses its trailing spaces (and \r)
+                    while (last && (fieldend > fieldstart) && ((fieldend[-1] == ' ')
+                            || (fieldend[-1] == '\r')))
+                        --fieldend;
+                    if (fieldend > fieldstart)
+                        fields.push_back(CSVField { fieldstart, static_cast<size_t> (fieldend
+                                - fieldstart) });
+                }
+                p = q + (q < end ? 1 : 0);
+                fieldstart = p;
+                if ((q == end) || (*q == '\n'))
+                    break;
             }
+            if (!comment && !fields.empty())
+                f(fields);
         }
     }
-    // map the string values to integer per frequency
-    void computeFreqNormalization(const char * filename) {
-        ifstream fsin(filename);
-        if (!fsin) {
+
+    enum {
+        BlockBytes = 1 << 24// bytes of lines converted per thread in nextRow
+    };
+
+private:
+    CSVFlatFile(const CSVFlatFile &);
+    CSVFlatFile & operator=(const CSVFlatFile &);
+
+    bool openFile(const char * filename) {
+        fd = ::open(filename, O_RDONLY);
+        if (fd < 0) {
             cerr << "can't open " << filename << endl;
-            return;
+            return false;
         }
-
-        vector<umaptype> histograms;
-        computeHisto(fsin, histograms);
-
-        fsin.close();
-        mapping.resize(histograms.size());
-        // next we sort the values per frequency
-        for (size_t k = 0; k < histograms.size(); ++k) {
-            vector < pair<size_t, string> > tobesorted;
-            tobesorted.reserve(histograms[k].size());
-            for (umaptype::iterator i = histograms[k].begin(); i
-                    != histograms[k].end(); ++i) {
-                tobesorted.push_back(pair<size_t, string> (i->second, i->first));
-            }
-            histograms[k].clear();// free the memory
-            sort(tobesorted.rbegin(), tobesorted.rend());
-            maptype & thismap = mapping[k];
-            for (size_t k = 0; k < tobesorted.size(); ++k)
-                thismap[tobesorted[k].second] = k;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            cerr << "can't stat " << filename << endl;
+            return false;
         }
+        mappedbytes = static_cast<size_t> (st.st_size);
+        if (mappedbytes == 0) {
+            cerr << "could open the file, but couldn't even read the first line" << endl;
+            return false;
+        }
+        void * addr = mmap(NULL, mappedbytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            cerr << "can't map " << filename << endl;
+            mappedbytes = 0;
+            return false;
+        }
+        madvise(addr, mappedbytes, MADV_SEQUENTIAL);
+        mapped = static_cast<const char *> (addr);
+        return true;
     }
 
-    // map the string values to integers in lexicographical order
-    void computeDomainNormalization(const char * filename) {
-        ifstream fsin(filename);
-        if (!fsin) {
-            cerr << "can't open " << filename << endl;
-            return;
+    // splits [begin, end) in parts of whole lines
+    vector<const char *> cutLines(const char * begin, const char * end,
+            size_t parts) const {
+        vector<const char *> bounds(1, begin);
+        for (size_t t = 1; t < parts; ++t) {
+            const char * b = begin + (end - begin) * t / parts;
+            b = max(b, bounds.back());
+            b = findEither(b, end, '\n', '\n');
+            bounds.push_back(b < end ? b + 1 : end);
         }
+        bounds.push_back(end);
+        return bounds;
+    }
+
+    // the histograms of the values of each column, and the number of lines
+    void computeHisto(vector<umaptype> & histograms) {
         NumberOfLines = 0;
-        CSVReader csvfile(&fsin);
-        vector < set<string> > histograms;
-        if (csvfile.hasNext()) {
-            ++NumberOfLines;
-            const vector<string> & row = csvfile.nextRow();
-            histograms.resize(row.size());
-            for (size_t k = 0; k < row.size(); ++k) {
-                histograms[k].insert(row[k]);
-            }
-        } else {
-            cerr
-                    << "could open the file, but couldn't even read the first line of "
-                    << filename << endl;
+        const char * const begin = mapped;
+        const char * const end = mapped + mappedbytes;
+        size_t columns = 0;
+        // the first line gives us the number of columns
+        for (const char * p = begin; (columns == 0) && (p < end);) {
+            const char * q = findEither(p, end, '\n', '\n');
+            q += (q < end) ? 1 : 0;
+            forEachLine(p, q, [&](const vector<CSVField> & fields) {
+                columns = fields.size();
+            });
+            p = q;
+        }
+        if (columns == 0) {
+            cerr << "could open the file, but couldn't even read the first line" << endl;
             return;
         }
-        while (csvfile.hasNext()) {
-            ++NumberOfLines;
-            const vector<string> & row = csvfile.nextRow();
-            for (size_t k = 0; k < row.size(); ++k) {
-                histograms[k].insert(row[k]);
+        const vector<const char *> bounds = cutLines(begin, end, numberofthreads);
+        vector < vector<umaptype> > local(numberofthreads, vector<umaptype> (columns));
+        vector<size_t> lines(numberofthreads);
+        parallelFor(numberofthreads, [&](size_t t) {
+            forEachLine(bounds[t], bounds[t + 1], [&](const vector<CSVField> & fields) {
+                ++lines[t];
+                for (size_t k = 0; k < min(columns, fields.size()); ++k)
+                    ++local[t][k][fields[k]];
+            });
+        }, numberofthreads);
+        histograms.swap(local[0]);
+        parallelFor(columns, [&](size_t k) {
+            for (size_t t = 1; t < local.size(); ++t) {
+                for (umaptype::const_iterator i = local[t][k].begin(); i != local[t][k].end(); ++i)
+                    histograms[k][i->key] += i->value;
+                local[t][k].clear();
             }
-        }
-        fsin.close();
-        mapping.resize(histograms.size());
-        // the values are already sorted lexicographically
-        for (size_t k = 0; k < histograms.size(); ++k) {
-            set < string > &myvalues = histograms[k];
-            maptype & thismap = mapping[k];
-            size_t counter = 0;
-            for (set<string>::iterator i = myvalues.begin(); i
-                    != myvalues.end(); ++i) {
-                thismap[*i] = counter++;
+        }, numberofthreads);
+        NumberOfLines = accumulate(lines.begin(), lines.end(), size_t(0));
+    }
+
+    // converts the next lines to integers, on several threads
+    bool loadRows() {
+        rows.clear();
+        currentrow = 0;
+        const size_t c = mapping.size();
+        while (rows.empty() && (cursor < mappedbytes)) {
+            const char * const begin = mapped + cursor;
+            const char * end = mapped + min(mappedbytes, cursor + numberofthreads
+                    * static_cast<size_t> (BlockBytes));
+            if (end < mapped + mappedbytes) {
+                end = findEither(end, mapped + mappedbytes, '\n', '\n');
+                end += (end < mapped + mappedbytes) ? 1 : 0;
             }
-            myvalues.clear();
+            cursor = end - mapped;
+            const vector<const char *> bounds = cutLines(begin, end, numberofthreads);
+            vector < vector<uint32_t> > parts(numberofthreads);
+            parallelFor(numberofthreads, [&](size_t t) {
+                forEachLine(bounds[t], bounds[t + 1], [&](const vector<CSVField> & fields) {
+                    for (size_t k = 0; k < c; ++k) {
+                        const size_t * i = k < fields.size() ? mapping[k].find(fields[k]) : NULL;
+                        parts[t].push_back(i == NULL ? 0 : static_cast<uint32_t> (*i));
+                    }
+                });
+            }, numberofthreads);
+            for (size_t t = 0; t < parts.size(); ++t)
+                rows.insert(rows.end(), parts[t].begin(), parts[t].end());
         }
+        return !rows.empty();
     }
 
-    ifstream in;
-    CSVReader mainreader;
+    int fd;
+    const char * mapped;
+    size_t mappedbytes;
+    size_t cursor;// where nextRow goes on in the file
+    vector<uint32_t> rows;// the rows converted by loadRows
+    size_t currentrow;
+    const uint32_t numberofthreads;
+
+public:
     vector<maptype> mapping;
     size_t NumberOfLines;
 };
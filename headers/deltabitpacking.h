@@ -0,0 +1,37 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef DELTABITPACKING_H_
+#define DELTABITPACKING_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+
+/**
+ * Unpacking with a fused inverse delta. Packing is done with the usual
+ * functions over the deltas.
+ */
+
+/**
+ * Same as fastunpack (32 integers), but the integers are the successive
+ * differences (D1): base is added to them and updated.
+ */
+void fastunpackd1(const uint32_t * __restrict__ in, uint32_t * __restrict__ out, const uint32_t bit, uint32_t & base);
+
+/**
+ * Same as SIMD_fastunpack_32 (128 integers in 4 lanes), but the integers are
+ * the differences with the integer 4 positions before (D4, see Delta::deltaSIMD).
+ * initOffset holds the last 4 values and is updated. As with SIMD_fastunpack_32,
+ * the output should be aligned on 16 bytes. Dispatches to the fastest build.
+ */
+void SIMD_fastunpackd4_32(const __m128i * __restrict__ in, uint32_t * __restrict__ out, const uint32_t bit, __m128i & initOffset);
+
+void simdunpackd4(const __m128i * __restrict__ in, uint32_t * __restrict__ out, const uint32_t bit, __m128i & initOffset);
+namespace avx2 {
+void simdunpackd4(const __m128i * __restrict__ in, uint32_t * __restrict__ out, const uint32_t bit, __m128i & initOffset);
+}
+
+#endif /* DELTABITPACKING_H_ */
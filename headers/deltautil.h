@@ -12,6 +12,9 @@
 #include "memutil.h"
 #include "entropy.h"
 #include "ztimer.h"
+#include "perfcounters.h"
+#include "latencyhistogram.h"
+#include "cpubenchmark.h"
 /**
  * This file is made of various convenient functions and structures.
  * It is not necessarily very reusable though.
@@ -19,8 +22,8 @@
 struct algostats {
 
     algostats(shared_ptr<IntegerCODEC> & a, bool simd = false) :
-        compspeed(), decompspeed(), bitsperint(), algo(a), decomptime(),
-                comptime(), output(), input(), SIMDDeltas(simd) {
+        compspeed(), decompspeed(), bitsperint(), compcounts(), decompcounts(),
+                decomplatency(), algo(a), decomptime(), comptime(), output(), input(), SIMDDeltas(simd) {
     }
     string name() {
         // if SIMDDeltas is "true", we prepend @
@@ -40,37 +43,93 @@ struct algostats {
     vector<double> compspeed;
     vector<double> decompspeed;
     vector<double> bitsperint;
+    // hardware counters (processparameters::perfcounters), one per test
+    // or, in the cumulative mode, their total
+    vector<PerfCounts> compcounts;
+    vector<PerfCounts> decompcounts;
+    // decoding cycles of each array (processparameters::latencies) over
+    // all tests, by length class: gccbits(length)
+    vector<LatencyHistogram> decomplatency;
     shared_ptr<IntegerCODEC> algo;
 
     // maps from name to results
     double decomptime, comptime, output, input;
     bool SIMDDeltas;
 };
+// the hardware counters of test k, if they were collected, as more columns
+void summarizeCounters(const algostats & a, const size_t k) {
+    if (k >= a.compcounts.size())
+        return;
+    cout << std::setprecision(4);
+    for (uint32_t c = 0; c < PerfCounts::HowMany; ++c)
+        cout << " \t " << a.compcounts[k].perInteger(c);
+    for (uint32_t c = 0; c < PerfCounts::HowMany; ++c)
+        cout << " \t " << a.decompcounts[k].perInteger(c);
+}
+
+// the percentiles of the decoding latency, for each length class
+void summarizeLatencies(vector<algostats> & v, string prefix = "#") {
+    bool any = false;
+    for (const algostats & a : v)
+        any = any || !a.decomplatency.empty();
+    if (!any)
+        return;
+    cout << "###################" << endl;
+    cout << "#decoding latency in cycles per array, by array length" << endl;
+    cout << "#(lengths, arrays, p50, p99, p999)" << endl;
+    cout << "#" << endl;
+    for (algostats & a : v)
+        for (uint32_t b = 0; b < a.decomplatency.size(); ++b) {
+            const LatencyHistogram & h = a.decomplatency[b];
+            if (h.count() == 0)
+                continue;
+            ostringstream lengths;
+            if (b == 0)
+                lengths << "0";
+            else
+                lengths << (1ULL << (b - 1)) << "-" << (1ULL << b) - 1;
+            cout << prefix << a.name(40) << " \t " << lengths.str() << " \t "
+                    << h.count() << " \t " << h.percentile(0.5) << " \t "
+                    << h.percentile(0.99) << " \t " << h.percentile(0.999) << endl;
+        }
+    cout << prefix << endl;
+}
+
 void summarize(vector<algostats> & v, string prefix = "#") {
     if (v.empty())
         return;
     cout << "# building summary " << endl;
     size_t N = v[0].bitsperint.size();
+    const bool counters = !v[0].compcounts.empty();
     for (size_t k = 0; k < N; ++k) {
         cout << "###################" << endl;
         if (N > 1)
             cout << "#test " << (k + 1) << " of " << N << endl;
         cout << "#wall clock (comp mis, decomp mis, bits per int)" << endl;
+        if (counters)
+            cout << "#then for comp and decomp: " << PerfCounts::header() << endl;
         cout << "#" << endl;
         for (auto i = v.begin(); i != v.end(); ++i) {
             cout << prefix << std::setprecision(4) << i->name(40) << " \t "
                     << i->compspeed.at(k) << " \t " << i->decompspeed.at(k)
-                    << " \t " << i->bitsperint.at(k) << endl;
+                    << " \t " << i->bitsperint.at(k);
+            summarizeCounters(*i, k);
+            cout << endl;
         }
         cout << prefix << endl << prefix << endl;
     }
+if (counters && (N == 0))
+    cout << "# then for comp and decomp: " << PerfCounts::header() << endl;
 for(algostats a : v) {
     if( (a.comptime != 0) and (a.decomptime !=0) and (a.input != 0)) {
         cout << " " << std::setprecision(4) << a.name(40) << " \t "
         << a.input / a.comptime << " \t " << a.input / a.decomptime << " \t "
-        << a.output * 32 / a.input << endl;
+        << a.output * 32 / a.input;
+        summarizeCounters(a, 0);
+        cout << endl;
     }
 }
+summarizeLatencies(v, prefix);
 }
 
 /**
@@ -111,11 +170,14 @@ struct processparameters {
     bool displayhistogram;
     bool computeentropy;
     bool cumulative;
+    bool perfcounters;// also collect hardware counters (see PerfCounters)
+    bool latencies;// also time the decoding of each array (see LatencyHistogram)
 
     processparameters(bool ndelta, bool fdisplay, bool dhisto,
-            bool compentropy, bool cumul) :
+            bool compentropy, bool cumul, bool perf = false, bool lat = false) :
         needtodelta(ndelta), fulldisplay(fdisplay), displayhistogram(dhisto),
-                computeentropy(compentropy), cumulative(cumul) {
+                computeentropy(compentropy), cumulative(cumul), perfcounters(perf),
+                latencies(lat) {
     }
 };
 /**
@@ -128,19 +190,29 @@ class Delta {
 public:
 
     /**
-     * This modifies the input.
+     * This modifies the input (unless the codec does the delta coding
+     * itself, see IntegerCODEC::codesDeltas).
      */
     static void encode(IntegerCODEC & c, bool SIMDmode, uint32_t *in,
             const size_t length, uint32_t * out, size_t &nvalue) {
-        assert(!needPaddingTo128Bits(in));
-        if (SIMDmode)
-            deltaSIMD(in, length);
-        else
-            delta(in, length);
-        assert(!needPaddingTo128Bits(out));
+        if (!c.codesDeltas()) {
+            if (SIMDmode)
+                deltaSIMD(in, length);
+            else
+                delta(in, length);
+        }
         c.encodeArray(in, length , out , nvalue);
     }
 
+    /**
+     * Same as above, but does not modify the input: the codec
+     * computes the deltas as it goes (see IntegerCODEC::encodeDeltaArray).
+     */
+    static void encode(IntegerCODEC & c, bool SIMDmode, const uint32_t *in,
+            const size_t length, uint32_t * out, size_t &nvalue) {
+        c.encodeDeltaArray(in, length, out, nvalue, SIMDmode);
+    }
+
     //  by D. Lemire
     template<class T>
     static void delta(T * data, const size_t size) {
@@ -171,10 +243,10 @@ public:
 #endif 
         __m128i* pCurr = reinterpret_cast<__m128i*>(pData) + Qty4 - 1;
         const __m128i* pStart = reinterpret_cast<__m128i*>(pData);
-        __m128i a = _mm_load_si128(pCurr);
+        __m128i a = _mm_loadu_si128(pCurr);
         while (pCurr > pStart) {
-            register __m128i b = _mm_load_si128(pCurr - 1);
-            _mm_store_si128(pCurr-- , _mm_sub_epi32(a, b));
+            register __m128i b = _mm_loadu_si128(pCurr - 1);
+            _mm_storeu_si128(pCurr-- , _mm_sub_epi32(a, b));
             a = b;
         }
      }
@@ -192,11 +264,11 @@ public:
 
          __m128i* pCurr = reinterpret_cast<__m128i*>(pData);
          const __m128i* pEnd = pCurr + Qty4;
-         __m128i a = _mm_load_si128(pCurr++);
+         __m128i a = _mm_loadu_si128(pCurr++);
          while (pCurr < pEnd) {
-             __m128i b = _mm_load_si128(pCurr);
+             __m128i b = _mm_loadu_si128(pCurr);
              a = _mm_add_epi32(a, b);
-             _mm_store_si128(pCurr++ , a);
+             _mm_storeu_si128(pCurr++ , a);
          }
 
          for (size_t i = Qty4 * 4; i < TotalQty; ++i) {
@@ -242,12 +314,182 @@ public:
         }
     }
 
+    /**
+     * The 64-bit versions. The SIMD deltas have a gap of 2 (a 128-bit
+     * register holds two 64-bit integers) and fastinverseDelta computes
+     * the prefix sum two integers at a time.
+     */
+    static void deltaSIMD(uint64_t * pData, const size_t TotalQty) {
+        if (TotalQty < 3) {
+            delta(pData, TotalQty); // no need for SIMD
+            return;
+        }
+        const size_t Qty2 = TotalQty / 2;
+        if (TotalQty > 2 * Qty2)
+            pData[TotalQty - 1] -= pData[TotalQty - 3];
+        __m128i * pCurr = reinterpret_cast<__m128i *>(pData) + Qty2 - 1;
+        const __m128i * pStart = reinterpret_cast<__m128i *>(pData);
+        __m128i a = _mm_loadu_si128(pCurr);
+        while (pCurr > pStart) {
+            const __m128i b = _mm_loadu_si128(pCurr - 1);
+            _mm_storeu_si128(pCurr--, _mm_sub_epi64(a, b));
+            a = b;
+        }
+    }
+
+    static void inverseDeltaSIMD(uint64_t * pData, const size_t TotalQty) {
+        if (TotalQty < 3) {
+            inverseDelta(pData, TotalQty); // no SIMD
+            return;
+        }
+        const size_t Qty2 = TotalQty / 2;
+        __m128i * pCurr = reinterpret_cast<__m128i *>(pData);
+        const __m128i * pEnd = pCurr + Qty2;
+        __m128i a = _mm_loadu_si128(pCurr++);
+        while (pCurr < pEnd) {
+            a = _mm_add_epi64(a, _mm_loadu_si128(pCurr));
+            _mm_storeu_si128(pCurr++, a);
+        }
+        if (TotalQty > 2 * Qty2)
+            pData[TotalQty - 1] += pData[TotalQty - 3];
+    }
+
+    static void fastinverseDelta(uint64_t * data, const size_t size) {
+        __m128i carry = _mm_setzero_si128();// the last sum, in both lanes
+        size_t i = 0;
+        for (; i + 2 <= size; i += 2) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i *>(data + i));
+            v = _mm_add_epi64(v, _mm_slli_si128(v, 8));
+            v = _mm_add_epi64(v, carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), v);
+            carry = _mm_shuffle_epi32(v, 0xEE);
+        }
+        if ((i < size) && (i > 0))
+            data[i] += data[i - 1];
+    }
+
+    /**
+     * Zigzag deltas, for arrays that go up and down (or signed integers):
+     * the deltas are computed as with delta (or deltaSIMD, with a gap of 4)
+     * and then mapped to (d << 1) ^ (d >> 31) (d being signed), so that
+     * small negative deltas become small integers (-1 -> 1, 1 -> 2, ...)
+     * instead of wrapping around near 2^32. Any other codec can compress
+     * the result. Unlike deltaSIMD, the SIMD versions do not require
+     * alignment.
+     */
+    static uint32_t zigzag(const uint32_t d) {
+        return (d << 1) ^ static_cast<uint32_t> (static_cast<int32_t> (d) >> 31);
+    }
+    static uint32_t inverseZigzag(const uint32_t z) {
+        return (z >> 1) ^ (0 - (z & 1));
+    }
+
+    static void zigzagDelta(uint32_t * data, const size_t size) {
+        if (size == 0)
+            return;
+        for (size_t i = size - 1; i > 0; --i) {
+            data[i] = zigzag(data[i] - data[i - 1]);
+        }
+        data[0] = zigzag(data[0]);
+    }
+
+    static void inverseZigzagDelta(uint32_t * data, const size_t size) {
+        if (size == 0)
+            return;
+        data[0] = inverseZigzag(data[0]);
+        for (size_t i = 1; i < size; ++i) {
+            data[i] = inverseZigzag(data[i]) + data[i - 1];
+        }
+    }
+
+    static void zigzagDeltaSIMD(uint32_t * pData, const size_t TotalQty) {
+        if (TotalQty < 5) {
+            zigzagDelta(pData, TotalQty); // no need for SIMD
+            return;
+        }
+        const size_t Qty4 = TotalQty / 4;
+        for (size_t i = TotalQty; i-- > 4 * Qty4;) {
+            pData[i] = zigzag(pData[i] - pData[i - 4]);
+        }
+        __m128i * pCurr = reinterpret_cast<__m128i *>(pData) + Qty4 - 1;
+        const __m128i * pStart = reinterpret_cast<__m128i *>(pData);
+        __m128i a = _mm_loadu_si128(pCurr);
+        while (pCurr > pStart) {
+            const __m128i b = _mm_loadu_si128(pCurr - 1);
+            const __m128i d = _mm_sub_epi32(a, b);
+            _mm_storeu_si128(pCurr--, _mm_xor_si128(_mm_slli_epi32(d, 1),
+                    _mm_srai_epi32(d, 31)));
+            a = b;
+        }
+        _mm_storeu_si128(pCurr, _mm_xor_si128(_mm_slli_epi32(a, 1),
+                _mm_srai_epi32(a, 31)));
+    }
+
+    static void inverseZigzagDeltaSIMD(uint32_t * pData, const size_t TotalQty) {
+        if (TotalQty < 5) {
+            inverseZigzagDelta(pData, TotalQty);// no SIMD
+            return;
+        }
+        const size_t Qty4 = TotalQty / 4;
+        const __m128i one = _mm_set1_epi32(1);
+        __m128i * pCurr = reinterpret_cast<__m128i *>(pData);
+        const __m128i * pEnd = pCurr + Qty4;
+        __m128i a = _mm_setzero_si128();
+        while (pCurr < pEnd) {
+            const __m128i z = _mm_loadu_si128(pCurr);
+            const __m128i d = _mm_xor_si128(_mm_srli_epi32(z, 1),
+                    _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(z, one)));
+            a = _mm_add_epi32(a, d);
+            _mm_storeu_si128(pCurr++, a);
+        }
+        for (size_t i = Qty4 * 4; i < TotalQty; ++i) {
+            pData[i] = inverseZigzag(pData[i]) + pData[i - 4];
+        }
+    }
+
+    // signed integers: same bits as the unsigned versions (two's complement)
+    static void zigzagDelta(int32_t * data, const size_t size) {
+        zigzagDelta(reinterpret_cast<uint32_t *> (data), size);
+    }
+    static void inverseZigzagDelta(int32_t * data, const size_t size) {
+        inverseZigzagDelta(reinterpret_cast<uint32_t *> (data), size);
+    }
+    static void zigzagDeltaSIMD(int32_t * data, const size_t size) {
+        zigzagDeltaSIMD(reinterpret_cast<uint32_t *> (data), size);
+    }
+    static void inverseZigzagDeltaSIMD(int32_t * data, const size_t size) {
+        inverseZigzagDeltaSIMD(reinterpret_cast<uint32_t *> (data), size);
+    }
+
+    /**
+     * As encode and decode, with zigzag deltas: the arrays need not be
+     * sorted. This modifies the input.
+     */
+    static void encodeZigZag(IntegerCODEC & c, bool SIMDmode, uint32_t *in,
+            const size_t length, uint32_t * out, size_t &nvalue) {
+        if (SIMDmode)
+            zigzagDeltaSIMD(in, length);
+        else
+            zigzagDelta(in, length);
+        c.encodeArray(in, length, out, nvalue);
+    }
+
+    static const uint32_t * decodeZigZag(IntegerCODEC & c, const bool SIMDmode,
+            const uint32_t *in, const size_t length, uint32_t *out, size_t & nvalue) {
+        const uint32_t * finalin = c.decodeArray(in, length, out, nvalue);
+        if (SIMDmode)
+            inverseZigzagDeltaSIMD(out, nvalue);
+        else
+            inverseZigzagDelta(out, nvalue);
+        return finalin;
+    }
+
     static const uint32_t * decode(IntegerCODEC & c, const bool SIMDmode, const uint32_t *in,
             const size_t length, uint32_t *out, size_t & nvalue) {
-        assert(!needPaddingTo128Bits(in));
-        assert(!needPaddingTo128Bits(out));
         const uint32_t * finalin = c.decodeArray(in , length , out,
                 nvalue);
+        if(c.codesDeltas())
+            return finalin;
         if(SIMDmode)
             inverseDeltaSIMD(out, nvalue);
         else
@@ -265,19 +507,21 @@ public:
         // pp.needtodelta = false;
         enum {verbose = false};
         if(datas.empty() or myalgos.empty()) return;
+        bool zigzagdeltas = false;// deltas of unsorted arrays
         if(pp.needtodelta) {
             if(verbose) cout<<"# delta coding requested... checking whether we have sorted arrays...";
-            for(auto x : datas) {
-                if(x.size() > 0)
-                    for (size_t k = 1; k < x.size(); ++k) {
-                        if(x[k]<x[k-1]) {
-                            cerr<<"Delta coding requested, but data is not sorted!"<<endl;
-                            cerr<<"Aborting!"<<endl;
-                            return;
-                        }
-                     }
+            for(auto & x : datas) {
+                if(zigzagdeltas) break;
+                for (size_t k = 1; k < x.size(); ++k) {
+                    if(x[k]<x[k-1]) {
+                        zigzagdeltas = true;
+                        break;
+                    }
+                }
             }
-            if(verbose) cout<<" arrays are indeed sorted. Good."<<endl;
+            if(zigzagdeltas)
+                cout<<"# delta coding requested, but data is not sorted: using zigzag deltas."<<endl;
+            else if(verbose) cout<<" arrays are indeed sorted. Good."<<endl;
         } else {
             if(verbose) cout<<"# compressing the arrays themselves, no delta coding applied."<<endl;
             // we check whether it could have been applied...
@@ -323,31 +567,40 @@ public:
             cout
                     << "# for each scheme we give compression speed (million int./s)"
                         " decompression speed and bits per integer" << endl;
-        EntropyRecorder er;
+        // the sketch takes a few megabytes: only if we need it
+        unique_ptr<EntropySketch> er(pp.computeentropy ? new EntropySketch() : NULL);
         if(pp.computeentropy) {
              for (uint k = 0; k < datas.size(); ++k)
-               if(!datas[k].empty()) er.eat(&datas[k][0], datas[k].size());
-             if (pp.fulldisplay)    cout << "# generated " << er.totallength << " integers" << endl;
+               if(!datas[k].empty()) er->eat(&datas[k][0], datas[k].size());
+             if (pp.fulldisplay)    cout << "# generated " << er->totallength << " integers" << endl;
+             if (pp.fulldisplay and (er->samplingLevel() > 0))
+                 cout << "# entropy estimated (sketch), standard error "
+                         << er->shannonStandardError() << endl;
         }
         if (pp.fulldisplay)cout  << prefix << "\t";
         if(pp.computeentropy and pp.fulldisplay)
-            cout << std::setprecision(4) << er.computeShannon() << "\t";
+            cout << std::setprecision(4) << er->computeShannon() << "\t";
         if (pp.computeentropy and pp.fulldisplay)
-            cout << std::setprecision(4) << er.computeDataBits() << "\t";
+            cout << std::setprecision(4) << er->computeDataBits() << "\t";
         WallClockTimer z;
         size_t totallength = 0;
         size_t maxlength = 0;
         vector<container > outs(datas.size());
         for (size_t k = 0; k < datas.size(); ++k) {
                 auto & data = datas[k];
-                outs[k].resize(4*data.size() + 2048 + 64);
+                size_t room = 0;
+                for (auto i = myalgos.begin(); i != myalgos.end(); ++i)
+                    room = max(room, i->algo->maxCompressedWords(data.size()));
+                outs[k].resize(room);
                 totallength += data.size();
                 if(maxlength < data.size()) maxlength = data.size();
         }
         vector<size_t> nvalues(datas.size());
         container recovereds(maxlength + 2048 + 64);
-        container backupdata;
-        backupdata.reserve(maxlength + 2048 + 64);
+        container scratch(zigzagdeltas ? maxlength : 0);// zigzag deltas are computed in place
+        unique_ptr<PerfCounters> perf(pp.perfcounters ? new PerfCounters() : NULL);
+        if (perf && !perf->available())
+            cout << "# hardware counters are not available (perf_event_open), they will be zero" << endl;
         for (auto i = myalgos.begin(); i != myalgos.end(); ++i) {
             IntegerCODEC & c = *(i->algo);
             const bool SIMDDeltas = i->SIMDDeltas;
@@ -355,6 +608,7 @@ public:
             size_t totalcompressed = 0;
             double timemsdecomp = 0;
             double timemscomp = 0;
+            PerfCounts compcounts, decompcounts;
             for (size_t k = 0; k < datas.size(); ++k) {
                 if(datas[k].empty()) continue;
                 uint32_t * outp = &outs[k][0];
@@ -364,14 +618,22 @@ public:
                 const size_t orignvalue = nvalue;
                 {
                     nvalue = orignvalue;
-                    backupdata.assign(datas[k].begin(),datas[k].end()); // making a copy to be safe
+                    const uint32_t * const data = &datas[k][0];
+                    if (zigzagdeltas)
+                        copy(datas[k].begin(), datas[k].end(), scratch.begin());
+                    if (perf)
+                        perf->start();
                     z.reset();
-                    if (pp.needtodelta) {
-                        encode(c,SIMDDeltas,&backupdata[0],backupdata.size(),outp,nvalue);
+                    if (zigzagdeltas) {
+                        encodeZigZag(c,SIMDDeltas,&scratch[0],datas[k].size(),outp,nvalue);
+                    } else if (pp.needtodelta) {
+                        encode(c,SIMDDeltas,data,datas[k].size(),outp,nvalue);
                     } else {
-                        c.encodeArray(&backupdata[0], backupdata.size(), outp, nvalue);
+                        c.encodeArray(data, datas[k].size(), outp, nvalue);
                     }
                     elapsedcomp += z.split();
+                    if (perf)
+                        perf->stop(compcounts, datas[k].size());
                     nvalues[k] = nvalue;
                 }
                 timemscomp += elapsedcomp;
@@ -384,16 +646,30 @@ public:
                 assert(recoveredsize > 0);
                 uint32_t * recov = &recovereds[0];
                 assert(!needPaddingTo128Bits(recov));
+                if (perf)
+                    perf->start();
                 z.reset();
+                // as CPUBenchmark, but only when asked (cpuid is not free)
+                const unsigned long long startcycles = pp.latencies ? startRDTSC() : 0;
                 {
-                  if  (pp.needtodelta) {
+                  if  (zigzagdeltas) {
+                        decodeZigZag(c,SIMDDeltas,outp,nvalue,recov,recoveredsize);
+                  } else if  (pp.needtodelta) {
                         decode(c,SIMDDeltas,outp,nvalue,recov,recoveredsize);
                    } else {
                         c.decodeArray(outp, nvalue,
                                 recov, recoveredsize);
                   }
                 }
+                const unsigned long long latency = pp.latencies ? stopRDTSCP() - startcycles : 0;
                 const uint64_t elapseddecomp = z.split();
+                if (pp.latencies) {
+                    if (i->decomplatency.empty())
+                        i->decomplatency.resize(33);
+                    i->decomplatency[gccbits(static_cast<uint32_t> (datas[k].size()))].add(latency);
+                }
+                if (perf)
+                    perf->stop(decompcounts, datas[k].size());
                 timemsdecomp += elapseddecomp;
                 if(recoveredsize!= datas[k].size()) {
                     cerr<<" expected size of "<<datas[k].size()<<" got "<<recoveredsize<<endl;
@@ -404,6 +680,14 @@ public:
                 }
 
             }
+            if (perf) {
+                if (!pp.cumulative || i->compcounts.empty()) {
+                    i->compcounts.push_back(PerfCounts());
+                    i->decompcounts.push_back(PerfCounts());
+                }
+                i->compcounts.back() += compcounts;
+                i->decompcounts.back() += decompcounts;
+            }
             if(pp.cumulative)
                 i->comptime += timemscomp;
             else
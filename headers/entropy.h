@@ -63,6 +63,221 @@ public:
 
 
 
+/**
+ * Estimates what EntropyRecorder computes (Shannon entropy and data bits of
+ * the values) in bounded memory, so that it can be left on when profiling
+ * large inputs.
+ *
+ *    - The values below 2^16 are counted exactly, in dense counters (four
+ *      interleaved copies, so that runs of the same value do not wait on
+ *      the same counter).
+ *    - The larger values are sampled by hashing (adaptive distinct
+ *      sampling): we keep the values whose hash value starts with "level"
+ *      zero bits, and we count every occurrence of these values exactly.
+ *      When more than Capacity values are kept, we increase the level and
+ *      drop half of them. The contribution of the large values to the
+ *      entropy is the sum over the sample, times 2^level: the estimator is
+ *      unbiased and shannonStandardError() estimates its standard error.
+ *
+ * If there are fewer than Capacity distinct large values, the level stays
+ * at 0 and the results are those of EntropyRecorder. computeDataBits() is
+ * always exact (we keep the histogram of the bit widths).
+ */
+class EntropySketch {
+public:
+    enum {
+        SmallValues = 1U << 16, Capacity = 1U << 16
+    };
+
+    EntropySketch() :
+        lanes(4 * SmallValues), pending(0), smallcounts(SmallValues), keys(2 * Capacity),
+                counts(2 * Capacity), sampled(0), level(0), bitwidths(33), totallength(0) {
+    }
+
+    void clear() {
+        fill(lanes.begin(), lanes.end(), 0);
+        pending = 0;
+        fill(smallcounts.begin(), smallcounts.end(), 0);
+        fill(keys.begin(), keys.end(), 0);
+        fill(counts.begin(), counts.end(), 0);
+        sampled = 0;
+        level = 0;
+        fill(bitwidths.begin(), bitwidths.end(), 0);
+        totallength = 0;
+    }
+
+    void eat(const uint32_t * in, const size_t length) {
+        totallength += length;
+        for (size_t start = 0; start < length; start += MaxPending) {
+            const size_t end = min<size_t> (length, start + MaxPending);
+            if (pending + (end - start) > MaxPending)
+                flush();
+            pending += end - start;
+            uint32_t * const l = lanes.data();
+            size_t k = start;
+            for (; k + 4 <= end; k += 4) {
+                const uint32_t a = in[k], b = in[k + 1], c = in[k + 2], d = in[k + 3];
+                if (((a | b | c | d) >> 16) == 0) {
+                    ++l[a];
+                    ++l[SmallValues + b];
+                    ++l[2 * SmallValues + c];
+                    ++l[3 * SmallValues + d];
+                } else {
+                    eatOne(a);
+                    eatOne(b);
+                    eatOne(c);
+                    eatOne(d);
+                }
+            }
+            for (; k < end; ++k)
+                eatOne(in[k]);
+        }
+    }
+
+    double computeShannon() {
+        flush();
+        double total = 0;
+        for (uint32_t v = 0; v < SmallValues; ++v)
+            total += term(smallcounts[v]);
+        double largetotal = 0;
+        for (size_t s = 0; s < keys.size(); ++s)
+            if (keys[s] != 0)
+                largetotal += term(counts[s]);
+        return total + ldexp(largetotal, level);
+    }
+
+    /**
+     * Estimated standard error of computeShannon(): 0 with no sampling
+     * (level 0), else the square root of (1 - p) / p^2 times the sum of
+     * the squares of the terms of the sampled values, where p = 2^-level.
+     */
+    double shannonStandardError() {
+        if (level == 0)
+            return 0;
+        double sumofsquares = 0;
+        for (size_t s = 0; s < keys.size(); ++s)
+            if (keys[s] != 0)
+                sumofsquares += term(counts[s]) * term(counts[s]);
+        const double p = ldexp(1.0, -static_cast<int> (level));
+        return sqrt((1 - p) / (p * p) * sumofsquares);
+    }
+
+    double computeDataBits() {
+        if (totallength == 0)
+            return 0;
+        flush();
+        double total = 0;
+        for (uint32_t b = 0; b < bitwidths.size(); ++b)
+            total += static_cast<double> (bitwidths[b]) * b;
+        return total / totallength;
+    }
+
+    // estimated number of distinct values (exact at level 0)
+    double distinctValues() {
+        flush();
+        size_t small = 0;
+        for (uint32_t v = 0; v < SmallValues; ++v)
+            small += smallcounts[v] != 0;
+        return static_cast<double> (small) + ldexp(static_cast<double> (sampled), level);
+    }
+
+    // the large values are sampled with probability 2^-level
+    uint32_t samplingLevel() const {
+        return level;
+    }
+
+private:
+    enum {
+        MaxPending = 1U << 30// at most that many increments of a lane between two flushes
+    };
+
+    double term(const uint64_t count) const {
+        if (count == 0)
+            return 0;
+        const double x = static_cast<double> (count);
+        return x / totallength * log2(totallength / x);
+    }
+
+    // the hash value of a large value: we sample on the top bits, the slot
+    // is given by the bits below
+    static uint64_t hash(const uint32_t v) {
+        return v * 0x9E3779B97F4A7C15ULL;
+    }
+    bool kept(const uint64_t h) const {
+        return (level == 0) || ((h >> (64 - level)) == 0);
+    }
+
+    void eatOne(const uint32_t v) {
+        if (v < SmallValues) {
+            ++lanes[v];
+            return;
+        }
+        ++bitwidths[gccbits(v)];
+        const uint64_t h = hash(v);
+        if (!kept(h))
+            return;
+        const size_t mask = keys.size() - 1;
+        size_t s = static_cast<size_t> (h >> 16) & mask;
+        while ((keys[s] != 0) && (keys[s] != v))
+            s = (s + 1) & mask;
+        if (keys[s] == 0) {
+            keys[s] = v;
+            ++sampled;
+        }
+        ++counts[s];
+        if (sampled > Capacity)
+            raiseLevel();
+    }
+
+    // halves the sampling rate, dropping the values that no longer qualify
+    void raiseLevel() {
+        vector < uint32_t > oldkeys(keys.size());
+        vector < uint64_t > oldcounts(counts.size());
+        keys.swap(oldkeys);
+        counts.swap(oldcounts);
+        ++level;
+        sampled = 0;
+        const size_t mask = keys.size() - 1;
+        for (size_t i = 0; i < oldkeys.size(); ++i) {
+            if ((oldkeys[i] == 0) || !kept(hash(oldkeys[i])))
+                continue;
+            size_t s = static_cast<size_t> (hash(oldkeys[i]) >> 16) & mask;
+            while (keys[s] != 0)
+                s = (s + 1) & mask;
+            keys[s] = oldkeys[i];
+            counts[s] = oldcounts[i];
+            ++sampled;
+        }
+    }
+
+    // adds the lanes to the small counts
+    void flush() {
+        for (uint32_t v = 0; v < SmallValues; ++v) {
+            const uint64_t c = static_cast<uint64_t> (lanes[v]) + lanes[SmallValues + v]
+                    + lanes[2 * SmallValues + v] + lanes[3 * SmallValues + v];
+            if (c == 0)
+                continue;
+            smallcounts[v] += c;
+            bitwidths[gccbits(v)] += c;
+        }
+        fill(lanes.begin(), lanes.end(), 0);
+        pending = 0;
+    }
+
+    vector<uint32_t> lanes;// 4 counters per small value
+    size_t pending;// increments since the last flush
+    vector<uint64_t> smallcounts;
+    vector<uint32_t> keys;// sampled large values (0 is an empty slot)
+    vector<uint64_t> counts;
+    size_t sampled;
+    uint32_t level;
+    vector<uint64_t> bitwidths;// number of values by bit width
+
+public:
+    size_t totallength;
+};
+
+
 /**
  * An entropic measure,
  * Index compression using 64-bit words by Vo Ngoc Anh and Alistair Moffat
@@ -8,6 +8,12 @@
 #ifndef EXTERNALVECTOR_H_
 #define EXTERNALVECTOR_H_
 #include "common.h"
+#include "util.h"
+#include "compositecodec.h"
+#include "fastpfor.h"
+#include "variablebyte.h"
+#include <future>
+#include <unistd.h>
 using namespace std;
 
 template<class CMP>
@@ -97,7 +103,7 @@ public:
         localpointer = 0;
     }
 
-    void hasMore() {
+    bool hasMore() {
         return valid;
     }
     bool empty() {
@@ -127,6 +133,154 @@ private:
 
 };
 
+/**
+ * Tournament tree of losers, to merge k sorted sources: each internal
+ * node keeps the source that lost there, and the root (top()) the overall
+ * winner. After the winner moves to its next element, replay() finds the
+ * new winner with one comparison per level (log2(k)), where a heap needs
+ * about twice as many.
+ *
+ * beats(a, b) must say whether source a goes before source b (the sources
+ * that are done go last).
+ */
+template<class Beats>
+class LoserTree {
+public:
+    LoserTree(size_t k, Beats b) :
+        K(k), tree(max<size_t> (1, k)), beats(b) {
+        if (K == 0)
+            return;
+        vector<size_t> winners(2 * K);
+        for (size_t i = 0; i < K; ++i)
+            winners[K + i] = i;
+        for (size_t node = K - 1; node > 0; --node) {
+            const size_t x = winners[2 * node], y = winners[2 * node + 1];
+            const bool xwins = beats(x, y);
+            winners[node] = xwins ? x : y;
+            tree[node] = xwins ? y : x;
+        }
+        tree[0] = winners[K == 1 ? K : 1];
+    }
+
+    size_t top() const {
+        return tree[0];
+    }
+
+    // call when the winner has moved to its next element
+    void replay() {
+        size_t winner = tree[0];
+        for (size_t node = (winner + K) / 2; node > 0; node /= 2)
+            if (beats(tree[node], winner))
+                std::swap(tree[node], winner);
+        tree[0] = winner;
+    }
+
+private:
+    size_t K;
+    vector<size_t> tree;
+    Beats beats;
+};
+
+/**
+ * A piece of a sorted run of externalvector::sort in the run file: where
+ * it starts, its size in bytes and its number of rows.
+ */
+struct RunChunk {
+    off_t offset;
+    size_t bytes;
+    size_t rows;
+};
+
+/**
+ * Reads a sorted run one chunk at a time; the next chunk is read (and
+ * decompressed) by another thread while we consume this one. The run file
+ * is read with pread, so that the readers of all runs can share it.
+ */
+class SortedRunReader {
+public:
+    typedef uint32_t Type;
+    typedef vector<Type> DataType;
+
+    SortedRunReader(int f, const vector<RunChunk> & c, size_t datasize, bool comp) :
+        fd(f), chunks(c), sizeofdata(datasize), compressed(comp), rows(),
+                current(0), nextchunk(0), next() {
+        advance();
+    }
+
+    bool empty() const {
+        return current >= rows.size();
+    }
+
+    const DataType & peek() const {
+        return rows[current];
+    }
+
+    void pop() {
+        if (++current == rows.size())
+            advance();
+    }
+
+    // the chunk format is that of externalvector::writeChunk
+    static vector<DataType> load(int fd, const RunChunk & chunk, size_t sizeofdata,
+            bool compressed) {
+        vector<Type> words((chunk.bytes + sizeof(Type) - 1) / sizeof(Type) + 1);
+        char * const bytes = reinterpret_cast<char *> (&words[0]);
+        for (size_t done = 0; done < chunk.bytes;) {
+            const ssize_t r = ::pread(fd, bytes + done, chunk.bytes - done,
+                    chunk.offset + static_cast<off_t> (done));
+            if (r <= 0)
+                throw runtime_error("failed to read a sorted run");
+            done += static_cast<size_t> (r);
+        }
+        vector<DataType> answer(chunk.rows, DataType(sizeofdata));
+        if (!compressed) {
+            for (size_t r = 0; r < chunk.rows; ++r)
+                memcpy(&answer[r][0], &words[r * sizeofdata], sizeofdata * sizeof(Type));
+            return answer;
+        }
+        CompositeCodec<FastPFor, VariableByte> codec;
+        vector<Type> column(chunk.rows);
+        const Type * in = &words[0];
+        for (size_t c = 0; c < sizeofdata; ++c) {
+            const size_t nvalue = *in++;
+            size_t howmany = column.size();
+            codec.decodeArray(in, nvalue, &column[0], howmany);
+            if (howmany != chunk.rows)
+                throw runtime_error("corrupted sorted run");
+            in += nvalue;
+            for (size_t r = 0; r < chunk.rows; ++r)
+                answer[r][c] = column[r];
+        }
+        return answer;
+    }
+
+private:
+    void advance() {
+        current = 0;
+        if (next.valid())
+            rows = next.get();
+        else if (nextchunk < chunks.size())
+            rows = load(fd, chunks[nextchunk++], sizeofdata, compressed);
+        else
+            rows.clear();
+        if (nextchunk < chunks.size())
+            next = async(launch::async, load, fd, chunks[nextchunk++], sizeofdata,
+                    compressed);
+    }
+
+    int fd;
+    vector<RunChunk> chunks;
+    size_t sizeofdata;
+    bool compressed;
+    vector<DataType> rows;
+    size_t current;
+    size_t nextchunk;
+    future<vector<DataType> > next;
+
+    SortedRunReader(const SortedRunReader &);
+    SortedRunReader & operator=(const SortedRunReader &);
+};
+
 class externalvector {
 
 public:
@@ -204,80 +358,55 @@ public:
 
     }
 
+    /**
+     * External merge sort: the blocks of BLOCKSIZE rows are sorted on
+     * several threads (by default, as many as there are cores) and written
+     * to a temporary file as sorted runs, which we then merge back into
+     * this file with a LoserTree. Each run is read ahead by chunks, with
+     * BLOCKSIZE rows of buffers overall. The sort is stable.
+     *
+     * With compressruns, the chunks of the runs are stored column by column
+     * with FastPFor, which saves I/O when the values are small.
+     */
     template<class CMP>
-    void sort(CMP & comparator, const size_t BLOCKSIZE = DEFAULTBLOCKSIZE) {
-        priority_queue<BinaryFileBuffer<CMP> , vector<BinaryFileBuffer<CMP> > ,
-                greater<BinaryFileBuffer<CMP> > > pq;
-
+    void sort(CMP & comparator, const size_t BLOCKSIZE = DEFAULTBLOCKSIZE,
+            const uint32_t threads = 0, const bool compressruns = false) {
         const size_t howmanybuffers = N / BLOCKSIZE + (N % BLOCKSIZE == 0 ? 0
                 : 1);
-
-        vector < vector<DataType> > buffers(howmanybuffers);
-        size_t buffercounter = 0;
-
         vector<DataType> buffer;
-        buffer.reserve(BLOCKSIZE);
-        for (size_t rowindex = 0; rowindex < size(); rowindex += BLOCKSIZE) {
-
-            size_t end = size();
-            if (rowindex + BLOCKSIZE < size())
-                end = rowindex + BLOCKSIZE;
-            loadACopy(buffer, rowindex, end);
-            std::sort(buffer.begin(), buffer.end(), comparator);
-            copyAt(buffer, rowindex);
-            BinaryFileBuffer<CMP> bfb(fd, rowindex, end, comparator,
-                    buffers[buffercounter++], sizeofdata);
-
-            pq.push(bfb);
+        buffer.reserve(min(N, BLOCKSIZE));
+        if (howmanybuffers <= 1) {
+            loadACopy(buffer, 0, N);
+            parallelSort(buffer, comparator, threads);
+            copyAt(buffer, 0);
+            return;
         }
-        if (buffercounter != buffers.size())
-            throw runtime_error("This should never happen.");
-        if (howmanybuffers == 1)
-            return;// we are done
-        // we must merge which requires a new file
-        FILE * newfd = ::tmpfile();
-        if (newfd == NULL) {
+        FILE * runfd = ::tmpfile();
+        if (runfd == NULL) {
             throw runtime_error("could not open temp file");
         }
-
-        DataType container;
-        const bool bfbparanoid = false;
-        DataType lastentry;
-        bool first = true;
-
-        size_t counter = 0;
-        BinaryFileBuffer<CMP> bfb;
-        while (!pq.empty()) {
-            bfb = pq.top();
-            pq.pop();
-
-            bfb.pop(container);
-            if (bfbparanoid) {
-                if (!first) {
-                    if (comparator(container, lastentry))
-                        cout << " we have a problem at counter = " << counter
-                                << endl;
-                    assert(!comparator(container, lastentry));
-                    lastentry = container;
-                } else {
-                    first = false;
-                    lastentry = container;
-                }
-            }
-
-            size_t result = fwrite(&container[0], sizeof(Type), sizeofdata,
-                    newfd);
-            if (result != sizeofdata) {
-                cerr << "Error appending to the file " << endl;
-                break;
-            }
-            ++counter;
-            if (!bfb.empty()) {
-                pq.push(bfb); // add it back
+        // two chunks per run are in memory at a time
+        const size_t chunkrows = max<size_t> (1, BLOCKSIZE / (2 * howmanybuffers));
+        vector < vector<RunChunk> > runs(howmanybuffers);
+        off_t offset = 0;
+        try {
+            for (size_t r = 0; r < howmanybuffers; ++r) {
+                const size_t begin = r * BLOCKSIZE;
+                loadACopy(buffer, begin, min(N, begin + BLOCKSIZE));
+                parallelSort(buffer, comparator, threads);
+                for (size_t k = 0; k < buffer.size(); k += chunkrows)
+                    runs[r].push_back(writeChunk(runfd, buffer, k, min(buffer.size(),
+                            k + chunkrows), compressruns, offset));
             }
+            vector<DataType> ().swap(buffer);
+            if (fflush(runfd) != 0)
+                throw runtime_error("could not write the sorted runs");
+            mergeRuns(comparator, fileno(runfd), runs, compressruns);
+        } catch (...) {
+            ::fclose(runfd);
+            throw;
         }
-        ::fclose(fd);
-        fd = newfd;
+        ::fclose(runfd);
     }
 
     bool append(const DataType & d) {
@@ -404,6 +533,117 @@ public:
 
 private:
 
+    /**
+     * Sorts pieces of the buffer on several threads, then merges them in
+     * pairs (also on several threads) until there is one piece left. The
+     * sort is stable. The algorithms get the comparator by reference, as
+     * it may be costly to copy (e.g., Cmp).
+     */
+    template<class CMP>
+    static void parallelSort(vector<DataType> & buffer, CMP & comparator,
+            uint32_t threads) {
+        if (threads == 0)
+            threads = max<uint32_t> (1, thread::hardware_concurrency());
+        const size_t pieces = min<size_t> (threads, max<size_t> (1,
+                buffer.size() / 4096));
+        auto less = [&comparator](const DataType & a, const DataType & b) {
+            return comparator(a, b);
+        };
+        vector<size_t> bounds(pieces + 1);
+        for (size_t p = 0; p <= pieces; ++p)
+            bounds[p] = buffer.size() * p / pieces;
+        parallelFor(pieces, [&](size_t p) {
+            std::stable_sort(buffer.begin() + bounds[p], buffer.begin() + bounds[p + 1],
+                    less);
+        }, threads);
+        for (size_t width = 1; width < pieces; width *= 2)
+            parallelFor((pieces + 2 * width - 1) / (2 * width), [&](size_t m) {
+                const size_t first = 2 * width * m;
+                if (first + width >= pieces)
+                    return;
+                std::inplace_merge(buffer.begin() + bounds[first], buffer.begin()
+                        + bounds[first + width], buffer.begin() + bounds[min(pieces,
+                        first + 2 * width)], less);
+            }, threads);
+    }
+
+    /**
+     * Appends the rows [begin, end) of the buffer to the run file. A
+     * compressed chunk has, for each column, the number of compressed words
+     * then the words.
+     */
+    RunChunk writeChunk(FILE * runfd, const vector<DataType> & buffer,
+            size_t begin, size_t end, bool compressed, off_t & offset) const {
+        const size_t rows = end - begin;
+        vector<Type> words;
+        if (compressed) {
+            CompositeCodec<FastPFor, VariableByte> codec;
+            vector<Type> column(rows);
+            for (size_t c = 0; c < sizeofdata; ++c) {
+                for (size_t r = 0; r < rows; ++r)
+                    column[r] = buffer[begin + r][c];
+                const size_t start = words.size();
+                words.resize(start + 1 + codec.maxCompressedWords(rows));
+                size_t nvalue = words.size() - start - 1;
+                codec.encodeArray(&column[0], rows, &words[start + 1], nvalue);
+                words[start] = static_cast<Type> (nvalue);
+                words.resize(start + 1 + nvalue);
+            }
+        } else {
+            words.resize(rows * sizeofdata);
+            for (size_t r = 0; r < rows; ++r)
+                memcpy(&words[r * sizeofdata], &buffer[begin + r][0], sizeofdata
+                        * sizeof(Type));
+        }
+        if (fwrite(&words[0], sizeof(Type), words.size(), runfd) != words.size())
+            throw runtime_error("could not write the sorted runs");
+        const RunChunk answer = { offset, words.size() * sizeof(Type), rows };
+        offset += static_cast<off_t> (answer.bytes);
+        return answer;
+    }
+
+    // merges the sorted runs and writes them over this file
+    template<class CMP>
+    void mergeRuns(CMP & comparator, int runfd, const vector<vector<RunChunk> > & runs,
+            bool compressed) {
+        vector<unique_ptr<SortedRunReader> > readers;
+        for (size_t r = 0; r < runs.size(); ++r)
+            readers.push_back(unique_ptr<SortedRunReader> (new SortedRunReader(runfd,
+                    runs[r], sizeofdata, compressed)));
+        // on ties, the first run wins, so that the sort is stable
+        auto beats = [&](size_t a, size_t b) {
+            if (readers[a]->empty())
+                return false;
+            if (readers[b]->empty())
+                return true;
+            if (comparator(readers[a]->peek(), readers[b]->peek()))
+                return true;
+            if (comparator(readers[b]->peek(), readers[a]->peek()))
+                return false;
+            return a < b;
+        };
+        LoserTree<decltype(beats)> tree(readers.size(), beats);
+        if (fseek(fd, 0, SEEK_SET) != 0)
+            throw runtime_error("bad seek");
+        vector<Type> out;
+        const size_t flushsize = 1 << 18;
+        out.reserve(flushsize + sizeofdata);
+        for (size_t counter = 0; counter < N; ++counter) {
+            SortedRunReader & winner = *readers[tree.top()];
+            if (winner.empty())
+                throw runtime_error("missing rows in the sorted runs");
+            out.insert(out.end(), winner.peek().begin(), winner.peek().end());
+            winner.pop();
+            tree.replay();
+            if ((out.size() >= flushsize) || (counter + 1 == N)) {
+                if (fwrite(&out[0], sizeof(Type), out.size(), fd) != out.size())
+                    throw runtime_error("bad write");
+                out.clear();
+            }
+        }
+        fflush(fd);
+    }
+
     FILE * fd; //file descriptor
     size_t N;
     size_t sizeofdata;
@@ -421,6 +661,9 @@ public:
     Cmp() :
         mIndexes() {
     }
+    Cmp(const Cmp & v) :
+        mIndexes(v.mIndexes) {
+    }
     Cmp& operator=(const Cmp & v) {
         mIndexes = v.mIndexes;
         return *this;
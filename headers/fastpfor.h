@@ -13,6 +13,7 @@
 #include "cpubenchmark.h"
 #include "blockpacking.h"
 #include "simple8b.h"
+#include "patching.h"
 
 /**
  * FastPFor 
@@ -47,7 +48,18 @@ public:
         BlockSize = BlockSizeInUnitsOfPackSize * PACKSIZE
     };
 
-    // sometimes, mem. usage can grow too much, this clears it up
+    /**
+     * The scratch buffers are kept from call to call, so that encoding
+     * and decoding do not allocate once they have warmed up. Sometimes,
+     * mem. usage can grow too much, this clears it up (the buffers of the
+     * instance and the workspace of the calling thread).
+     */
+    void trim() {
+        resetBuffer();
+        threadWorkspace().trim();
+    }
+
+    // frees the encoding buffers of the instance
     void resetBuffer() {
         for (size_t i = 0; i < datatobepacked.size(); ++i) {
             vector<uint32_t> ().swap(datatobepacked[i]);
@@ -64,30 +76,80 @@ public:
     const uint32_t PageSize;
     const uint32_t bitsPageSize;
 
-    vector<vector<uint32_t> > datatobepacked;
+    vector<vector<uint32_t> > datatobepacked;// scratch for encoding
     vector<uint8_t> bytescontainer;
 
+    /**
+     * Scratch space for decoding: the exceptions of a page. The encoder
+     * uses the buffers of the instance instead.
+     */
+    struct Workspace {
+        Workspace() :
+            datatobepacked(33) {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            for (size_t i = 0; i < datatobepacked.size(); ++i)
+                vector<uint32_t> ().swap(datatobepacked[i]);
+        }
+        vector<vector<uint32_t> > datatobepacked;
+    };
+
+    // the workspace used by decodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // thread-safe: it does not modify the instance
     const uint32_t * decodeArray(const uint32_t *in, const size_t length,
             uint32_t *out, size_t &nvalue) {
+        return decodeArray(in, length, out, nvalue, threadWorkspace());
+    }
+
+    /**
+     * Same as decodeArray, but with your own scratch space (e.g., one per
+     * thread, reused from call to call).
+     */
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, Workspace & ws) const {
+        return decodePages(in, length, out, nvalue, ws);
+    }
+
+    /**
+     * Same as decodeArray, but to uint16_t or uint8_t (T): the blocks are
+     * unpacked straight to the narrow type (see fastunpack_narrow), then
+     * patched. Throws logic_error if a block has integers that do not fit
+     * in T (its maxbits is too large).
+     */
+    template<class T>
+    const uint32_t * decodeNarrow(const uint32_t *in, const size_t length,
+            T *out, size_t &nvalue) const {
+        return decodePages(in, length, out, nvalue, threadWorkspace());
+    }
+
+    // decodeArray and decodeNarrow: the pages one after the other
+    template<class T>
+    const uint32_t * decodePages(const uint32_t *in, const size_t length,
+            T *out, size_t &nvalue, Workspace & ws) const {
         const uint32_t * const initin(in);
         const size_t mynvalue = *in;
         ++in;
         if (mynvalue > nvalue)
             throw NotEnoughStorage(mynvalue);
         nvalue = mynvalue;
-        const uint32_t * const finalout(out + nvalue);
+        const T * const finalout(out + nvalue);
         while (out != finalout) {
             size_t thisnvalue(0);
             size_t thissize =
                     static_cast<size_t> (finalout > PageSize + out ? PageSize
                             : (finalout - out));
 
-            __decodeArray(in, thisnvalue, out, thissize);
+            __decodeArray(in, thisnvalue, out, thissize, ws);
             in += thisnvalue;
             out += thissize;
         }
         assert(initin + length >= in);
-        resetBuffer();// if you don't do this, the codec has a "memory".
         return in;
     }
 
@@ -98,7 +160,22 @@ public:
      */
     void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
             size_t &nvalue) {
+        encodeWithGap(in, length, out, nvalue, 0);
+    }
+
+    void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        encodeWithGap(in, length, out, nvalue, deltaGap(SIMDmode, length));
+    }
+
+    /**
+     * If gap > 0, we encode the deltas (see computeDeltas), computing
+     * them one block at a time.
+     */
+    void encodeWithGap(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap) {
         checkifdivisibleby(length, BlockSize);
+        const uint32_t * const initin(in);
         const uint32_t * const initout(out);
         const uint32_t * const finalin(in + length);
 
@@ -110,7 +187,7 @@ public:
                     static_cast<size_t> (finalin > PageSize + in ? PageSize
                             : (finalin - in));
             size_t thisnvalue(0);
-            __encodeArray(in, thissize, out, thisnvalue);
+            __encodeArray(in, thissize, out, thisnvalue, gap, in - initin);
             nvalue += thisnvalue;
             out += thisnvalue;
             in += thissize;
@@ -118,18 +195,13 @@ public:
         assert(out == nvalue + initout);
         if (oldnvalue < nvalue)
             cerr << "It is possible we have a buffer overrun. " << endl;
-        resetBuffer();// if you don't do this, the buffer has a memory
     }
 
 
     void getBestBFromData(const uint32_t * in, uint8_t& bestb,
             uint8_t & bestcexcept, uint8_t & maxb) {
         uint32_t freqs[33];
-        for (uint32_t k = 0; k <= 32; ++k)
-            freqs[k] = 0;
-        for (uint32_t k = 0; k < BlockSize; ++k) {
-            freqs[asmbits(in[k])]++;
-        }
+        bitWidthHistogram(in, BlockSize, freqs);
         bestb = 32;
         while (freqs[bestb] == 0)
             bestb--;
@@ -149,38 +221,48 @@ public:
         }
     }
 
+    /**
+     * Encodes one page. If gap > 0, we encode the deltas, in[0] being
+     * at position "position" in the whole array.
+     */
     void __encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
-            size_t & nvalue) {
+            size_t & nvalue, const uint32_t gap = 0, const size_t position = 0) {
+        const uint32_t * const initin = in;
         uint32_t * const initout = out; // keep track of this
         checkifdivisibleby(length, BlockSize);
         uint32_t * const headerout = out++; // keep track of this
         for (uint32_t k = 0; k < 32 + 1; ++k)
             datatobepacked[k].clear();
         uint8_t * bc = &bytescontainer[0];
+        uint32_t deltas[BlockSize];
         for (const uint32_t * const final = in + length; (in + BlockSize
                 <= final); in += BlockSize) {
+            const uint32_t * block = in;
+            if (gap > 0) {
+                computeDeltas(in, BlockSize, deltas, gap, position + (in - initin));
+                block = deltas;
+            }
             uint8_t bestb, bestcexcept, maxb;
-            getBestBFromData(in, bestb, bestcexcept, maxb);
+            getBestBFromData(block, bestb, bestcexcept, maxb);
+            codeccounters::encodedBlock(bestb, bestcexcept);
             *bc++ = bestb;
             *bc++ = bestcexcept;
             if (bestcexcept > 0) {
                 *bc++ = maxb;
                 vector < uint32_t > &thisexceptioncontainer
                         = datatobepacked[maxb - bestb];
-                const uint32_t maxval = 1U << bestb;
-                for (uint32_t k = 0; k < BlockSize; ++k) {
-                    if (in[k] >= maxval) {
-                        // we have an exception
-                        thisexceptioncontainer.push_back(in[k] >> bestb);
-                        *bc++ = k;
-                    }
-                }
+                const uint32_t cexcept = exceptionPositions(block, BlockSize, bestb, bc);
+                for (uint32_t k = 0; k < cexcept; ++k)
+                    thisexceptioncontainer.push_back(block[bc[k]] >> bestb);
+                bc += cexcept;
             }
-            out = packblockup<BlockSize>(in, out, bestb);
+            out = packblockup<BlockSize>(block, out, bestb);
         }
         headerout[0] = static_cast<uint32_t> (out - headerout);
         const uint32_t bytescontainersize = bc - &bytescontainer[0];
         *(out++) = bytescontainersize;
+        if (bytescontainersize % sizeof(uint32_t) != 0)// the padding bytes are zeros
+            out[bytescontainersize / sizeof(uint32_t)] = 0;
         memcpy(out, &bytescontainer[0], bytescontainersize);
         out += (bytescontainersize + sizeof(uint32_t) - 1)
                 / sizeof(uint32_t);
@@ -197,8 +279,10 @@ public:
         nvalue = out - initout;
     }
 
-    void __decodeArray(const uint32_t *in, size_t & length, uint32_t *out,
-            const size_t nvalue) {
+    template<class T>
+    void __decodeArray(const uint32_t *in, size_t & length, T *out,
+            const size_t nvalue, Workspace & ws) const {
+        vector<vector<uint32_t> > & datatobepacked = ws.datatobepacked;
         const uint32_t * const initin = in;
         const uint32_t * const headerin = in++;
         const uint32_t wheremeta = headerin[0];
@@ -217,27 +301,178 @@ public:
         for (uint32_t k = 1; k <= 32; ++k) {
             unpackpointers[k] = datatobepacked[k].begin();
         }
+        uint64_t patched = 0;
         for (uint32_t run = 0; run < nvalue / BlockSize; ++run, out
                 += BlockSize) {
             const uint8_t b = *bytep++;
             const uint8_t cexcept = *bytep++;
-            in = unpackblock<BlockSize>(in, out, b);
+            const uint8_t maxbits = cexcept > 0 ? *bytep++ : b;
+            if ((sizeof(T) < sizeof(uint32_t)) && (maxbits > narrowBits<T>()))
+                throw logic_error("FastPFor: the integers do not fit in the output type");
+            in = unpackBlockTo(in, out, b);
             if (cexcept > 0) {
-                const uint8_t maxbits = *bytep++;
                 vector<uint32_t>::const_iterator & exceptionsptr =
                         unpackpointers[maxbits - b];
-                for (uint32_t k = 0; k < cexcept; ++k) {
-                    const uint8_t pos = *(bytep++);
-                    out[pos] |= (*(exceptionsptr++)) << b;
-                }
+                patchExceptionsTo(out, bytep, &*exceptionsptr, cexcept, b);
+                bytep += cexcept;
+                exceptionsptr += cexcept;
+                patched += cexcept;
             }
         }
+        codeccounters::decodedBlocks(nvalue / BlockSize, patched);
         assert(in == headerin + wheremeta);
     }
 
+    // unpacks a block of BlockSize integers to out, returns the end of the packed data
+    static const uint32_t * unpackBlockTo(const uint32_t * in, uint32_t * out, const uint32_t b) {
+        return unpackblock<BlockSize>(in, out, b);
+    }
+    template<class T>
+    static const uint32_t * unpackBlockTo(const uint32_t * in, T * out, const uint32_t b) {
+        for (uint32_t j = 0; j != BlockSize; j += 32, in += b)
+            fastunpack_narrow(in, out + j, b);
+        return in;
+    }
+
+    static void patchExceptionsTo(uint32_t * out, const uint8_t * positions,
+            const uint32_t * exceptions, const uint32_t cexcept, const uint32_t b) {
+        patchExceptions(out, positions, exceptions, cexcept, b);
+    }
+    template<class T>
+    static void patchExceptionsTo(T * out, const uint8_t * positions,
+            const uint32_t * exceptions, const uint32_t cexcept, const uint32_t b) {
+        for (uint32_t k = 0; k < cexcept; ++k)
+            out[positions[k]] = static_cast<T> (out[positions[k]] | (exceptions[k] << b));
+    }
+
+    /**
+     * Returns the integer at position index (out[index] after decodeArray)
+     * without decoding the array. We skip whole pages, then walk the byte
+     * container of the page to find the block, and we extract the single
+     * integer (and its exception, if any).
+     */
+    uint32_t select(const uint32_t *in, const size_t index) const {
+        const size_t mynvalue = *in++;
+        if (index >= mynvalue)
+            throw out_of_range("FastPFor::select: index out of range");
+        const uint32_t * exceptions[32 + 1];
+        const uint8_t * bytep;
+        for (size_t page = 0; page < index / PageSize; ++page)
+            in += locatePage(in, exceptions, bytep);
+        locatePage(in, exceptions, bytep);
+        const uint32_t inpage = static_cast<uint32_t> (index % PageSize);
+        const uint32_t * packed = in + 1;
+        uint32_t exceptcount[32 + 1] = {0};
+        for (uint32_t run = 0; run < inpage / BlockSize; ++run) {
+            const uint8_t b = *bytep++;
+            const uint8_t cexcept = *bytep++;
+            if (cexcept > 0) {
+                const uint8_t maxbits = *bytep++;
+                exceptcount[maxbits - b] += cexcept;
+                bytep += cexcept;
+            }
+            packed += BlockSize / 32 * b;
+        }
+        const uint8_t b = *bytep++;
+        const uint8_t cexcept = *bytep++;
+        const uint32_t pos = inpage % BlockSize;
+        uint32_t answer = fastselect(packed, b, pos);
+        if (cexcept > 0) {
+            const uint8_t maxbits = *bytep++;
+            for (uint32_t k = 0; k < cexcept; ++k) {
+                if (bytep[k] == pos) {
+                    answer |= fastselect(exceptions[maxbits - b], maxbits - b, exceptcount[maxbits - b] + k) << b;
+                    break;
+                }
+            }
+        }
+        return answer;
+    }
+
+    /**
+     * Writes the integers at positions [begin, end) to out, only unpacking
+     * the blocks that overlap the range. Exceptions are extracted one at a time.
+     */
+    void decodeRange(const uint32_t *in, const size_t begin, const size_t end,
+            uint32_t *out) const {
+        const size_t mynvalue = *in++;
+        if ((begin > end) || (end > mynvalue))
+            throw out_of_range("FastPFor::decodeRange: bad range");
+        const uint32_t * exceptions[32 + 1];
+        const uint8_t * bytep;
+        uint32_t buffer[BlockSize];
+        size_t pagestart = 0;
+        for (; pagestart + PageSize <= begin; pagestart += PageSize)
+            in += locatePage(in, exceptions, bytep);
+        for (; pagestart < end; pagestart += PageSize) {
+            const size_t pagelength = locatePage(in, exceptions, bytep);
+            const uint32_t * packed = in + 1;
+            uint32_t exceptcount[32 + 1] = {0};
+            for (size_t pos = pagestart; (pos < end) && (pos < pagestart + PageSize); pos += BlockSize) {
+                const uint8_t b = *bytep++;
+                const uint8_t cexcept = *bytep++;
+                const uint8_t maxbits = cexcept > 0 ? *bytep++ : b;
+                if (pos + BlockSize > begin) {
+                    unpackblock<BlockSize>(packed, buffer, b);
+                    for (uint32_t k = 0; k < cexcept; ++k)
+                        buffer[bytep[k]] |= fastselect(exceptions[maxbits - b], maxbits - b, exceptcount[maxbits - b] + k) << b;
+                    const size_t from = pos < begin ? begin - pos : 0;
+                    const size_t to = pos + BlockSize > end ? end - pos : static_cast<size_t> (BlockSize);
+                    memcpy(out, buffer + from, (to - from) * sizeof(uint32_t));
+                    out += to - from;
+                }
+                exceptcount[maxbits - b] += cexcept;
+                bytep += cexcept;
+                packed += BlockSize / 32 * b;
+            }
+            in += pagelength;
+        }
+    }
+
+    /**
+     * Finds the exception arrays and the byte container of the page starting at in,
+     * and returns the size of the page in words (as computed by __decodeArray).
+     */
+    static size_t locatePage(const uint32_t * in, const uint32_t * exceptions[32 + 1],
+            const uint8_t * & bytep) {
+        const uint32_t *inexcept = in + in[0];
+        const uint32_t bytesize = *inexcept++;
+        bytep = reinterpret_cast<const uint8_t *> (inexcept);
+        inexcept += (bytesize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        const uint32_t bitmap = *(inexcept++);
+        for (uint32_t k = 1; k <= 32; ++k) {
+            if ((bitmap & (1U << (k - 1))) != 0) {
+                const uint32_t size = *inexcept++;
+                exceptions[k] = inexcept;
+                inexcept += (size + 32 - 1) / 32 * k;
+            }
+        }
+        return inexcept - in;
+    }
+
+    /**
+     * getBestBFromData only keeps exceptions when their cost (8 bits for
+     * the position, plus their bits) is less than what they save, so a
+     * block takes at most BlockSize words plus 3 bytes (b, the number of
+     * exceptions, maxb). Each page adds 4 words (offset to the metadata,
+     * number of bytes, padding of the bytes, bitmap) and each of the 32
+     * exception arrays a size word and less than k words of padding.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t pages = (length + PageSize - 1) / PageSize;
+        return 1 + length + (3 * (length / BlockSize) + 3) / 4
+                + pages * (4 + 32 + 32 * 33 / 2);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         return "FastPFor";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new FastPFor(*this));
+    }
 
 };
 
@@ -287,17 +522,56 @@ public:
     const uint32_t PageSize;
     const uint32_t bitsPageSize;
 
-    vector<uint32_t> datatobepacked;
+    vector<uint32_t> datatobepacked;// scratch for encoding
     vector<uint8_t> bytescontainer;
 
+    /**
+     * Scratch space for decoding: the exceptions of a page.
+     */
+    struct Workspace {
+        Workspace() :
+            exceptions() {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            vector<uint32_t> ().swap(exceptions);
+        }
+        vector<uint32_t> exceptions;
+    };
+
+    // the workspace used by decodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // frees the workspace of the calling thread (see FastPFor::trim)
+    void trim() {
+        threadWorkspace().trim();
+    }
+
+    // thread-safe: it does not modify the instance
     const uint32_t * decodeArray(const uint32_t *in, const size_t length,
             uint32_t *out, size_t &nvalue) {
+        return decodeArray(in, length, out, nvalue, threadWorkspace());
+    }
+
+    /**
+     * Same as decodeArray, but with your own scratch space (e.g., one per
+     * thread, reused from call to call).
+     */
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, Workspace & ws) {
         const uint32_t * const initin(in);
         const size_t mynvalue = *in;
         ++in;
         if (mynvalue > nvalue)
             throw NotEnoughStorage(mynvalue);
         nvalue = mynvalue;
+        // the exception coder may write past the last exception
+        const size_t wanted = min<size_t>(PageSize, mynvalue) + 1024;
+        if (ws.exceptions.size() < wanted)
+            ws.exceptions.resize(wanted);
         const uint32_t * const finalout(out + nvalue);
         while (out != finalout) {
             size_t thisnvalue = length - (in-initin);
@@ -305,7 +579,7 @@ public:
                     static_cast<size_t> (finalout > PageSize + out ? PageSize
                             : (finalout - out));
 
-            __decodeArray(in, thisnvalue, out, thissize);
+            __decodeArray(in, thisnvalue, out, thissize, ws);
             in += thisnvalue;
             out += thissize;
         }
@@ -346,11 +620,7 @@ public:
     void getBestBFromData(const uint32_t * in, uint8_t& bestb,
             uint8_t & bestcexcept, uint8_t & maxb) {
         uint32_t freqs[33];
-        for (uint32_t k = 0; k <= 32; ++k)
-            freqs[k] = 0;
-        for (uint32_t k = 0; k < BlockSize; ++k) {
-            freqs[asmbits(in[k])]++;
-        }
+        bitWidthHistogram(in, BlockSize, freqs);
         bestb = 32;
         while (freqs[bestb] == 0)
             bestb--;
@@ -383,20 +653,19 @@ public:
             getBestBFromData(in, bestb, bestcexcept, maxb);
             *bc++ = bestb;
             *bc++ = bestcexcept;
-            if (true) {
-                const uint32_t maxval = 1U << bestb;
-                for (uint32_t k = 0; k < BlockSize; ++k) {
-                    if (in[k] >= maxval) {
-                        datatobepacked.push_back(in[k] >> bestb);
-                        *bc++ = k;
-                    }
-                }
+            if (bestb < 32) {// 1U << 32 is undefined
+                const uint32_t cexcept = exceptionPositions(in, BlockSize, bestb, bc);
+                for (uint32_t k = 0; k < cexcept; ++k)
+                    datatobepacked.push_back(in[bc[k]] >> bestb);
+                bc += cexcept;
             }
             out = packblockup<BlockSize>(in, out, bestb);
         }
         headerout[0] = static_cast<uint32_t> (out - headerout);
         const uint32_t bytescontainersize = bc - &bytescontainer[0];
         *(out++) = bytescontainersize;
+        if (bytescontainersize % sizeof(uint32_t) != 0)// the padding bytes are zeros
+            out[bytescontainersize / sizeof(uint32_t)] = 0;
         memcpy(out, &bytescontainer[0], bytescontainersize);
         out += (bytescontainersize + sizeof(uint32_t) - 1)
                 / sizeof(uint32_t);
@@ -407,7 +676,8 @@ public:
     }
 
     void __decodeArray(const uint32_t *in, size_t & length, uint32_t *out,
-            const size_t nvalue) {
+            const size_t nvalue, Workspace & ws) {
+        vector<uint32_t> & datatobepacked = ws.exceptions;
         const uint32_t * const initin = in;
         const uint32_t * const headerin = in++;
         const uint32_t wheremeta = headerin[0];
@@ -415,7 +685,7 @@ public:
         const uint32_t bytesize = *inexcept++;
         const uint8_t * bytep = reinterpret_cast<const uint8_t *> (inexcept);
         inexcept += (bytesize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
-        size_t cap = datatobepacked.capacity();// theoretically unsafe
+        size_t cap = datatobepacked.size();
         size_t le = initin+length - inexcept;
         inexcept = ecoder.decodeArray(inexcept, le,&datatobepacked[0],cap );
 
@@ -427,17 +697,38 @@ public:
             const uint8_t b = *bytep++;
             const uint8_t cexcept = *bytep++;
             in = unpackblock<BlockSize>(in, out, b);
-                for (uint32_t k = 0; k < cexcept; ++k) {
-                    const uint8_t pos = *(bytep++);
-                    out[pos] |= (*(exceptionsptr++)) << b;
-                }
+            if (cexcept > 0) {
+                patchExceptions(out, bytep, &*exceptionsptr, cexcept, b);
+                bytep += cexcept;
+                exceptionsptr += cexcept;
+            }
         }
         assert(in == headerin + wheremeta);
     }
 
+    /**
+     * Simple8b may use 64 bits for an exception of many bits, so the bound
+     * is less favorable than with FastPFor: under the cost model of
+     * getBestBFromData, a block takes at most 4b words, 2 words per
+     * exception and 2 + cexcept bytes, that is, at most 2 * BlockSize + 1
+     * words (e.g., b = 15 with 87 exceptions). Each page adds 4 words (offset
+     * to the metadata, number of bytes, padding of the bytes, length of the
+     * exceptions).
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t pages = (length + PageSize - 1) / PageSize;
+        return 1 + length / BlockSize * (2 * BlockSize + 1) + pages * 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         return "SimplePFor";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SimplePFor(*this));
+    }
 };
 
 
@@ -0,0 +1,247 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef FASTPFOR64_H_
+#define FASTPFOR64_H_
+
+#include "common.h"
+#include "codecs64.h"
+#include "simdbitpacking64.h"
+
+/**
+ * FastPFor for 64-bit integers. As with FastPFor, each block of 128
+ * integers is packed with its best bit width b (SIMD_fastpack_64) and
+ * the integers that do not fit are exceptions: their position goes in
+ * the byte container and their high bits (in[k] >> b) in one of 64 arrays,
+ * one per number of bits (maxb - b), packed at the end of the page.
+ *
+ * Format of a page:
+ *    where the metadata starts (in words, from the start of the page),
+ *    the packed blocks,
+ *    number of bytes, bytes (b, number of exceptions, maxb if there are
+ *    exceptions, positions) up to 32 bits,
+ *    bitmap of the exception arrays (2 words),
+ *    for each exception array: its size, the integers (packStream64).
+ *
+ * There are no alignment requirements.
+ */
+class FastPFor64: public IntegerCODEC64 {
+public:
+    /**
+     * ps (page size) should be a multiple of BlockSize, any "large"
+     * value should do.
+     */
+    FastPFor64(uint32_t ps = 65536) :
+        PageSize(ps), datatobepacked(65), bytescontainer(PageSize + 3 * PageSize / BlockSize) {
+        assert(ps / BlockSize * BlockSize == ps);
+    }
+    enum {
+        BlockSize = 128,
+        overheadofeachexcept = 8
+    };
+
+    const uint32_t PageSize;
+
+    vector<vector<uint64_t> > datatobepacked;// scratch for encoding
+    vector<uint8_t> bytescontainer;
+
+    // scratch space for decoding: the exceptions of a page
+    struct Workspace {
+        Workspace() :
+            datatobepacked(65) {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            for (size_t i = 0; i < datatobepacked.size(); ++i)
+                vector<uint64_t> ().swap(datatobepacked[i]);
+        }
+        vector<vector<uint64_t> > datatobepacked;
+    };
+
+    // the workspace used by decodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // frees the encoding buffers and the workspace of the calling thread
+    void trim() {
+        for (size_t i = 0; i < datatobepacked.size(); ++i)
+            vector<uint64_t> ().swap(datatobepacked[i]);
+        threadWorkspace().trim();
+    }
+
+    void encodeArray(const uint64_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        if (maxCompressedWords(length) > nvalue)
+            throw NotEnoughStorage(maxCompressedWords(length));
+        const uint32_t * const initout(out);
+        const uint64_t * const finalin(in + length);
+        *out++ = static_cast<uint32_t> (length);
+        while (in != finalin) {
+            const size_t thissize = min<size_t> (PageSize, finalin - in);
+            out = encodePage(in, thissize, out);
+            in += thissize;
+        }
+        nvalue = out - initout;
+    }
+
+    // thread-safe: it does not modify the instance
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint64_t *out, size_t &nvalue) {
+        return decodeArray(in, length, out, nvalue, threadWorkspace());
+    }
+
+    // same as decodeArray, but with your own scratch space
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint64_t *out, size_t &nvalue, Workspace & ws) const {
+        const size_t mynvalue = *in++;
+        if (mynvalue > nvalue)
+            throw NotEnoughStorage(mynvalue);
+        nvalue = mynvalue;
+        const uint64_t * const finalout(out + nvalue);
+        while (out != finalout) {
+            const size_t thissize = min<size_t> (PageSize, finalout - out);
+            in = decodePage(in, out, thissize, ws);
+            out += thissize;
+        }
+        return in;
+    }
+
+    /**
+     * As in FastPFor::getBestBFromData, with bit widths up to 64.
+     */
+    static void getBestBFromData(const uint64_t * in, uint8_t & bestb,
+            uint8_t & bestcexcept, uint8_t & maxb) {
+        uint32_t freqs[65] = { 0 };
+        for (uint32_t k = 0; k < BlockSize; ++k)
+            freqs[bits64(in[k])]++;
+        uint32_t b = 64;
+        while ((b > 0) && (freqs[b] == 0))
+            --b;
+        maxb = static_cast<uint8_t> (b);
+        bestb = maxb;
+        bestcexcept = 0;
+        uint32_t bestcost = maxb * BlockSize;
+        uint32_t cexcept = 0;
+        for (b = maxb; b-- > 0;) {
+            cexcept += freqs[b + 1];
+            const uint32_t thiscost = cexcept * overheadofeachexcept + cexcept
+                    * (maxb - b) + b * BlockSize + 8;// the extra 8 is the cost of storing maxbits
+            if (thiscost < bestcost) {
+                bestcost = thiscost;
+                bestb = static_cast<uint8_t> (b);
+                bestcexcept = static_cast<uint8_t> (cexcept);
+            }
+        }
+    }
+
+    /**
+     * A block takes at most 2 * BlockSize words and 3 bytes (see
+     * FastPFor::maxCompressedWords). Each page adds 5 words (offset to
+     * the metadata, number of bytes, padding of the bytes, bitmap) and
+     * each of the 64 exception arrays a size word and one of padding.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t pages = (length + PageSize - 1) / PageSize;
+        return 1 + 2 * length + (3 * (length / BlockSize) + 3) / 4
+                + pages * (5 + 64 * 2);
+    }
+
+    string name() const {
+        return "FastPFor64";
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new FastPFor64(*this));
+    }
+
+private:
+    uint32_t * encodePage(const uint64_t *in, const size_t length, uint32_t *out) {
+        uint32_t * const headerout = out++;
+        for (uint32_t k = 0; k <= 64; ++k)
+            datatobepacked[k].clear();
+        uint8_t * bc = &bytescontainer[0];
+        for (const uint64_t * const final = in + length; in + BlockSize <= final; in
+                += BlockSize) {
+            uint8_t bestb, bestcexcept, maxb;
+            getBestBFromData(in, bestb, bestcexcept, maxb);
+            *bc++ = bestb;
+            *bc++ = bestcexcept;
+            if (bestcexcept > 0) {
+                *bc++ = maxb;
+                vector<uint64_t> & thisexceptioncontainer = datatobepacked[maxb - bestb];
+                for (uint32_t k = 0; k < BlockSize; ++k) {
+                    if ((in[k] >> bestb) != 0) {// bestb < 64 here
+                        thisexceptioncontainer.push_back(in[k] >> bestb);
+                        *bc++ = static_cast<uint8_t> (k);
+                    }
+                }
+            }
+            SIMD_fastpack_64(in, out, bestb);
+            out += 4 * bestb;
+        }
+        headerout[0] = static_cast<uint32_t> (out - headerout);
+        const uint32_t bytescontainersize = static_cast<uint32_t> (bc - &bytescontainer[0]);
+        *out++ = bytescontainersize;
+        if (bytescontainersize % sizeof(uint32_t) != 0)// the padding bytes are zeros
+            out[bytescontainersize / sizeof(uint32_t)] = 0;
+        memcpy(out, &bytescontainer[0], bytescontainersize);
+        out += (bytescontainersize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        uint64_t bitmap = 0;
+        for (uint32_t k = 1; k <= 64; ++k)
+            if (!datatobepacked[k].empty())
+                bitmap |= 1ULL << (k - 1);
+        *out++ = static_cast<uint32_t> (bitmap);
+        *out++ = static_cast<uint32_t> (bitmap >> 32);
+        for (uint32_t k = 1; k <= 64; ++k) {
+            if (datatobepacked[k].empty())
+                continue;
+            *out++ = static_cast<uint32_t> (datatobepacked[k].size());
+            out = packStream64(&datatobepacked[k][0], datatobepacked[k].size(), out, k);
+        }
+        return out;
+    }
+
+    const uint32_t * decodePage(const uint32_t *in, uint64_t *out, const size_t nvalue,
+            Workspace & ws) const {
+        vector<vector<uint64_t> > & exceptions = ws.datatobepacked;
+        const uint32_t * const headerin = in++;
+        const uint32_t *inexcept = headerin + headerin[0];
+        const uint32_t bytesize = *inexcept++;
+        const uint8_t * bytep = reinterpret_cast<const uint8_t *> (inexcept);
+        inexcept += (bytesize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        const uint64_t bitmap = inexcept[0] | (static_cast<uint64_t> (inexcept[1]) << 32);
+        inexcept += 2;
+        const uint64_t * unpackpointers[64 + 1];
+        for (uint32_t k = 1; k <= 64; ++k) {
+            if ((bitmap & (1ULL << (k - 1))) != 0) {
+                const uint32_t size = *inexcept++;
+                if (exceptions[k].size() < size)
+                    exceptions[k].resize(size);
+                inexcept = unpackStream64(inexcept, size, &exceptions[k][0], k);
+                unpackpointers[k] = &exceptions[k][0];
+            }
+        }
+        for (size_t run = 0; run < nvalue / BlockSize; ++run, out += BlockSize) {
+            const uint32_t b = *bytep++;
+            const uint32_t cexcept = *bytep++;
+            SIMD_fastunpack_64(in, out, b);
+            in += 4 * b;
+            if (cexcept > 0) {
+                const uint32_t maxbits = *bytep++;
+                const uint64_t * & exceptionsptr = unpackpointers[maxbits - b];
+                for (uint32_t k = 0; k < cexcept; ++k)
+                    out[*bytep++] |= *exceptionsptr++ << b;
+            }
+        }
+        assert(in == headerin + headerin[0]);
+        return inexcept;
+    }
+};
+
+#endif /* FASTPFOR64_H_ */
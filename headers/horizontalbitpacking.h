@@ -21,7 +21,7 @@
 #define HORIZONTALBITPACKING_H_
 
 
-#ifndef __SSE4_1__
+#if !defined(__SSE4_1__) && !defined(__aarch64__)
 #pragma message "No SSSE4.1 support? try adding -msse4.1"
 #endif
 #include "common.h"
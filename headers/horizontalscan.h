@@ -0,0 +1,169 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef HORIZONTALSCAN_H_
+#define HORIZONTALSCAN_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "cpufeatures.h"
+#include "scanpredicate.h"
+
+/**
+ * A column codec for filters: the integers are bit packed horizontally
+ * with a single bit width, so that predicates (ScanPredicate) can be
+ * evaluated on the packed data with SIMD compares, several integers per
+ * instruction, producing a bitmap (scanToBitmap) or a selection vector
+ * (scanToSelection) without decoding the column to an array. Scanning a
+ * low-cardinality column then costs about a pass over its packed words.
+ *
+ * Format:
+ *    length, bit width,
+ *    the packed integers (see horizontalScan), Slack words of zeros.
+ *
+ * Any length works (no CompositeCodec needed) and there is no alignment
+ * requirement.
+ */
+class HorizontalScanCodec: public IntegerCODEC {
+public:
+    enum {
+        HeaderSize = 2,
+        Slack = 4 // words after the packed integers, for the 128-bit loads
+    };
+
+    void encodeArray(const uint32_t * in, const size_t length, uint32_t * out,
+            size_t & nvalue) {
+        const uint32_t b = maxbits(in, in + length);
+        const size_t required = HeaderSize + packedWords(length, b) + Slack;
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        out[0] = static_cast<uint32_t> (length);
+        out[1] = b;
+        uint32_t * o = out + HeaderSize;
+        uint64_t buffer = 0;
+        uint32_t inbuffer = 0;
+        for (size_t i = 0; i < length; ++i) {
+            buffer |= static_cast<uint64_t> (in[i]) << inbuffer;
+            inbuffer += b;
+            if (inbuffer >= 32) {
+                *o++ = static_cast<uint32_t> (buffer);
+                buffer >>= 32;
+                inbuffer -= 32;
+            }
+        }
+        if (inbuffer > 0)
+            *o++ = static_cast<uint32_t> (buffer);
+        for (uint32_t k = 0; k < Slack; ++k)
+            *o++ = 0;
+        nvalue = o - out;
+    }
+
+    const uint32_t * decodeArray(const uint32_t * in, const size_t /*length*/,
+            uint32_t * out, size_t & nvalue) {
+        const size_t length = in[0];
+        const uint32_t b = in[1];
+        if (length > nvalue)
+            throw NotEnoughStorage(length);
+        if (cpuSupportsAVX2())
+            avx2::horizontalUnpack(in + HeaderSize, length, b, out);
+        else if (cpuSupportsSSE41())
+            horizontalUnpack(in + HeaderSize, length, b, out);
+        else
+            for (size_t i = 0; i < length; ++i)
+                out[i] = extract(in + HeaderSize, b, i);
+        nvalue = length;
+        return in + HeaderSize + packedWords(length, b) + Slack;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return HeaderSize + length + Slack;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "HorizontalScan";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new HorizontalScanCodec(*this));
+    }
+
+    // number of 64-bit words of the bitmap of the compressed column in
+    static size_t bitmapWords(const uint32_t * in) {
+        return (in[0] + 63) / 64;
+    }
+
+    /**
+     * Evaluates p on the compressed column in: bit i of bitmap (which has
+     * bitmapWords(in) words) tells whether integer i satisfies it.
+     */
+    static void scanToBitmap(const uint32_t * in, const ScanPredicate & p, uint64_t * bitmap) {
+        scan(in + HeaderSize, in[0], in[1], p, bitmap);
+    }
+
+    /**
+     * Writes to out the positions of the integers of the compressed column
+     * in satisfying p (in increasing order), returns how many there are.
+     * We scan ChunkSize integers at a time to a bitmap on the stack.
+     */
+    static size_t scanToSelection(const uint32_t * in, const ScanPredicate & p, uint32_t * out) {
+        enum {
+            ChunkSize = 1 << 12
+        };
+        const size_t length = in[0];
+        const uint32_t b = in[1];
+        uint64_t bitmap[ChunkSize / 64];
+        uint32_t * const initout = out;
+        for (size_t start = 0; start < length; start += ChunkSize) {
+            const size_t thissize = min<size_t> (ChunkSize, length - start);
+            // chunks start on whole words, so we can scan them on their own
+            const uint32_t * const packed = in + HeaderSize + start * b / 32;
+            scan(packed, thissize, b, p, bitmap);
+            for (size_t w = 0; w < (thissize + 63) / 64; ++w)
+                for (uint64_t word = bitmap[w]; word != 0; word &= word - 1)
+                    *out++ = static_cast<uint32_t> (start + 64 * w + __builtin_ctzll(word));
+        }
+        return out - initout;
+    }
+
+    // number of integers of the compressed column in satisfying p
+    static size_t count(const uint32_t * in, const ScanPredicate & p) {
+        vector<uint64_t> bitmap(bitmapWords(in));
+        scanToBitmap(in, p, bitmap.data());
+        size_t answer = 0;
+        for (size_t w = 0; w < bitmap.size(); ++w)
+            answer += __builtin_popcountll(bitmap[w]);
+        return answer;
+    }
+
+    static size_t packedWords(const size_t length, const uint32_t b) {
+        return (length * b + 31) / 32;
+    }
+
+    // integer i of the packed stream
+    static uint32_t extract(const uint32_t * packed, const uint32_t b, const size_t i) {
+        return horizontalExtract(packed, b, i);
+    }
+
+    // horizontalScan, with the best kernels for this processor
+    static void scan(const uint32_t * packed, const size_t length, const uint32_t b,
+            const ScanPredicate & p, uint64_t * bitmap) {
+        if (cpuSupportsAVX2())
+            avx2::horizontalScan(packed, length, b, scanConstants(p), bitmap);
+        else if (cpuSupportsSSE41())
+            horizontalScan(packed, length, b, scanConstants(p), bitmap);
+        else {
+            memset(bitmap, 0, (length + 63) / 64 * sizeof(uint64_t));
+            for (size_t i = 0; i < length; ++i)
+                if (p.matches(extract(packed, b, i)))
+                    bitmap[i / 64] |= static_cast<uint64_t> (1) << (i % 64);
+        }
+    }
+};
+
+#endif /* HORIZONTALSCAN_H_ */
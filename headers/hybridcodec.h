@@ -0,0 +1,290 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef HYBRIDCODEC_H_
+#define HYBRIDCODEC_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "simdbitpacking.h"
+#include "simple8b.h"
+#include "util.h"
+
+/**
+ * Chooses a scheme for each block of 128 integers: plain binary packing
+ * (as in SIMDBinaryPacking), binary packing with patched exceptions (as in
+ * SIMDFastPFor), Simple8b or variable byte. The choice is made with the
+ * bit-width frequencies of the block (as in SIMDFastPFor::getBestBFromData)
+ * and Simple8b::fakeencodeArray: we take the smallest and, on a tie, the
+ * fastest to decode.
+ *
+ * Format:
+ *    length, words of packed data, words of Simple8b data, bytes of metadata,
+ *    the schemes (2 bits per block, 16 blocks per word),
+ *    padding up to 16 bytes (CookiePadder),
+ *    packed data (SIMD_fastpack_32, so it stays 16-byte aligned),
+ *    Simple8b data,
+ *    metadata bytes (bit widths, exceptions, variable bytes) up to 32 bits.
+ *
+ * The length should be a multiple of BlockSize (see CompositeCodec).
+ * As with SIMDBinaryPacking, the output of decodeArray should be aligned
+ * on 16 bytes and if you move the data around, you should preserve the
+ * alignment.
+ */
+class HybridCodec: public IntegerCODEC {
+public:
+    enum {
+        BlockSize = 128,
+        HeaderSize = 4,
+        SchemesPerWord = 16
+    };
+    enum Scheme {
+        Packed = 0, // bit width, then 4 * b packed words
+        Patched = 1, // b, number of exceptions, positions, variable bytes of in[k] >> b
+        Simple = 2, // Simple8b words
+        VByte = 3 // 128 variable bytes
+    };
+    static const uint32_t CookiePadder = 123456;
+
+    HybridCodec() :
+        simplewords(), bytes(), simple() {
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        const size_t numberofblocks = length / BlockSize;
+        uint32_t * const initout(out);
+        const size_t schemewords = (numberofblocks + SchemesPerWord - 1) / SchemesPerWord;
+        if (HeaderSize + schemewords + 3 > nvalue)
+            throw NotEnoughStorage(HeaderSize + schemewords + 3);
+        uint32_t * const header = out;
+        uint32_t * const schemes = out + HeaderSize;
+        fill(schemes, schemes + schemewords, 0);
+        out = schemes + schemewords;
+        while (needPaddingTo128Bits(out))
+            *out++ = CookiePadder;
+        uint32_t * const packed = out;
+        simplewords.clear();
+        bytes.clear();
+        __attribute__ ((aligned (16))) uint32_t block[BlockSize];
+        for (size_t k = 0; k < numberofblocks; ++k, in += BlockSize) {
+            memcpy(block, in, sizeof(block));// the SIMD kernels load aligned data
+            uint32_t b, bits;
+            const Scheme scheme = bestScheme(block, b, bits);
+            schemes[k / SchemesPerWord] |= scheme << (2 * (k % SchemesPerWord));
+            if ((scheme <= Patched) && (static_cast<size_t> (out - initout) + 4 * b > nvalue))
+                throw NotEnoughStorage(maxCompressedWords(length));
+            switch (scheme) {
+            case Packed:
+                bytes.push_back(static_cast<uint8_t> (b));
+                SIMD_fastpackwithoutmask_32(block, reinterpret_cast<__m128i *> (out), b);
+                out += 4 * b;
+                break;
+            case Patched: {
+                bytes.push_back(static_cast<uint8_t> (b));
+                const size_t where = bytes.size();
+                bytes.push_back(0);
+                for (uint32_t j = 0; j < BlockSize; ++j)
+                    if ((block[j] >> b) != 0)
+                        bytes.push_back(static_cast<uint8_t> (j));
+                const uint32_t cexcept = static_cast<uint32_t> (bytes.size() - where - 1);
+                bytes[where] = static_cast<uint8_t> (cexcept);
+                for (uint32_t j = 0; j < BlockSize; ++j)
+                    if ((block[j] >> b) != 0)
+                        writeVByte(block[j] >> b);
+                SIMD_fastpack_32(block, reinterpret_cast<__m128i *> (out), b);
+                out += 4 * b;
+                break;
+            }
+            case Simple: {
+                const size_t where = simplewords.size();
+                simplewords.resize(where + 2 * BlockSize);
+                size_t words = 2 * BlockSize;
+                simple.encodeArray(block, BlockSize, &simplewords[where], words);
+                simplewords.resize(where + words);
+                break;
+            }
+            case VByte:
+                for (uint32_t j = 0; j < BlockSize; ++j)
+                    writeVByte(block[j]);
+                break;
+            }
+        }
+        header[0] = static_cast<uint32_t> (length);
+        header[1] = static_cast<uint32_t> (out - packed);
+        header[2] = static_cast<uint32_t> (simplewords.size());
+        header[3] = static_cast<uint32_t> (bytes.size());
+        const size_t required = (out - initout) + simplewords.size()
+                + (bytes.size() + 3) / 4;
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        if (!simplewords.empty())
+            memcpy(out, &simplewords[0], simplewords.size() * sizeof(uint32_t));
+        out += simplewords.size();
+        while (bytes.size() % 4 != 0)
+            bytes.push_back(0);
+        if (!bytes.empty())
+            memcpy(out, &bytes[0], bytes.size());
+        out += bytes.size() / 4;
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t actuallength = in[0];
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        if (needPaddingTo128Bits(out))
+            throw runtime_error("bad initial output align");
+        const size_t numberofblocks = actuallength / BlockSize;
+        const uint32_t * const schemes = in + HeaderSize;
+        const uint32_t * packed = schemes + (numberofblocks + SchemesPerWord - 1)
+                / SchemesPerWord;
+        while (needPaddingTo128Bits(packed)) {
+            if (packed[0] != CookiePadder)
+                throw logic_error("HybridCodec alignment issue.");
+            ++packed;
+        }
+        const uint32_t * simplein = packed + in[1];
+        const uint8_t * bytep = reinterpret_cast<const uint8_t *> (simplein + in[2]);
+        const uint8_t * const endbytes = bytep + in[3];
+        // Simple8b may write up to 240 integers past the block
+        __attribute__ ((aligned (16))) uint32_t buffer[BlockSize + 240];
+        for (size_t k = 0; k < numberofblocks; ++k, out += BlockSize) {
+            switch ((schemes[k / SchemesPerWord] >> (2 * (k % SchemesPerWord))) & 3) {
+            case Packed: {
+                const uint32_t b = *bytep++;
+                SIMD_fastunpack_32(reinterpret_cast<const __m128i *> (packed), out, b);
+                packed += 4 * b;
+                break;
+            }
+            case Patched: {
+                const uint32_t b = *bytep++;
+                const uint32_t cexcept = *bytep++;
+                SIMD_fastunpack_32(reinterpret_cast<const __m128i *> (packed), out, b);
+                packed += 4 * b;
+                const uint8_t * positions = bytep;
+                bytep += cexcept;
+                for (uint32_t j = 0; j < cexcept; ++j)
+                    out[positions[j]] |= readVByte(bytep) << b;
+                break;
+            }
+            case Simple: {
+                size_t howmany = BlockSize;
+                simplein = simple.decodeArray(simplein, 2 * BlockSize, buffer, howmany);
+                memcpy(out, buffer, BlockSize * sizeof(uint32_t));
+                break;
+            }
+            case VByte:
+                for (uint32_t j = 0; j < BlockSize; ++j)
+                    out[j] = readVByte(bytep);
+                break;
+            }
+        }
+        if (bytep > endbytes)
+            throw logic_error("HybridCodec: corrupted metadata");
+        nvalue = actuallength;
+        return reinterpret_cast<const uint32_t *> (padTo32bits(endbytes));
+    }
+
+    /**
+     * Finds the smallest scheme for this block using the same kind of
+     * cost model as SIMDFastPFor::getBestBFromData, b gets the bit width
+     * for Packed and Patched and bits the size of the block in bits.
+     */
+    Scheme bestScheme(const uint32_t * block, uint32_t & b, uint32_t & bits) {
+        uint32_t freqs[33] = { 0 };
+        for (uint32_t k = 0; k < BlockSize; ++k)
+            freqs[asmbits(block[k])]++;
+        uint32_t maxb = 32;
+        while ((maxb > 0) && (freqs[maxb] == 0))
+            maxb--;
+        b = maxb;
+        Scheme answer = Packed;
+        uint32_t bestcost = maxb * BlockSize + 8;
+        // patched: 2 bytes, then one byte and the variable bytes of each exception
+        for (uint32_t thisb = maxb; thisb-- > 0;) {
+            uint32_t thiscost = thisb * BlockSize + 16;
+            for (uint32_t w = thisb + 1; w <= maxb; ++w)
+                thiscost += freqs[w] * 8 * (1 + (w - thisb + 6) / 7);
+            if (thiscost < bestcost) {
+                bestcost = thiscost;
+                b = thisb;
+                answer = Patched;
+            }
+        }
+        // a Simple8b word holds at most 60 bits of data
+        uint32_t totalbits = 0;
+        for (uint32_t w = 1; w <= maxb; ++w)
+            totalbits += freqs[w] * w;
+        if ((totalbits + 59) / 60 * 64 < bestcost) {
+            size_t simplewordcount;
+            simple.fakeencodeArray(block, BlockSize, simplewordcount);
+            if (simplewordcount * 32 < bestcost) {
+                bestcost = static_cast<uint32_t> (simplewordcount * 32);
+                answer = Simple;
+            }
+        }
+        uint32_t vbytecost = freqs[0] * 8;
+        for (uint32_t w = 1; w <= maxb; ++w)
+            vbytecost += freqs[w] * 8 * ((w + 6) / 7);
+        if (vbytecost < bestcost) {
+            bestcost = vbytecost;
+            answer = VByte;
+        }
+        bits = bestcost;
+        return answer;
+    }
+
+    /**
+     * No scheme is chosen if it uses more than packing would: at most
+     * BlockSize words and one byte per block.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t numberofblocks = length / BlockSize;
+        return HeaderSize + (numberofblocks + SchemesPerWord - 1) / SchemesPerWord
+                + 3 + numberofblocks * BlockSize + (numberofblocks + 3) / 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "Hybrid";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new HybridCodec(*this));
+    }
+
+private:
+    // same byte format as VariableByte
+    void writeVByte(uint32_t val) {
+        while (val >= 128) {
+            bytes.push_back(static_cast<uint8_t> (val & 127));
+            val >>= 7;
+        }
+        bytes.push_back(static_cast<uint8_t> (val | 128));
+    }
+
+    static uint32_t readVByte(const uint8_t * & bytep) {
+        uint32_t v = 0;
+        for (uint32_t shift = 0;; shift += 7) {
+            const uint8_t c = *bytep++;
+            v += (c & 127) << shift;
+            if (c & 128)
+                return v;
+        }
+    }
+
+    // scratch for encoding
+    vector<uint32_t> simplewords;
+    vector<uint8_t> bytes;
+    Simple8b<false> simple;
+};
+
+#endif /* HYBRIDCODEC_H_ */
@@ -0,0 +1,339 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef INDEXFILE_H_
+#define INDEXFILE_H_
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "common.h"
+#include "codecfactory.h"
+
+using namespace std;
+
+/**
+ * A file of compressed arrays (e.g., posting lists) meant to be memory
+ * mapped: arrays are decoded straight from the mapped pages, there is
+ * no read and no copy.
+ *
+ * Format:
+ *    header (IndexFileHeader),
+ *    payloads, each one starting at a multiple of 16 bytes,
+ *    directory: one IndexFileEntry per array,
+ *    codec names (as in CODECFactory), each one followed by a zero byte.
+ *
+ * Integers are stored in the byte order of the machine. Since mmap returns
+ * page-aligned addresses, the payloads stay 16-byte aligned in memory, as
+ * SIMDBinaryPacking and the other SIMD codecs expect.
+ */
+struct IndexFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t numberofarrays;
+    uint64_t directoryoffset;// in bytes, from the start of the file
+    uint32_t numberofcodecs;
+    uint32_t codecnamesbytes;
+};
+
+struct IndexFileEntry {
+    uint32_t codec;// index in the codec names
+    uint32_t count;// number of integers (less than 2^32)
+    uint64_t offset;// of the payload in bytes, from the start of the file
+    uint64_t length;// of the payload in 32-bit words
+};
+
+enum {
+    IndexFileMagic = 0x46495046, // "FPIF"
+    IndexFileVersion = 1,
+    IndexFileAlignment = 16,
+    WriteBufferBytes = 1 << 20// buffering of IndexFileWriter
+};
+
+class IndexFileWriter {
+public:
+    IndexFileWriter(const string & filename) :
+        mFilename(filename), fd(::fopen(filename.c_str(), "wb")), position(0),
+                codecnames(), codecids(), directory(), buffer() {
+        if (fd == NULL) {
+            cerr << "IO status: " << strerror(errno) << endl;
+            cerr << "Can't open " << mFilename << endl;
+            throw runtime_error("could not open index file");
+        }
+        setvbuf(fd, NULL, _IOFBF, WriteBufferBytes);
+        IndexFileHeader header = IndexFileHeader();// filled in by close()
+        write(&header, sizeof(header));
+    }
+
+    ~IndexFileWriter() {
+        try {
+            close();
+        } catch (...) {
+            // cannot throw from a destructor
+        }
+    }
+
+    /**
+     * Compresses the array with the codec having this name in CODECFactory
+     * and appends it to the file. Returns the index of the array.
+     */
+    size_t add(const string & codecname, const uint32_t * in, const size_t length) {
+        checkCodec(codecname);
+        // the buffer is aligned, as the payload will be in the mapped file
+        IntegerCODEC & codec = *CODECFactory::getFromName(codecname);
+        buffer.resize(codec.maxCompressedWords(length));
+        size_t nvalue = buffer.size();
+        codec.encodeArray(in, length, &buffer[0], nvalue);
+        return addCompressed(codecname, &buffer[0], nvalue, length);
+    }
+
+    /**
+     * Appends an array of length integers already compressed (nvalue words)
+     * with the codec having this name in CODECFactory, so that the arrays
+     * can be compressed elsewhere (e.g., on other threads). Returns the
+     * index of the array.
+     */
+    size_t addCompressed(const string & codecname, const uint32_t * compressed,
+            const size_t nvalue, const size_t length) {
+        checkCodec(codecname);
+        if (length > numeric_limits<uint32_t>::max())
+            throw invalid_argument("IndexFileWriter: arrays are limited to 2^32 - 1 integers");
+        if (codecids.find(codecname) == codecids.end()) {
+            codecids[codecname] = static_cast<uint32_t> (codecnames.size());
+            codecnames.push_back(codecname);
+        }
+        pad();
+        IndexFileEntry entry;
+        entry.codec = codecids[codecname];
+        entry.count = static_cast<uint32_t> (length);
+        entry.offset = position;
+        entry.length = nvalue;
+        write(compressed, nvalue * sizeof(uint32_t));
+        directory.push_back(entry);
+        return directory.size() - 1;
+    }
+
+    // number of arrays added so far
+    size_t size() const {
+        return directory.size();
+    }
+
+    /**
+     * Writes the directory and the header. Called by the destructor.
+     */
+    void close() {
+        if (fd == NULL)
+            return;
+        pad();
+        IndexFileHeader header;
+        header.magic = IndexFileMagic;
+        header.version = IndexFileVersion;
+        header.numberofarrays = directory.size();
+        header.directoryoffset = position;
+        header.numberofcodecs = static_cast<uint32_t> (codecnames.size());
+        header.codecnamesbytes = 0;
+        if (!directory.empty())
+            write(&directory[0], directory.size() * sizeof(IndexFileEntry));
+        for (size_t i = 0; i < codecnames.size(); ++i) {
+            write(codecnames[i].c_str(), codecnames[i].size() + 1);
+            header.codecnamesbytes += static_cast<uint32_t> (codecnames[i].size() + 1);
+        }
+        if (fseeko(fd, 0, SEEK_SET) != 0)
+            throw runtime_error("IndexFileWriter: could not seek");
+        write(&header, sizeof(header));
+        const int result = ::fclose(fd);
+        fd = NULL;
+        if (result != 0)
+            throw runtime_error("IndexFileWriter: could not close the file");
+    }
+
+private:
+    IndexFileWriter(const IndexFileWriter &);
+    IndexFileWriter & operator=(const IndexFileWriter &);
+
+    void checkCodec(const string & codecname) const {
+        if (fd == NULL)
+            throw logic_error("IndexFileWriter: the file is closed");
+        if (CODECFactory::scodecmap.find(codecname) == CODECFactory::scodecmap.end())
+            throw invalid_argument("IndexFileWriter: no codec named " + codecname);
+    }
+
+    void write(const void * data, const size_t bytes) {
+        if (fwrite(data, 1, bytes, fd) != bytes) {
+            cerr << "IO status: " << strerror(errno) << endl;
+            throw runtime_error("IndexFileWriter: bad write");
+        }
+        position += bytes;
+    }
+
+    // zeros up to the next multiple of IndexFileAlignment
+    void pad() {
+        const char zeros[IndexFileAlignment] = { 0 };
+        if (position % IndexFileAlignment != 0)
+            write(zeros, IndexFileAlignment - position % IndexFileAlignment);
+    }
+
+    string mFilename;
+    FILE * fd;
+    uint64_t position;
+    vector<string> codecnames;
+    map<string, uint32_t> codecids;
+    vector<IndexFileEntry> directory;
+    vector<uint32_t, cacheallocator> buffer;
+};
+
+/**
+ * Maps an index file in memory. The compressed arrays can be passed
+ * directly to decodeArray (as done by decode), and decoding can proceed
+ * from several threads.
+ */
+class IndexFileReader {
+public:
+    IndexFileReader(const string & filename) :
+        mFilename(filename), fd(-1), mapped(NULL), mappedbytes(0),
+                header(NULL), directory(NULL), codecnames(), codecs() {
+        fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            cerr << "IO status: " << strerror(errno) << endl;
+            cerr << "Can't open " << mFilename << endl;
+            throw runtime_error("could not open index file");
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close();
+            throw runtime_error("IndexFileReader: could not stat the file");
+        }
+        mappedbytes = static_cast<size_t> (st.st_size);
+        if (mappedbytes < sizeof(IndexFileHeader)) {
+            close();
+            throw runtime_error("IndexFileReader: not an index file");
+        }
+        void * addr = mmap(NULL, mappedbytes, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            close();
+            throw runtime_error("IndexFileReader: could not map the file");
+        }
+        mapped = static_cast<const uint8_t *> (addr);
+        header = reinterpret_cast<const IndexFileHeader *> (mapped);
+        if ((header->magic != IndexFileMagic) || (header->version != IndexFileVersion)) {
+            close();
+            throw runtime_error("IndexFileReader: not an index file (or wrong version)");
+        }
+        // the sums below cannot wrap around: each term is first checked
+        // against what is left of the file
+        const uint64_t directoryoffset = header->directoryoffset;
+        if ((directoryoffset < sizeof(IndexFileHeader)) || (directoryoffset > mappedbytes)
+                || (directoryoffset % alignof(IndexFileEntry) != 0)
+                || (header->numberofarrays > (mappedbytes - directoryoffset)
+                        / sizeof(IndexFileEntry))) {
+            close();
+            throw runtime_error("IndexFileReader: truncated index file");
+        }
+        const uint64_t namesoffset = directoryoffset + header->numberofarrays
+                * sizeof(IndexFileEntry);
+        if (header->codecnamesbytes > mappedbytes - namesoffset) {
+            close();
+            throw runtime_error("IndexFileReader: truncated index file");
+        }
+        directory = reinterpret_cast<const IndexFileEntry *> (mapped + directoryoffset);
+        const char * name = reinterpret_cast<const char *> (mapped + namesoffset);
+        const char * const namesend = name + header->codecnamesbytes;
+        for (uint32_t c = 0; c < header->numberofcodecs; ++c) {
+            const void * const zero = memchr(name, 0, namesend - name);
+            if (zero == NULL) {
+                close();
+                throw runtime_error("IndexFileReader: corrupted codec names");
+            }
+            codecnames.push_back(string(name, static_cast<const char *> (zero)));
+            name = static_cast<const char *> (zero) + 1;
+            if (CODECFactory::scodecmap.find(codecnames.back())
+                    == CODECFactory::scodecmap.end()) {
+                close();
+                throw runtime_error("IndexFileReader: unknown codec " + codecnames.back());
+            }
+            codecs.push_back(CODECFactory::getFromName(codecnames.back()));
+        }
+        if (name != namesend) {
+            close();
+            throw runtime_error("IndexFileReader: corrupted codec names");
+        }
+        for (size_t i = 0; i < size(); ++i)
+            if ((directory[i].codec >= codecs.size()) || (directory[i].offset
+                    < sizeof(IndexFileHeader)) || (directory[i].offset % IndexFileAlignment
+                    != 0) || (directory[i].offset > directoryoffset) || (directory[i].length
+                    > (directoryoffset - directory[i].offset) / sizeof(uint32_t))) {
+                close();
+                throw runtime_error("IndexFileReader: corrupted directory");
+            }
+    }
+
+    ~IndexFileReader() {
+        close();
+    }
+
+    // number of arrays
+    size_t size() const {
+        return header == NULL ? 0 : static_cast<size_t> (header->numberofarrays);
+    }
+
+    // number of integers in array i
+    size_t count(const size_t i) const {
+        return directory[i].count;
+    }
+
+    // the compressed array i, within the mapped file
+    const uint32_t * compressed(const size_t i) const {
+        return reinterpret_cast<const uint32_t *> (mapped + directory[i].offset);
+    }
+
+    // length of the compressed array i in 32-bit words
+    size_t compressedLength(const size_t i) const {
+        return static_cast<size_t> (directory[i].length);
+    }
+
+    const string & codecName(const size_t i) const {
+        return codecnames[directory[i].codec];
+    }
+
+    /**
+     * Decodes array i to out (which should have room for count(i) integers,
+     * plus whatever slack the codec needs), nvalue gets the number of integers.
+     */
+    void decode(const size_t i, uint32_t * out, size_t & nvalue) const {
+        codecs[directory[i].codec]->decodeArray(compressed(i), compressedLength(i),
+                out, nvalue);
+    }
+
+    void close() {
+        if (mapped != NULL) {
+            munmap(const_cast<uint8_t *> (mapped), mappedbytes);
+            mapped = NULL;
+            header = NULL;
+            directory = NULL;
+        }
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+private:
+    IndexFileReader(const IndexFileReader &);
+    IndexFileReader & operator=(const IndexFileReader &);
+
+    string mFilename;
+    int fd;
+    const uint8_t * mapped;
+    size_t mappedbytes;
+    const IndexFileHeader * header;
+    const IndexFileEntry * directory;
+    vector<string> codecnames;
+    vector<shared_ptr<IntegerCODEC> > codecs;
+};
+
+#endif /* INDEXFILE_H_ */
@@ -0,0 +1,284 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef INTERSECTION_H_
+#define INTERSECTION_H_
+
+#include "common.h"
+#include "skipindex.h"
+#include "simdfastpfor.h"
+
+/**
+ * Intersection of sorted arrays of distinct integers (e.g., posting lists).
+ *
+ * The functions write the intersection to out and return its size. Because
+ * the SIMD kernels store 4 integers at a time, out should have room for
+ * the smallest of the two arrays plus 4 integers.
+ */
+
+/**
+ * pshufb masks moving the 32-bit words selected by a 4-bit mask
+ * to the front of the register.
+ */
+struct IntersectionShuffleTable {
+    IntersectionShuffleTable() : masks() {
+        for (uint32_t m = 0; m < 16; ++m) {
+            uint32_t w = 0;
+            for (uint32_t k = 0; k < 4; ++k) {
+                if ((m & (1U << k)) == 0)
+                    continue;
+                for (uint32_t b = 0; b < 4; ++b)
+                    masks[m][4 * w + b] = static_cast<uint8_t> (4 * k + b);
+                ++w;
+            }
+            for (uint32_t b = 4 * w; b < 16; ++b)
+                masks[m][b] = 0x80;// zero
+        }
+    }
+    __attribute__ ((aligned (16))) uint8_t masks[16][16];
+
+    static const IntersectionShuffleTable & get() {
+        static const IntersectionShuffleTable table;
+        return table;
+    }
+};
+
+/**
+ * Scalar merge, used for the tails of the SIMD kernels.
+ */
+inline size_t intersectScalar(const uint32_t * A, const size_t lenA,
+        const uint32_t * B, const size_t lenB, uint32_t * out) {
+    size_t i = 0, j = 0, count = 0;
+    while ((i < lenA) && (j < lenB)) {
+        if (A[i] < B[j])
+            ++i;
+        else if (B[j] < A[i])
+            ++j;
+        else {
+            out[count++] = A[i];
+            ++i;
+            ++j;
+        }
+    }
+    return count;
+}
+
+/**
+ * Compares blocks of 4 integers all-against-all (with 3 rotations) and uses
+ * a shuffle to write the matches. Best when the arrays have similar sizes.
+ *
+ * Reference: Schlegel et al., Fast Sorted-Set Intersection using SIMD
+ * Instructions, ADMS 2011.
+ */
+inline size_t intersectSIMD(const uint32_t * A, const size_t lenA,
+        const uint32_t * B, const size_t lenB, uint32_t * out) {
+    const IntersectionShuffleTable & table = IntersectionShuffleTable::get();
+    size_t i = 0, j = 0, count = 0;
+    const size_t stA = lenA / 4 * 4, stB = lenB / 4 * 4;
+    while ((i < stA) && (j < stB)) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *> (A + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *> (B + j));
+        const uint32_t amax = A[i + 3], bmax = B[j + 3];
+        __m128i cmp = _mm_cmpeq_epi32(va, vb);
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1));
+        cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1));
+        cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1));
+        cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, vb));
+        const int mask = _mm_movemask_ps(_mm_castsi128_ps(cmp));
+        const __m128i matches = _mm_shuffle_epi8(va,
+                _mm_load_si128(reinterpret_cast<const __m128i *> (table.masks[mask])));
+        _mm_storeu_si128(reinterpret_cast<__m128i *> (out + count), matches);
+        count += __builtin_popcount(mask);
+        if (amax <= bmax)
+            i += 4;
+        if (bmax <= amax)
+            j += 4;
+    }
+    return count + intersectScalar(A + i, lenA - i, B + j, lenB - j, out + count);
+}
+
+/**
+ * For each integer of the small array, we gallop over the large array by
+ * blocks of 8 integers, and compare the block with SIMD instructions.
+ * Best when the large array is much larger.
+ */
+inline size_t intersectGalloping(const uint32_t * small, const size_t lenSmall,
+        const uint32_t * large, const size_t lenLarge, uint32_t * out) {
+    size_t i = 0, j = 0, count = 0;
+    for (; (i < lenSmall) && (j + 8 <= lenLarge); ++i) {
+        const uint32_t target = small[i];
+        if (large[j + 7] < target) {
+            // invariant: large[lo + 7] < target
+            size_t lo = j, step = 8, hi = j + 8;
+            while ((hi + 8 <= lenLarge) && (large[hi + 7] < target)) {
+                lo = hi;
+                step *= 2;
+                hi = lo + step;
+            }
+            if (hi + 8 > lenLarge) {
+                hi = lenLarge - 8;
+                if (large[hi + 7] < target) {
+                    j = lenLarge;
+                    break;
+                }
+            }
+            // large[lo + 7] < target <= large[hi + 7]
+            while (hi > lo + 8) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (large[mid + 7] < target)
+                    lo = mid;
+                else
+                    hi = mid;
+            }
+            j = hi;
+        }
+        const __m128i t = _mm_set1_epi32(target);
+        const __m128i cmp = _mm_or_si128(
+                _mm_cmpeq_epi32(t, _mm_loadu_si128(reinterpret_cast<const __m128i *> (large + j))),
+                _mm_cmpeq_epi32(t, _mm_loadu_si128(reinterpret_cast<const __m128i *> (large + j + 4))));
+        if (_mm_movemask_epi8(cmp) != 0)
+            out[count++] = target;
+    }
+    return count + intersectScalar(small + i, lenSmall - i, large + j,
+            lenLarge - j, out + count);
+}
+
+/**
+ * Picks the kernel according to the ratio of the sizes.
+ */
+inline size_t intersectArrays(const uint32_t * A, const size_t lenA,
+        const uint32_t * B, const size_t lenB, uint32_t * out) {
+    enum { GallopingRatio = 32 };
+    if (lenA * GallopingRatio < lenB)
+        return intersectGalloping(A, lenA, B, lenB, out);
+    if (lenB * GallopingRatio < lenA)
+        return intersectGalloping(B, lenB, A, lenA, out);
+    return intersectSIMD(A, lenA, B, lenB, out);
+}
+
+/**
+ * Intersection of lists compressed with DeltaSkipIndex. Using the skip
+ * table, we only decode the chunks whose range of values overlaps a chunk
+ * of the other list.
+ *
+ * An instance keeps decoding buffers: use one per thread.
+ */
+template<class CODEC = SIMDBinaryPacking>
+class CompressedIntersection {
+public:
+    typedef DeltaSkipIndex<CODEC> SkipIndex;
+
+    CompressedIntersection(SkipIndex & s) :
+        dsi(s), bufferA(s.ChunkSize), bufferB(s.ChunkSize), cachedlist(NULL),
+                cachedchunk(0) {
+    }
+
+    /**
+     * Intersects the sorted array A with the compressed list B.
+     */
+    size_t intersect(const uint32_t * A, const size_t lenA, const uint32_t * B,
+            uint32_t * out) {
+        cachedlist = NULL;
+        size_t cb = 0;
+        return intersectFrom(A, lenA, B, cb, out);
+    }
+
+    /**
+     * Intersects the compressed lists A and B.
+     */
+    size_t intersect(const uint32_t * A, const uint32_t * B, uint32_t * out) {
+        if (SkipIndex::length(A) > SkipIndex::length(B))
+            swap(A, B);
+        cachedlist = NULL;
+        const size_t na = SkipIndex::numberOfChunks(A);
+        const size_t nb = SkipIndex::numberOfChunks(B);
+        size_t count = 0;
+        size_t cb = 0;
+        for (size_t ca = 0; ca < na; ++ca) {
+            const uint32_t lowA = SkipIndex::chunkBase(A, ca);
+            const uint32_t maxA = SkipIndex::chunkMax(A, ca);
+            while ((cb < nb) && (SkipIndex::chunkMax(B, cb) < lowA))
+                ++cb;
+            if (cb == nb)
+                break;
+            if (SkipIndex::chunkBase(B, cb) > maxA)
+                continue;// no need to decode this chunk
+            dsi.decodeChunk(A, ca, &bufferA[0]);
+            count += intersectFrom(&bufferA[0], SkipIndex::chunkLength(A, ca), B, cb,
+                    out + count);
+        }
+        return count;
+    }
+
+    /**
+     * Intersects several compressed lists, starting with the shortest ones.
+     */
+    size_t intersect(vector<const uint32_t *> lists, uint32_t * out) {
+        if (lists.empty())
+            return 0;
+        sort(lists.begin(), lists.end(), [](const uint32_t * x, const uint32_t * y) {
+            return SkipIndex::length(x) < SkipIndex::length(y);
+        });
+        if (lists.size() == 1) {
+            size_t nvalue = SkipIndex::length(lists[0]);
+            dsi.decodeArray(lists[0], 0, out, nvalue);
+            return nvalue;
+        }
+        size_t count = intersect(lists[0], lists[1], out);
+        vector<uint32_t, cacheallocator> tmp(count + 4);
+        for (size_t k = 2; (k < lists.size()) && (count > 0); ++k) {
+            tmp.assign(out, out + count);
+            count = intersect(&tmp[0], count, lists[k], out);
+        }
+        return count;
+    }
+
+private:
+    CompressedIntersection(const CompressedIntersection &);
+    CompressedIntersection & operator=(const CompressedIntersection &);
+
+    /**
+     * Intersects A with the chunks of B starting at chunk cb. On return, cb is the
+     * last chunk we looked at (a later part of A might still need it).
+     */
+    size_t intersectFrom(const uint32_t * A, const size_t lenA,
+            const uint32_t * B, size_t & cb, uint32_t * out) {
+        const size_t nb = SkipIndex::numberOfChunks(B);
+        size_t count = 0;
+        size_t i = 0;
+        for (; (cb < nb) && (i < lenA); ++cb) {
+            const uint32_t maxB = SkipIndex::chunkMax(B, cb);
+            if (maxB < A[i])
+                continue;// we skip this chunk of B without decoding it
+            const size_t end = upper_bound(A + i, A + lenA, maxB) - A;
+            i = lower_bound(A + i, A + end, SkipIndex::chunkBase(B, cb)) - A;
+            if (i < end) {
+                if ((cachedlist != B) || (cachedchunk != cb)) {
+                    dsi.decodeChunk(B, cb, &bufferB[0]);
+                    cachedlist = B;
+                    cachedchunk = cb;
+                }
+                count += intersectArrays(A + i, end - i, &bufferB[0],
+                        SkipIndex::chunkLength(B, cb), out + count);
+            }
+            i = end;
+            if (i == lenA)
+                break;// the next part of A might still need chunk cb
+        }
+        return count;
+    }
+
+    SkipIndex & dsi;
+    vector<uint32_t, cacheallocator> bufferA;
+    vector<uint32_t, cacheallocator> bufferB;
+    const uint32_t * cachedlist;
+    size_t cachedchunk;
+};
+
+#endif /* INTERSECTION_H_ */
@@ -0,0 +1,90 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+#include "common.h"
+
+/**
+ * Histogram of latencies (in cycles, see CPUBenchmark) for the percentiles
+ * (p50, p99, p999...). The values below 32 have their own bucket, the
+ * others share a bucket with the values having the same 5 most significant
+ * bits: each bucket is within 1/16 of its values and we never need more
+ * than Buckets counters, however many samples we have.
+ */
+class LatencyHistogram {
+public:
+    enum {
+        Buckets = 61 * 16
+    };
+
+    LatencyHistogram() :
+        counts(), total(0) {
+    }
+
+    void add(const uint64_t cycles) {
+        if (counts.empty())
+            counts.resize(Buckets);
+        ++counts[bucket(cycles)];
+        ++total;
+    }
+
+    LatencyHistogram & operator+=(const LatencyHistogram & other) {
+        if (other.total == 0)
+            return *this;
+        if (counts.empty())
+            counts.resize(Buckets);
+        for (uint32_t k = 0; k < Buckets; ++k)
+            counts[k] += other.counts[k];
+        total += other.total;
+        return *this;
+    }
+
+    uint64_t count() const {
+        return total;
+    }
+
+    /**
+     * The latency below which we find the fraction p of the samples (e.g.,
+     * p = 0.99 for p99), as the middle of its bucket; 0 if there is no sample.
+     */
+    uint64_t percentile(const double p) const {
+        if (total == 0)
+            return 0;
+        const uint64_t rank = max<uint64_t> (1, static_cast<uint64_t> (ceil(p
+                * static_cast<double> (total))));
+        uint64_t seen = 0;
+        for (uint32_t k = 0; k < Buckets; ++k) {
+            seen += counts[k];
+            if (seen >= rank)
+                return lowerBound(k) + (lowerBound(k + 1) - lowerBound(k)) / 2;
+        }
+        return lowerBound(Buckets - 1);
+    }
+
+    static uint32_t bucket(const uint64_t v) {
+        if (v < 32)
+            return static_cast<uint32_t> (v);
+        const uint32_t b = 64 - __builtin_clzll(v);// at least 6
+        return (b - 5) * 16 + static_cast<uint32_t> (v >> (b - 5));
+    }
+
+    // the smallest value in bucket k
+    static uint64_t lowerBound(const uint32_t k) {
+        if (k < 32)
+            return k;
+        const uint32_t e = k / 16 - 1;
+        return static_cast<uint64_t> (k - 16 * e) << e;
+    }
+
+private:
+    vector<uint64_t> counts;
+    uint64_t total;
+};
+
+#endif /* LATENCYHISTOGRAM_H_ */
@@ -8,7 +8,13 @@
 #ifndef MAROPUPARSER_H_
 #define MAROPUPARSER_H_
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <future>
 #include "common.h"
+#include "memutil.h"
 
 using namespace std;
 
@@ -82,4 +88,185 @@ public:
     }
 };
 
+/**
+ * Same file format as MaropuGapReader, but the file is memory mapped
+ * (with madvise(MADV_SEQUENTIAL)): nextList gives a pointer to the
+ * integers within the mapped file, without copying.
+ */
+class MaropuMappedReader {
+public:
+    MaropuMappedReader(const string & filename) :
+        mFilename(filename), fd(-1), mapped(NULL), mappedwords(0), pos(0) {
+    }
+
+    ~MaropuMappedReader() {
+        close();
+    }
+
+    // return false if no more data can be loaded
+    bool nextList(const uint32_t * & data, size_t & length) {
+        if (mapped == NULL) {
+            cerr << "You forgot to open the file." << endl;
+            return false;
+        }
+        if (pos >= mappedwords)
+            return false;
+        length = mapped[pos];
+        if (pos + 1 + length > mappedwords) {
+            cerr << "Error reading from file " << mFilename << endl;
+            throw runtime_error("bad read");
+        }
+        data = mapped + pos + 1;
+        pos += 1 + length;
+        return true;
+    }
+
+    // like MaropuGapReader::loadIntegers (this copies the integers)
+    template<class container>
+    bool loadIntegers(container & buffer) {
+        const uint32_t * data;
+        size_t length;
+        if (!nextList(data, length))
+            return false;
+        buffer.assign(data, data + length);
+        return true;
+    }
+
+    void open() {
+        close();
+        fd = ::open(mFilename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            cerr << "IO status: " << strerror(errno) << endl;
+            cerr << "Can't open " << mFilename << endl;
+            throw runtime_error("could not open temp file");
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close();
+            throw runtime_error("could not stat file");
+        }
+        mappedwords = static_cast<size_t> (st.st_size) / sizeof(uint32_t);
+        pos = 0;
+        if (mappedwords == 0)
+            return;// nothing to map, nextList returns false
+        void * addr = mmap(NULL, mappedwords * sizeof(uint32_t), PROT_READ,
+                MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            close();
+            throw runtime_error("could not map file");
+        }
+        madvise(addr, mappedwords * sizeof(uint32_t), MADV_SEQUENTIAL);
+        mapped = static_cast<const uint32_t *> (addr);
+    }
+
+    void close() {
+        if (mapped != NULL) {
+            munmap(const_cast<uint32_t *> (mapped), mappedwords * sizeof(uint32_t));
+            mapped = NULL;
+        }
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+        mappedwords = 0;
+        pos = 0;
+    }
+
+    // we are done with what was read so far: the kernel can drop these pages
+    void release() {
+        if (mapped == NULL)
+            return;
+        const size_t pagewords = static_cast<size_t> (sysconf(_SC_PAGESIZE)) / sizeof(uint32_t);
+        const size_t upto = pos / pagewords * pagewords;
+        if (upto > 0)
+            madvise(const_cast<uint32_t *> (mapped), upto * sizeof(uint32_t), MADV_DONTNEED);
+    }
+
+private:
+    MaropuMappedReader(const MaropuMappedReader &);
+    MaropuMappedReader & operator=(const MaropuMappedReader &);
+
+    string mFilename;
+    int fd;
+    const uint32_t * mapped;
+    size_t mappedwords;
+    size_t pos;
+};
+
+/**
+ * Loads a Maropu file block by block (a block being a set of lists with
+ * about blocksize integers) with the next block loading in a background
+ * thread while you process the current one.
+ *
+ * MaropuBlockReader reader(filename);
+ * vector<vector<uint32_t, cacheallocator> > datas;
+ * while (reader.nextBlock(datas)) { ... }
+ */
+class MaropuBlockReader {
+public:
+    typedef vector<vector<uint32_t, cacheallocator> > block;
+
+    /**
+     * Lists shorter than minlength or longer than maxlength are skipped,
+     * we stop after maxcounter lists.
+     */
+    MaropuBlockReader(const string & filename, size_t blocksize = 104857600,
+            size_t minlength = 1,
+            size_t maxlength = std::numeric_limits<uint32_t>::max(),
+            size_t maxcounter = std::numeric_limits<size_t>::max()) :
+        reader(filename), BlockSize(blocksize), MinLength(minlength),
+                MaxLength(maxlength), MaxCounter(maxcounter), counter(0), next() {
+        reader.open();
+        next = async(launch::async, &MaropuBlockReader::loadBlock, this);
+    }
+
+    ~MaropuBlockReader() {
+        if (next.valid())
+            next.wait();
+    }
+
+    /**
+     * Replaces datas by the next block, returns false when we are done.
+     */
+    bool nextBlock(block & datas) {
+        if (!next.valid())
+            return false;
+        datas = next.get();
+        if (datas.empty())
+            return false;
+        next = async(launch::async, &MaropuBlockReader::loadBlock, this);
+        return true;
+    }
+
+private:
+    MaropuBlockReader(const MaropuBlockReader &);
+    MaropuBlockReader & operator=(const MaropuBlockReader &);
+
+    // only one block is loaded at a time
+    block loadBlock() {
+        block datas;
+        size_t datastotalsize = 0;
+        const uint32_t * data;
+        size_t length;
+        while ((counter < MaxCounter) && (datastotalsize < BlockSize)
+                && reader.nextList(data, length)) {
+            if ((length < MinLength) || (length > MaxLength))
+                continue;
+            ++counter;
+            datas.push_back(vector<uint32_t, cacheallocator> (data, data + length));
+            datastotalsize += length;
+        }
+        reader.release();
+        return datas;
+    }
+
+    MaropuMappedReader reader;
+    const size_t BlockSize;
+    const size_t MinLength;
+    const size_t MaxLength;
+    const size_t MaxCounter;
+    size_t counter;// only used by the loading thread
+    future<block> next;
+};
+
 #endif /* MAROPUPARSER_H_ */
@@ -9,6 +9,11 @@
 #define MEMUTIL_H_
 
 #include "common.h"
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 
 template<class T, size_t alignment>
@@ -19,8 +24,135 @@ T * moveToBoundary(T * inbyte) {
 
 
 
+/**
+ * How AlignedSTLAllocator gets its large blocks (minimumBytes or more,
+ * such as the blocks of inmemorybenchmark or the decoding buffers). With
+ * the default policy, they come from operator new, as the small ones do.
+ * Otherwise, they are mapped (Linux only):
+ *   - pages: TransparentHugePages asks the kernel to back the block with
+ *     2 MB pages (madvise(MADV_HUGEPAGE)); HugePages2MB and HugePages1GB
+ *     map reserved huge pages (MAP_HUGETLB, see /proc/sys/vm/nr_hugepages)
+ *     and fall back on transparent huge pages when none are left;
+ *   - placement (mbind): LocalNode prefers the node of the allocating
+ *     thread, Interleaved spreads the pages over the nodes we may use,
+ *     BoundNode puts them all on node (one of the first 64). FirstTouch
+ *     leaves it to the first thread writing each page, as the kernel
+ *     does by default.
+ * A 2 MB page covers 512 pages of 4 KB, so sequential decoding over large
+ * arrays walks the page tables much less often.
+ *
+ * The policy is process-wide: set it before allocating, not while other
+ * threads allocate. The blocks already allocated keep their pages.
+ */
+struct MemoryPolicy {
+    enum Pages {
+        SmallPages, TransparentHugePages, HugePages2MB, HugePages1GB
+    };
+    enum Placement {
+        FirstTouch, LocalNode, Interleaved, BoundNode
+    };
+
+    MemoryPolicy() :
+        pages(SmallPages), placement(FirstTouch), node(0), minimumBytes(size_t(1) << 21) {
+    }
+
+    // whether the large blocks are mapped
+    bool mapsLargeBlocks() const {
+#ifdef __linux__
+        return (pages != SmallPages) || (placement != FirstTouch);
+#else
+        return false;
+#endif
+    }
+
+    Pages pages;
+    Placement placement;
+    uint32_t node;// for BoundNode
+    size_t minimumBytes;
+};
+
+inline MemoryPolicy & memoryPolicy() {
+    static MemoryPolicy policy;
+    return policy;
+}
+
+#ifdef __linux__
+// applies the placement of policy to the mapped block p (a hint: we ignore failures)
+inline void placeMappedBlock(void * p, const size_t bytes, const MemoryPolicy & policy) {
+    enum {
+        MPOL_PREFERRED_ = 1, MPOL_BIND_ = 2, MPOL_INTERLEAVE_ = 3, MPOL_F_MEMS_ALLOWED_ = 4
+    };
+    const unsigned long maxnode = 8 * sizeof(unsigned long) + 1;// the kernel reads maxnode - 1 bits
+    unsigned long mask = 0;
+    long mode = 0;
+    switch (policy.placement) {
+    case MemoryPolicy::FirstTouch:
+        return;
+    case MemoryPolicy::LocalNode: {
+        unsigned cpu = 0, node = 0;
+        if ((syscall(SYS_getcpu, &cpu, &node, NULL) != 0) || (node >= 8 * sizeof(mask)))
+            return;
+        mask = 1UL << node;
+        mode = MPOL_PREFERRED_;
+        break;
+    }
+    case MemoryPolicy::Interleaved: {
+        int current = 0;
+        if (syscall(SYS_get_mempolicy, &current, &mask, maxnode, NULL, MPOL_F_MEMS_ALLOWED_) != 0)
+            return;
+        mode = MPOL_INTERLEAVE_;
+        break;
+    }
+    case MemoryPolicy::BoundNode:
+        if (policy.node >= 8 * sizeof(mask))
+            return;
+        mask = 1UL << policy.node;
+        mode = MPOL_BIND_;
+        break;
+    }
+    syscall(SYS_mbind, p, bytes, mode, &mask, maxnode, 0);
+}
+
+/**
+ * Maps at least bytes bytes (zeros) as policy asks, mapped gets the length
+ * of the mapping (for unmapLargeBlock). Throws bad_alloc.
+ */
+inline void * mapLargeBlock(const size_t bytes, size_t & mapped, const MemoryPolicy & policy) {
+    void * p = MAP_FAILED;
+    if ((policy.pages == MemoryPolicy::HugePages2MB) || (policy.pages
+            == MemoryPolicy::HugePages1GB)) {
+        const uint32_t pagebits = policy.pages == MemoryPolicy::HugePages1GB ? 30 : 21;
+        const size_t page = size_t(1) << pagebits;
+        mapped = (bytes + page - 1) / page * page;
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+        flags |= static_cast<int> (pagebits << MAP_HUGE_SHIFT);
+#endif
+        p = mmap(NULL, mapped, PROT_READ | PROT_WRITE, flags, -1, 0);
+    }
+    if (p == MAP_FAILED) {
+        const size_t page = static_cast<size_t> (sysconf(_SC_PAGESIZE));
+        mapped = (bytes + page - 1) / page * page;
+        p = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+            throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+        if (policy.pages != MemoryPolicy::SmallPages)
+            madvise(p, mapped, MADV_HUGEPAGE);
+#endif
+    }
+    placeMappedBlock(p, mapped, policy);
+    return p;
+}
+
+inline void unmapLargeBlock(void * p, const size_t mapped) {
+    munmap(p, mapped);
+}
+#endif
+
 // use this when calling STL object if you want
-// their memory to be aligned on cache lines
+// their memory to be aligned on cache lines (large blocks follow
+// memoryPolicy(), huge pages and NUMA placement)
 template<class T, size_t alignment>
 class AlignedSTLAllocator {
 public:
@@ -46,6 +178,12 @@ public:
         return &value;
     }
 
+    enum {
+        // before a mapped block: its mapping length and offset, and the alignment
+        MappedHeader = (2 * sizeof(size_t) + alignment - 1) / alignment * alignment
+    };
+    static const size_t MappedBlock = ~(~static_cast<size_t> (0) >> 1);// flags the offset
+
     /* constructors and destructor
      * - nothing to do because the allocator has no state
      */
@@ -67,6 +205,19 @@ public:
      *  This implementation is potentially unsafe on some compilers.
      */
     pointer allocate(size_type num, const void* = 0) {
+#ifdef __linux__
+        const MemoryPolicy & policy = memoryPolicy();
+        if (policy.mapsLargeBlocks() && (num * sizeof(T) >= policy.minimumBytes)) {
+            // the length of the mapping and the offset (flagged) before the block
+            size_t mapped;
+            uint8_t * const base = reinterpret_cast<uint8_t *> (mapLargeBlock(MappedHeader
+                    + num * sizeof(T), mapped, policy));
+            size_t * answer = reinterpret_cast<size_t *> (base + MappedHeader);
+            *(answer - 1) = MappedHeader | MappedBlock;
+            *(answer - 2) = mapped;
+            return reinterpret_cast<pointer> (answer);
+        }
+#endif
         /**
          * The nasty trick here is to make the position of the actual pointer
          * within the newly allocated memory. The alternative is to use
@@ -93,6 +244,13 @@ public:
     void deallocate(pointer p, size_type /*num*/) {
         const size_t * assize_t = reinterpret_cast<size_t *> (p);
         const size_t offset = assize_t[-1];
+#ifdef __linux__
+        if ((offset & MappedBlock) != 0) {
+            unmapLargeBlock(reinterpret_cast<uint8_t *> (p) - (offset & ~MappedBlock),
+                    assize_t[-2]);
+            return;
+        }
+#endif
         ::operator delete(reinterpret_cast<pointer>(reinterpret_cast<uintptr_t> (p) - offset));
     }
 };
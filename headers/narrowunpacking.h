@@ -0,0 +1,87 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef NARROWUNPACKING_H_
+#define NARROWUNPACKING_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+#include "simdbitpacking.h"
+
+/**
+ * Unpacks 128 integers packed with bit bits by SIMD_fastpack_32 (bit * 4
+ * words, aligned) to uint16_t (bit <= 16) or uint8_t (bit <= 8): each
+ * vector of integers is narrowed in registers (_mm_packus_epi32, or
+ * _mm_packs_epi32 then _mm_packus_epi16) before it is stored, so we
+ * write 2 or 4 times fewer bytes than SIMD_fastunpack_32. out needs not
+ * be aligned.
+ *
+ * The implementation (src/narrowunpacking.cpp) is compiled with -msse4.1
+ * and, in the avx2 namespace, with -mavx2 (src/narrowunpacking_avx2.cpp).
+ */
+void SIMD_unpack_32to16(const __m128i * in, uint16_t * out, const uint32_t bit);
+void SIMD_unpack_32to8(const __m128i * in, uint8_t * out, const uint32_t bit);
+namespace avx2 {
+void SIMD_unpack_32to16(const __m128i * in, uint16_t * out, const uint32_t bit);
+void SIMD_unpack_32to8(const __m128i * in, uint8_t * out, const uint32_t bit);
+}
+
+/**
+ * The same for 32 integers packed with bit bits by fastpack (bit words),
+ * as BP32 and FastPFor do: the shifts and masks go straight to the narrow
+ * output.
+ */
+void fastunpack_narrow(const uint32_t * in, uint16_t * out, const uint32_t bit);
+void fastunpack_narrow(const uint32_t * in, uint8_t * out, const uint32_t bit);
+
+// the number of bits of the narrow output types
+template<class T>
+inline uint32_t narrowBits() {
+    return static_cast<uint32_t> (8 * sizeof(T));
+}
+
+/**
+ * Copies length integers to out, throwing logic_error (with message
+ * what) if one does not fit in T.
+ */
+template<class T>
+inline void narrowCopy(const uint32_t * in, const size_t length, T * out, const char * what) {
+    uint32_t all = 0;
+    for (size_t i = 0; i < length; ++i) {
+        all |= in[i];
+        out[i] = static_cast<T> (in[i]);
+    }
+    if ((all >> (narrowBits<T>() - 1) >> 1) != 0)
+        throw std::logic_error(what);
+}
+
+// SIMD_unpack_32to16 or SIMD_unpack_32to8 with the best build for this processor
+inline void SIMD_fastunpack_narrow(const __m128i * in, uint16_t * out, const uint32_t bit) {
+    if (cpuSupportsAVX2()) {
+        avx2::SIMD_unpack_32to16(in, out, bit);
+    } else if (cpuSupportsSSE41()) {
+        SIMD_unpack_32to16(in, out, bit);
+    } else {
+        __attribute__ ((aligned (16))) uint32_t buffer[128];
+        SIMD_fastunpack_32(in, buffer, bit);
+        narrowCopy(buffer, 128, out, "SIMD_fastunpack_narrow: bit width too large");
+    }
+}
+
+inline void SIMD_fastunpack_narrow(const __m128i * in, uint8_t * out, const uint32_t bit) {
+    if (cpuSupportsAVX2()) {
+        avx2::SIMD_unpack_32to8(in, out, bit);
+    } else if (cpuSupportsSSE41()) {
+        SIMD_unpack_32to8(in, out, bit);
+    } else {
+        __attribute__ ((aligned (16))) uint32_t buffer[128];
+        SIMD_fastunpack_32(in, buffer, bit);
+        narrowCopy(buffer, 128, out, "SIMD_fastunpack_narrow: bit width too large");
+    }
+}
+
+#endif /* NARROWUNPACKING_H_ */
@@ -0,0 +1,263 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef NEONSSE_H_
+#define NEONSSE_H_
+
+/**
+ * The SSE intrinsics (up to SSE4.1) of the 128-bit kernels and codecs,
+ * written with NEON intrinsics, so that the same code builds on aarch64
+ * (common.h includes this file instead of immintrin.h). __m128i holds the
+ * same four 32-bit lanes (little endian) as on x86, so the kernels write
+ * the same streams: data compressed on x86 decodes on ARM and vice versa.
+ *
+ * Only what the library uses is here. As with SSE, the shifts by an
+ * immediate accept any count (32 or more gives zeros); _mm_slli_si128
+ * needs a count from 1 to 15 and _mm_srli_si128 from 0 to 15.
+ */
+#include <arm_neon.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int64x2_t __m128i;
+typedef float32x4_t __m128;
+
+#define NEONSSE_U8(x) vreinterpretq_u8_s64(x)
+#define NEONSSE_S8(x) vreinterpretq_s8_s64(x)
+#define NEONSSE_U16(x) vreinterpretq_u16_s64(x)
+#define NEONSSE_S16(x) vreinterpretq_s16_s64(x)
+#define NEONSSE_U32(x) vreinterpretq_u32_s64(x)
+#define NEONSSE_S32(x) vreinterpretq_s32_s64(x)
+#define NEONSSE_U64(x) vreinterpretq_u64_s64(x)
+#define NEONSSE_FROM_U8(x) vreinterpretq_s64_u8(x)
+#define NEONSSE_FROM_S8(x) vreinterpretq_s64_s8(x)
+#define NEONSSE_FROM_U16(x) vreinterpretq_s64_u16(x)
+#define NEONSSE_FROM_S16(x) vreinterpretq_s64_s16(x)
+#define NEONSSE_FROM_U32(x) vreinterpretq_s64_u32(x)
+#define NEONSSE_FROM_S32(x) vreinterpretq_s64_s32(x)
+#define NEONSSE_FROM_U64(x) vreinterpretq_s64_u64(x)
+
+#define _MM_SHUFFLE(fp3, fp2, fp1, fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))
+
+// loads and stores
+
+inline __m128i _mm_load_si128(const __m128i * p) {
+    return vld1q_s64(reinterpret_cast<const int64_t *> (p));
+}
+inline __m128i _mm_loadu_si128(const __m128i * p) {
+    return NEONSSE_FROM_U8(vld1q_u8(reinterpret_cast<const uint8_t *> (p)));
+}
+inline __m128i _mm_loadl_epi64(const __m128i * p) {
+    int64_t low;
+    memcpy(&low, p, sizeof(low));
+    return vcombine_s64(vdup_n_s64(low), vdup_n_s64(0));
+}
+inline void _mm_store_si128(__m128i * p, const __m128i a) {
+    vst1q_s64(reinterpret_cast<int64_t *> (p), a);
+}
+inline void _mm_storeu_si128(__m128i * p, const __m128i a) {
+    vst1q_u8(reinterpret_cast<uint8_t *> (p), NEONSSE_U8(a));
+}
+
+// constants
+
+inline __m128i _mm_setzero_si128() {
+    return vdupq_n_s64(0);
+}
+inline __m128i _mm_set1_epi8(const char x) {
+    return NEONSSE_FROM_S8(vdupq_n_s8(static_cast<int8_t> (x)));
+}
+inline __m128i _mm_set1_epi32(const int x) {
+    return NEONSSE_FROM_S32(vdupq_n_s32(x));
+}
+inline __m128i _mm_set1_epi64x(const long long x) {
+    return vdupq_n_s64(static_cast<int64_t> (x));
+}
+inline __m128i _mm_setr_epi32(const int e0, const int e1, const int e2, const int e3) {
+    const int32_t lanes[4] = { e0, e1, e2, e3 };
+    return NEONSSE_FROM_S32(vld1q_s32(lanes));
+}
+inline __m128i _mm_set_epi8(const char e15, const char e14, const char e13, const char e12,
+        const char e11, const char e10, const char e9, const char e8, const char e7,
+        const char e6, const char e5, const char e4, const char e3, const char e2,
+        const char e1, const char e0) {
+    const int8_t lanes[16] = { static_cast<int8_t> (e0), static_cast<int8_t> (e1),
+            static_cast<int8_t> (e2), static_cast<int8_t> (e3), static_cast<int8_t> (e4),
+            static_cast<int8_t> (e5), static_cast<int8_t> (e6), static_cast<int8_t> (e7),
+            static_cast<int8_t> (e8), static_cast<int8_t> (e9), static_cast<int8_t> (e10),
+            static_cast<int8_t> (e11), static_cast<int8_t> (e12), static_cast<int8_t> (e13),
+            static_cast<int8_t> (e14), static_cast<int8_t> (e15) };
+    return NEONSSE_FROM_S8(vld1q_s8(lanes));
+}
+inline __m128i _mm_cvtsi32_si128(const int x) {
+    return NEONSSE_FROM_S32(vsetq_lane_s32(x, vdupq_n_s32(0), 0));
+}
+inline int _mm_cvtsi128_si32(const __m128i a) {
+    return vgetq_lane_s32(NEONSSE_S32(a), 0);
+}
+
+// logic
+
+inline __m128i _mm_and_si128(const __m128i a, const __m128i b) {
+    return vandq_s64(a, b);
+}
+inline __m128i _mm_andnot_si128(const __m128i a, const __m128i b) {
+    return vbicq_s64(b, a);// ~a & b
+}
+inline __m128i _mm_or_si128(const __m128i a, const __m128i b) {
+    return vorrq_s64(a, b);
+}
+inline __m128i _mm_xor_si128(const __m128i a, const __m128i b) {
+    return veorq_s64(a, b);
+}
+
+// arithmetic
+
+inline __m128i _mm_add_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_S32(vaddq_s32(NEONSSE_S32(a), NEONSSE_S32(b)));
+}
+inline __m128i _mm_sub_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_S32(vsubq_s32(NEONSSE_S32(a), NEONSSE_S32(b)));
+}
+inline __m128i _mm_add_epi64(const __m128i a, const __m128i b) {
+    return vaddq_s64(a, b);
+}
+inline __m128i _mm_sub_epi64(const __m128i a, const __m128i b) {
+    return vsubq_s64(a, b);
+}
+inline __m128i _mm_mullo_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_S32(vmulq_s32(NEONSSE_S32(a), NEONSSE_S32(b)));
+}
+inline __m128i _mm_min_epu32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vminq_u32(NEONSSE_U32(a), NEONSSE_U32(b)));
+}
+inline __m128i _mm_max_epu32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vmaxq_u32(NEONSSE_U32(a), NEONSSE_U32(b)));
+}
+
+// shifts: vshlq shifts right for negative counts and gives zeros (or the
+// sign, for signed lanes) beyond the width of the lanes, as SSE does
+
+inline __m128i _mm_slli_epi32(const __m128i a, const int count) {
+    return NEONSSE_FROM_U32(vshlq_u32(NEONSSE_U32(a), vdupq_n_s32(count)));
+}
+inline __m128i _mm_srli_epi32(const __m128i a, const int count) {
+    return NEONSSE_FROM_U32(vshlq_u32(NEONSSE_U32(a), vdupq_n_s32(-count)));
+}
+inline __m128i _mm_srai_epi32(const __m128i a, const int count) {
+    return NEONSSE_FROM_S32(vshlq_s32(NEONSSE_S32(a), vdupq_n_s32(-count)));
+}
+inline __m128i _mm_srl_epi32(const __m128i a, const __m128i count) {
+    const int64_t c = vgetq_lane_s64(count, 0);
+    if ((c < 0) || (c > 31))
+        return _mm_setzero_si128();
+    return _mm_srli_epi32(a, static_cast<int> (c));
+}
+inline __m128i _mm_srli_epi16(const __m128i a, const int count) {
+    return NEONSSE_FROM_U16(vshlq_u16(NEONSSE_U16(a), vdupq_n_s16(static_cast<int16_t> (-count))));
+}
+inline __m128i _mm_slli_epi64(const __m128i a, const int count) {
+    return NEONSSE_FROM_U64(vshlq_u64(NEONSSE_U64(a), vdupq_n_s64(count)));
+}
+inline __m128i _mm_srli_epi64(const __m128i a, const int count) {
+    return NEONSSE_FROM_U64(vshlq_u64(NEONSSE_U64(a), vdupq_n_s64(-count)));
+}
+// whole register, by bytes (vext needs an immediate)
+#define _mm_slli_si128(a, count) NEONSSE_FROM_U8(vextq_u8(vdupq_n_u8(0), NEONSSE_U8(a), \
+        16 - (count)))
+#define _mm_srli_si128(a, count) NEONSSE_FROM_U8(vextq_u8(NEONSSE_U8(a), vdupq_n_u8(0), \
+        (count)))
+// the bytes of b then a, shifted right by count bytes (0 to 15)
+#define _mm_alignr_epi8(a, b, count) NEONSSE_FROM_U8(vextq_u8(NEONSSE_U8(b), NEONSSE_U8(a), \
+        (count)))
+
+// comparisons
+
+inline __m128i _mm_cmpeq_epi8(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U8(vceqq_s8(NEONSSE_S8(a), NEONSSE_S8(b)));
+}
+inline __m128i _mm_cmpeq_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vceqq_s32(NEONSSE_S32(a), NEONSSE_S32(b)));
+}
+inline __m128i _mm_cmpgt_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vcgtq_s32(NEONSSE_S32(a), NEONSSE_S32(b)));
+}
+
+// shuffles and blends
+
+// pshufb zeroes the bytes whose index has its high bit set, tbl those
+// whose index is 16 or more: we keep the high bit and the low 4 bits
+inline __m128i _mm_shuffle_epi8(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U8(vqtbl1q_u8(NEONSSE_U8(a), vandq_u8(NEONSSE_U8(b),
+            vdupq_n_u8(0x8F))));
+}
+inline __m128i neonsse_shuffle_epi32(const __m128i a, const int imm) {
+    uint8_t indexes[16];
+    for (int k = 0; k < 4; ++k)
+        for (int t = 0; t < 4; ++t)
+            indexes[4 * k + t] = static_cast<uint8_t> (4 * ((imm >> (2 * k)) & 3) + t);
+    return NEONSSE_FROM_U8(vqtbl1q_u8(NEONSSE_U8(a), vld1q_u8(indexes)));
+}
+#define _mm_shuffle_epi32(a, imm) neonsse_shuffle_epi32((a), (imm))
+inline __m128i neonsse_blend_epi16(const __m128i a, const __m128i b, const int imm) {
+    uint16_t mask[8];
+    for (int k = 0; k < 8; ++k)
+        mask[k] = ((imm >> k) & 1) != 0 ? 0xFFFF : 0;
+    return NEONSSE_FROM_U16(vbslq_u16(vld1q_u16(mask), NEONSSE_U16(b), NEONSSE_U16(a)));
+}
+#define _mm_blend_epi16(a, b, imm) neonsse_blend_epi16((a), (b), (imm))
+inline __m128i _mm_unpacklo_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vzip1q_u32(NEONSSE_U32(a), NEONSSE_U32(b)));
+}
+inline __m128i _mm_unpackhi_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U32(vzip2q_u32(NEONSSE_U32(a), NEONSSE_U32(b)));
+}
+inline __m128i _mm_unpacklo_epi64(const __m128i a, const __m128i b) {
+    return vcombine_s64(vget_low_s64(a), vget_low_s64(b));
+}
+inline __m128i _mm_unpackhi_epi64(const __m128i a, const __m128i b) {
+    return vcombine_s64(vget_high_s64(a), vget_high_s64(b));
+}
+
+// saturating packs: the lanes of a, then those of b
+inline __m128i _mm_packus_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U16(vcombine_u16(vqmovun_s32(NEONSSE_S32(a)),
+            vqmovun_s32(NEONSSE_S32(b))));
+}
+inline __m128i _mm_packs_epi32(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_S16(vcombine_s16(vqmovn_s32(NEONSSE_S32(a)), vqmovn_s32(NEONSSE_S32(b))));
+}
+inline __m128i _mm_packus_epi16(const __m128i a, const __m128i b) {
+    return NEONSSE_FROM_U8(vcombine_u8(vqmovun_s16(NEONSSE_S16(a)),
+            vqmovun_s16(NEONSSE_S16(b))));
+}
+
+// masks and floats
+
+inline int _mm_movemask_epi8(const __m128i a) {
+    const int8_t shifts[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+    const uint8x16_t bits = vshlq_u8(vshrq_n_u8(NEONSSE_U8(a), 7), vld1q_s8(shifts));
+    return static_cast<int> (vaddv_u8(vget_low_u8(bits))) | (static_cast<int> (vaddv_u8(
+            vget_high_u8(bits))) << 8);
+}
+inline int _mm_movemask_ps(const __m128 a) {
+    const int32_t shifts[4] = { 0, 1, 2, 3 };
+    const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(a), 31), vld1q_s32(
+            shifts));
+    return static_cast<int> (vaddvq_u32(bits));
+}
+inline __m128 _mm_castsi128_ps(const __m128i a) {
+    return vreinterpretq_f32_s64(a);
+}
+inline __m128i _mm_castps_si128(const __m128 a) {
+    return vreinterpretq_s64_f32(a);
+}
+inline __m128 _mm_cvtepi32_ps(const __m128i a) {
+    return vcvtq_f32_s32(NEONSSE_S32(a));
+}
+
+#endif /* NEONSSE_H_ */
@@ -55,12 +55,27 @@ public:
             uint32_t *out, size_t &nvalue);
     virtual const uint32_t * decodeArray(const uint32_t *in, const size_t len,
             uint32_t *out, size_t &nvalue);
+    /**
+     * A block never takes more than its header word and BlockSize words:
+     * findBestB falls back on b = 32 (a plain copy) rather than having too
+     * many exceptions (OPTPFor keeps b only if it is no larger).
+     */
+    virtual size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (1 + BlockSize);
+    }
+    // the header is the number of blocks
+    virtual size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0] * BlockSize;
+    }
     virtual string name() const {
         ostringstream convert;
         convert << "NewPFor<" << BlockSizeInUnitsOfPackSize << ","
                 << ecoder.name() << ">";
         return convert.str();
     }
+    virtual shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new NewPFor(*this));
+    }
     ExceptionCoder ecoder;
     vector<uint32_t> exceptionsPositions;
     vector<uint32_t> exceptionsValues;
@@ -98,13 +113,22 @@ template<uint32_t BlockSizeInUnitsOfPackSize, class ExceptionCoder>
 __attribute__ ((pure))
 uint32_t NewPFor<BlockSizeInUnitsOfPackSize, ExceptionCoder>::findBestB(
         const uint32_t *in, uint32_t len) {
-    const uint32_t mb = maxbits(in,in+len);
+    // one pass: the number of exceptions for b (as tryB) is the number of
+    // integers having more than b bits
+    uint32_t freqs[33] = { 0 };
+    for (uint32_t k = 0; k < len; ++k)
+        freqs[asmbits(in[k])]++;
+    uint32_t mb = 32;
+    while ((mb > 0) && (freqs[mb] == 0))
+        --mb;
     uint32_t i = 0;
     while(mb  > 28 + possLogs[i]  ) ++i; // some schemes such as Simple16 don't code numbers greater than 28
 
     for (; i < possLogs.size() - 1; i++) {
 
-        const uint32_t nExceptions = tryB(possLogs[i], in, len);
+        uint32_t nExceptions = 0;
+        for (uint32_t w = possLogs[i] + 1; w <= mb; ++w)
+            nExceptions += freqs[w];
         if (nExceptions * PFORDELTA_INVERSERATIO <= len)
             return possLogs[i];
     }
@@ -223,6 +247,8 @@ const uint32_t * NewPFor<BlockSizeInUnitsOfPackSize, ExceptionCoder>::decodeArra
     if (BlockSize * (*in) > nvalue)
         throw NotEnoughStorage(*in);
     const uint32_t numBlocks = *in++;
+    // not the member: decoding does not modify the instance
+    uint32_t exceptions[4 * BlockSize + TAIL_MERGIN + 1];
 
     for (uint32_t i = 0; i < numBlocks; i++) {
 
@@ -237,7 +263,7 @@ const uint32_t * NewPFor<BlockSizeInUnitsOfPackSize, ExceptionCoder>::decodeArra
         size_t twonexceptions = 2 * nExceptions;
         ++in;
         if (encodedExceptionsSize > 0)
-            ecoder.decodeArray(in, encodedExceptionsSize, &exceptions[0],
+            ecoder.decodeArray(in, encodedExceptionsSize, exceptions,
                     twonexceptions);
         assert(twonexceptions >= 2 * nExceptions);
         in += encodedExceptionsSize;
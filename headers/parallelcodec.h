@@ -0,0 +1,180 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef PARALLELCODEC_H_
+#define PARALLELCODEC_H_
+
+#include "common.h"
+#include "util.h"
+#include "codecs.h"
+#include "compositecodec.h"
+#include "variablebyte.h"
+#include "streamcodec.h"
+
+/**
+ * Compresses large arrays one page at a time on several threads. The pages
+ * (PageSize integers for FastPFor and SIMDFastPFor, see streamFrameSize)
+ * are coded independently, and a directory of page offsets lets us decode
+ * them on several threads as well.
+ *
+ * Format:
+ *    length, number of pages, page size,
+ *    for each page, where its compressed words end in the payload,
+ *    compressed pages (each one starting on a 16-byte boundary, so page p
+ *    starts at the end of page p-1 rounded up to a multiple of 4 words).
+ *
+ * As with SIMDBinaryPacking, if you move the data around, you should
+ * preserve the alignment.
+ */
+template<class CODEC = SIMDFastPFor>
+class PageParallelCodec: public IntegerCODEC {
+public:
+    enum {
+        HeaderSize = 3,
+        MinPagesPerThread = 4
+    };
+
+    /**
+     * By default, we use as many threads as there are cores.
+     */
+    PageParallelCodec(uint32_t threads = 0) :
+        numberofthreads(threads > 0 ? threads : max<uint32_t> (1,
+                thread::hardware_concurrency())),
+                PageSize(streamFrameSize(CODEC())) {
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        const size_t numberofpages = (length + PageSize - 1) / PageSize;
+        if (HeaderSize + numberofpages > nvalue)
+            throw NotEnoughStorage(HeaderSize + numberofpages);
+        out[0] = static_cast<uint32_t> (length);
+        out[1] = static_cast<uint32_t> (numberofpages);
+        out[2] = PageSize;
+        uint32_t * const ends = out + HeaderSize;
+        uint32_t * const payload = ends + numberofpages;
+        // the pages are compressed with the alignment they have in out
+        const size_t shift = (reinterpret_cast<uintptr_t> (payload) % 16)
+                / sizeof(uint32_t);
+        // each thread compresses a page to its own buffer, then waits for the
+        // previous page to be in out and copies it right after: the pages are
+        // taken in order, so the thread with page p - 1 never waits for us
+        atomic<size_t> written(0);// pages in out
+        atomic<bool> failed(false);
+        size_t end = 0;// of the pages in out, only used by the thread writing
+        forEachPage(numberofpages, [&](size_t p, PageWorker & worker) {
+            try {
+                const size_t thissize = min<size_t> (PageSize, length - p * PageSize);
+                worker.scratch.resize(max(worker.scratch.size(), shift
+                        + worker.codec.maxCompressedWords(thissize)));
+                size_t thisnvalue = worker.scratch.size() - shift;
+                worker.codec.encodeArray(in + p * PageSize, thissize, &worker.scratch[shift],
+                        thisnvalue);
+                while (written.load() != p) {
+                    if (failed.load())
+                        return;
+                    this_thread::yield();
+                }
+                const size_t start = (end + 3) / 4 * 4;
+                if (HeaderSize + numberofpages + (start + thisnvalue + 3) / 4 * 4 > nvalue)
+                    throw NotEnoughStorage(maxCompressedWords(length));
+                fill(payload + end, payload + start, 0);
+                memcpy(payload + start, &worker.scratch[shift], thisnvalue * sizeof(uint32_t));
+                end = start + thisnvalue;
+                ends[p] = static_cast<uint32_t> (end);
+                written.store(p + 1);
+            } catch (...) {
+                failed.store(true);
+                throw;
+            }
+        });
+        const size_t required = HeaderSize + numberofpages + (end + 3) / 4 * 4;
+        fill(payload + end, out + required, 0);
+        nvalue = required;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t mynvalue = in[0];
+        if (mynvalue > nvalue)
+            throw NotEnoughStorage(mynvalue);
+        nvalue = mynvalue;
+        const size_t numberofpages = in[1];
+        if (in[2] != PageSize)
+            throw logic_error("PageParallelCodec: page size does not match");
+        const uint32_t * const ends = in + HeaderSize;
+        const uint32_t * const payload = ends + numberofpages;
+        forEachPage(numberofpages, [&](size_t p, PageWorker & worker) {
+            size_t thissize = min<size_t> (PageSize, mynvalue - p * PageSize);
+            const size_t start = pageStart(ends, p);
+            worker.codec.decodeArray(payload + start, ends[p] - start, out + p * PageSize,
+                    thissize);
+        });
+        return numberofpages > 0 ? payload + (ends[numberofpages - 1] + 3) / 4 * 4
+                : payload;
+    }
+
+    // each page may be followed by 3 words of padding
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t numberofpages = (length + PageSize - 1) / PageSize;
+        CompositeCodec<CODEC, VariableByte> codec;
+        size_t answer = HeaderSize + numberofpages;
+        if (numberofpages > 0)
+            answer += (numberofpages - 1) * (codec.maxCompressedWords(PageSize) + 3)
+                    + codec.maxCompressedWords(length - (numberofpages - 1) * PageSize) + 3;
+        return answer;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        ostringstream convert;
+        convert << "PageParallel<" << CompositeCodec<CODEC, VariableByte> ().name()
+                << "," << numberofthreads << ">";
+        return convert.str();
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new PageParallelCodec(*this));
+    }
+
+    const uint32_t numberofthreads;
+    const uint32_t PageSize;
+
+private:
+    // where page p starts in the payload
+    static size_t pageStart(const uint32_t * ends, const size_t p) {
+        return p > 0 ? (ends[p - 1] + 3) / 4 * 4 : 0;
+    }
+
+    // what each thread needs: a codec and, to encode, a buffer for one page
+    struct PageWorker {
+        PageWorker() :
+            codec(), scratch() {
+        }
+        CompositeCodec<CODEC, VariableByte> codec;
+        vector<uint32_t, cacheallocator> scratch;
+    };
+
+    /**
+     * Calls f(page, worker) for each page; the threads take the pages in
+     * order and each thread has its own worker. Small arrays (fewer than
+     * MinPagesPerThread pages for a second thread) are coded by the calling
+     * thread alone, as starting threads would cost more than it saves.
+     */
+    template<class Function>
+    void forEachPage(const size_t numberofpages, Function f) const {
+        const uint32_t threads = static_cast<uint32_t> (max<size_t> (1, min<size_t> (
+                numberofthreads, numberofpages / MinPagesPerThread)));
+        vector<PageWorker> workers(parallelForThreads(numberofpages, threads));
+        parallelForByThread(numberofpages, [&](size_t p, size_t t) {
+            f(p, workers[t]);
+        }, threads);
+    }
+};
+
+#endif /* PARALLELCODEC_H_ */
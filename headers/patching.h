@@ -0,0 +1,44 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef PATCHING_H_
+#define PATCHING_H_
+
+#include "common.h"
+#include "cpufeatures.h"
+
+namespace avx512 {
+/**
+ * Same as patchExceptions below, 16 exceptions at a time (gather, shift
+ * and OR, scatter). The implementation (src/patching_avx512.cpp) is
+ * compiled for AVX-512, so it should only be called when
+ * cpuSupportsAVX512() is true.
+ */
+void patchExceptions(uint32_t * out, const uint8_t * positions,
+        const uint32_t * exceptions, const uint32_t cexcept, const uint32_t b);
+}
+
+/**
+ * Adds the high bits of the exceptions to a block unpacked with b < 32
+ * bits: out[positions[k]] |= exceptions[k] << b, for k < cexcept. This is
+ * how the PFor schemes (FastPFor, SIMDFastPFor) decode a block.
+ *
+ * The positions of a block are distinct. With few exceptions, the scalar
+ * loop is faster than the gather and scatter of AVX-512.
+ */
+inline void patchExceptions(uint32_t * out, const uint8_t * positions,
+        const uint32_t * exceptions, const uint32_t cexcept, const uint32_t b) {
+#ifdef FASTPFOR_X86
+    if ((cexcept >= 16) && cpuSupportsAVX512()) {
+        avx512::patchExceptions(out, positions, exceptions, cexcept, b);
+        return;
+    }
+#endif
+    for (uint32_t k = 0; k < cexcept; ++k)
+        out[positions[k]] |= exceptions[k] << b;
+}
+
+#endif /* PATCHING_H_ */
@@ -0,0 +1,145 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef PERFCOUNTERS_H_
+#define PERFCOUNTERS_H_
+
+#include "common.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Totals of the hardware counters (see PerfCounters) over some number of
+ * encoded or decoded integers.
+ */
+struct PerfCounts {
+    enum {
+        Cycles, Instructions, L1DMisses, LLCMisses, BranchMisses, HowMany
+    };
+    PerfCounts() :
+        values(), integers(0) {
+    }
+    uint64_t values[HowMany];
+    uint64_t integers;
+
+    PerfCounts & operator+=(const PerfCounts & other) {
+        for (uint32_t k = 0; k < HowMany; ++k)
+            values[k] += other.values[k];
+        integers += other.integers;
+        return *this;
+    }
+
+    // per integer, for summarize
+    double perInteger(const uint32_t which) const {
+        return integers == 0 ? 0 : static_cast<double> (values[which]) / integers;
+    }
+
+    static std::string header() {
+        return "cycles, instructions, L1d misses, LLC misses, branch misses per int";
+    }
+};
+
+/**
+ * Hardware counters of the calling thread, with perf_event_open (Linux):
+ * cycles, instructions, L1 data cache read misses, last level cache misses
+ * and branch misses, counted in user space between start() and stop().
+ *
+ * When the processor or the kernel will not let us count (other systems,
+ * virtual machines, /proc/sys/kernel/perf_event_paranoid), available() is
+ * false and the counts stay at zero. An event that cannot be counted
+ * alone also stays at zero.
+ */
+class PerfCounters {
+public:
+    PerfCounters() :
+        fds(), leader(-1), ids() {
+        for (uint32_t k = 0; k < PerfCounts::HowMany; ++k)
+            fds[k] = -1;
+#ifdef __linux__
+        const uint64_t cachemiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ
+                << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const uint32_t types[PerfCounts::HowMany] = { PERF_TYPE_HARDWARE,
+                PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE,
+                PERF_TYPE_HARDWARE };
+        const uint64_t configs[PerfCounts::HowMany] = { PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_INSTRUCTIONS, cachemiss, PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES };
+        for (uint32_t k = 0; k < PerfCounts::HowMany; ++k) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = types[k];
+            attr.config = configs[k];
+            attr.disabled = (leader == -1);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+            fds[k] = static_cast<int> (syscall(__NR_perf_event_open, &attr, 0, -1,
+                    leader, 0));
+            if (fds[k] == -1)
+                continue;
+            if (leader == -1)
+                leader = fds[k];
+            ioctl(fds[k], PERF_EVENT_IOC_ID, &ids[k]);
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (uint32_t k = 0; k < PerfCounts::HowMany; ++k)
+            if (fds[k] != -1)
+                close(fds[k]);
+#endif
+    }
+
+    bool available() const {
+        return leader != -1;
+    }
+
+    void start() {
+#ifdef __linux__
+        if (!available())
+            return;
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    // adds the counts since start() to c
+    void stop(PerfCounts & c, const size_t integers) {
+        c.integers += integers;
+#ifdef __linux__
+        if (!available())
+            return;
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        // number of events, then (value, id) for each
+        uint64_t buffer[1 + 2 * PerfCounts::HowMany];
+        if (read(leader, buffer, sizeof(buffer)) <= 0)
+            return;
+        for (uint64_t e = 0; e < buffer[0]; ++e)
+            for (uint32_t k = 0; k < PerfCounts::HowMany; ++k)
+                if ((fds[k] != -1) && (ids[k] == buffer[2 + 2 * e]))
+                    c.values[k] += buffer[1 + 2 * e];
+#endif
+    }
+
+private:
+    PerfCounters(const PerfCounters &);
+    PerfCounters & operator=(const PerfCounters &);
+
+    int fds[PerfCounts::HowMany];
+    int leader;
+    uint64_t ids[PerfCounts::HowMany];
+};
+
+#endif /* PERFCOUNTERS_H_ */
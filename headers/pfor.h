@@ -45,13 +45,36 @@ public:
         BlockSize = BlockSizeInUnitsOfPackSize * PACKSIZE,
         blocksizeinbits = constexprbits(BlockSize)
     };
-    // these are reusable buffers
-    vector<uint32_t> codedcopy;
-    vector<size_t> miss;
     typedef uint32_t DATATYPE;// this is so that our code looks more like the original paper
 
-    PFor() :
-        codedcopy(BlockSize), miss(BlockSize) {
+    /**
+     * Scratch space for encoding: a copy of the block being coded, the
+     * positions of its exceptions and the exceptions of the array. The
+     * instance holds no buffer, so that threads can encode through a
+     * shared instance.
+     */
+    struct Workspace {
+        Workspace() :
+            codedcopy(BlockSize), miss(BlockSize), exceptions() {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            vector<DATATYPE> ().swap(exceptions);
+        }
+        vector<uint32_t> codedcopy;
+        vector<size_t> miss;
+        vector<DATATYPE> exceptions;
+    };
+
+    // the workspace used by encodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // frees the encoding scratch of the calling thread (it is otherwise kept from call to call)
+    void trim() {
+        threadWorkspace().trim();
     }
     // for delta coding, we don't use a base.
     static uint32_t determineBestBase(
@@ -101,7 +124,9 @@ public:
     // returns location of first exception or BlockSize if there is none
     size_t compressblockPFOR(const DATATYPE * __restrict__ in,
             uint32_t * __restrict__ outputbegin, const uint32_t b,
-            DATATYPE * __restrict__ & exceptions) {
+            DATATYPE * __restrict__ & exceptions, Workspace & ws) {
+        vector<uint32_t> & codedcopy = ws.codedcopy;
+        vector<size_t> & miss = ws.miss;
         if (b == 32) {
             for (size_t k = 0; k < BlockSize; ++k)
                 *(outputbegin++) = *(in++) ;
@@ -219,8 +244,10 @@ public:
             size_t &nvalue) {
         checkifdivisibleby(len, BlockSize);
         const uint32_t * const initout(out);
-        vector<DATATYPE> exceptions;
-        exceptions.reserve(len);// possibly unsafe but can be faster than resize
+        Workspace & ws = threadWorkspace();
+        vector<DATATYPE> & exceptions = ws.exceptions;
+        if (exceptions.size() < len + 1)
+            exceptions.resize(len + 1);
         DATATYPE * __restrict__ i = &exceptions[0];
         const uint32_t b = determineBestBase(in,len);
         *out++ = len;
@@ -228,7 +255,7 @@ public:
         for (size_t k = 0; k < len / BlockSize; ++k) {
             uint32_t * const headerout(out);
             ++out;
-            size_t firstexcept = compressblockPFOR(in, out, b, i);
+            size_t firstexcept = compressblockPFOR(in, out, b, i, ws);
             out += (BlockSize * b) / 32;
             in += BlockSize;
             const uint32_t bitsforfirstexcept = blocksizeinbits;
@@ -284,11 +311,29 @@ public:
         }
     }
 
+    /**
+     * The bit width b comes from a sample, so there can be up to one
+     * exception per integer: with b = 31, a block takes a header word,
+     * 4 * 31 words and BlockSize exceptions. Arrays are cut in chunks
+     * having 2 header words (length and b).
+     */
+    virtual size_t maxCompressedWords(const size_t length) const {
+        const size_t maxsize = (1U << (32 - blocksizeinbits - 1));
+        const size_t chunks = (length + maxsize - 1) / maxsize;
+        return 1 + chunks * 2 + length / BlockSize * (1 + 4 * 31 + BlockSize);
+    }
+    virtual size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     virtual string name() const {
         ostringstream convert;
         convert << "PFor";
         return convert.str();
     }
+    virtual shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new PFor(*this));
+    }
 
 };
 
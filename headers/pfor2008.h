@@ -34,13 +34,31 @@ public:
         BlockSize = BlockSizeInUnitsOfPackSize * PACKSIZE,
         blocksizeinbits = constexprbits(BlockSize)
     };
-    // these are reusable buffers
-    vector<uint32_t> codedcopy;
-    vector<size_t> miss;
     typedef uint32_t DATATYPE;// this is so that our code looks more like the original paper
 
-    PFor2008() :
-        codedcopy(BlockSize), miss(BlockSize) {
+    // scratch space for encoding, as in PFor
+    struct Workspace {
+        Workspace() :
+            codedcopy(BlockSize), miss(BlockSize), exceptions() {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            vector<DATATYPE> ().swap(exceptions);
+        }
+        vector<uint32_t> codedcopy;
+        vector<size_t> miss;
+        vector<DATATYPE> exceptions;
+    };
+
+    // the workspace used by encodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // frees the encoding scratch of the calling thread (it is otherwise kept from call to call)
+    void trim() {
+        threadWorkspace().trim();
     }
     // for delta coding, we don't use a base.
     static uint32_t determineBestBase(const DATATYPE * in, size_t size,
@@ -52,7 +70,7 @@ public:
         // a sample, but this only makes sense if you
         // are coding a frame of reference.
         size_t samplesize = size > defaultsamplesize ? defaultsamplesize : size;
-        vector<uint32_t> freqs(33);
+        uint32_t freqs[33] = { 0 };
         // we choose the sample to be consecutive
         uint32_t rstart = size > samplesize ? (rand() % (size - samplesize))
                 : 0;
@@ -91,7 +109,9 @@ public:
     // returns location of first exception or BlockSize if there is none
     size_t compressblockPFOR(const DATATYPE * __restrict__ in,
             uint32_t * __restrict__ outputbegin, const uint32_t b,
-            DATATYPE * __restrict__ & exceptions) {
+            DATATYPE * __restrict__ & exceptions, Workspace & ws) {
+        vector<uint32_t> & codedcopy = ws.codedcopy;
+        vector<size_t> & miss = ws.miss;
         if (b == 32) {
             for (size_t k = 0; k < BlockSize; ++k)
                 *(outputbegin++) = *(in++);
@@ -235,7 +255,10 @@ public:
         const uint32_t maxb = howmanybits(in, len);
         checkifdivisibleby(len, BlockSize);
         const uint32_t * const initout(out);
-        vector<DATATYPE> exceptions(len);
+        Workspace & ws = threadWorkspace();
+        vector<DATATYPE> & exceptions = ws.exceptions;
+        if (exceptions.size() < len + 1)
+            exceptions.resize(len + 1);
         DATATYPE * __restrict__ i = &exceptions[0];
         const uint32_t b = determineBestBase(in, len, maxb);
         *out++ = maxb;
@@ -245,7 +268,7 @@ public:
         for (size_t k = 0; k < len / BlockSize; ++k) {
             uint32_t * const headerout(out);
             ++out;
-            size_t firstexcept = compressblockPFOR(in, out, b, i);
+            size_t firstexcept = compressblockPFOR(in, out, b, i, ws);
             out += (BlockSize * b) / 32;
             in += BlockSize;
             const uint32_t bitsforfirstexcept = blocksizeinbits;
@@ -328,11 +351,28 @@ public:
         }
     }
 
+    /**
+     * As with PFor, up to one exception per integer (stored on at most
+     * 32 bits); chunks have 3 header words (maxb, length and b) and end
+     * with at most 1 word of padding.
+     */
+    virtual size_t maxCompressedWords(const size_t length) const {
+        const size_t maxsize = (1U << (32 - blocksizeinbits - 1));
+        const size_t chunks = (length + maxsize - 1) / maxsize;
+        return 1 + chunks * 4 + length / BlockSize * (1 + 4 * 31 + BlockSize);
+    }
+    virtual size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     virtual string name() const {
         ostringstream convert;
         convert << "PFor2008";
         return convert.str();
     }
+    virtual shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new PFor2008(*this));
+    }
 
 };
 #endif /* PFOR2008_H_ */
@@ -0,0 +1,291 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef POSTINGSTORE_H_
+#define POSTINGSTORE_H_
+
+#include "common.h"
+#include "codecfactory.h"
+#include "deltautil.h"
+#include "util.h"
+
+using namespace std;
+
+/**
+ * Many compressed arrays (e.g., the posting lists of an inverted index)
+ * in memory: the compressed arrays are concatenated in a single arena
+ * (each one starting at a multiple of 16 bytes, as the SIMD codecs
+ * expect) and a directory gives, for each array (term), where it starts,
+ * its length in words, its number of integers and its codec. That is 16
+ * bytes per array, instead of a vector (24 bytes and the slack of malloc)
+ * per array.
+ *
+ * The arrays are bulk loaded (load), compressed on several threads, each
+ * one with the codec given to the constructor or, with "auto", the one
+ * CODECFactory::recommend picks for this array. If delta is true (the
+ * default), the arrays should be sorted: we compress their deltas and get
+ * adds them back.
+ *
+ * As with IndexFileReader, get can be called from several threads.
+ */
+class PostingStore {
+public:
+    struct Entry {
+        uint64_t offsetandcodec;// offset in words in the arena << 8 | codec
+        uint32_t count;// number of integers
+        uint32_t words;// length of the compressed array
+    };
+
+    /**
+     * A compressed array of the store, as given by the iterators.
+     */
+    class Posting {
+    public:
+        Posting(const PostingStore & s, const size_t t) :
+            store(&s), term(t) {
+        }
+        size_t id() const {
+            return term;
+        }
+        size_t count() const {
+            return store->count(term);
+        }
+        const uint32_t * compressed() const {
+            return store->compressed(term);
+        }
+        size_t compressedLength() const {
+            return store->compressedLength(term);
+        }
+        void get(uint32_t * out, size_t & nvalue) const {
+            store->get(term, out, nvalue);
+        }
+
+    private:
+        const PostingStore * store;
+        size_t term;
+    };
+
+    class const_iterator {
+    public:
+        const_iterator(const PostingStore & s, const size_t t) :
+            store(&s), term(t) {
+        }
+        Posting operator*() const {
+            return Posting(*store, term);
+        }
+        const_iterator & operator++() {
+            ++term;
+            return *this;
+        }
+        bool operator==(const const_iterator & o) const {
+            return term == o.term;
+        }
+        bool operator!=(const const_iterator & o) const {
+            return term != o.term;
+        }
+
+    private:
+        const PostingStore * store;
+        size_t term;
+    };
+
+    /**
+     * codecname is a name of CODECFactory, or "auto" to let
+     * CODECFactory::recommend pick a codec for each array (with this
+     * bitspernanosecond).
+     */
+    PostingStore(const string & codecname = "auto", const bool delta = true,
+            const double bitspernanosecond = 0) :
+        mCodecName(codecname), mDelta(delta), mBitsPerNanosecond(bitspernanosecond),
+                arena(), directory(), codecnames(), codecs() {
+        if ((codecname != "auto") && (CODECFactory::scodecmap.find(codecname)
+                == CODECFactory::scodecmap.end()))
+            throw invalid_argument("PostingStore: no codec named " + codecname);
+    }
+
+    /**
+     * Compresses the arrays and appends them to the store, their terms
+     * being size() to size() + howmany - 1. The threads compress their
+     * share of the arrays in their own buffers: the arena is then
+     * allocated once and filled. (With threads = 0, we use all cores.)
+     */
+    void load(const ListDescriptor * lists, const size_t howmany, uint32_t threads = 0) {
+        if (threads == 0)
+            threads = max<uint32_t> (1, thread::hardware_concurrency());
+        threads = static_cast<uint32_t> (max<size_t> (1, min<size_t> (threads, howmany)));
+        vector<Segment> segments(threads);
+        parallelFor(threads, [&](size_t t) {
+            compressSegment(lists, t * howmany / threads, (t + 1) * howmany / threads,
+                    segments[t]);
+        }, threads);
+        size_t total = arena.size();
+        for (const Segment & s : segments)
+            total += s.words.size();
+        vector<uint32_t, cacheallocator> newarena(total);
+        if (!arena.empty())
+            memcpy(&newarena[0], &arena[0], arena.size() * sizeof(uint32_t));
+        size_t offset = arena.size();
+        directory.reserve(directory.size() + howmany);
+        for (Segment & s : segments) {
+            if (!s.words.empty())
+                memcpy(&newarena[offset], &s.words[0], s.words.size() * sizeof(uint32_t));
+            for (size_t i = 0; i < s.entries.size(); ++i) {
+                Entry e = s.entries[i];
+                const uint64_t codec = codecId(s.codecnames[i]);
+                e.offsetandcodec = ((offset + (e.offsetandcodec >> 8)) << 8) | codec;
+                directory.push_back(e);
+            }
+            offset += s.words.size();
+            vector<uint32_t, cacheallocator> ().swap(s.words);
+        }
+        arena.swap(newarena);
+    }
+
+    // with vectors (or anything with data() and size())
+    template<class container>
+    void load(const vector<container> & lists, uint32_t threads = 0) {
+        vector<ListDescriptor> descriptors(lists.size());
+        for (size_t i = 0; i < lists.size(); ++i)
+            descriptors[i] = ListDescriptor { lists[i].data(), lists[i].size() };
+        load(descriptors.data(), descriptors.size(), threads);
+    }
+
+    // number of arrays (terms)
+    size_t size() const {
+        return directory.size();
+    }
+
+    // number of integers in array term
+    size_t count(const size_t term) const {
+        return directory[term].count;
+    }
+
+    // the compressed array term, within the arena
+    const uint32_t * compressed(const size_t term) const {
+        return &arena[0] + (directory[term].offsetandcodec >> 8);
+    }
+
+    // length of the compressed array term in 32-bit words
+    size_t compressedLength(const size_t term) const {
+        return directory[term].words;
+    }
+
+    const string & codecName(const size_t term) const {
+        return codecnames[directory[term].offsetandcodec & 0xFF];
+    }
+
+    /**
+     * Decodes array term to out (which should have room for count(term)
+     * integers, plus whatever slack the codec needs, and be aligned on 16
+     * bytes), nvalue gets the number of integers.
+     */
+    void get(const size_t term, uint32_t * out, size_t & nvalue) const {
+        const Entry & e = directory[term];
+        if (e.count == 0) {
+            nvalue = 0;
+            return;
+        }
+        codecs[e.offsetandcodec & 0xFF]->decodeArray(compressed(term), e.words, out, nvalue);
+        if (mDelta)
+            Delta::inverseDelta(out, nvalue);
+    }
+
+    // same as get, out is resized
+    void get(const size_t term, vector<uint32_t, cacheallocator> & out) const {
+        out.resize(count(term) + Slack);
+        size_t nvalue = out.size();
+        get(term, out.data(), nvalue);
+        out.resize(nvalue);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(*this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(*this, size());
+    }
+
+    // bytes used by the arena and the directory
+    size_t memoryUsage() const {
+        return arena.size() * sizeof(uint32_t) + directory.size() * sizeof(Entry);
+    }
+
+    enum {
+        Slack = 1024// room beyond the integers that get leaves to the codecs
+    };
+
+private:
+    PostingStore(const PostingStore &);
+    PostingStore & operator=(const PostingStore &);
+
+    // what a thread compresses: entries with offsets within words
+    struct Segment {
+        Segment() :
+            words(), entries(), codecnames() {
+        }
+        vector<uint32_t, cacheallocator> words;
+        vector<Entry> entries;
+        vector<string> codecnames;
+    };
+
+    void compressSegment(const ListDescriptor * lists, const size_t begin,
+            const size_t end, Segment & s) const {
+        map<string, shared_ptr<IntegerCODEC> > mycodecs;// our own copies
+        vector<uint32_t, cacheallocator> deltas;
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t * in = lists[i].data;
+            const size_t length = lists[i].length;
+            if (mDelta && (length > 0)) {
+                deltas.assign(in, in + length);
+                Delta::delta(deltas.data(), length);
+                in = deltas.data();
+            }
+            const string name = mCodecName != "auto" ? mCodecName
+                    : length == 0 ? string("copy")
+                    : CODECFactory::recommendName(in, length, mBitsPerNanosecond);
+            if (mycodecs.find(name) == mycodecs.end())
+                mycodecs[name] = CODECFactory::getFromName(name)->clone();
+            IntegerCODEC & codec = *mycodecs[name];
+            // the arrays start on 16 bytes, so the codecs pad as they will in the arena
+            const size_t offset = s.words.size();
+            s.words.resize(offset + codec.maxCompressedWords(length) + 4);
+            size_t nvalue = s.words.size() - offset;
+            if (length > 0)
+                codec.encodeArray(in, length, &s.words[offset], nvalue);
+            else
+                nvalue = 0;
+            s.words.resize(offset + (nvalue + 3) / 4 * 4);
+            Entry e;
+            e.offsetandcodec = static_cast<uint64_t> (offset) << 8;
+            e.count = static_cast<uint32_t> (length);
+            e.words = static_cast<uint32_t> (nvalue);
+            s.entries.push_back(e);
+            s.codecnames.push_back(name);
+        }
+    }
+
+    uint32_t codecId(const string & name) {
+        for (uint32_t c = 0; c < codecnames.size(); ++c)
+            if (codecnames[c] == name)
+                return c;
+        if (codecnames.size() == 256)
+            throw logic_error("PostingStore: too many codecs");
+        codecnames.push_back(name);
+        codecs.push_back(CODECFactory::getFromName(name)->clone());
+        return static_cast<uint32_t> (codecnames.size() - 1);
+    }
+
+    const string mCodecName;
+    const bool mDelta;
+    const double mBitsPerNanosecond;
+    vector<uint32_t, cacheallocator> arena;
+    vector<Entry> directory;
+    vector<string> codecnames;
+    vector<shared_ptr<IntegerCODEC> > codecs;
+};
+
+#endif /* POSTINGSTORE_H_ */
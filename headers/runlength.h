@@ -0,0 +1,205 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef RUNLENGTH_H_
+#define RUNLENGTH_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "simdbitpacking.h"
+#include "util.h"
+
+/**
+ * Binary packing (as in SIMDBinaryPacking) where the blocks of 128
+ * integers that are arithmetic progressions (in[j] = start + j * stride,
+ * modulo 2^32) are stored as runs instead: consecutive blocks
+ * continuing the same progression make up one run, stored as 4 words
+ * whatever its length. After delta coding, dense posting lists and
+ * ranges of identifiers become runs of 1s (stride 0); undelta'd ranges
+ * are runs of stride 1. Decoding a run is a loop of SIMD stores of an
+ * incrementing vector.
+ *
+ * Format:
+ *    length, number of runs, words of packed data, number of packed blocks,
+ *    padding up to 16 bytes (CookiePadder),
+ *    packed data (SIMD_fastpack_32, so it stays 16-byte aligned),
+ *    runs: first block, number of blocks, start, stride,
+ *    bit widths of the packed blocks (one byte each), up to 32 bits.
+ *
+ * The length should be a multiple of BlockSize (see CompositeCodec).
+ * As with SIMDBinaryPacking, the output of decodeArray should be aligned
+ * on 16 bytes and if you move the data around, you should preserve the
+ * alignment.
+ */
+class RunLengthCodec: public IntegerCODEC {
+public:
+    enum {
+        BlockSize = 128,
+        HeaderSize = 4,
+        RunWords = 4
+    };
+    static const uint32_t CookiePadder = 123456;
+
+    RunLengthCodec() :
+        runs(), bitwidths() {
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        const size_t numberofblocks = length / BlockSize;
+        uint32_t * const initout(out);
+        if (HeaderSize + 3 > nvalue)
+            throw NotEnoughStorage(HeaderSize + 3);
+        uint32_t * const header = out;
+        out += HeaderSize;
+        while (needPaddingTo128Bits(out))
+            *out++ = CookiePadder;
+        uint32_t * const packed = out;
+        runs.clear();
+        bitwidths.clear();
+        __attribute__ ((aligned (16))) uint32_t block[BlockSize];
+        for (size_t k = 0; k < numberofblocks; ++k, in += BlockSize) {
+            uint32_t stride;
+            if (isProgression(in, stride)) {
+                const size_t r = runs.size();
+                // does it go on with the previous run?
+                if ((r > 0) && (runs[r - 4] + runs[r - 3] == k) && (runs[r - 1] == stride)
+                        && (runs[r - 2] + runs[r - 3] * BlockSize * stride == in[0])) {
+                    ++runs[r - 3];
+                } else {
+                    runs.push_back(static_cast<uint32_t> (k));
+                    runs.push_back(1);
+                    runs.push_back(in[0]);
+                    runs.push_back(stride);
+                }
+                continue;
+            }
+            uint32_t accumulator = 0;
+            for (uint32_t j = 0; j < BlockSize; ++j)
+                accumulator |= in[j];
+            const uint32_t b = gccbits(accumulator);
+            if (static_cast<size_t> (out - initout) + 4 * b > nvalue)
+                throw NotEnoughStorage(maxCompressedWords(length));
+            memcpy(block, in, sizeof(block));// the SIMD kernels load aligned data
+            SIMD_fastpackwithoutmask_32(block, reinterpret_cast<__m128i *> (out), b);
+            out += 4 * b;
+            bitwidths.push_back(static_cast<uint8_t> (b));
+        }
+        header[0] = static_cast<uint32_t> (length);
+        header[1] = static_cast<uint32_t> (runs.size() / RunWords);
+        header[2] = static_cast<uint32_t> (out - packed);
+        header[3] = static_cast<uint32_t> (bitwidths.size());
+        const size_t required = (out - initout) + runs.size() + (bitwidths.size() + 3) / 4;
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        if (!runs.empty())
+            memcpy(out, &runs[0], runs.size() * sizeof(uint32_t));
+        out += runs.size();
+        while (bitwidths.size() % 4 != 0)
+            bitwidths.push_back(0);
+        if (!bitwidths.empty())
+            memcpy(out, &bitwidths[0], bitwidths.size());
+        out += bitwidths.size() / 4;
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t actuallength = in[0];
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        if (needPaddingTo128Bits(out))
+            throw runtime_error("bad initial output align");
+        const size_t numberofblocks = actuallength / BlockSize;
+        const size_t numberofruns = in[1];
+        const uint32_t * packed = in + HeaderSize;
+        while (needPaddingTo128Bits(packed)) {
+            if (packed[0] != CookiePadder)
+                throw logic_error("RunLengthCodec alignment issue.");
+            ++packed;
+        }
+        const uint32_t * run = packed + in[2];
+        const uint32_t * const endruns = run + RunWords * numberofruns;
+        const uint8_t * bitwidth = reinterpret_cast<const uint8_t *> (endruns);
+        const uint8_t * const endbitwidths = bitwidth + in[3];
+        for (size_t k = 0; k < numberofblocks;) {
+            if ((run < endruns) && (run[0] == k)) {
+                writeProgression(out + k * BlockSize, run[1] * BlockSize, run[2], run[3]);
+                k += run[1];
+                run += RunWords;
+            } else {
+                const uint32_t b = *bitwidth++;
+                SIMD_fastunpack_32(reinterpret_cast<const __m128i *> (packed),
+                        out + k * BlockSize, b);
+                packed += 4 * b;
+                ++k;
+            }
+        }
+        if ((bitwidth != endbitwidths) || (run != endruns))
+            throw logic_error("RunLengthCodec: corrupted data");
+        nvalue = actuallength;
+        return reinterpret_cast<const uint32_t *> (padTo32bits(endbitwidths));
+    }
+
+    /**
+     * A run takes RunWords words instead of at most BlockSize words and a
+     * byte for a packed block.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t numberofblocks = length / BlockSize;
+        return HeaderSize + 3 + numberofblocks * BlockSize + (numberofblocks + 3) / 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "RunLength";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new RunLengthCodec(*this));
+    }
+
+    // whether the block is start, start + stride, start + 2 * stride...
+    static bool isProgression(const uint32_t * in, uint32_t & stride) {
+        stride = in[1] - in[0];
+        for (uint32_t j = 2; j < BlockSize; ++j)
+            if (in[j] - in[j - 1] != stride)
+                return false;
+        return true;
+    }
+
+    /**
+     * Writes start, start + stride... (howmany integers, a multiple of 8)
+     * to out, which is aligned on 16 bytes.
+     */
+    static void writeProgression(uint32_t * out, const size_t howmany,
+            const uint32_t start, const uint32_t stride) {
+        __m128i v = _mm_setr_epi32(static_cast<int> (start), static_cast<int> (start
+                + stride), static_cast<int> (start + 2 * stride), static_cast<int> (start
+                + 3 * stride));
+        const __m128i step = _mm_set1_epi32(static_cast<int> (4 * stride));
+        const __m128i twosteps = _mm_add_epi32(step, step);
+        __m128i * o = reinterpret_cast<__m128i *> (out);
+        __m128i * const end = o + howmany / 4;
+        __m128i w = _mm_add_epi32(v, step);
+        for (; o != end; o += 2) {
+            _mm_store_si128(o, v);
+            _mm_store_si128(o + 1, w);
+            v = _mm_add_epi32(v, twosteps);
+            w = _mm_add_epi32(w, twosteps);
+        }
+    }
+
+private:
+    // scratch for encoding
+    vector<uint32_t> runs;
+    vector<uint8_t> bitwidths;
+};
+
+#endif /* RUNLENGTH_H_ */
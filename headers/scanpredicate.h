@@ -0,0 +1,114 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SCANPREDICATE_H_
+#define SCANPREDICATE_H_
+
+#include "common.h"
+
+using namespace std;
+
+/**
+ * A predicate on the integers of a column (see HorizontalScanCodec):
+ * value == lo, value < lo, lo <= value <= hi or value in values.
+ */
+struct ScanPredicate {
+    enum Op {
+        Equal, Less, Between, In
+    };
+
+    static ScanPredicate equal(const uint32_t v) {
+        return ScanPredicate(Equal, v, v, vector<uint32_t> ());
+    }
+    static ScanPredicate less(const uint32_t v) {
+        return ScanPredicate(Less, v, v, vector<uint32_t> ());
+    }
+    // inclusive: lo <= value <= hi
+    static ScanPredicate between(const uint32_t lo, const uint32_t hi) {
+        return ScanPredicate(Between, lo, hi, vector<uint32_t> ());
+    }
+    static ScanPredicate in(const vector<uint32_t> & values) {
+        return ScanPredicate(In, 0, 0, values);
+    }
+
+    bool matches(const uint32_t v) const {
+        switch (op) {
+        case Equal:
+            return v == lo;
+        case Less:
+            return v < lo;
+        case Between:
+            return (lo <= v) && (v <= hi);
+        default:
+            return find(values.begin(), values.end(), v) != values.end();
+        }
+    }
+
+    ScanPredicate(const Op o, const uint32_t l, const uint32_t h, const vector<uint32_t> & v) :
+        op(o), lo(l), hi(h), values(v) {
+    }
+
+    Op op;
+    uint32_t lo;
+    uint32_t hi;
+    vector<uint32_t> values;
+};
+
+/**
+ * A predicate as the kernels read it, with the values of In as an array:
+ * src/horizontalscan.cpp does not call the (inline) functions of
+ * std::vector, see there.
+ */
+struct ScanConstants {
+    ScanPredicate::Op op;
+    uint32_t lo;
+    uint32_t hi;
+    const uint32_t * values;
+    size_t howmany;
+};
+
+inline ScanConstants scanConstants(const ScanPredicate & p) {
+    const ScanConstants answer = { p.op, p.lo, p.hi, p.values.empty() ? NULL : &p.values[0],
+            p.values.size() };
+    return answer;
+}
+
+/**
+ * The kernels of src/horizontalscan.cpp, compiled for SSE4.1 and, in the
+ * avx2 namespace, for AVX2 (src/horizontalscan_avx2.cpp). Value i of
+ * the packed stream occupies bits [i * bit, (i + 1) * bit) (least
+ * significant bits first), as in the SIMD-scan layout of Willhalm et al.
+ * (see horizontalbitpacking.h). The stream should be followed by
+ * 16 bytes we may read (HorizontalScanCodec::Slack words).
+ *
+ * horizontalScan sets bit i of bitmap (bit i % 64 of word i / 64) to
+ * whether value i satisfies p (see scanConstants), for i in [0, length);
+ * the last word is padded with zeros.
+ */
+void horizontalScan(const uint32_t * packed, const size_t length, const uint32_t bit,
+        const ScanConstants & p, uint64_t * bitmap);
+void horizontalUnpack(const uint32_t * packed, const size_t length, const uint32_t bit,
+        uint32_t * out);
+namespace avx2 {
+void horizontalScan(const uint32_t * packed, const size_t length, const uint32_t bit,
+        const ScanConstants & p, uint64_t * bitmap);
+void horizontalUnpack(const uint32_t * packed, const size_t length, const uint32_t bit,
+        uint32_t * out);
+}
+
+// integer i of a stream packed as for horizontalScan, with 8 bytes we may read past it
+// (static: each file, whatever its instruction set, has its own copy)
+static inline uint32_t horizontalExtract(const uint32_t * packed, const uint32_t b, const size_t i) {
+    if (b == 0)
+        return 0;
+    uint64_t word;
+    memcpy(&word, reinterpret_cast<const uint8_t *> (packed) + i * b / 8, sizeof(word));
+    return static_cast<uint32_t> ((word >> (i * b % 8)) & ((static_cast<uint64_t> (1) << b)
+            - 1));
+}
+
+#endif /* SCANPREDICATE_H_ */
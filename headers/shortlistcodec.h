@@ -0,0 +1,169 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SHORTLISTCODEC_H_
+#define SHORTLISTCODEC_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "util.h"
+#include "compositecodec.h"
+
+/**
+ * For short arrays (most posting lists have a few integers, and so do the
+ * tails of CompositeCodec): one header word giving the length and a
+ * single bit width b, then the integers packed with b bits, 32 at a time
+ * as fastpackwithoutmask does. The last group only keeps the
+ * ceil(r * b / 32) words its r integers need, so an array of n integers
+ * takes 1 + ceil(n * b / 32) words, against one byte or more per integer
+ * with VariableByte. Decoding copies the words of the last group to the
+ * stack before unpacking them, so we never read past the array.
+ *
+ * Format:
+ *    length << LengthShift | b,
+ *    the packed integers.
+ *
+ * The length should be less than 2^26.
+ */
+class ShortListCodec: public IntegerCODEC {
+public:
+    enum {
+        LengthShift = 6,
+        GroupSize = 32
+    };
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        if (length >> (32 - LengthShift) != 0)
+            throw logic_error("ShortListCodec: array too long");
+        const uint32_t b = maxbits(in, in + length);
+        const size_t required = 1 + (length * b + 31) / 32;
+        if (required > nvalue)
+            throw NotEnoughStorage(required);
+        *out++ = static_cast<uint32_t> (length << LengthShift) | b;
+        const size_t fullgroups = length / GroupSize;
+        for (size_t g = 0; g < fullgroups; ++g, in += GroupSize, out += b)
+            fastpackwithoutmask(in, out, b);
+        const size_t r = length - fullgroups * GroupSize;
+        if (r > 0) {
+            uint32_t group[GroupSize] = { 0 };
+            uint32_t packed[GroupSize];
+            memcpy(group, in, r * sizeof(uint32_t));
+            fastpackwithoutmask(group, packed, b);
+            memcpy(out, packed, (r * b + 31) / 32 * sizeof(uint32_t));
+        }
+        nvalue = required;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t length = in[0] >> LengthShift;
+        const uint32_t b = in[0] & ((1U << LengthShift) - 1);
+        if (length > nvalue)
+            throw NotEnoughStorage(length);
+        ++in;
+        const size_t fullgroups = length / GroupSize;
+        for (size_t g = 0; g < fullgroups; ++g, in += b, out += GroupSize)
+            fastunpack(in, out, b);
+        const size_t r = length - fullgroups * GroupSize;
+        if (r > 0) {
+            const size_t words = (r * b + 31) / 32;
+            uint32_t packed[GroupSize] = { 0 };
+            uint32_t group[GroupSize];
+            memcpy(packed, in, words * sizeof(uint32_t));
+            fastunpack(packed, group, b);
+            memcpy(out, group, r * sizeof(uint32_t));
+            in += words;
+        }
+        nvalue = length;
+        return in;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0] >> LengthShift;
+    }
+
+    string name() const {
+        return "ShortListCodec";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new ShortListCodec(*this));
+    }
+};
+
+/**
+ * CompositeCodec<Codec1, ShortListCodec>, except that the arrays shorter
+ * than Codec1::BlockSize do not go through Codec1 (its header, padding
+ * and page metadata would cost more than the array): they are stored by
+ * ShortListCodec alone. So a short array costs a single header word.
+ *
+ * Format:
+ *    if the array is shorter than Codec1::BlockSize: ShortListCodec,
+ *    otherwise: LongArray, then CompositeCodec<Codec1, ShortListCodec>.
+ *
+ * (A ShortListCodec header never has the bit width LongArray.) As with
+ * Codec1, if you move the data around, you should preserve the alignment.
+ */
+template<class Codec1>
+class LengthAwareCodec: public IntegerCODEC {
+public:
+    enum {
+        LongArray = (1U << ShortListCodec::LengthShift) - 1
+    };
+
+    LengthAwareCodec() :
+        shortcodec(), composite() {
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        if (length < Codec1::BlockSize) {
+            shortcodec.encodeArray(in, length, out, nvalue);
+            return;
+        }
+        if (nvalue < 1)
+            throw NotEnoughStorage(maxCompressedWords(length));
+        out[0] = LongArray;
+        size_t nvalue1 = nvalue - 1;
+        composite.encodeArray(in, length, out + 1, nvalue1);
+        nvalue = 1 + nvalue1;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t & nvalue) {
+        if ((in[0] & LongArray) != LongArray)
+            return shortcodec.decodeArray(in, length, out, nvalue);
+        return composite.decodeArray(in + 1, length - 1, out, nvalue);
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        if (length < Codec1::BlockSize)
+            return shortcodec.maxCompressedWords(length);
+        return 1 + composite.maxCompressedWords(length);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        if ((in[0] & LongArray) != LongArray)
+            return shortcodec.decodedLength(in, length);
+        return composite.decodedLength(in + 1, length - 1);
+    }
+
+    string name() const {
+        return "LengthAware<" + composite.name() + ">";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new LengthAwareCodec(*this));
+    }
+
+private:
+    ShortListCodec shortcodec;
+    CompositeCodec<Codec1, ShortListCodec> composite;
+};
+
+#endif /* SHORTLISTCODEC_H_ */
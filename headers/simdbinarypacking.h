@@ -10,7 +10,14 @@
 
 #include "codecs.h"
 #include "simdbitpacking.h"
+#include "avxbitpacking.h"
 #include "util.h"
+#include "variablebyte.h"
+#include "deltabitpacking.h"
+#include "blocksummaries.h"
+#include "simdbitpackingtemplates.h"
+#include "aggregation.h"
+#include "narrowunpacking.h"
 
 
 /**
@@ -41,16 +48,52 @@ public:
      */
     void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
             size_t &nvalue) {
+        encodeWithGap(in, length, out, nvalue, 0);
+    }
+
+    void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        encodeWithGap(in, length, out, nvalue, deltaGap(SIMDmode, length));
+    }
+
+    /**
+     * If gap > 0, we encode the deltas (see computeDeltas), computing
+     * them one block at a time. In that case, in needs not be aligned.
+     */
+    void encodeWithGap(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap) {
+        encodeWithSummaries(in, length, out, nvalue, gap, false, NULL);
+    }
+
+    /**
+     * Same as encodeWithGap, but if summaries is true, we also write the
+     * block summaries (see BlockSummaries: the largest value of each 128
+     * integers, and of impacts if it is not NULL) after the length, so that
+     * BlockSummaryView can find them without decoding. With gap > 0, in is
+     * assumed sorted. The output takes BlockSummaries::words more words.
+     */
+    void encodeWithSummaries(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap, const bool summaries,
+            const uint32_t * impacts) {
         checkifdivisibleby(length, BlockSize);
+        const uint32_t * const initin(in);
         const uint32_t * const initout(out);
         *out++ = length;
+        if (summaries && (length > 0))
+            out = BlockSummaries::write(in, length, impacts, gap > 0, out);
         while(needPaddingTo128Bits(out)) *out++ = CookiePadder;
         uint32_t Bs[HowManyMiniBlocks];
+        __attribute__ ((aligned (16))) uint32_t deltas[BlockSize];
         for (const uint32_t * const final = in + length; in + BlockSize
                 <= final; in += BlockSize) {
+            const uint32_t * block = in;
+            if (gap > 0) {
+                computeDeltas(in, BlockSize, deltas, gap, in - initin);
+                block = deltas;
+            }
             for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
-                Bs[i] = maxbits(in + i * MiniBlockSize,
-                        in + (i + 1) * MiniBlockSize);
+                Bs[i] = maxbits(block + i * MiniBlockSize,
+                        block + (i + 1) * MiniBlockSize);
             *out++ = (Bs[0] << 24) | (Bs[1] << 16) | (Bs[2] << 8)
                 | Bs[3];
             *out++ = (Bs[4] << 24) | (Bs[5] << 16) | (Bs[6] << 8)
@@ -61,7 +104,7 @@ public:
                             | Bs[15];
             for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
                 // D.L. : is the reinterpret_cast safe here?
-                SIMD_fastpackwithoutmask_32(in + i * MiniBlockSize, reinterpret_cast<__m128i *>(out),
+                SIMD_fastpackwithoutmask_32(block + i * MiniBlockSize, reinterpret_cast<__m128i *>(out),
                                 Bs[i]);
                 out += MiniBlockSize/32 * Bs[i];
             }
@@ -73,13 +116,374 @@ public:
             uint32_t *out, size_t & nvalue) {
         const uint32_t actuallength = *in++;
         if(needPaddingTo128Bits(out)) throw runtime_error("bad initial output align");
+        in = BlockSummaries::skip(in, actuallength);
         while(needPaddingTo128Bits(in)) {
             if(in[0] != CookiePadder) throw logic_error("SIMDBinaryPacking alignment issue.");
             ++in;
         }
         const uint32_t * const initout(out);
+        for (; out < initout + actuallength; out += BlockSize)
+            in = decodeBlock(in, out);
+        nvalue = out - initout;
+        return in;
+    }
+
+    /**
+     * Decodes howmany arrays: in[i] to out[i] (aligned), with room for
+     * nvalue[i] integers, nvalue[i] then gets the number of integers and,
+     * if ends is not NULL, ends[i] where array i ends.
+     *
+     * Calling decodeArray on each cold array, we would wait on memory for
+     * its header, then for its bit widths, then for its packed data, one
+     * array after the other. Instead, we prefetch the start of all arrays,
+     * then decode them one block from each array at a time, prefetching
+     * the next block of an array while we decode the others: the cache
+     * misses of the arrays overlap.
+     */
+    void decodeMany(const uint32_t * const * in, uint32_t * const * out, size_t * nvalue,
+            const size_t howmany, const uint32_t ** ends = NULL) const {
+        for (size_t i = 0; i < howmany; ++i)
+            prefetchLines(in[i], 2);
+        vector<const uint32_t *> where(howmany);
+        vector<size_t> blocksleft(howmany);
+        for (size_t i = 0; i < howmany; ++i) {
+            const uint32_t * p = in[i];
+            const uint32_t actuallength = *p++;
+            if (actuallength > nvalue[i])
+                throw NotEnoughStorage(actuallength);
+            if (needPaddingTo128Bits(out[i]))
+                throw runtime_error("bad initial output align");
+            p = BlockSummaries::skip(p, actuallength);
+            while (needPaddingTo128Bits(p)) {
+                if (p[0] != CookiePadder)
+                    throw logic_error("SIMDBinaryPacking alignment issue.");
+                ++p;
+            }
+            prefetchLines(p, PrefetchedLines);
+            where[i] = p;
+            blocksleft[i] = actuallength / BlockSize;
+            nvalue[i] = actuallength;
+        }
+        for (size_t block = 0, active = howmany; active > 0; ++block) {
+            active = 0;
+            for (size_t i = 0; i < howmany; ++i) {
+                if (blocksleft[i] == 0)
+                    continue;
+                where[i] = decodeBlock(where[i], out[i] + block * BlockSize);
+                if (--blocksleft[i] > 0) {
+                    prefetchLines(where[i], PrefetchedLines);
+                    ++active;
+                }
+            }
+        }
+        if (ends != NULL)
+            for (size_t i = 0; i < howmany; ++i)
+                ends[i] = where[i];
+    }
+
+    /**
+     * Adds the integers of the compressed array in to a (sum, min, max,
+     * count) without writing them anywhere: each miniblock is unpacked
+     * into registers and reduced there (see SIMD_fastaggregate_32).
+     * Returns where the array ends, as decodeArray.
+     */
+    const uint32_t * aggregate(const uint32_t *in, Aggregate & a) const {
+        const uint32_t actuallength = *in++;
+        in = padTo128bits(BlockSummaries::skip(in, actuallength));
+        for (size_t block = 0; block < actuallength / BlockSize; ++block) {
+            const uint32_t * const header = in;
+            in += HowManyMiniBlocks / 4;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                const uint32_t b = bitWidth(header, i);
+                SIMD_fastaggregate_32(reinterpret_cast<const __m128i *>(in), b, 1, a);
+                in += MiniBlockSize / 32 * b;
+            }
+        }
+        return in;
+    }
+
+    /**
+     * Same as decodeArray, but to uint16_t or uint8_t (T): each miniblock
+     * is narrowed in registers as it is unpacked (see
+     * SIMD_fastunpack_narrow). out needs not be aligned. Throws logic_error
+     * if a miniblock has integers that do not fit in T.
+     */
+    template<class T>
+    const uint32_t * decodeNarrow(const uint32_t *in, const size_t /*length*/,
+            T *out, size_t & nvalue) const {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        in = padTo128bits(BlockSummaries::skip(in, actuallength));
+        for (size_t block = 0; block < actuallength / BlockSize; ++block) {
+            const uint32_t * const header = in;
+            in += HowManyMiniBlocks / 4;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, out += MiniBlockSize) {
+                const uint32_t b = bitWidth(header, i);
+                if (b > narrowBits<T>())
+                    throw logic_error("SIMDBinaryPacking: the integers do not fit in the output type");
+                SIMD_fastunpack_narrow(reinterpret_cast<const __m128i *>(in), out, b);
+                in += MiniBlockSize / 32 * b;
+            }
+        }
+        nvalue = actuallength;
+        return in;
+    }
+
+    /**
+     * Returns the integer at position index (out[index] after decodeArray)
+     * without decoding the array: we skip blocks using their bit widths
+     * and extract the single integer.
+     */
+    uint32_t select(const uint32_t *in, const size_t index) const {
+        const uint32_t actuallength = *in++;
+        if (index >= actuallength)
+            throw out_of_range("SIMDBinaryPacking::select: index out of range");
+        in = skipBlocks(padTo128bits(BlockSummaries::skip(in, actuallength)), index / BlockSize);
+        const uint32_t inblock = static_cast<uint32_t>(index % BlockSize);
+        const uint32_t * packed = in + HowManyMiniBlocks / 4;
+        for (uint32_t i = 0; i < inblock / MiniBlockSize; ++i)
+            packed += MiniBlockSize / 32 * bitWidth(in, i);
+        return SIMD_fastselect_32(reinterpret_cast<const __m128i *>(packed),
+                bitWidth(in, inblock / MiniBlockSize), inblock % MiniBlockSize);
+    }
+
+    /**
+     * Writes the integers at positions [begin, end) to out, only unpacking
+     * the miniblocks that overlap the range. Unlike decodeArray, out needs
+     * not be aligned.
+     */
+    void decodeRange(const uint32_t *in, const size_t begin, const size_t end,
+            uint32_t *out) const {
+        const uint32_t actuallength = *in++;
+        if ((begin > end) || (end > actuallength))
+            throw out_of_range("SIMDBinaryPacking::decodeRange: bad range");
+        if (begin == end)
+            return;
+        in = skipBlocks(padTo128bits(BlockSummaries::skip(in, actuallength)), begin / BlockSize);
+        __attribute__ ((aligned (16))) uint32_t buffer[MiniBlockSize];
+        size_t pos = begin / BlockSize * BlockSize;
+        while (pos < end) {
+            const uint32_t * const header = in;
+            in += HowManyMiniBlocks / 4;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, pos += MiniBlockSize) {
+                const uint32_t b = bitWidth(header, i);
+                if ((pos + MiniBlockSize > begin) && (pos < end)) {
+                    SIMD_fastunpack_32(reinterpret_cast<const __m128i *>(in), buffer, b);
+                    const size_t from = pos < begin ? begin - pos : 0;
+                    const size_t to = pos + MiniBlockSize > end ? end - pos : MiniBlockSize;
+                    memcpy(out, buffer + from, (to - from) * sizeof(uint32_t));
+                    out += to - from;
+                }
+                in += MiniBlockSize / 32 * b;
+            }
+        }
+    }
+
+    // the length, up to 3 words of padding, then the blocks
+    size_t maxCompressedWords(const size_t length) const {
+        return 4 + length / BlockSize * (4 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "SIMDBinaryPacking";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDBinaryPacking(*this));
+    }
+
+private:
+    enum {
+        PrefetchedLines = 4// of each block, ahead of decodeMany
+    };
+
+    static uint32_t bitWidth(const uint32_t * header, const uint32_t i) {
+        return static_cast<uint8_t>(header[i / 4] >> (24 - 8 * (i % 4)));
+    }
+
+    // decodes the block at in (bit widths and miniblocks), returns its end
+    static const uint32_t * decodeBlock(const uint32_t * in, uint32_t * out) {
         uint32_t Bs[HowManyMiniBlocks];
-        for (; out < initout + actuallength; out += BlockSize) {
+        for(uint32_t i = 0; i < 4 ; ++i,++in) {
+            Bs[0 + 4 * i] = static_cast<uint8_t>(in[0] >> 24);
+            Bs[1 + 4 * i] = static_cast<uint8_t>(in[0] >> 16);
+            Bs[2 + 4 * i] = static_cast<uint8_t>(in[0] >> 8);
+            Bs[3 + 4 * i] = static_cast<uint8_t>(in[0]);
+        }
+        for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+            // D.L. : is the reinterpret_cast safe here?
+            SIMD_fastunpack_32(reinterpret_cast<const __m128i *>(in), out + i * MiniBlockSize, Bs[i]);
+            in += MiniBlockSize/32 * Bs[i];
+        }
+        return in;
+    }
+
+    static const uint32_t * skipBlocks(const uint32_t * in, size_t howmany) {
+        for (; howmany > 0; --howmany) {
+            const uint32_t * const header = in;
+            in += HowManyMiniBlocks / 4;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                in += MiniBlockSize / 32 * bitWidth(header, i);
+        }
+        return in;
+    }
+
+};
+
+
+/**
+ * SIMDBinaryPacking without padding and with unaligned loads and stores
+ * (SIMD_fastunpack_32_unaligned...): the compressed data can be moved
+ * anywhere (a slab, a network buffer) and decoded in place, to any output.
+ * On recent processors, the unaligned kernels are about as fast.
+ *
+ * Format:
+ *    length,
+ *    for each block: the 16 bit widths (4 words), the 16 packed miniblocks.
+ */
+class UnalignedSIMDBinaryPacking: public IntegerCODEC {
+public:
+    static const uint32_t MiniBlockSize = 128;
+    static const uint32_t HowManyMiniBlocks = 16;
+    static const uint32_t BlockSize = HowManyMiniBlocks * MiniBlockSize;
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        if (maxCompressedWords(length) > nvalue)
+            throw NotEnoughStorage(maxCompressedWords(length));
+        const uint32_t * const initout(out);
+        *out++ = static_cast<uint32_t>(length);
+        for (const uint32_t * const final = in + length; in + BlockSize
+                <= final; in += BlockSize) {
+            uint32_t * const header = out;
+            out += HowManyMiniBlocks / 4;
+            fill(header, out, 0);
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                const uint32_t b = maxbits(in + i * MiniBlockSize,
+                        in + (i + 1) * MiniBlockSize);
+                header[i / 4] |= b << (24 - 8 * (i % 4));
+                SIMD_fastpackwithoutmask_32_unaligned(in + i * MiniBlockSize, out, b);
+                out += MiniBlockSize / 32 * b;
+            }
+        }
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        for (const uint32_t * const final = out + actuallength; out < final;) {
+            const uint32_t * const header = in;
+            in += HowManyMiniBlocks / 4;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i, out += MiniBlockSize) {
+                const uint32_t b = static_cast<uint8_t>(header[i / 4] >> (24 - 8 * (i % 4)));
+                SIMD_fastunpack_32_unaligned(in, out, b);
+                in += MiniBlockSize / 32 * b;
+            }
+        }
+        nvalue = actuallength;
+        return in;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (HowManyMiniBlocks / 4 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "UnalignedSIMDBinaryPacking";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new UnalignedSIMDBinaryPacking(*this));
+    }
+};
+
+
+/**
+ * SIMDBinaryPacking for sorted arrays: the codec does the delta coding itself,
+ * with the differences between integers 4 positions apart (D4, as
+ * Delta::deltaSIMD) so that they match the 4 lanes of the SIMD layout. It
+ * expects the original integers (the input is not modified) and the decoder
+ * computes the prefix sum in registers while unpacking (SIMD_fastunpackd4_32),
+ * the running values being carried from one block to the next.
+ *
+ * Any length is supported: the last (incomplete) block is delta coded (D1)
+ * and written with variable byte. As with SIMDBinaryPacking, the output
+ * of the decoder must be aligned on 16 bytes.
+ */
+class SIMDDeltaBinaryPacking: public IntegerCODEC {
+public:
+    static const uint32_t CookiePadder = 123456;
+    static const uint32_t MiniBlockSize = 128;
+    static const uint32_t HowManyMiniBlocks = 16;
+    static const uint32_t BlockSize = HowManyMiniBlocks * MiniBlockSize;
+
+    SIMDDeltaBinaryPacking() : tailcodec() {}
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        const uint32_t * const initout(out);
+        *out++ = length;
+        while(needPaddingTo128Bits(out)) *out++ = CookiePadder;
+        uint32_t Bs[HowManyMiniBlocks];
+        __attribute__ ((aligned (16))) uint32_t deltas[BlockSize];
+        __m128i prev = _mm_setzero_si128();
+        const uint32_t * const final = in + length / BlockSize * BlockSize;
+        for (; in < final; in += BlockSize) {
+            for (uint32_t k = 0; k < BlockSize; k += 4) {
+                const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + k));
+                _mm_store_si128(reinterpret_cast<__m128i *>(deltas + k), _mm_sub_epi32(cur, prev));
+                prev = cur;
+            }
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                Bs[i] = maxbits(deltas + i * MiniBlockSize,
+                        deltas + (i + 1) * MiniBlockSize);
+            for(uint32_t i = 0; i < 4 ; ++i)
+                *out++ = (Bs[4 * i] << 24) | (Bs[4 * i + 1] << 16) | (Bs[4 * i + 2] << 8)
+                    | Bs[4 * i + 3];
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                SIMD_fastpackwithoutmask_32(deltas + i * MiniBlockSize, reinterpret_cast<__m128i *>(out),
+                                Bs[i]);
+                out += MiniBlockSize/32 * Bs[i];
+            }
+        }
+        const uint32_t taillength = static_cast<uint32_t>(length % BlockSize);
+        uint32_t base = length >= BlockSize ? in[-1] : 0;
+        for (uint32_t k = 0; k < taillength; ++k) {
+            deltas[k] = in[k] - base;
+            base = in[k];
+        }
+        uint32_t * const tailsize = out++;
+        size_t tailnvalue = 0;
+        tailcodec.encodeArray(deltas, taillength, out, tailnvalue);
+        *tailsize = static_cast<uint32_t>(tailnvalue);
+        out += tailnvalue;
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        if(needPaddingTo128Bits(out)) throw runtime_error("bad initial output align");
+        while(needPaddingTo128Bits(in)) {
+            if(in[0] != CookiePadder) throw logic_error("SIMDDeltaBinaryPacking alignment issue.");
+            ++in;
+        }
+        const uint32_t * const initout(out);
+        const uint32_t * const finalout(out + actuallength / BlockSize * BlockSize);
+        uint32_t Bs[HowManyMiniBlocks];
+        __m128i prev = _mm_setzero_si128();
+        for (; out < finalout; out += BlockSize) {
             for(uint32_t i = 0; i < 4 ; ++i,++in) {
                 Bs[0 + 4 * i] = static_cast<uint8_t>(in[0] >> 24);
                 Bs[1 + 4 * i] = static_cast<uint8_t>(in[0] >> 16);
@@ -87,19 +491,41 @@ public:
                 Bs[3 + 4 * i] = static_cast<uint8_t>(in[0]);
             }
             for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
-                // D.L. : is the reinterpret_cast safe here?
-                SIMD_fastunpack_32(reinterpret_cast<const __m128i *>(in), out + i * MiniBlockSize, Bs[i]);
+                SIMD_fastunpackd4_32(reinterpret_cast<const __m128i *>(in), out + i * MiniBlockSize, Bs[i], prev);
                 in += MiniBlockSize/32 * Bs[i];
             }
         }
-        nvalue = out - initout;
+        const uint32_t tailsize = *in++;
+        size_t tailnvalue = actuallength - (out - initout);
+        in = tailcodec.decodeArray(in, tailsize, out, tailnvalue);
+        uint32_t base = out > initout ? out[-1] : 0;
+        for (size_t k = 0; k < tailnvalue; ++k)
+            out[k] = base += out[k];
+        nvalue = actuallength;
         return in;
     }
 
+    size_t maxCompressedWords(const size_t length) const {
+        return 5 + length / BlockSize * (4 + BlockSize)
+                + tailcodec.maxCompressedWords(length % BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    bool codesDeltas() const {
+        return true;
+    }
+
     string name() const {
-        return "SIMDBinaryPacking";
+        return "SIMDDeltaBinaryPacking";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDDeltaBinaryPacking(*this));
     }
 
+private:
+    VariableByte tailcodec;
 };
 
 
@@ -121,11 +547,9 @@ public:
         uint32_t Bs = maxbits(in,in + length);
         *out++ = Bs;
         while(needPaddingTo128Bits(out)) *out++ = CookiePadder;
-        for (const uint32_t * const final = in + length; in + BlockSize
-                <= final; in += BlockSize, out +=  4 * Bs) {
-                SIMD_fastpackwithoutmask_32(in, reinterpret_cast<__m128i *>(out),
-                                Bs);
-        }
+        // all blocks have the same bit width: one loop specialized for it
+        SIMD_packBlocksTable(Bs)(in, reinterpret_cast<__m128i *>(out), length / BlockSize);
+        out += 4 * Bs * (length / BlockSize);
         nvalue = out - initout;
     }
 
@@ -138,9 +562,8 @@ public:
             if(in[0] != CookiePadder) throw logic_error("SIMDBinaryPacking alignment issue.");
             ++in;
         }
-        for (uint32_t k = 0; k < actuallength / 128; ++k) {
-               SIMD_fastunpack_32(reinterpret_cast<const __m128i *>(in + 4 * Bs * k), out + 128 * k, Bs);
-        }
+        SIMD_unpackBlocksTable(Bs)(reinterpret_cast<const __m128i *>(in), out,
+                actuallength / BlockSize);
         nvalue = actuallength;
         return in + 4* Bs * actuallength / 128;
         /*const uint32_t * const initout(out);
@@ -151,10 +574,113 @@ public:
         return in;*/
     }
 
+    /**
+     * Adds the integers of the compressed array in to a (sum, min, max,
+     * count) without writing them anywhere: with a single bit width, this
+     * is one call to SIMD_fastaggregate_32. Returns where the array ends.
+     */
+    const uint32_t * aggregate(const uint32_t *in, Aggregate & a) const {
+        const uint32_t actuallength = *in++;
+        const uint32_t Bs = *in++;
+        in = padTo128bits(in);
+        SIMD_fastaggregate_32(reinterpret_cast<const __m128i *>(in), Bs,
+                actuallength / BlockSize, a);
+        return in + 4 * Bs * actuallength / 128;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 5 + length;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
         return "SIMDGlobalBinaryPacking";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDGlobalBinaryPacking(*this));
+    }
+
+};
+
+#ifdef FASTPFOR_X86
+/**
+ * Same idea as SIMDBinaryPacking, but using the 256-bit (AVX2) kernels:
+ * miniblocks have 256 integers and we group 8 of them into a block
+ * of 2048 integers, with two header words for the 8 bit widths.
+ *
+ * The AVX2 kernels use unaligned loads and stores so, unlike SIMDBinaryPacking,
+ * there is no padding and no alignment requirement on in or out.
+ *
+ * Only use this on processors supporting AVX2 (see cpuSupportsAVX2()).
+ */
+class SIMDBinaryPacking256: public IntegerCODEC {
+public:
+    static const uint32_t MiniBlockSize = 256;
+    static const uint32_t HowManyMiniBlocks = 8;
+    static const uint32_t BlockSize = HowManyMiniBlocks * MiniBlockSize;
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        const uint32_t * const initout(out);
+        *out++ = length;
+        uint32_t Bs[HowManyMiniBlocks];
+        for (const uint32_t * const final = in + length; in + BlockSize
+                <= final; in += BlockSize) {
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                Bs[i] = maxbits(in + i * MiniBlockSize,
+                        in + (i + 1) * MiniBlockSize);
+            *out++ = (Bs[0] << 24) | (Bs[1] << 16) | (Bs[2] << 8)
+                | Bs[3];
+            *out++ = (Bs[4] << 24) | (Bs[5] << 16) | (Bs[6] << 8)
+                            | Bs[7];
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                avxpackwithoutmask(in + i * MiniBlockSize, reinterpret_cast<__m256i *>(out),
+                                Bs[i]);
+                out += MiniBlockSize/32 * Bs[i];
+            }
+        }
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const uint32_t actuallength = *in++;
+        const uint32_t * const initout(out);
+        uint32_t Bs[HowManyMiniBlocks];
+        for (; out < initout + actuallength; out += BlockSize) {
+            for(uint32_t i = 0; i < 2 ; ++i,++in) {
+                Bs[0 + 4 * i] = static_cast<uint8_t>(in[0] >> 24);
+                Bs[1 + 4 * i] = static_cast<uint8_t>(in[0] >> 16);
+                Bs[2 + 4 * i] = static_cast<uint8_t>(in[0] >> 8);
+                Bs[3 + 4 * i] = static_cast<uint8_t>(in[0]);
+            }
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                avxunpack(reinterpret_cast<const __m256i *>(in), out + i * MiniBlockSize, Bs[i]);
+                in += MiniBlockSize/32 * Bs[i];
+            }
+        }
+        nvalue = out - initout;
+        return in;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (2 + BlockSize);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "SIMDBinaryPacking256";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDBinaryPacking256(*this));
+    }
 
 };
+#endif
 
 #endif /* SIMDBINARYPACKING_H_ */
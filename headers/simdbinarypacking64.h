@@ -0,0 +1,89 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SIMDBINARYPACKING64_H_
+#define SIMDBINARYPACKING64_H_
+
+#include "common.h"
+#include "codecs64.h"
+#include "simdbitpacking64.h"
+
+/**
+ * SIMDBinaryPacking for 64-bit integers: miniblocks of 128 integers
+ * packed with SIMD_fastpack_64, grouped 4 by 4 so that the 4 bit widths
+ * fit in one header word.
+ *
+ * Format:
+ *    length,
+ *    for each block: the 4 bit widths (one byte each), the 4 miniblocks.
+ *
+ * There are no alignment requirements.
+ */
+class SIMDBinaryPacking64: public IntegerCODEC64 {
+public:
+    static const uint32_t MiniBlockSize = 128;
+    static const uint32_t HowManyMiniBlocks = 4;
+    static const uint32_t BlockSize = HowManyMiniBlocks * MiniBlockSize;
+
+    void encodeArray(const uint64_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        if (maxCompressedWords(length) > nvalue) {// check more carefully
+            size_t required = 1;
+            for (size_t k = 0; k < length; k += MiniBlockSize)
+                required += MiniBlockSize / 32 * maxbits64(in + k, in + k + MiniBlockSize);
+            required += length / BlockSize;
+            if (required > nvalue)
+                throw NotEnoughStorage(required);
+        }
+        const uint32_t * const initout(out);
+        *out++ = static_cast<uint32_t> (length);
+        uint32_t Bs[HowManyMiniBlocks];
+        for (const uint64_t * const final = in + length; in + BlockSize
+                <= final; in += BlockSize) {
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i)
+                Bs[i] = maxbits64(in + i * MiniBlockSize, in + (i + 1) * MiniBlockSize);
+            *out++ = (Bs[0] << 24) | (Bs[1] << 16) | (Bs[2] << 8) | Bs[3];
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                SIMD_fastpack_64(in + i * MiniBlockSize, out, Bs[i]);
+                out += MiniBlockSize / 32 * Bs[i];
+            }
+        }
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint64_t *out, size_t & nvalue) {
+        const uint32_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        const uint64_t * const initout(out);
+        for (; out < initout + actuallength; out += BlockSize) {
+            const uint32_t header = *in++;
+            for (uint32_t i = 0; i < HowManyMiniBlocks; ++i) {
+                const uint32_t b = static_cast<uint8_t> (header >> (24 - 8 * i));
+                SIMD_fastunpack_64(in, out + i * MiniBlockSize, b);
+                in += MiniBlockSize / 32 * b;
+            }
+        }
+        nvalue = actuallength;
+        return in;
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + length / BlockSize * (1 + 2 * BlockSize);
+    }
+
+    string name() const {
+        return "SIMDBinaryPacking64";
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new SIMDBinaryPacking64(*this));
+    }
+};
+
+#endif /* SIMDBINARYPACKING64_H_ */
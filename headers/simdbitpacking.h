@@ -8,13 +8,77 @@
 #define SIMDBITPACKING_H_
 
 #include "common.h"
+#include "cpufeatures.h"
 
 void simdpack(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
 void simdpackwithoutmask(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
 void simdunpack(const __m128i * __restrict__ in,uint32_t * __restrict__ out, uint32_t bit);
 
+/**
+ * The three functions above are compiled for SSSE3. The same kernels are
+ * also compiled with -mavx2 (src/simdbitpacking_avx2.cpp); they produce the same
+ * format and should only be called when cpuSupportsAVX2() is true.
+ */
+namespace avx2 {
+void simdpack(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdpackwithoutmask(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdunpack(const __m128i * __restrict__ in,uint32_t * __restrict__ out, uint32_t bit);
+}
+
+/**
+ * The same kernels with unaligned loads and stores, for SSSE3
+ * (src/simdbitpacking_unaligned.cpp) and AVX2
+ * (src/simdbitpacking_unaligned_avx2.cpp).
+ */
+namespace unaligned {
+void simdpack(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdpackwithoutmask(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdunpack(const __m128i * __restrict__ in,uint32_t * __restrict__ out, uint32_t bit);
+}
+namespace avx2_unaligned {
+void simdpack(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdpackwithoutmask(const uint32_t * __restrict__ in,__m128i * __restrict__ out, uint32_t bit);
+void simdunpack(const __m128i * __restrict__ in,uint32_t * __restrict__ out, uint32_t bit);
+}
+
+/**
+ * The following functions pick the fastest build of the kernels
+ * for this processor. This is what the codecs use.
+ */
 void SIMD_fastunpack_32(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) ;
 void SIMD_fastpackwithoutmask_32(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, const uint32_t bit);
 void SIMD_fastpack_32(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, const uint32_t bit) ;
 
+/**
+ * Same format as the three functions above, but neither the input
+ * nor the output need be aligned.
+ */
+void SIMD_fastunpack_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) ;
+void SIMD_fastpackwithoutmask_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit);
+void SIMD_fastpack_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) ;
+
+/**
+ * Returns the integer at position index of data packed with SIMD_fastpack_32
+ * or SIMD_fastpackwithoutmask_32 (any number of consecutive blocks of 128
+ * integers packed with the same bit width), without unpacking. The integers
+ * of a block are spread over 4 interleaved 32-bit lanes.
+ */
+inline uint32_t SIMD_fastselect_32(const __m128i * in, const uint32_t bit, size_t index) {
+    if (bit == 0)
+        return 0;
+    const uint32_t * const block = reinterpret_cast<const uint32_t *> (in)
+            + index / 128 * 4 * bit;
+    index %= 128;
+    const uint32_t lane = static_cast<uint32_t> (index & 3);
+    const uint32_t pos = static_cast<uint32_t> (index >> 2) * bit;
+    const uint32_t word = pos >> 5;
+    const uint32_t offset = pos & 31;
+    if (bit == 32)
+        return block[4 * word + lane];
+    uint32_t answer = block[4 * word + lane] >> offset;
+    if (offset + bit > 32)
+        answer |= block[4 * (word + 1) + lane] << (32 - offset);
+    return answer & ((1U << bit) - 1);
+}
+
 #endif /* SIMDBITPACKING_H_ */
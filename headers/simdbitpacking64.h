@@ -0,0 +1,180 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+#ifndef SIMDBITPACKING64_H_
+#define SIMDBITPACKING64_H_
+
+#include "common.h"
+#include "codecs64.h"
+
+/**
+ * Bit packing of blocks of 128 64-bit integers with SSE2, the 64-bit
+ * version of SIMD_fastpack_32: the integers are spread over 2 interleaved
+ * 64-bit lanes (in[2k] in the first lane, in[2k+1] in the second), so a
+ * block packed with b bits takes b 128-bit words (4 * b 32-bit words).
+ *
+ * The kernels are templates (so the shifts are constants once the loop
+ * is unrolled) and we dispatch through a table of function pointers. The
+ * loads and stores are unaligned: no alignment is required.
+ */
+template<uint32_t bit>
+void simdpack64(const uint64_t * __restrict__ in, uint32_t * __restrict__ out) {
+    const __m128i * pin = reinterpret_cast<const __m128i *> (in);
+    __m128i * pout = reinterpret_cast<__m128i *> (out);
+    if (bit == 0)
+        return;
+    if (bit == 64) {
+        for (uint32_t k = 0; k < 64; ++k)
+            _mm_storeu_si128(pout + k, _mm_loadu_si128(pin + k));
+        return;
+    }
+    const __m128i mask = _mm_set1_epi64x((1ULL << (bit % 64)) - 1);
+    __m128i acc = _mm_setzero_si128();
+    uint32_t shift = 0;
+    for (uint32_t k = 0; k < 64; ++k) {
+        const __m128i v = _mm_and_si128(_mm_loadu_si128(pin + k), mask);
+        acc = _mm_or_si128(acc, _mm_slli_epi64(v, shift));
+        shift += bit;
+        if (shift >= 64) {
+            _mm_storeu_si128(pout++, acc);
+            shift -= 64;
+            acc = shift > 0 ? _mm_srli_epi64(v, bit - shift) : _mm_setzero_si128();
+        }
+    }
+}
+
+template<uint32_t bit>
+void simdunpack64(const uint32_t * __restrict__ in, uint64_t * __restrict__ out) {
+    const __m128i * pin = reinterpret_cast<const __m128i *> (in);
+    __m128i * pout = reinterpret_cast<__m128i *> (out);
+    if (bit == 0) {
+        for (uint32_t k = 0; k < 64; ++k)
+            _mm_storeu_si128(pout + k, _mm_setzero_si128());
+        return;
+    }
+    if (bit == 64) {
+        for (uint32_t k = 0; k < 64; ++k)
+            _mm_storeu_si128(pout + k, _mm_loadu_si128(pin + k));
+        return;
+    }
+    const __m128i mask = _mm_set1_epi64x((1ULL << (bit % 64)) - 1);
+    __m128i w = _mm_loadu_si128(pin++);
+    uint32_t shift = 0;
+    for (uint32_t k = 0; k < 64; ++k) {
+        __m128i v = _mm_srli_epi64(w, shift);
+        shift += bit;
+        if (shift > 64) {
+            w = _mm_loadu_si128(pin++);
+            shift -= 64;
+            v = _mm_or_si128(v, _mm_slli_epi64(w, bit - shift));
+        } else if ((shift == 64) && (k < 63)) {
+            w = _mm_loadu_si128(pin++);
+            shift = 0;
+        }
+        _mm_storeu_si128(pout + k, _mm_and_si128(v, mask));
+    }
+}
+
+typedef void (*simdpack64function)(const uint64_t *, uint32_t *);
+typedef void (*simdunpack64function)(const uint32_t *, uint64_t *);
+
+template<uint32_t bit>
+struct SIMDPacking64Table {
+    static void fill(simdpack64function * pack, simdunpack64function * unpack) {
+        pack[bit] = &simdpack64<bit>;
+        unpack[bit] = &simdunpack64<bit>;
+        SIMDPacking64Table<bit - 1>::fill(pack, unpack);
+    }
+};
+
+template<>
+struct SIMDPacking64Table<0> {
+    static void fill(simdpack64function * pack, simdunpack64function * unpack) {
+        pack[0] = &simdpack64<0>;
+        unpack[0] = &simdunpack64<0>;
+    }
+};
+
+struct SIMDPacking64Functions {
+    SIMDPacking64Functions() {
+        SIMDPacking64Table<64>::fill(pack, unpack);
+    }
+    simdpack64function pack[65];
+    simdunpack64function unpack[65];
+
+    static const SIMDPacking64Functions & get() {
+        static const SIMDPacking64Functions functions;
+        return functions;
+    }
+};
+
+/**
+ * Packs 128 integers to 4 * bit words (only the bit least significant
+ * bits of each integer are kept).
+ */
+inline void SIMD_fastpack_64(const uint64_t * in, uint32_t * out, const uint32_t bit) {
+    SIMDPacking64Functions::get().pack[bit](in, out);
+}
+
+inline void SIMD_fastunpack_64(const uint32_t * in, uint64_t * out, const uint32_t bit) {
+    SIMDPacking64Functions::get().unpack[bit](in, out);
+}
+
+// number of bits needed for the largest integer in [begin, end)
+inline uint32_t maxbits64(const uint64_t * begin, const uint64_t * end) {
+    uint64_t accumulator = 0;
+    for (const uint64_t * k = begin; k != end; ++k)
+        accumulator |= *k;
+    return bits64(accumulator);
+}
+
+__extension__ typedef unsigned __int128 uint128_for_packing;
+
+/**
+ * Packs any number of integers, one after the other in ceil(count * bit / 32)
+ * words (only the bit least significant bits of each integer are kept).
+ * Returns the end of the output.
+ */
+inline uint32_t * packStream64(const uint64_t * in, const size_t count,
+        uint32_t * out, const uint32_t bit) {
+    if (bit == 0)
+        return out;
+    const uint64_t mask = bit == 64 ? ~0ULL : (1ULL << bit) - 1;
+    uint128_for_packing buffer = 0;
+    uint32_t filled = 0;// always less than 32 bits between integers
+    for (size_t k = 0; k < count; ++k) {
+        buffer |= static_cast<uint128_for_packing> (in[k] & mask) << filled;
+        filled += bit;
+        for (; filled >= 32; filled -= 32) {
+            *out++ = static_cast<uint32_t> (buffer);
+            buffer >>= 32;
+        }
+    }
+    if (filled > 0)
+        *out++ = static_cast<uint32_t> (buffer);
+    return out;
+}
+
+inline const uint32_t * unpackStream64(const uint32_t * in, const size_t count,
+        uint64_t * out, const uint32_t bit) {
+    if (bit == 0) {
+        fill(out, out + count, 0);
+        return in;
+    }
+    const uint64_t mask = bit == 64 ? ~0ULL : (1ULL << bit) - 1;
+    uint128_for_packing buffer = 0;
+    uint32_t available = 0;
+    for (size_t k = 0; k < count; ++k) {
+        for (; available < bit; available += 32)
+            buffer |= static_cast<uint128_for_packing> (*in++) << available;
+        out[k] = static_cast<uint64_t> (buffer) & mask;
+        buffer >>= bit;
+        available -= bit;
+    }
+    return in;
+}
+
+#endif /* SIMDBITPACKING64_H_ */
@@ -0,0 +1,166 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SIMDBITPACKINGTEMPLATES_H_
+#define SIMDBITPACKINGTEMPLATES_H_
+
+#include "common.h"
+
+/**
+ * Header-only versions of the kernels of simdbitpacking.h (same format as
+ * SIMD_fastpack_32 and SIMD_fastunpack_32: 128 integers in 4 interleaved
+ * 32-bit lanes, aligned input and output), with the bit width as a
+ * template parameter. The steps are unrolled by template recursion, so
+ * every shift and mask is a constant. Unlike the generated kernels of
+ * src/simdbitpacking.cpp, which we reach through a switch in the library,
+ * they can be inlined: a codec that knows the bit width of many blocks
+ * (e.g., SIMDGlobalBinaryPacking) picks, once, a loop over the blocks
+ * specialized for this width (see SIMD_unpackBlocks and
+ * SIMD_unpackBlocksTable).
+ */
+
+namespace simdtemplates {
+
+// step j (out of 32) of unpacking bit-wide integers
+template<uint32_t bit, uint32_t j>
+struct UnpackStep {
+    enum {
+        word = j * bit / 32,
+        offset = j * bit % 32
+    };
+    static inline void run(const __m128i * __restrict__ in, __m128i * __restrict__ out,
+            const __m128i mask) {
+        __m128i v = _mm_srli_epi32(_mm_load_si128(in + word), offset);
+        if (offset + bit > 32)
+            v = _mm_or_si128(v, _mm_slli_epi32(_mm_load_si128(in + word + 1), 32 - offset));
+        if (offset + bit != 32)// not the last integer of the word
+            v = _mm_and_si128(v, mask);
+        _mm_store_si128(out + j, v);
+        UnpackStep<bit, j + 1>::run(in, out, mask);
+    }
+};
+
+template<uint32_t bit>
+struct UnpackStep<bit, 32> {
+    static inline void run(const __m128i * __restrict__, __m128i * __restrict__,
+            const __m128i) {
+    }
+};
+
+// step j (out of 32) of packing bit-wide integers, acc holds the current word
+template<uint32_t bit, bool mask, uint32_t j>
+struct PackStep {
+    enum {
+        word = j * bit / 32,
+        offset = j * bit % 32
+    };
+    static inline void run(const __m128i * __restrict__ in, __m128i * __restrict__ out,
+            __m128i acc, const __m128i m) {
+        __m128i v = _mm_load_si128(in + j);
+        if (mask && (bit < 32))
+            v = _mm_and_si128(v, m);
+        acc = offset == 0 ? v : _mm_or_si128(acc, _mm_slli_epi32(v, offset));
+        if (offset + bit >= 32) {
+            _mm_store_si128(out + word, acc);
+            acc = offset + bit > 32 ? _mm_srli_epi32(v, 32 - offset) : _mm_setzero_si128();
+        }
+        PackStep<bit, mask, j + 1>::run(in, out, acc, m);
+    }
+};
+
+template<uint32_t bit, bool mask>
+struct PackStep<bit, mask, 32> {
+    static inline void run(const __m128i * __restrict__, __m128i * __restrict__,
+            __m128i, const __m128i) {
+    }
+};
+
+template<uint32_t bit>
+inline __m128i maskOf() {
+    return _mm_set1_epi32(bit >= 32 ? -1 : static_cast<int> ((1U << (bit % 32)) - 1));
+}
+
+}// namespace simdtemplates
+
+// unpacks 128 integers of bit bits (bit * 4 words at in) to out
+template<uint32_t bit>
+inline void SIMD_unpack(const __m128i * __restrict__ in, uint32_t * __restrict__ out) {
+    simdtemplates::UnpackStep<bit, 0>::run(in, reinterpret_cast<__m128i *> (out),
+            simdtemplates::maskOf<bit>());
+}
+
+template<>
+inline void SIMD_unpack<0>(const __m128i * __restrict__, uint32_t * __restrict__ out) {
+    memset(out, 0, 128 * sizeof(uint32_t));
+}
+
+// packs 128 integers (that fit in bit bits) from in to bit * 4 words at out
+template<uint32_t bit>
+inline void SIMD_packwithoutmask(const uint32_t * __restrict__ in, __m128i * __restrict__ out) {
+    simdtemplates::PackStep<bit, false, 0>::run(reinterpret_cast<const __m128i *> (in), out,
+            _mm_setzero_si128(), _mm_setzero_si128());
+}
+
+template<>
+inline void SIMD_packwithoutmask<0>(const uint32_t * __restrict__, __m128i * __restrict__) {
+}
+
+// same as SIMD_packwithoutmask, but we only keep the bit least significant bits
+template<uint32_t bit>
+inline void SIMD_pack(const uint32_t * __restrict__ in, __m128i * __restrict__ out) {
+    simdtemplates::PackStep<bit, true, 0>::run(reinterpret_cast<const __m128i *> (in), out,
+            _mm_setzero_si128(), simdtemplates::maskOf<bit>());
+}
+
+template<>
+inline void SIMD_pack<0>(const uint32_t * __restrict__, __m128i * __restrict__) {
+}
+
+/**
+ * Unpacks howmany consecutive blocks of 128 integers, all packed with bit
+ * bits: the whole loop is specialized for this bit width.
+ */
+template<uint32_t bit>
+void SIMD_unpackBlocks(const __m128i * __restrict__ in, uint32_t * __restrict__ out,
+        const size_t howmany) {
+    for (size_t k = 0; k < howmany; ++k, in += bit, out += 128)
+        SIMD_unpack<bit> (in, out);
+}
+
+// same as SIMD_unpackBlocks, the other way around
+template<uint32_t bit>
+void SIMD_packBlocksWithoutMask(const uint32_t * __restrict__ in, __m128i * __restrict__ out,
+        const size_t howmany) {
+    for (size_t k = 0; k < howmany; ++k, in += 128, out += bit)
+        SIMD_packwithoutmask<bit> (in, out);
+}
+
+typedef void (*SIMDBlocksUnpacker)(const __m128i * __restrict__ in,
+        uint32_t * __restrict__ out, const size_t howmany);
+typedef void (*SIMDBlocksPacker)(const uint32_t * __restrict__ in,
+        __m128i * __restrict__ out, const size_t howmany);
+
+#define SIMD_BLOCKS_TABLE(f) { &f<0>, &f<1>, &f<2>, &f<3>, &f<4>, &f<5>, &f<6>, &f<7>, \
+        &f<8>, &f<9>, &f<10>, &f<11>, &f<12>, &f<13>, &f<14>, &f<15>, &f<16>, &f<17>, \
+        &f<18>, &f<19>, &f<20>, &f<21>, &f<22>, &f<23>, &f<24>, &f<25>, &f<26>, &f<27>, \
+        &f<28>, &f<29>, &f<30>, &f<31>, &f<32> }
+
+// SIMD_unpackBlocks<bit> for a bit width known at run time (0 to 32)
+inline SIMDBlocksUnpacker SIMD_unpackBlocksTable(const uint32_t bit) {
+    static const SIMDBlocksUnpacker table[33] = SIMD_BLOCKS_TABLE(SIMD_unpackBlocks);
+    return table[bit];
+}
+
+// SIMD_packBlocksWithoutMask<bit> for a bit width known at run time (0 to 32)
+inline SIMDBlocksPacker SIMD_packBlocksTable(const uint32_t bit) {
+    static const SIMDBlocksPacker table[33] = SIMD_BLOCKS_TABLE(SIMD_packBlocksWithoutMask);
+    return table[bit];
+}
+
+#undef SIMD_BLOCKS_TABLE
+
+#endif /* SIMDBITPACKINGTEMPLATES_H_ */
@@ -10,8 +10,12 @@
 #include "common.h"
 #include "codecs.h"
 #include "simdbitpacking.h"
+#include "avxbitpacking.h"
 #include "memutil.h"
 #include "util.h"
+#include "patching.h"
+#include "blocksummaries.h"
+#include "aggregation.h"
 
 
 /**
@@ -110,7 +114,17 @@ public:
     }
 
 
-    // sometimes, mem. usage can grow too much, this clears it up
+    /**
+     * The scratch buffers are kept from call to call (see FastPFor::trim),
+     * this frees the buffers of the instance and the workspace of the
+     * calling thread.
+     */
+    void trim() {
+        resetBuffer();
+        threadWorkspace().trim();
+    }
+
+    // frees the encoding buffers of the instance
     void resetBuffer() {
         for (size_t i = 0; i < datatobepacked.size(); ++i) {
             vector<uint32_t,cacheallocator> ().swap(datatobepacked[i]);
@@ -120,16 +134,49 @@ public:
     const uint32_t PageSize;
     const uint32_t bitsPageSize;
 
-    vector<vector<uint32_t,cacheallocator> > datatobepacked;
+    vector<vector<uint32_t,cacheallocator> > datatobepacked;// scratch for encoding
     vector<uint8_t> bytescontainer;
 
+    /**
+     * Scratch space for decoding: the exceptions of a page. The encoder
+     * uses the buffers of the instance instead.
+     */
+    struct Workspace {
+        Workspace() :
+            datatobepacked(33) {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            for (size_t i = 0; i < datatobepacked.size(); ++i)
+                vector<uint32_t,cacheallocator> ().swap(datatobepacked[i]);
+        }
+        vector<vector<uint32_t,cacheallocator> > datatobepacked;
+    };
+
+    // the workspace used by decodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // thread-safe: it does not modify the instance
     const uint32_t * decodeArray(const uint32_t *in, const size_t length,
             uint32_t *out, size_t &nvalue) {
+        return decodeArray(in, length, out, nvalue, threadWorkspace());
+    }
+
+    /**
+     * Same as decodeArray, but with your own scratch space (e.g., one per
+     * thread, reused from call to call).
+     */
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, Workspace & ws) const {
         const uint32_t * const initin(in);
         const size_t mynvalue = *in;
         ++in;
         if (mynvalue > nvalue)
             throw NotEnoughStorage(mynvalue);
+        in = BlockSummaries::skip(in, mynvalue);
         nvalue = mynvalue;
         const uint32_t * const finalout(out + nvalue);
         while (out != finalout) {
@@ -138,15 +185,72 @@ public:
                     static_cast<size_t> (finalout > PageSize + out ? PageSize
                             : (finalout - out));
 
-            __decodeArray(in, thisnvalue, out, thissize);
+            __decodeArray(in, thisnvalue, out, thissize, ws);
             in += thisnvalue;
             out += thissize;
         }
         assert(initin + length >= in);
-        resetBuffer();// if you don't do this, the codec has a "memory".
         return in;
     }
 
+    /**
+     * Decodes howmany arrays: in[i] to out[i] (aligned), with room for
+     * nvalue[i] integers, nvalue[i] then gets the number of integers and,
+     * if ends is not NULL, ends[i] where array i ends.
+     *
+     * Decoding a cold page means waiting on memory for its header, then for
+     * its metadata (bit widths and exceptions, at the end of the page),
+     * then for its packed data. We prefetch the headers of all arrays,
+     * then their metadata and the start of their packed data, and decode
+     * them one page from each array at a time: the cache misses of the
+     * arrays overlap instead of adding up.
+     */
+    void decodeMany(const uint32_t * const * in, uint32_t * const * out, size_t * nvalue,
+            const size_t howmany, const uint32_t ** ends = NULL) const {
+        Workspace & ws = threadWorkspace();
+        for (size_t i = 0; i < howmany; ++i)
+            prefetchLines(in[i], 2);
+        vector<const uint32_t *> where(howmany);
+        vector<size_t> left(howmany);
+        for (size_t i = 0; i < howmany; ++i) {
+            const size_t mynvalue = in[i][0];
+            if (mynvalue > nvalue[i])
+                throw NotEnoughStorage(mynvalue);
+            where[i] = BlockSummaries::skip(in[i] + 1, mynvalue);
+            left[i] = nvalue[i] = mynvalue;
+            if (mynvalue > 0)
+                prefetchPage(where[i]);
+        }
+        for (size_t page = 0, active = howmany; active > 0; ++page) {
+            active = 0;
+            for (size_t i = 0; i < howmany; ++i) {
+                if (left[i] == 0)
+                    continue;
+                size_t thisnvalue(0);
+                const size_t thissize = min<size_t> (left[i], PageSize);
+                __decodeArray(where[i], thisnvalue, out[i] + page * PageSize, thissize, ws);
+                where[i] += thisnvalue;
+                left[i] -= thissize;
+                if (left[i] > 0) {
+                    prefetchPage(where[i]);
+                    ++active;
+                }
+            }
+        }
+        if (ends != NULL)
+            for (size_t i = 0; i < howmany; ++i)
+                ends[i] = where[i];
+    }
+
+    /**
+     * Prefetches the page at in: its metadata (in[0] words further) and
+     * the start of its packed data.
+     */
+    static void prefetchPage(const uint32_t * in) {
+        prefetchLines(in + in[0], 2);
+        prefetchLines(in, 4);
+    }
+
     /**
      * If you save the output and recover it in memory, you are
      * responsible to ensure that the alignment is preserved.
@@ -155,6 +259,555 @@ public:
      * BlockSizeInUnitsOfPackSize * PACKSIZE. (This was done
      * to simplify slightly the implementation.)
      */
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        encodeWithGap(in, length, out, nvalue, 0);
+    }
+
+    void encodeDeltaArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, const bool SIMDmode) {
+        encodeWithGap(in, length, out, nvalue, deltaGap(SIMDmode, length));
+    }
+
+    /**
+     * If gap > 0, we encode the deltas (see computeDeltas), computing
+     * them one block at a time.
+     */
+    void encodeWithGap(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap) {
+        encodeWithSummaries(in, length, out, nvalue, gap, false, NULL);
+    }
+
+    /**
+     * Same as encodeWithGap, but if summaries is true, we also write the
+     * block summaries (see BlockSummaries: the largest value of each
+     * block, and of impacts if it is not NULL) after the length, so that
+     * BlockSummaryView can find them without decoding. With gap > 0, in is
+     * assumed sorted. The output takes BlockSummaries::words more words.
+     */
+    void encodeWithSummaries(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue, const uint32_t gap, const bool summaries,
+            const uint32_t * impacts) {
+        checkifdivisibleby(length, BlockSize);
+        const uint32_t * const initin(in);
+        const uint32_t * const initout(out);
+        const uint32_t * const finalin(in + length);
+
+        *out++ = length;
+        if (summaries && (length > 0))
+            out = BlockSummaries::write(in, length, impacts, gap > 0, out);
+        const size_t oldnvalue = nvalue;
+        nvalue = out - initout;
+        while (in != finalin) {
+            size_t thissize =
+                    static_cast<size_t> (finalin > PageSize + in ? PageSize
+                            : (finalin - in));
+            size_t thisnvalue(0);
+            __encodeArray(in, thissize, out, thisnvalue, gap, in - initin);
+            nvalue += thisnvalue;
+            out += thisnvalue;
+            in += thissize;
+        }
+        assert(out == nvalue + initout);
+        if (oldnvalue < nvalue)
+            cerr << "It is possible we have a buffer overrun. " << endl;
+    }
+
+
+    void getBestBFromData(const uint32_t * in, uint8_t& bestb,
+            uint8_t & bestcexcept, uint8_t & maxb) {
+        uint32_t freqs[33];
+        bitWidthHistogram(in, BlockSize, freqs);
+        bestb = 32;
+        while (freqs[bestb] == 0)
+            bestb--;
+        maxb = bestb;
+        uint32_t bestcost = bestb * BlockSize;
+        uint32_t cexcept = 0;
+        bestcexcept = cexcept;
+        for (uint32_t b = bestb - 1; b < 32; --b) {
+            cexcept += freqs[b + 1];
+            uint32_t thiscost = cexcept * overheadofeachexcept + cexcept
+                    * (maxb - b) + b * BlockSize + 8;// the  extra 8 is the cost of storing maxbits
+            if (thiscost < bestcost) {
+                bestcost = thiscost;
+                bestb = b;
+                bestcexcept = cexcept;
+            }
+        }
+    }
+
+    /**
+     * Encodes one page. If gap > 0, we encode the deltas, in[0] being
+     * at position "position" in the whole array.
+     */
+    void __encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t & nvalue, const uint32_t gap = 0, const size_t position = 0) {
+        const uint32_t * const initin = in;
+        uint32_t * const initout = out; // keep track of this
+        checkifdivisibleby(length, BlockSize);
+        uint32_t * const headerout = out++; // keep track of this
+        for (uint32_t k = 0; k < 32 + 1; ++k)
+            datatobepacked[k].clear();
+        uint8_t * bc = &bytescontainer[0];
+        out = padTo128bits(out);
+        assert((gap > 0) || !needPaddingTo128Bits(in));
+        __attribute__ ((aligned (16))) uint32_t deltas[BlockSize];
+        for (const uint32_t * const final = in + length; (in + BlockSize
+                <= final); in += BlockSize) {
+            const uint32_t * block = in;
+            if (gap > 0) {
+                computeDeltas(in, BlockSize, deltas, gap, position + (in - initin));
+                block = deltas;
+            }
+            uint8_t bestb, bestcexcept, maxb;
+            getBestBFromData(block, bestb, bestcexcept, maxb);
+            codeccounters::encodedBlock(bestb, bestcexcept);
+            *bc++ = bestb;
+            *bc++ = bestcexcept;
+            if (bestcexcept > 0) {
+                *bc++ = maxb;
+                vector < uint32_t , cacheallocator> &thisexceptioncontainer
+                        = datatobepacked[maxb - bestb];
+                const uint32_t cexcept = exceptionPositions(block, BlockSize, bestb, bc);
+                for (uint32_t k = 0; k < cexcept; ++k)
+                    thisexceptioncontainer.push_back(block[bc[k]] >> bestb);
+                bc += cexcept;
+            }
+            out = packblockupsimd(block, out, bestb);
+        }
+        headerout[0] = static_cast<uint32_t> (out - headerout);
+        const uint32_t bytescontainersize = bc - &bytescontainer[0];
+        *(out++) = bytescontainersize;
+        if (bytescontainersize % sizeof(uint32_t) != 0)// the padding bytes are zeros
+            out[bytescontainersize / sizeof(uint32_t)] = 0;
+        memcpy(out, &bytescontainer[0], bytescontainersize);
+        out += (bytescontainersize + sizeof(uint32_t) - 1)
+                / sizeof(uint32_t);
+        uint32_t bitmap = 0;
+        for (uint32_t k = 1; k <= 32; ++k) {
+            if (datatobepacked[k].size() != 0)
+                bitmap |= (1U << (k - 1));
+        }
+        *(out++) = bitmap;
+        for (uint32_t k = 1; k <= 32; ++k) {
+            if (datatobepacked[k].size() > 0)
+                out = packmeupwithoutmasksimd(datatobepacked[k], out, k);
+        }
+        nvalue = out - initout;
+    }
+
+    void __decodeArray(const uint32_t *in, size_t & length, uint32_t *out,
+            const size_t nvalue, Workspace & ws) const {
+        vector<vector<uint32_t,cacheallocator> > & datatobepacked = ws.datatobepacked;
+        const uint32_t * const initin = in;
+        const uint32_t * const headerin = in++;
+        const uint32_t wheremeta = headerin[0];
+        const uint32_t *inexcept = headerin + wheremeta;
+        const uint32_t bytesize = *inexcept++;
+        const uint8_t * bytep = reinterpret_cast<const uint8_t *> (inexcept);
+        inexcept += (bytesize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        const uint32_t bitmap = *(inexcept++);
+        for (uint32_t k = 1; k <= 32; ++k) {
+            if ((bitmap & (1U << (k - 1))) != 0) {
+                inexcept = unpackmesimd(inexcept, datatobepacked[k], k);
+            }
+        }
+        length = inexcept - initin;
+        vector<uint32_t,cacheallocator>::const_iterator unpackpointers[32 + 1];
+        for (uint32_t k = 1; k <= 32; ++k) {
+            unpackpointers[k] = datatobepacked[k].begin();
+        }
+        in = padTo128bits(in);
+        assert(!needPaddingTo128Bits(out));
+        uint64_t patched = 0;
+        for (uint32_t run = 0; run < nvalue / BlockSize; ++run, out
+                += BlockSize) {
+            const uint8_t b = *bytep++;
+            const uint8_t cexcept = *bytep++;
+            in = unpackblocksimd(in, out, b);
+            if (cexcept > 0) {
+                const uint8_t maxbits = *bytep++;
+                vector<uint32_t,cacheallocator>::const_iterator & exceptionsptr =
+                        unpackpointers[maxbits - b];
+                patchExceptions(out, bytep, &*exceptionsptr, cexcept, b);
+                bytep += cexcept;
+                exceptionsptr += cexcept;
+                patched += cexcept;
+            }
+        }
+        codeccounters::decodedBlocks(nvalue / BlockSize, patched);
+        assert(in == headerin + wheremeta);
+    }
+
+    /**
+     * Returns the integer at position index (out[index] after decodeArray)
+     * without decoding the array. We skip whole pages, then walk the byte
+     * container of the page to find the block, and we extract the single
+     * integer (and its exception, if any).
+     */
+    uint32_t select(const uint32_t *in, const size_t index) const {
+        const size_t mynvalue = *in++;
+        if (index >= mynvalue)
+            throw out_of_range("SIMDFastPFor::select: index out of range");
+        in = BlockSummaries::skip(in, mynvalue);
+        const uint32_t * exceptions[32 + 1];
+        const uint8_t * bytep;
+        for (size_t page = 0; page < index / PageSize; ++page)
+            in += locatePage(in, exceptions, bytep);
+        locatePage(in, exceptions, bytep);
+        const uint32_t inpage = static_cast<uint32_t> (index % PageSize);
+        const uint32_t * packed = padTo128bits(in + 1);
+        uint32_t exceptcount[32 + 1] = {0};
+        for (uint32_t run = 0; run < inpage / BlockSize; ++run) {
+            const uint8_t b = *bytep++;
+            const uint8_t cexcept = *bytep++;
+            if (cexcept > 0) {
+                const uint8_t maxbits = *bytep++;
+                exceptcount[maxbits - b] += cexcept;
+                bytep += cexcept;
+            }
+            packed += 4 * b;
+        }
+        const uint8_t b = *bytep++;
+        const uint8_t cexcept = *bytep++;
+        const uint32_t pos = inpage % BlockSize;
+        uint32_t answer = SIMD_fastselect_32(reinterpret_cast<const __m128i *>(packed), b, pos);
+        if (cexcept > 0) {
+            const uint8_t maxbits = *bytep++;
+            for (uint32_t k = 0; k < cexcept; ++k) {
+                if (bytep[k] == pos) {
+                    answer |= SIMD_fastselect_32(reinterpret_cast<const __m128i *>(exceptions[maxbits - b]), maxbits - b, exceptcount[maxbits - b] + k) << b;
+                    break;
+                }
+            }
+        }
+        return answer;
+    }
+
+    /**
+     * Writes the integers at positions [begin, end) to out, only unpacking
+     * the blocks that overlap the range. Exceptions are extracted one at a time.
+     */
+    void decodeRange(const uint32_t *in, const size_t begin, const size_t end,
+            uint32_t *out) const {
+        const size_t mynvalue = *in++;
+        if ((begin > end) || (end > mynvalue))
+            throw out_of_range("SIMDFastPFor::decodeRange: bad range");
+        in = BlockSummaries::skip(in, mynvalue);
+        const uint32_t * exceptions[32 + 1];
+        const uint8_t * bytep;
+        __attribute__ ((aligned (16))) uint32_t buffer[BlockSize];
+        size_t pagestart = 0;
+        for (; pagestart + PageSize <= begin; pagestart += PageSize)
+            in += locatePage(in, exceptions, bytep);
+        for (; pagestart < end; pagestart += PageSize) {
+            const size_t pagelength = locatePage(in, exceptions, bytep);
+            const uint32_t * packed = padTo128bits(in + 1);
+            uint32_t exceptcount[32 + 1] = {0};
+            for (size_t pos = pagestart; (pos < end) && (pos < pagestart + PageSize); pos += BlockSize) {
+                const uint8_t b = *bytep++;
+                const uint8_t cexcept = *bytep++;
+                const uint8_t maxbits = cexcept > 0 ? *bytep++ : b;
+                if (pos + BlockSize > begin) {
+                    SIMD_fastunpack_32(reinterpret_cast<const __m128i *>(packed), buffer, b);
+                    for (uint32_t k = 0; k < cexcept; ++k)
+                        buffer[bytep[k]] |= SIMD_fastselect_32(reinterpret_cast<const __m128i *>(exceptions[maxbits - b]), maxbits - b, exceptcount[maxbits - b] + k) << b;
+                    const size_t from = pos < begin ? begin - pos : 0;
+                    const size_t to = pos + BlockSize > end ? end - pos : static_cast<size_t> (BlockSize);
+                    memcpy(out, buffer + from, (to - from) * sizeof(uint32_t));
+                    out += to - from;
+                }
+                exceptcount[maxbits - b] += cexcept;
+                bytep += cexcept;
+                packed += 4 * b;
+            }
+            in += pagelength;
+        }
+    }
+
+    /**
+     * Adds the integers of the compressed array in to a (sum, min, max,
+     * count) without decoding it: the low bits of each block are reduced
+     * in registers (SIMD_fastaggregate_32), then the exceptions of the
+     * block are applied as corrections (see aggregateBlock). Returns where
+     * the array ends, as decodeArray.
+     */
+    const uint32_t * aggregate(const uint32_t *in, Aggregate & a) const {
+        const size_t mynvalue = *in++;
+        in = BlockSummaries::skip(in, mynvalue);
+        const uint32_t * exceptions[32 + 1];
+        const uint8_t * bytep;
+        for (size_t pagestart = 0; pagestart < mynvalue; pagestart += PageSize) {
+            const size_t pagelength = locatePage(in, exceptions, bytep);
+            const uint32_t * packed = padTo128bits(in + 1);
+            uint32_t exceptcount[32 + 1] = {0};
+            const size_t blocks = min<size_t> (PageSize, mynvalue - pagestart) / BlockSize;
+            for (size_t run = 0; run < blocks; ++run) {
+                const uint8_t b = *bytep++;
+                const uint8_t cexcept = *bytep++;
+                const __m128i * const block = reinterpret_cast<const __m128i *>(packed);
+                if (cexcept == 0) {
+                    SIMD_fastaggregate_32(block, b, 1, a);
+                } else {
+                    const uint8_t maxbits = *bytep++;
+                    aggregateBlock(block, b, bytep, cexcept, exceptions[maxbits - b],
+                            maxbits - b, exceptcount[maxbits - b], a);
+                    exceptcount[maxbits - b] += cexcept;
+                    bytep += cexcept;
+                }
+                packed += 4 * b;
+            }
+            in += pagelength;
+        }
+        return in;
+    }
+
+    /**
+     * Adds to a the block of low bits at packed (b bits) patched with the
+     * cexcept exceptions at positions (high bits: integers first, first + 1...
+     * of the exception array with excbits bits). An exception is at least
+     * 2^b while the other integers are below, so we correct the sum and the
+     * maximum from the exceptions alone. The minimum of the low bits is
+     * right unless it is only reached by exceptions: then we unpack the block.
+     */
+    static void aggregateBlock(const __m128i * packed, const uint32_t b,
+            const uint8_t * positions, const uint32_t cexcept, const uint32_t * exceptions,
+            const uint32_t excbits, const uint32_t first, Aggregate & a) {
+        Aggregate block;
+        SIMD_fastaggregate_32(packed, b, 1, block);
+        const __m128i * const highbits = reinterpret_cast<const __m128i *>(exceptions);
+        uint32_t exceptmin = 0xFFFFFFFFU;
+        bool ambiguous = false;
+        for (uint32_t k = 0; k < cexcept; ++k) {
+            const uint32_t low = SIMD_fastselect_32(packed, b, positions[k]);
+            const uint32_t value = low | (SIMD_fastselect_32(highbits, excbits, first + k) << b);
+            block.sum += value - low;
+            block.max = max(block.max, value);
+            exceptmin = min(exceptmin, value);
+            ambiguous |= (low == block.min);
+        }
+        if (cexcept == BlockSize) {
+            block.min = exceptmin;
+        } else if (ambiguous && (b > 0)) {// with b = 0, the other integers are zeros
+            __attribute__ ((aligned (16))) uint32_t buffer[BlockSize];
+            SIMD_fastunpack_32(packed, buffer, b);
+            for (uint32_t k = 0; k < cexcept; ++k)
+                buffer[positions[k]] = 0xFFFFFFFFU;
+            block.min = min(exceptmin, *std::min_element(buffer, buffer + BlockSize));
+        }
+        a += block;
+    }
+
+    /**
+     * Finds the exception arrays and the byte container of the page starting at in,
+     * and returns the size of the page in words (as computed by __decodeArray).
+     */
+    static size_t locatePage(const uint32_t * in, const uint32_t * exceptions[32 + 1],
+            const uint8_t * & bytep) {
+        const uint32_t *inexcept = in + in[0];
+        const uint32_t bytesize = *inexcept++;
+        bytep = reinterpret_cast<const uint8_t *> (inexcept);
+        inexcept += (bytesize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        const uint32_t bitmap = *(inexcept++);
+        for (uint32_t k = 1; k <= 32; ++k) {
+            if ((bitmap & (1U << (k - 1))) != 0) {
+                const uint32_t size = *inexcept++;
+                inexcept = padTo128bits(inexcept);
+                exceptions[k] = inexcept;
+                inexcept += (size + 128 - 1) / 128 * 4 * k;
+            }
+        }
+        return inexcept - in;
+    }
+
+    /**
+     * As with FastPFor, a block takes at most BlockSize words plus 3 bytes.
+     * Each page adds 7 words (offset to the metadata, padding to 16 bytes,
+     * number of bytes, padding of the bytes, bitmap) and each of the 32
+     * exception arrays a size word, 3 words of padding to 16 bytes and less
+     * than 4 k words of padding at the end.
+     */
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t pages = (length + PageSize - 1) / PageSize;
+        return 1 + length + (3 * (length / BlockSize) + 3) / 4
+                + pages * (7 + 32 * 4 + 4 * (32 * 33 / 2));
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "SIMDFastPFor";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDFastPFor(*this));
+    }
+
+};
+
+
+
+#ifdef FASTPFOR_X86
+/**
+ * SIMDFastPFor256
+ *
+ * This is SIMDFastPFor using the 256-bit (AVX2) kernels: blocks have 256
+ * integers instead of 128. Since the AVX2 kernels use unaligned loads and
+ * stores, there is no padding and no alignment requirement.
+ *
+ * Only use this on processors supporting AVX2 (see cpuSupportsAVX2()).
+ */
+class SIMDFastPFor256: public IntegerCODEC {
+public:
+    /**
+     * ps (page size) should be a multiple of BlockSize, any "large"
+     * value should do.
+     */
+    SIMDFastPFor256(uint32_t ps = 65536) :
+        PageSize(ps), bitsPageSize(gccbits(PageSize)), datatobepacked(33),
+                bytescontainer(PageSize + 3 * PageSize / BlockSize) {
+        assert(ps / BlockSize * BlockSize == ps);
+        assert(gccbits(BlockSizeInUnitsOfPackSize * PACKSIZE - 1) <= 8);
+    }
+    enum {
+        BlockSizeInUnitsOfPackSize = 8,
+        PACKSIZE = 32,
+        overheadofeachexcept = 8,
+        overheadduetobits = 8,
+        overheadduetonmbrexcept = 8,
+        BlockSize = BlockSizeInUnitsOfPackSize * PACKSIZE
+    };
+
+    static uint32_t * packblockupsimd(const uint32_t * source, uint32_t * out,
+            const uint32_t bit) {
+       avxpack(source, reinterpret_cast<__m256i *>(out), bit);
+       out += 8 * bit;
+       return out;
+    }
+
+    static const uint32_t * unpackblocksimd(const uint32_t * source, uint32_t * out,
+            const uint32_t bit) {
+        avxunpack(reinterpret_cast<const __m256i *>(source), out, bit);
+        source += 8 * bit;
+        return source;
+    }
+
+    template<class STLContainer>
+    static const uint32_t * unpackmesimd(const uint32_t * in, STLContainer & out,
+            const uint32_t bit) {
+        const uint32_t size = *in;
+        ++in;
+        out.resize((size + 256 - 1) / 256 * 256);
+        for (uint32_t j = 0; j != out.size(); j += 256) {
+            avxunpack(reinterpret_cast<const __m256i *>(in), &out[j], bit);
+            in += 8 * bit;
+        }
+        out.resize(size);
+        return in;
+    }
+
+    template<class STLContainer>
+    static uint32_t * packmeupwithoutmasksimd(STLContainer & source, uint32_t * out,
+            const uint32_t bit) {
+        const uint32_t size = source.size();
+        *out = size;
+        out++;
+        if (source.size() == 0)
+            return out;
+        source.resize((source.size() + 256 - 1) / 256 * 256);
+        for (uint32_t j = 0; j != source.size(); j += 256) {
+            avxpackwithoutmask(&source[j], reinterpret_cast<__m256i *>(out), bit);
+            out += 8 * bit;
+        }
+        source.resize(size);
+        return out;
+    }
+
+
+    /**
+     * The scratch buffers are kept from call to call (see FastPFor::trim),
+     * this frees the buffers of the instance and the workspace of the
+     * calling thread.
+     */
+    void trim() {
+        resetBuffer();
+        threadWorkspace().trim();
+    }
+
+    // frees the encoding buffers of the instance
+    void resetBuffer() {
+        for (size_t i = 0; i < datatobepacked.size(); ++i) {
+            vector<uint32_t,cacheallocator> ().swap(datatobepacked[i]);
+        }
+    }
+
+    const uint32_t PageSize;
+    const uint32_t bitsPageSize;
+
+    vector<vector<uint32_t,cacheallocator> > datatobepacked;// scratch for encoding
+    vector<uint8_t> bytescontainer;
+
+    /**
+     * Scratch space for decoding: the exceptions of a page. The encoder
+     * uses the buffers of the instance instead.
+     */
+    struct Workspace {
+        Workspace() :
+            datatobepacked(33) {
+        }
+        // frees the memory, the workspace remains usable
+        void trim() {
+            for (size_t i = 0; i < datatobepacked.size(); ++i)
+                vector<uint32_t,cacheallocator> ().swap(datatobepacked[i]);
+        }
+        vector<vector<uint32_t,cacheallocator> > datatobepacked;
+    };
+
+    // the workspace used by decodeArray on the calling thread
+    static Workspace & threadWorkspace() {
+        static thread_local Workspace ws;
+        return ws;
+    }
+
+    // thread-safe: it does not modify the instance
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue) {
+        return decodeArray(in, length, out, nvalue, threadWorkspace());
+    }
+
+    /**
+     * Same as decodeArray, but with your own scratch space (e.g., one per
+     * thread, reused from call to call).
+     */
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue, Workspace & ws) const {
+        const uint32_t * const initin(in);
+        const size_t mynvalue = *in;
+        ++in;
+        if (mynvalue > nvalue)
+            throw NotEnoughStorage(mynvalue);
+        nvalue = mynvalue;
+        const uint32_t * const finalout(out + nvalue);
+        while (out != finalout) {
+            size_t thisnvalue(0);
+            size_t thissize =
+                    static_cast<size_t> (finalout > PageSize + out ? PageSize
+                            : (finalout - out));
+
+            __decodeArray(in, thisnvalue, out, thissize, ws);
+            in += thisnvalue;
+            out += thissize;
+        }
+        assert(initin + length >= in);
+        return in;
+    }
+
+    /**
+     * The input size (length) should be a multiple of
+     * BlockSizeInUnitsOfPackSize * PACKSIZE. (This was done
+     * to simplify slightly the implementation.)
+     */
     void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
             size_t &nvalue) {
         checkifdivisibleby(length, BlockSize);
@@ -177,18 +830,13 @@ public:
         assert(out == nvalue + initout);
         if (oldnvalue < nvalue)
             cerr << "It is possible we have a buffer overrun. " << endl;
-        resetBuffer();// if you don't do this, the buffer has a memory
     }
 
 
     void getBestBFromData(const uint32_t * in, uint8_t& bestb,
             uint8_t & bestcexcept, uint8_t & maxb) {
         uint32_t freqs[33];
-        for (uint32_t k = 0; k <= 32; ++k)
-            freqs[k] = 0;
-        for (uint32_t k = 0; k < BlockSize; ++k) {
-            freqs[asmbits(in[k])]++;
-        }
+        bitWidthHistogram(in, BlockSize, freqs);
         bestb = 32;
         while (freqs[bestb] == 0)
             bestb--;
@@ -216,32 +864,29 @@ public:
         for (uint32_t k = 0; k < 32 + 1; ++k)
             datatobepacked[k].clear();
         uint8_t * bc = &bytescontainer[0];
-        out = padTo128bits(out);
-        assert(!needPaddingTo128Bits(in));
         for (const uint32_t * const final = in + length; (in + BlockSize
                 <= final); in += BlockSize) {
             uint8_t bestb, bestcexcept, maxb;
             getBestBFromData(in, bestb, bestcexcept, maxb);
+            codeccounters::encodedBlock(bestb, bestcexcept);
             *bc++ = bestb;
             *bc++ = bestcexcept;
             if (bestcexcept > 0) {
                 *bc++ = maxb;
                 vector < uint32_t , cacheallocator> &thisexceptioncontainer
                         = datatobepacked[maxb - bestb];
-                const uint32_t maxval = 1U << bestb;
-                for (uint32_t k = 0; k < BlockSize; ++k) {
-                    if (in[k] >= maxval) {
-                        // we have an exception
-                        thisexceptioncontainer.push_back(in[k] >> bestb);
-                        *bc++ = k;
-                    }
-                }
+                const uint32_t cexcept = exceptionPositions(in, BlockSize, bestb, bc);
+                for (uint32_t k = 0; k < cexcept; ++k)
+                    thisexceptioncontainer.push_back(in[bc[k]] >> bestb);
+                bc += cexcept;
             }
             out = packblockupsimd(in, out, bestb);
         }
         headerout[0] = static_cast<uint32_t> (out - headerout);
         const uint32_t bytescontainersize = bc - &bytescontainer[0];
         *(out++) = bytescontainersize;
+        if (bytescontainersize % sizeof(uint32_t) != 0)// the padding bytes are zeros
+            out[bytescontainersize / sizeof(uint32_t)] = 0;
         memcpy(out, &bytescontainer[0], bytescontainersize);
         out += (bytescontainersize + sizeof(uint32_t) - 1)
                 / sizeof(uint32_t);
@@ -259,7 +904,8 @@ public:
     }
 
     void __decodeArray(const uint32_t *in, size_t & length, uint32_t *out,
-            const size_t nvalue) {
+            const size_t nvalue, Workspace & ws) const {
+        vector<vector<uint32_t,cacheallocator> > & datatobepacked = ws.datatobepacked;
         const uint32_t * const initin = in;
         const uint32_t * const headerin = in++;
         const uint32_t wheremeta = headerin[0];
@@ -278,8 +924,7 @@ public:
         for (uint32_t k = 1; k <= 32; ++k) {
             unpackpointers[k] = datatobepacked[k].begin();
         }
-        in = padTo128bits(in);
-        assert(!needPaddingTo128Bits(out));
+        uint64_t patched = 0;
         for (uint32_t run = 0; run < nvalue / BlockSize; ++run, out
                 += BlockSize) {
             const uint8_t b = *bytep++;
@@ -289,20 +934,35 @@ public:
                 const uint8_t maxbits = *bytep++;
                 vector<uint32_t,cacheallocator>::const_iterator & exceptionsptr =
                         unpackpointers[maxbits - b];
-                for (uint32_t k = 0; k < cexcept; ++k) {
-                    const uint8_t pos = *(bytep++);
-                    out[pos] |= (*(exceptionsptr++)) << b;
-                }
+                patchExceptions(out, bytep, &*exceptionsptr, cexcept, b);
+                bytep += cexcept;
+                exceptionsptr += cexcept;
+                patched += cexcept;
             }
         }
+        codeccounters::decodedBlocks(nvalue / BlockSize, patched);
         assert(in == headerin + wheremeta);
     }
 
+    // see SIMDFastPFor::maxCompressedWords, without the padding to 16 bytes
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t pages = (length + PageSize - 1) / PageSize;
+        return 1 + length + (3 * (length / BlockSize) + 3) / 4
+                + pages * (4 + 32 + 8 * (32 * 33 / 2));
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
     string name() const {
-        return "SIMDFastPFor";
+        return "SIMDFastPFor256";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDFastPFor256(*this));
     }
 
 };
+#endif
 
 
 
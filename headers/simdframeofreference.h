@@ -0,0 +1,120 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SIMDFRAMEOFREFERENCE_H_
+#define SIMDFRAMEOFREFERENCE_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "simdbitpacking.h"
+#include "util.h"
+
+/**
+ * Frame of reference for unsorted data clustered around some value
+ * (prices, sensor readings...): each block of 128 integers is coded as
+ * its minimum and the differences to the minimum, packed with
+ * SIMD_fastpackwithoutmask_32.
+ *
+ * Format:
+ *    length,
+ *    the minimum of each block,
+ *    the bit width of each block (4 per word),
+ *    padding up to 16 bytes (CookiePadder),
+ *    packed blocks (4 * b words each, so they stay aligned).
+ *
+ * As with SIMDBinaryPacking, the output of decodeArray should be aligned
+ * on 16 bytes and if you move the data around, you should preserve the
+ * alignment.
+ */
+class SIMDFrameOfReference: public IntegerCODEC {
+public:
+    static const uint32_t CookiePadder = 123456;
+    static const uint32_t BlockSize = 128;
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        checkifdivisibleby(length, BlockSize);
+        const size_t numberofblocks = length / BlockSize;
+        uint32_t * const initout(out);
+        uint32_t * const mins = out + 1;
+        uint32_t * const widths = mins + numberofblocks;
+        uint32_t * packed = widths + (numberofblocks + 3) / 4;
+        while (needPaddingTo128Bits(packed))
+            *packed++ = CookiePadder;
+        if (static_cast<size_t> (packed - initout) > nvalue)
+            throw NotEnoughStorage(maxCompressedWords(length));
+        out[0] = static_cast<uint32_t> (length);
+        fill(widths, widths + (numberofblocks + 3) / 4, 0);
+        __attribute__ ((aligned (16))) uint32_t offsets[BlockSize];
+        for (size_t k = 0; k < numberofblocks; ++k, in += BlockSize) {
+            uint32_t minimum = in[0], maximum = in[0];
+            for (uint32_t j = 1; j < BlockSize; ++j) {
+                minimum = min(minimum, in[j]);
+                maximum = max(maximum, in[j]);
+            }
+            const uint32_t b = gccbits(maximum - minimum);
+            if (static_cast<size_t> (packed - initout) + 4 * b > nvalue)
+                throw NotEnoughStorage(maxCompressedWords(length));
+            for (uint32_t j = 0; j < BlockSize; ++j)
+                offsets[j] = in[j] - minimum;
+            mins[k] = minimum;
+            widths[k / 4] |= b << (8 * (k % 4));
+            SIMD_fastpackwithoutmask_32(offsets, reinterpret_cast<__m128i *> (packed), b);
+            packed += 4 * b;
+        }
+        nvalue = packed - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t actuallength = in[0];
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        if (needPaddingTo128Bits(out))
+            throw runtime_error("bad initial output align");
+        const size_t numberofblocks = actuallength / BlockSize;
+        const uint32_t * const mins = in + 1;
+        const uint32_t * const widths = mins + numberofblocks;
+        const uint32_t * packed = widths + (numberofblocks + 3) / 4;
+        while (needPaddingTo128Bits(packed)) {
+            if (packed[0] != CookiePadder)
+                throw logic_error("SIMDFrameOfReference alignment issue.");
+            ++packed;
+        }
+        for (size_t k = 0; k < numberofblocks; ++k, out += BlockSize) {
+            const uint32_t b = static_cast<uint8_t> (widths[k / 4] >> (8 * (k % 4)));
+            SIMD_fastunpack_32(reinterpret_cast<const __m128i *> (packed), out, b);
+            packed += 4 * b;
+            // the block is still in L1 cache
+            const __m128i base = _mm_set1_epi32(static_cast<int> (mins[k]));
+            __m128i * const vout = reinterpret_cast<__m128i *> (out);
+            for (uint32_t j = 0; j < BlockSize / 4; ++j)
+                _mm_store_si128(vout + j, _mm_add_epi32(_mm_load_si128(vout + j), base));
+        }
+        nvalue = actuallength;
+        return packed;
+    }
+
+    // the header, up to 3 words of padding, then at most 32 bits per integer
+    size_t maxCompressedWords(const size_t length) const {
+        const size_t numberofblocks = length / BlockSize;
+        return 1 + numberofblocks + (numberofblocks + 3) / 4 + 3
+                + numberofblocks * BlockSize;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "SIMDFrameOfReference";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new SIMDFrameOfReference(*this));
+    }
+};
+
+#endif /* SIMDFRAMEOFREFERENCE_H_ */
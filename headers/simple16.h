@@ -14,6 +14,8 @@
 
 #include "common.h"
 #include "codecs.h"
+#include "cpufeatures.h"
+#include "simple_avx2.h"
 
 /**
  * If MarkLength is true, than the number of symbols is written
@@ -142,9 +144,32 @@ public:
 
     const uint32_t * decodeArray(const uint32_t *in, const size_t len,
             uint32_t *out, size_t & nvalue);
+
+    // each word holds at least one integer
+    size_t maxCompressedWords(const size_t length) const {
+        return (MarkLength ? 1 : 0) + length;
+    }
+
+    /**
+     * Without MarkLength, we add up what the selectors can hold: the
+     * last word may be partly used, so this is an upper bound.
+     */
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        if (MarkLength)
+            return in[0];
+        static const uint32_t counts[SIMPLE16_LEN] = { 28, 21, 21, 21, 14, 9,
+                8, 7, 6, 6, 5, 5, 4, 3, 2, 1 };
+        size_t answer = 0;
+        for (size_t k = 0; k < length; ++k)
+            answer += counts[which(in + k)];
+        return answer;
+    }
     string name() const {
         return "Simple16";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new Simple16(*this));
+    }
     Simple16() {
     }
 
@@ -697,6 +722,11 @@ const uint32_t * Simple16<MarkLength>::decodeArray(const uint32_t *in,
     vector<uint32_t> stats(16,0);
 #endif
     const uint32_t * const end = out + nvalue;
+#if !defined(STATS) && defined(FASTPFOR_X86)
+    // with AVX2, all but the last few words (see simple_avx2.h)
+    if (cpuSupportsAVX2())
+        in = avx2::simple16Decode(in, out, end);
+#endif
     while (end > out) {
 #ifdef STATS
         stats[which(in)]++;
@@ -10,6 +10,8 @@
 
 #include "common.h"
 #include "codecs.h"
+#include "cpufeatures.h"
+#include "simple_avx2.h"
 
 /**
  * Follows Vo Ngoc Anh, Alistair Moffat: Index compression using 64-bit words.
@@ -76,9 +78,33 @@ public:
      */
     const uint32_t * decodeArray(const uint32_t *in, const size_t len,
             uint32_t *out, size_t & nvalue);
+
+    // each 64-bit word holds at least one integer
+    size_t maxCompressedWords(const size_t length) const {
+        return (MarkLength ? 1 : 0) + 2 * length;
+    }
+
+    /**
+     * Without MarkLength, we add up what the selectors can hold: the
+     * last word may be partly used, so this is an upper bound.
+     */
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        if (MarkLength)
+            return in[0];
+        static const uint32_t counts[SIMPLE8B_LEN] = { 240, 120, 60, 30, 20,
+                15, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1 };
+        const uint64_t * in64 = reinterpret_cast<const uint64_t *> (in);
+        size_t answer = 0;
+        for (size_t k = 0; k < length / 2; ++k)
+            answer += counts[which(in64 + k)];
+        return answer;
+    }
     string name() const {
         return "Simple8b";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new Simple8b(*this));
+    }
     Simple8b() {
     }
 
@@ -495,6 +521,12 @@ const uint32_t * Simple8b<MarkLength>::decodeArray(const uint32_t *in,
     nvalue = actualvalue;
     const uint32_t * const end = out + nvalue;
     const uint32_t * const initout(out);
+#if !defined(STATS) && defined(FASTPFOR_X86)
+    // with AVX2, all but the last few words (see simple_avx2.h)
+    if (cpuSupportsAVX2())
+        in64 = reinterpret_cast<const uint64_t *> (avx2::simple8bDecode(
+                reinterpret_cast<const uint32_t *> (in64), out, end));
+#endif
     while (end > out + 240) {
 #ifdef STATS
         stats[which(in64)]++;
@@ -0,0 +1,182 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SIMPLE8B64_H_
+#define SIMPLE8B64_H_
+
+#include "common.h"
+#include "codecs64.h"
+
+/**
+ * Simple8b for 64-bit integers. Each 64-bit word has a 4-bit selector
+ * and 60 bits of data, as in Simple8b, but integers needing more than 60
+ * bits are possible: selector 1 (120 zeros in Simple8b) says that the
+ * next 64-bit word holds one integer as is.
+ *
+ * Format:
+ *    length,
+ *    64-bit words (the first integer in the least significant bits).
+ */
+class Simple8b64: public IntegerCODEC64 {
+public:
+    enum {
+        Escape = 1
+    };
+
+    void encodeArray(const uint64_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        if (1 > nvalue)
+            throw NotEnoughStorage(maxCompressedWords(length));
+        const uint32_t * const initout(out);
+        const uint32_t * const endout(out + nvalue);
+        *out++ = static_cast<uint32_t> (length);
+        for (size_t k = 0; k < length;) {
+            const size_t remaining = length - k;
+            uint32_t selector = 0;
+            for (; selector < 16; ++selector) {
+                if (selector == Escape)
+                    continue;
+                const size_t n = min<size_t> (count(selector), remaining);
+                uint64_t accumulator = 0;
+                for (size_t j = 0; j < n; ++j)
+                    accumulator |= in[k + j];
+                if (bits64(accumulator) <= bits(selector))
+                    break;
+            }
+            if (out + (selector == 16 ? 4 : 2) > endout)
+                throw NotEnoughStorage(maxCompressedWords(length));
+            if (selector == 16) {// more than 60 bits
+                write(out, static_cast<uint64_t> (Escape) << 60);
+                write(out, in[k++]);
+                continue;
+            }
+            const size_t n = min<size_t> (count(selector), remaining);
+            uint64_t word = static_cast<uint64_t> (selector) << 60;
+            for (size_t j = 0; j < n; ++j)
+                word |= in[k + j] << (j * bits(selector));
+            write(out, word);
+            k += n;
+        }
+        nvalue = out - initout;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint64_t *out, size_t & nvalue) {
+        const size_t actuallength = *in++;
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        const uint64_t * const endout(out + actuallength);
+        while (out < endout) {
+            const uint64_t word = read(in);
+            const size_t remaining = endout - out;
+            switch (word >> 60) {
+            case 0:
+                out = unpack<240, 0> (word, out, remaining);
+                break;
+            case Escape:
+                *out++ = read(in);
+                break;
+            case 2:
+                out = unpack<60, 1> (word, out, remaining);
+                break;
+            case 3:
+                out = unpack<30, 2> (word, out, remaining);
+                break;
+            case 4:
+                out = unpack<20, 3> (word, out, remaining);
+                break;
+            case 5:
+                out = unpack<15, 4> (word, out, remaining);
+                break;
+            case 6:
+                out = unpack<12, 5> (word, out, remaining);
+                break;
+            case 7:
+                out = unpack<10, 6> (word, out, remaining);
+                break;
+            case 8:
+                out = unpack<8, 7> (word, out, remaining);
+                break;
+            case 9:
+                out = unpack<7, 8> (word, out, remaining);
+                break;
+            case 10:
+                out = unpack<6, 10> (word, out, remaining);
+                break;
+            case 11:
+                out = unpack<5, 12> (word, out, remaining);
+                break;
+            case 12:
+                out = unpack<4, 15> (word, out, remaining);
+                break;
+            case 13:
+                out = unpack<3, 20> (word, out, remaining);
+                break;
+            case 14:
+                out = unpack<2, 30> (word, out, remaining);
+                break;
+            default:
+                out = unpack<1, 60> (word, out, remaining);
+                break;
+            }
+        }
+        nvalue = actuallength;
+        return in;
+    }
+
+    // at worst, 2 64-bit words per integer
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + 4 * length;
+    }
+
+    string name() const {
+        return "Simple8b64";
+    }
+    shared_ptr<IntegerCODEC64> clone() const {
+        return shared_ptr<IntegerCODEC64> (new Simple8b64(*this));
+    }
+
+private:
+    // how many integers and how many bits each for the selectors
+    static uint32_t count(const uint32_t selector) {
+        static const uint32_t counts[16] = { 240, 0, 60, 30, 20, 15, 12, 10, 8,
+                7, 6, 5, 4, 3, 2, 1 };
+        return counts[selector];
+    }
+    static uint32_t bits(const uint32_t selector) {
+        static const uint32_t bitsper[16] = { 0, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+                10, 12, 15, 20, 30, 60 };
+        return bitsper[selector];
+    }
+
+    // the 64-bit words are only 32-bit aligned
+    static void write(uint32_t * & out, const uint64_t word) {
+        memcpy(out, &word, sizeof(word));
+        out += 2;
+    }
+    static uint64_t read(const uint32_t * & in) {
+        uint64_t word;
+        memcpy(&word, in, sizeof(word));
+        in += 2;
+        return word;
+    }
+
+    template<uint32_t num, uint32_t bit>
+    static uint64_t * unpack(const uint64_t word, uint64_t * out, const size_t remaining) {
+        const uint64_t mask = (1ULL << bit) - 1;
+        if (remaining >= num) {
+            for (uint32_t j = 0; j < num; ++j)
+                out[j] = (word >> (j * bit)) & mask;
+            return out + num;
+        }
+        for (uint32_t j = 0; j < remaining; ++j)
+            out[j] = (word >> (j * bit)) & mask;
+        return out + remaining;
+    }
+};
+
+#endif /* SIMPLE8B64_H_ */
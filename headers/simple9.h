@@ -55,11 +55,34 @@ public:
             size_t &nvalue);
     const uint32_t * decodeArray(const uint32_t *in, const size_t len,
             uint32_t *out, size_t & nvalue);
+
+    // each word holds at least one integer
+    size_t maxCompressedWords(const size_t length) const {
+        return (MarkLength ? 1 : 0) + length;
+    }
+
+    /**
+     * Without MarkLength, we add up what the selectors can hold: the
+     * last word may be partly used, so this is an upper bound.
+     */
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        if (MarkLength)
+            return in[0];
+        static const uint32_t counts[SIMPLE9_LEN] = { 28, 14, 9, 7, 5, 4, 3,
+                2, 1, 28, 0, 0, 0, 0, 0, 0 };
+        size_t answer = 0;
+        for (size_t k = 0; k < length; ++k)
+            answer += counts[which(in + k)];
+        return answer;
+    }
     string name() const {
         if (hacked)
             return "Simple9hacked";
         return "Simple9";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new Simple9(*this));
+    }
     Simple9() {
     }
 
@@ -0,0 +1,32 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef SIMPLE_AVX2_H_
+#define SIMPLE_AVX2_H_
+
+#include "common.h"
+
+namespace avx2 {
+/**
+ * Decodes Simple16 words (see Simple16::decodeArray) to out for as long
+ * as there is room for 32 integers before end, and returns where it
+ * stopped in the input (out is updated).
+ *
+ * The implementation (src/simple_avx2.cpp) is compiled with -mavx2,
+ * so it should only be called when cpuSupportsAVX2() is true.
+ */
+const uint32_t * simple16Decode(const uint32_t * in, uint32_t * & out,
+        const uint32_t * end);
+
+/**
+ * Same as simple16Decode for the 64-bit words of Simple8b (which need
+ * not be aligned), as long as there is room for more than 240 integers.
+ */
+const uint32_t * simple8bDecode(const uint32_t * in, uint32_t * & out,
+        const uint32_t * end);
+}
+
+#endif /* SIMPLE_AVX2_H_ */
@@ -0,0 +1,342 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef SKIPINDEX_H_
+#define SKIPINDEX_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "compositecodec.h"
+#include "variablebyte.h"
+#include "simdbinarypacking.h"
+#include "memutil.h"
+#include "blockcache.h"
+
+/**
+ * Delta coding of sorted arrays (e.g., posting lists) with a skip table.
+ *
+ * The array is cut into chunks of BlocksPerSkip * CODEC::BlockSize integers,
+ * each chunk being delta coded from the last value of the previous chunk and
+ * compressed on its own. For each chunk, the skip table stores the running
+ * base value and the word offset of the chunk in the payload. Hence, we can
+ * seek to a value (nextGEQ) by decoding a single chunk.
+ *
+ * Format:
+ *    length, number of chunks, chunk size, largest value, payload size,
+ *    (base, offset) for each chunk,
+ *    compressed chunks.
+ *
+ * CompressedMerge writes another layout, flagged by ExplicitChunks in the
+ * chunk size word: there, a chunk may be shorter than the chunk size (it
+ * copies the chunks of its inputs as they are), so the skip table is
+ * followed by the position of the first integer of each chunk and by
+ * padding to 16 bytes:
+ *    length, number of chunks, chunk size | ExplicitChunks, largest value,
+ *    payload size,
+ *    (base, offset) for each chunk,
+ *    position of each chunk,
+ *    padding, compressed chunks.
+ *
+ * As with SIMDBinaryPacking, if you move the data around, you should
+ * preserve the alignment.
+ */
+template<class CODEC = SIMDBinaryPacking>
+class DeltaSkipIndex {
+public:
+    enum {
+        HeaderSize = 5
+    };
+    static const uint32_t ExplicitChunks = 1U << 31;
+
+    DeltaSkipIndex(uint32_t BlocksPerSkip = 1) :
+        ChunkSize(BlocksPerSkip * CODEC::BlockSize), codec(), buffer(ChunkSize) {
+        if (BlocksPerSkip == 0)
+            throw logic_error("DeltaSkipIndex needs at least one block per skip");
+    }
+
+    /**
+     * in should be sorted, it is not modified.
+     */
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t * out,
+            size_t & nvalue) {
+        const uint32_t * const initout(out);
+        const size_t numberofchunks = (length + ChunkSize - 1) / ChunkSize;
+        *out++ = static_cast<uint32_t> (length);
+        *out++ = static_cast<uint32_t> (numberofchunks);
+        *out++ = ChunkSize;
+        *out++ = length > 0 ? in[length - 1] : 0;
+        uint32_t * const payloadsize = out++;
+        uint32_t * skips = out;
+        out += 2 * numberofchunks;
+        const uint32_t * const payload = out;
+        uint32_t base = 0;
+        for (size_t c = 0; c < numberofchunks; ++c) {
+            const size_t thissize = min<size_t>(ChunkSize, length - c * ChunkSize);
+            const uint32_t * chunk = in + c * ChunkSize;
+            *skips++ = base;
+            *skips++ = static_cast<uint32_t> (out - payload);
+            size_t thisnvalue = nvalue - (out - initout);
+            encodeChunk(chunk, thissize, base, out, thisnvalue);
+            out += thisnvalue;
+            base = chunk[thissize - 1];
+        }
+        *payloadsize = static_cast<uint32_t> (out - payload);
+        nvalue = out - initout;
+    }
+
+    /**
+     * Compresses a chunk of thissize integers (at most ChunkSize), delta
+     * coded from base: the payload of a chunk of encodeArray.
+     */
+    void encodeChunk(const uint32_t * chunk, const size_t thissize, const uint32_t base,
+            uint32_t * out, size_t & nvalue) {
+        buffer[0] = chunk[0] - base;
+        for (size_t i = 1; i < thissize; ++i)
+            buffer[i] = chunk[i] - chunk[i - 1];
+        codec.encodeArray(&buffer[0], thissize, out, nvalue);
+    }
+
+    // an upper bound on the words encodeChunk writes
+    size_t maxChunkWords(const size_t thissize) const {
+        return codec.maxCompressedWords(thissize);
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t /*length*/,
+            uint32_t *out, size_t & nvalue) {
+        const size_t mynvalue = in[0];
+        if (mynvalue > nvalue)
+            throw NotEnoughStorage(mynvalue);
+        nvalue = mynvalue;
+        const size_t numberofchunks = in[1];
+        if (maxChunkLength(in) != ChunkSize)
+            throw logic_error("DeltaSkipIndex: chunk size does not match");
+        const uint32_t * p = payload(in);
+        for (size_t c = 0; c < numberofchunks; ++c)
+            p = decodeChunk(in, c, out + chunkStart(in, c));
+        return p;
+    }
+
+    /**
+     * Decodes chunk c to out (ChunkSize integers at most), returns a pointer
+     * past the compressed chunk.
+     */
+    const uint32_t * decodeChunk(const uint32_t * in, const size_t c, uint32_t * out) {
+        const size_t thissize = chunkLength(in, c);
+        size_t thisnvalue = thissize;
+        uint32_t * const target = needPaddingTo128Bits(out) ? &buffer[0] : out;
+        const uint32_t * answer = codec.decodeArray(compressedChunk(in, c),
+                compressedChunkLength(in, c), target, thisnvalue);
+        uint32_t base = chunkBase(in, c);
+        for (size_t i = 0; i < thissize; ++i)
+            out[i] = base += target[i];
+        return answer;
+    }
+
+    // the following read the skip table of a compressed array
+
+    static size_t length(const uint32_t * in) {
+        return in[0];
+    }
+
+    static size_t numberOfChunks(const uint32_t * in) {
+        return in[1];
+    }
+
+    // the chunk size the array was written with (no chunk is longer)
+    static uint32_t maxChunkLength(const uint32_t * in) {
+        return in[2] & ~ExplicitChunks;
+    }
+
+    // position of the first integer of chunk c (the length if c is the number of chunks)
+    static size_t chunkStart(const uint32_t * in, const size_t c) {
+        if ((in[2] & ExplicitChunks) == 0)
+            return min<size_t>(c * in[2], in[0]);
+        return c < in[1] ? in[HeaderSize + 2 * in[1] + c] : in[0];
+    }
+
+    // number of integers in chunk c
+    static size_t chunkLength(const uint32_t * in, const size_t c) {
+        return chunkStart(in, c + 1) - chunkStart(in, c);
+    }
+
+    // the chunk holding the integer at position pos (< length)
+    static size_t chunkOf(const uint32_t * in, const size_t pos) {
+        if ((in[2] & ExplicitChunks) == 0)
+            return pos / in[2];
+        const uint32_t * const starts = in + HeaderSize + 2 * in[1];
+        return upper_bound(starts, starts + in[1], pos) - starts - 1;
+    }
+
+    // where the compressed chunks start
+    static const uint32_t * payload(const uint32_t * in) {
+        const uint32_t * const p = in + HeaderSize + 2 * in[1];
+        if ((in[2] & ExplicitChunks) == 0)
+            return p;
+        return padTo128bits(p + in[1]);
+    }
+
+    // chunk c as compressed, and its length in words
+    static const uint32_t * compressedChunk(const uint32_t * in, const size_t c) {
+        return payload(in) + in[HeaderSize + 2 * c + 1];
+    }
+    static size_t compressedChunkLength(const uint32_t * in, const size_t c) {
+        return (c + 1 < in[1] ? in[HeaderSize + 2 * c + 3] : in[4]) - in[HeaderSize + 2 * c + 1];
+    }
+
+    // all integers in chunk c are >= chunkBase(in, c)
+    static uint32_t chunkBase(const uint32_t * in, const size_t c) {
+        return in[HeaderSize + 2 * c];
+    }
+
+    // largest integer in chunk c
+    static uint32_t chunkMax(const uint32_t * in, const size_t c) {
+        return c + 1 < in[1] ? in[HeaderSize + 2 * (c + 1)] : in[3];
+    }
+
+    string name() const {
+        ostringstream convert;
+        convert << "DeltaSkipIndex<" << codec.name() << "," << ChunkSize << ">";
+        return convert.str();
+    }
+
+    /**
+     * Iterates over a compressed array, one chunk at a time.
+     *
+     * DeltaSkipIndex<> dsi;
+     * ...
+     * DeltaSkipIndex<>::Cursor c(dsi, compressed);
+     * uint32_t value;
+     * while (c.nextGEQ(target, value)) { ... }
+     *
+     * With a DecodedBlockCache, the chunks are looked up in the cache
+     * (as blocks (listid, chunk index)) before we decode them.
+     */
+    class Cursor {
+    public:
+        Cursor(DeltaSkipIndex & s, const uint32_t * compressed,
+                DecodedBlockCache * c = NULL, const uint32_t id = 0) :
+            dsi(s), in(compressed), length(compressed[0]),
+                    numberofchunks(compressed[1]), largest(compressed[3]),
+                    chunk(numberofchunks), pos(0), chunkvalues(s.ChunkSize), cache(c),
+                    listid(id) {
+            if (maxChunkLength(compressed) != s.ChunkSize)
+                throw logic_error("DeltaSkipIndex: chunk size does not match");
+        }
+
+        Cursor(const Cursor & o) :
+            dsi(o.dsi), in(o.in), length(o.length), numberofchunks(o.numberofchunks),
+                    largest(o.largest), chunk(o.chunk), pos(o.pos),
+                    chunkvalues(o.chunkvalues), cache(o.cache), listid(o.listid) {
+        }
+
+        /**
+         * Finds the first value >= target, at or after the current position,
+         * and moves the cursor there. Returns false if there is no such value.
+         */
+        bool nextGEQ(const uint32_t target, uint32_t & value) {
+            if ((pos >= length) || (target > largest)) {
+                pos = length;
+                return false;
+            }
+            size_t c = chunkAt(pos);
+            if ((chunk != c) || (chunkvalues[chunkLength(in, c) - 1] < target)) {
+                // chunk c covers the values in (base(c), base(c+1)]
+                const uint32_t * const skips = in + HeaderSize;
+                size_t lo = c, hi = numberofchunks - 1;
+                if (chunk == c) // we know it is not in chunk c
+                    lo = c + 1;
+                while (lo < hi) {
+                    const size_t mid = lo + (hi - lo + 1) / 2;
+                    if (skips[2 * mid] < target)
+                        lo = mid;
+                    else
+                        hi = mid - 1;
+                }
+                if (lo != c)
+                    pos = chunkStart(in, lo);
+                c = lo;
+                load(c);
+            }
+            const size_t start = chunkStart(in, c);
+            const uint32_t * const begin = &chunkvalues[0];
+            const uint32_t * const end = begin + chunkLength(in, c);
+            const uint32_t * const answer = lower_bound(begin + (pos - start), end, target);
+            pos = start + (answer - begin);
+            value = *answer;
+            return true;
+        }
+
+        /**
+         * Same as nextGEQ, but starting from the beginning of the array.
+         */
+        bool seek(const uint32_t target, uint32_t & value) {
+            pos = 0;
+            return nextGEQ(target, value);
+        }
+
+        // position of the cursor (length if we are done)
+        size_t position() const {
+            return pos;
+        }
+
+        // value at the current position (requires position() < length)
+        uint32_t value() {
+            const size_t c = chunkAt(pos);
+            load(c);
+            return chunkvalues[pos - chunkStart(in, c)];
+        }
+
+        // moves the cursor by one, returns false if we are done
+        bool advance() {
+            return ++pos < length;
+        }
+
+    private:
+        Cursor & operator=(const Cursor &);
+
+        // chunkOf, without a search if pos is in the chunk we have
+        size_t chunkAt(const size_t p) const {
+            if ((chunk < numberofchunks) && (chunkStart(in, chunk) <= p)
+                    && (p < chunkStart(in, chunk + 1)))
+                return chunk;
+            return chunkOf(in, p);
+        }
+
+        void load(size_t c) {
+            if (chunk == c)
+                return;
+            if (cache == NULL)
+                dsi.decodeChunk(in, c, &chunkvalues[0]);
+            else
+                cache->fetch(listid, static_cast<uint32_t> (c), &chunkvalues[0],
+                        [&](uint32_t * out) {
+                            dsi.decodeChunk(in, c, out);
+                            return chunkLength(in, c);
+                        });
+            chunk = c;
+        }
+
+        DeltaSkipIndex & dsi;
+        const uint32_t * const in;
+        const size_t length;
+        const size_t numberofchunks;
+        const uint32_t largest;
+        size_t chunk;// chunk currently in chunkvalues
+        size_t pos;
+        vector<uint32_t, cacheallocator> chunkvalues;
+        DecodedBlockCache * const cache;
+        const uint32_t listid;
+    };
+
+    const uint32_t ChunkSize;
+
+private:
+    CompositeCodec<CODEC, VariableByte> codec;
+    vector<uint32_t, cacheallocator> buffer;
+};
+
+#endif /* SKIPINDEX_H_ */
@@ -41,9 +41,22 @@ public:
                 reinterpret_cast<char*>(out));
        return in + length;
     }
+    size_t maxCompressedWords(const size_t length) const {
+        return (snappy::MaxCompressedLength(length * 4) + 3) / 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        size_t nvalueinbytes = 0;
+        if (!snappy::GetUncompressedLength(reinterpret_cast<const char*>(in), length * 4,
+                &nvalueinbytes))
+            throw logic_error("got some bug retrieving length");
+        return nvalueinbytes / 4;
+    }
     string name() const {
         return "Snappy";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new JustSnappy(*this));
+    }
 };
 
 
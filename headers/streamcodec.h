@@ -0,0 +1,254 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef STREAMCODEC_H_
+#define STREAMCODEC_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "compositecodec.h"
+#include "variablebyte.h"
+#include "fastpfor.h"
+#include "simdfastpfor.h"
+#include "simdbinarypacking.h"
+#include "memutil.h"
+
+/**
+ * Streaming compression: integers are pushed (or pulled) a few at a time,
+ * and only one frame is ever held in memory, so that arbitrarily long
+ * arrays can be compressed to (or from) a file.
+ *
+ * For FastPFor and SIMDFastPFor, a frame is a page (PageSize integers);
+ * for the other codecs, it is made of whole blocks (about 64K integers).
+ * Only the last frame can be shorter, its tail is coded with VariableByte.
+ *
+ * Format (32-bit words):
+ *    frame size,
+ *    then for each frame: number of integers, number of words, compressed words.
+ *
+ * If differential is true, the integers should be sorted: we store the
+ * differences between successive integers (continuing across frames).
+ */
+
+// number of integers per frame
+template<class CODEC>
+inline uint32_t streamFrameSize(const CODEC &) {
+    enum { DefaultFrameSize = 65536 };
+    return CODEC::BlockSize >= DefaultFrameSize ? CODEC::BlockSize
+            : DefaultFrameSize / CODEC::BlockSize * CODEC::BlockSize;
+}
+
+inline uint32_t streamFrameSize(const FastPFor & c) {
+    return c.PageSize;
+}
+
+inline uint32_t streamFrameSize(const SIMDFastPFor & c) {
+    return c.PageSize;
+}
+
+#ifdef FASTPFOR_X86
+inline uint32_t streamFrameSize(const SIMDFastPFor256 & c) {
+    return c.PageSize;
+}
+#endif
+
+template<class CODEC = SIMDFastPFor>
+class StreamEncoder {
+public:
+    /**
+     * The encoder writes to out, which should be opened in binary mode.
+     */
+    StreamEncoder(ostream & o, bool differential = false) :
+        out(o), codec(), FrameSize(streamFrameSize(codec.codec1)),
+                frame(FrameSize), compressed(codec.maxCompressedWords(FrameSize)), buffered(0),
+                previous(0), delta(differential), pushed(0), written(0), finished(false) {
+        writeWords(&FrameSize, 1);
+    }
+
+    /**
+     * Appends n integers to the stream.
+     */
+    void push(const uint32_t * in, size_t n) {
+        if (finished)
+            throw logic_error("StreamEncoder: push after finish");
+        while (n > 0) {
+            const size_t howmany = min<size_t>(n, FrameSize - buffered);
+            copy(in, in + howmany, frame.begin() + buffered);
+            buffered += howmany;
+            in += howmany;
+            n -= howmany;
+            pushed += howmany;
+            if (buffered == FrameSize)
+                flushFrame();
+        }
+    }
+
+    /**
+     * Writes the last (partial) frame. You must call it before closing
+     * the stream.
+     */
+    void finish() {
+        if (finished)
+            return;
+        if (buffered > 0)
+            flushFrame();
+        out.flush();
+        finished = true;
+    }
+
+    // number of integers pushed so far
+    uint64_t integersPushed() const {
+        return pushed;
+    }
+
+    // number of 32-bit words written so far
+    uint64_t wordsWritten() const {
+        return written;
+    }
+
+    string name() const {
+        return string("StreamEncoder<") + codec.name() + ">";
+    }
+
+private:
+    StreamEncoder(const StreamEncoder &);
+    StreamEncoder & operator=(const StreamEncoder &);
+
+    void flushFrame() {
+        if (delta) {
+            for (size_t i = 0; i < buffered; ++i) {
+                const uint32_t value = frame[i];
+                frame[i] = value - previous;
+                previous = value;
+            }
+        }
+        // a short frame may have a larger tail than a full one
+        compressed.resize(codec.maxCompressedWords(buffered));
+        size_t nvalue = compressed.size();
+        codec.encodeArray(&frame[0], buffered, &compressed[0], nvalue);
+        const uint32_t frameheader[2] = { static_cast<uint32_t> (buffered),
+                static_cast<uint32_t> (nvalue) };
+        writeWords(frameheader, 2);
+        writeWords(&compressed[0], nvalue);
+        buffered = 0;
+    }
+
+    void writeWords(const uint32_t * words, size_t n) {
+        out.write(reinterpret_cast<const char *> (words), n * sizeof(uint32_t));
+        if (!out)
+            throw runtime_error("StreamEncoder: could not write");
+        written += n;
+    }
+
+    ostream & out;
+    CompositeCodec<CODEC, VariableByte> codec;
+    const uint32_t FrameSize;
+    vector<uint32_t, cacheallocator> frame;
+    vector<uint32_t, cacheallocator> compressed;
+    size_t buffered;
+    uint32_t previous;
+    const bool delta;
+    uint64_t pushed;
+    uint64_t written;
+    bool finished;
+};
+
+template<class CODEC = SIMDFastPFor>
+class StreamDecoder {
+public:
+    /**
+     * The decoder reads from in, which should be opened in binary mode.
+     * The differential flag must match the one given to the encoder.
+     */
+    StreamDecoder(istream & i, bool differential = false) :
+        in(i), codec(), FrameSize(streamFrameSize(codec.codec1)), frame(FrameSize),
+                compressed(codec.maxCompressedWords(FrameSize)), available(0), pos(0),
+                previous(0), delta(differential), done(false) {
+        uint32_t framesize = 0;
+        if (!readWords(&framesize, 1))
+            throw runtime_error("StreamDecoder: empty stream");
+        if (framesize != FrameSize)
+            throw logic_error("StreamDecoder: frame size does not match");
+    }
+
+    /**
+     * Writes up to maxn integers to out, returns how many were written
+     * (0 at the end of the stream).
+     */
+    size_t next(uint32_t * out, size_t maxn) {
+        size_t count = 0;
+        while (count < maxn) {
+            if ((pos == available) && !loadFrame())
+                break;
+            const size_t howmany = min<size_t>(maxn - count, available - pos);
+            copy(frame.begin() + pos, frame.begin() + pos + howmany, out + count);
+            pos += howmany;
+            count += howmany;
+        }
+        return count;
+    }
+
+    bool hasNext() {
+        return (pos < available) || loadFrame();
+    }
+
+private:
+    StreamDecoder(const StreamDecoder &);
+    StreamDecoder & operator=(const StreamDecoder &);
+
+    bool loadFrame() {
+        if (done)
+            return false;
+        uint32_t frameheader[2];
+        if (!readWords(frameheader, 2)) {
+            done = true;
+            return false;
+        }
+        if ((frameheader[0] > FrameSize) || (frameheader[1]
+                > codec.maxCompressedWords(frameheader[0])))
+            throw runtime_error("StreamDecoder: corrupted frame header");
+        if (frameheader[1] > compressed.size())
+            compressed.resize(frameheader[1]);
+        if (!readWords(&compressed[0], frameheader[1]))
+            throw runtime_error("StreamDecoder: truncated stream");
+        size_t nvalue = frameheader[0];
+        codec.decodeArray(&compressed[0], frameheader[1], &frame[0], nvalue);
+        if (nvalue != frameheader[0])
+            throw runtime_error("StreamDecoder: corrupted frame");
+        if (delta) {
+            for (size_t i = 0; i < nvalue; ++i)
+                frame[i] = previous += frame[i];
+        }
+        available = nvalue;
+        pos = 0;
+        return true;
+    }
+
+    // returns false if we are at the end of the stream
+    bool readWords(uint32_t * words, size_t n) {
+        in.read(reinterpret_cast<char *> (words), n * sizeof(uint32_t));
+        const size_t got = static_cast<size_t> (in.gcount());
+        if (got == n * sizeof(uint32_t))
+            return true;
+        if (got != 0)
+            throw runtime_error("StreamDecoder: truncated stream");
+        return false;
+    }
+
+    istream & in;
+    CompositeCodec<CODEC, VariableByte> codec;
+    const uint32_t FrameSize;
+    vector<uint32_t, cacheallocator> frame;
+    vector<uint32_t, cacheallocator> compressed;
+    size_t available;
+    size_t pos;
+    uint32_t previous;
+    const bool delta;
+    bool done;
+};
+
+#endif /* STREAMCODEC_H_ */
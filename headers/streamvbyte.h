@@ -0,0 +1,140 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef STREAMVBYTE_H_
+#define STREAMVBYTE_H_
+
+#include "common.h"
+#include "codecs.h"
+
+/**
+ * Stream VByte (Lemire, Kurz and Rupp, 2017): each integer takes 1 to 4
+ * bytes, and the lengths (2 bits each) are stored apart from the data,
+ * as one control byte for 4 integers. Decoding a group of 4 integers is
+ * then one load, one shuffle (pshufb, with a table indexed by the control
+ * byte) and one store, without branching on each byte as VariableByte does.
+ * It is meant as the Codec2 of CompositeCodec, for the tails and the short
+ * arrays.
+ *
+ * Format:
+ *    length,
+ *    control bytes (ceil(length / 4)),
+ *    data bytes (little endian), padding up to 32 bits.
+ *
+ * There are no alignment requirements.
+ */
+class StreamVByte: public IntegerCODEC {
+public:
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        if (maxCompressedWords(length) > nvalue) {// check more carefully
+            size_t databytes = 0;
+            for (size_t k = 0; k < length; ++k)
+                databytes += byteLength(in[k]);
+            const size_t required = 1 + ((length + 3) / 4 + databytes + 3) / 4;
+            if (required > nvalue)
+                throw NotEnoughStorage(required);
+        }
+        out[0] = static_cast<uint32_t> (length);
+        uint8_t * control = reinterpret_cast<uint8_t *> (out + 1);
+        uint8_t * data = control + (length + 3) / 4;
+        for (size_t k = 0; k < length; k += 4) {
+            uint8_t key = 0;
+            for (size_t j = 0; (j < 4) && (k + j < length); ++j) {
+                const uint32_t val = in[k + j];
+                const uint32_t bytes = byteLength(val);
+                key = static_cast<uint8_t> (key | ((bytes - 1) << (2 * j)));
+                for (uint32_t i = 0; i < bytes; ++i)
+                    *data++ = static_cast<uint8_t> (val >> (8 * i));
+            }
+            *control++ = key;
+        }
+        while (needPaddingTo32Bits(data))
+            *data++ = 0;
+        nvalue = reinterpret_cast<uint32_t *> (data) - out;
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t & nvalue) {
+        const size_t actuallength = in[0];
+        if (actuallength > nvalue)
+            throw NotEnoughStorage(actuallength);
+        const ShuffleTables & tables = ShuffleTables::get();
+        const uint8_t * control = reinterpret_cast<const uint8_t *> (in + 1);
+        const uint8_t * data = control + (actuallength + 3) / 4;
+        // we load 16 bytes at a time: the last groups are decoded one by one
+        const uint8_t * const endin = reinterpret_cast<const uint8_t *> (in + length);
+        size_t k = 0;
+        for (; (k + 4 <= actuallength) && (data + 16 <= endin); k += 4) {
+            const uint8_t key = *control++;
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *> (data));
+            _mm_storeu_si128(reinterpret_cast<__m128i *> (out + k), _mm_shuffle_epi8(v,
+                    _mm_load_si128(reinterpret_cast<const __m128i *> (tables.shuffle[key]))));
+            data += tables.length[key];
+        }
+        for (; k < actuallength; k += 4) {
+            const uint8_t key = *control++;
+            for (size_t j = 0; (j < 4) && (k + j < actuallength); ++j) {
+                const uint32_t bytes = ((key >> (2 * j)) & 3) + 1;
+                uint32_t val = 0;
+                for (uint32_t i = 0; i < bytes; ++i)
+                    val |= static_cast<uint32_t> (*data++) << (8 * i);
+                out[k + j] = val;
+            }
+        }
+        nvalue = actuallength;
+        return reinterpret_cast<const uint32_t *> (padTo32bits(data));
+    }
+
+    // a control byte for 4 integers, at most 4 bytes per integer
+    size_t maxCompressedWords(const size_t length) const {
+        return 1 + ((length + 3) / 4 + 4 * length + 3) / 4;
+    }
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
+
+    string name() const {
+        return "StreamVByte";
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new StreamVByte(*this));
+    }
+
+private:
+    static uint32_t byteLength(const uint32_t val) {
+        return val < (1U << 8) ? 1 : val < (1U << 16) ? 2 : val < (1U << 24) ? 3 : 4;
+    }
+
+    // for each control byte: the shuffle that spreads the data bytes to 4
+    // integers and the number of data bytes
+    struct ShuffleTables {
+        ShuffleTables() :
+            shuffle(), length() {
+            for (uint32_t key = 0; key < 256; ++key) {
+                uint32_t offset = 0;
+                for (uint32_t j = 0; j < 4; ++j) {
+                    const uint32_t bytes = ((key >> (2 * j)) & 3) + 1;
+                    for (uint32_t i = 0; i < 4; ++i)
+                        shuffle[key][4 * j + i] = static_cast<int8_t> (i < bytes
+                                ? offset + i : -1);
+                    offset += bytes;
+                }
+                length[key] = static_cast<uint8_t> (offset);
+            }
+        }
+        __attribute__ ((aligned (16))) int8_t shuffle[256][16];
+        uint8_t length[256];
+
+        static const ShuffleTables & get() {
+            static const ShuffleTables tables;
+            return tables;
+        }
+    };
+};
+
+#endif /* STREAMVBYTE_H_ */
@@ -13,6 +13,18 @@
 
 using namespace std;
 
+/**
+ * The seed of the k-th generator (array, chunk...) derived from seed: the
+ * generated data depend on the seed only, not on the number of threads.
+ */
+inline uint32_t derivedSeed(const uint32_t seed, const uint64_t k) {
+    uint64_t z = (static_cast<uint64_t> (seed) << 32 | (k & 0xFFFFFFFF))
+            + 0x9E3779B97F4A7C15ULL * (k >> 32 | 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<uint32_t> (z ^ (z >> 31));
+}
+
 vector<uint32_t,cacheallocator> generateArray(uint32_t N, const uint32_t mask = 0xFFFFFFFFU) {
     vector < uint32_t,cacheallocator> ans(N);
     for (size_t k = 0; k < N; ++k)
@@ -48,11 +60,8 @@ public:
                 ans.push_back(k);
             return ans;
         }
-        if (N > Max / 2) {
-            set < uint32_t > s;
-            while (s.size() < N)
-                s.insert(rand.getValue(Max - 1) );
-            ans.assign(s.begin(), s.end());
+        if (Max / BitmapDensity <= N) {
+            generateUniformWithBitmap(N, Max, ans);
             return ans;
         }
         while (ans.size() < N) {
@@ -66,6 +75,42 @@ public:
         return ans;
     }
 
+    /**
+     * When we pick at least one value out of BitmapDensity, we mark them in
+     * a bitmap (Max bits) rather than sorting them. Past Max / 2, we mark the
+     * Max - N values we leave out, so that there are few repeated draws.
+     */
+    enum {
+        BitmapDensity = 256
+    };
+
+    void generateUniformWithBitmap(uint32_t N, uint32_t Max,
+            vector<uint32_t, cacheallocator> & ans) {
+        const bool complement = N > Max / 2;
+        const uint32_t howmany = complement ? Max - N : N;
+        vector<uint64_t> bitmap((static_cast<size_t> (Max) + 63) / 64);
+        for (uint32_t marked = 0; marked < howmany;) {
+            const uint32_t v = rand.getValue(Max - 1);
+            const uint64_t bit = 1ULL << (v % 64);
+            if ((bitmap[v / 64] & bit) == 0) {
+                bitmap[v / 64] |= bit;
+                ++marked;
+            }
+        }
+        ans.resize(N);
+        uint32_t * out = ans.data();
+        for (size_t w = 0; w < bitmap.size(); ++w) {
+            uint64_t word = complement ? ~bitmap[w] : bitmap[w];
+            if (complement && (w + 1 == bitmap.size()) && (Max % 64 != 0))
+                word &= (1ULL << (Max % 64)) - 1;
+            while (word != 0) {
+                *out++ = static_cast<uint32_t> (w * 64 + __builtin_ctzll(word));
+                word &= word - 1;
+            }
+        }
+        assert(out == ans.data() + N);
+    }
+
     ZRandom rand;
 
 };
@@ -124,6 +169,57 @@ public:
         return ans;
     }
 
+    /**
+     * Same distribution as generateClustered, but the recursion is cut into
+     * pieces of about PieceSize integers filled on several threads, each
+     * piece with its own generator (seeded from this one): the result
+     * depends on the seed, not on the number of threads.
+     */
+    enum {
+        PieceSize = 1 << 16
+    };
+    vector<uint32_t,cacheallocator> generateClusteredParallel(uint32_t N, uint32_t Max,
+            uint32_t threads = 0) {
+        vector < uint32_t,cacheallocator > ans(N);
+        vector<Piece> pieces;
+        cutClustered(0, N, 0, Max, pieces);
+        parallelFor(pieces.size(), [&](size_t k) {
+            const Piece & p = pieces[k];
+            ClusteredDataGenerator g(p.seed);
+            if (p.clustered)
+                g.fillClustered(ans.begin() + p.begin, ans.begin() + p.end, p.Min, p.Max);
+            else
+                g.fillUniform(ans.begin() + p.begin, ans.begin() + p.end, p.Min, p.Max);
+        }, threads);
+        return ans;
+    }
+
+private:
+    struct Piece {
+        size_t begin, end;
+        uint32_t Min, Max;
+        bool clustered;
+        uint32_t seed;
+    };
+
+    // the first levels of fillClustered, down to pieces of PieceSize
+    void cutClustered(size_t begin, size_t end, uint32_t Min, uint32_t Max,
+            vector<Piece> & pieces, bool clustered = true) {
+        const size_t N = end - begin;
+        const uint32_t range = Max - Min;
+        if(range < N) throw runtime_error("can't generate that many in small interval.");
+        if (!clustered || (N <= PieceSize) || (range == N)) {
+            pieces.push_back(Piece { begin, end, Min, Max, clustered,
+                    unidg.rand.getValue() });
+            return;
+        }
+        const uint32_t cut = static_cast<uint32_t> (N / 2 + unidg.rand.getValue(
+                static_cast<uint32_t> (range - N)));
+        const double p = unidg.rand.getDouble();
+        cutClustered(begin, begin + N / 2, Min, Min + cut, pieces, p > 0.25);
+        cutClustered(begin + N / 2, end, Min + cut, Max, pieces, (p <= 0.25) || (p > 0.5));
+    }
+
 };
 
 class ZipfianGenerator {
@@ -132,10 +228,13 @@ public:
     uint32_t n;
     double zetan, theta;
     vector<double> proba;
+    // guide[j]: the first value whose cumulative probability reaches
+    // j / (guide.size() - 1), so that nextInt searches a short range
+    vector<uint32_t> guide;
 
     ZRandom rand;
     ZipfianGenerator(uint32_t seed = time(NULL)) :
-        n(0), zetan(0), theta(0), proba(n), rand(seed) {
+        n(0), zetan(0), theta(0), proba(n), guide(), rand(seed) {
     }
 
     void init(int _items, double _zipfianconstant = 1.0) {
@@ -150,8 +249,16 @@ public:
             for (uint32_t i = 1; i < n; ++i)
                 proba[i] = proba[i - 1] + zetan / pow(i + 1, theta);
         } else {
-            proba.resize(n, 1.0 / n);
+            proba.clear();
+            proba.resize(n);
+            for (uint32_t i = 0; i < n; ++i)
+                proba[i] = (i + 1.0) / n;
         }
+        guide.resize(n + 1);
+        for (uint32_t j = 0; j <= n; ++j)
+            guide[j] = static_cast<uint32_t> (min<size_t> (n - 1, lower_bound(
+                    proba.begin(), proba.end(), static_cast<double> (j) / n)
+                    - proba.begin()));
     }
 
     void seed(uint32_t s) {
@@ -160,7 +267,7 @@ public:
 
     ZipfianGenerator(int _items, double _zipfianconstant,
             uint32_t seed = time(NULL)) :
-        n(_items), zetan(0), theta(_zipfianconstant), proba(n), rand(seed) {
+        n(_items), zetan(0), theta(_zipfianconstant), proba(n), guide(), rand(seed) {
         init(_items, _zipfianconstant);
     }
 
@@ -172,22 +279,60 @@ public:
         return sum;
     }
     int nextInt() {
+        return nextInt(rand);
+    }
+
+    // with another random number generator (e.g., one per thread)
+    int nextInt(ZRandom & r) const {
         // Map z to the value
-        const double u = rand.getDouble();
-        return lower_bound(proba.begin(), proba.end(), u) - proba.begin();
+        const double u = r.getDouble();
+        // the answer is between guide[j] and guide[j + 1] (we start at
+        // guide[j - 1] in case u * n was rounded up)
+        const size_t j = min<size_t> (guide.size() - 2, static_cast<size_t> (u
+                * (guide.size() - 1)));
+        return static_cast<int> (lower_bound(proba.begin() + guide[j > 0 ? j - 1 : 0],
+                proba.begin() + guide[j + 1] + 1, u) - proba.begin());
     }
 
 };
 
+/**
+ * The integers are drawn on several threads, by chunks of ChunkSize
+ * integers, each with its own generator (seeded with derivedSeed). For a
+ * given seed, the result does not depend on the number of threads.
+ */
 vector<uint32_t,cacheallocator> generateZipfianArray32(uint32_t N, double power,
-        const uint32_t mask = 0xFFFFFFFFU) {
+        const uint32_t mask = 0xFFFFFFFFU, uint32_t seed = time(NULL),
+        uint32_t threads = 0) {
     vector < uint32_t , cacheallocator> ans(N);
     ZipfianGenerator zipf;
     const uint32_t MAXVALUE = 1U << 22;
     zipf.init(mask  > MAXVALUE-1 ? MAXVALUE : mask + 1, power);
-    for (size_t k = 0; k < N; ++k)
-        ans[k] = zipf.nextInt();
+    const size_t ChunkSize = 1 << 16;
+    parallelFor((N + ChunkSize - 1) / ChunkSize, [&](size_t c) {
+        ZRandom r(derivedSeed(seed, c));
+        const size_t end = min<size_t> (N, (c + 1) * ChunkSize);
+        for (size_t k = c * ChunkSize; k < end; ++k)
+            ans[k] = zipf.nextInt(r);
+    }, threads);
     return ans;
 }
 
+/**
+ * howmany arrays, the k-th being generate(g) with a Generator (e.g.,
+ * ClusteredDataGenerator) seeded with derivedSeed(seed, k), on several
+ * threads. For a given seed, the result does not depend on the number of
+ * threads.
+ */
+template<class Generator, class Function>
+vector<vector<uint32_t, cacheallocator> > generateArrays(const size_t howmany,
+        const uint32_t seed, Function generate, uint32_t threads = 0) {
+    vector<vector<uint32_t, cacheallocator> > answer(howmany);
+    parallelFor(howmany, [&](size_t k) {
+        Generator g(derivedSeed(seed, k));
+        answer[k] = generate(g);
+    }, threads);
+    return answer;
+}
+
 #endif 
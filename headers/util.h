@@ -9,6 +9,9 @@
 #ifndef UTIL
 #define UTIL
 #include "common.h"
+#include <thread>
+#include <atomic>
+#include <exception>
 
 #ifdef __linux__
 #define USE_O_DIRECT
@@ -80,6 +83,16 @@ const T * padTo128bits(const T * inbyte) {
             + 15) & ~15);
 }
 
+/**
+ * Asks for the howmanylines cache lines (of 64 bytes) starting at p,
+ * without waiting for them (software prefetching).
+ */
+inline void prefetchLines(const void * p, const size_t howmanylines) {
+    const char * c = static_cast<const char *> (p);
+    for (size_t k = 0; k < howmanylines; ++k)
+        __builtin_prefetch(c + 64 * k);
+}
+
 template <class T>
 __attribute__ ((const))
 T * padTo64bytes(T * inbyte) {
@@ -164,9 +177,13 @@ __attribute__ ((const))
 uint32_t asmbits(const uint32_t v) {
     if (v == 0)
         return 0;
+#ifdef FASTPFOR_X86
     uint32_t answer;
     __asm__("bsr %1, %0;" :"=r"(answer) :"r"(v));
     return answer + 1;
+#else
+    return 32 - __builtin_clz(v);
+#endif
 }
 
 __attribute__ ((const))
@@ -241,6 +258,71 @@ uint32_t slowmaxbits(const iterator & begin, const iterator & end) {
     return accumulator;
 }
 
+/**
+ * The bit widths (as gccbits) of 4 integers. We have bits(x) =
+ * bits(x >> 1) + (x != 0), and x >> 1 is converted to float after clearing
+ * the bit below its most significant bit, so that rounding cannot go up to
+ * the next power of two: the exponent of the float is the bit width.
+ */
+inline __m128i bitWidths(const __m128i x) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i y = _mm_srli_epi32(x, 1);
+    const __m128i z = _mm_andnot_si128(_mm_srli_epi32(y, 1), y);
+    const __m128i exponent = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(z)), 23);
+    const __m128i bitsofy = _mm_and_si128(_mm_sub_epi32(exponent, _mm_set1_epi32(126)),
+            _mm_cmpgt_epi32(z, zero));
+    // cmpeq is -1 when x == 0
+    return _mm_add_epi32(_mm_add_epi32(bitsofy, _mm_set1_epi32(1)), _mm_cmpeq_epi32(x, zero));
+}
+
+/**
+ * Sets freqs[b] (33 counters) to the number of integers having b bits
+ * among the length integers at in (length is a multiple of 4 and at most
+ * 256, in needs no alignment). Four histograms are kept and merged at the
+ * end, because incrementing one counter over and over (most integers of
+ * a block have the same width) waits on the previous store.
+ */
+inline void bitWidthHistogram(const uint32_t * in, const uint32_t length,
+        uint32_t * freqs) {
+    assert(length <= 256);
+    __attribute__ ((aligned (16))) uint32_t widths[256];
+    for (uint32_t k = 0; k < length; k += 4)
+        _mm_store_si128(reinterpret_cast<__m128i *> (widths + k), bitWidths(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *> (in + k))));
+    uint32_t histograms[4][33] = { { 0 } };
+    for (uint32_t k = 0; k < length; k += 4) {
+        histograms[0][widths[k]]++;
+        histograms[1][widths[k + 1]]++;
+        histograms[2][widths[k + 2]]++;
+        histograms[3][widths[k + 3]]++;
+    }
+    for (uint32_t b = 0; b <= 32; ++b)
+        freqs[b] = histograms[0][b] + histograms[1][b] + histograms[2][b]
+                + histograms[3][b];
+}
+
+/**
+ * Writes the positions (as bytes) of the integers at in that need more than
+ * b < 32 bits and returns how many there are. As for bitWidthHistogram,
+ * length is a multiple of 4 and at most 256.
+ */
+inline uint32_t exceptionPositions(const uint32_t * in, const uint32_t length,
+        const uint32_t b, uint8_t * positions) {
+    const __m128i shift = _mm_cvtsi32_si128(static_cast<int> (b));
+    const __m128i zero = _mm_setzero_si128();
+    uint8_t * const initpositions = positions;
+    for (uint32_t k = 0; k < length; k += 4) {
+        const __m128i high = _mm_srl_epi32(_mm_loadu_si128(
+                reinterpret_cast<const __m128i *> (in + k)), shift);
+        uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(high, zero))) ^ 15;
+        while (mask != 0) {
+            *positions++ = static_cast<uint8_t> (k + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    return static_cast<uint32_t> (positions - initpositions);
+}
+
 //basically, we can sometimes memoize the maxbits computation
 // Since the first scan looks at b input words, the second looks
 // at b/2, the third looks at b/3... (total related to harmonic numbers)
@@ -378,4 +460,58 @@ public:
 };
 
 
+// how many threads parallelFor(howmany, f, threads) uses
+inline size_t parallelForThreads(const size_t howmany, uint32_t threads = 0) {
+    if (threads == 0)
+        threads = max<uint32_t> (1, thread::hardware_concurrency());
+    return min<size_t> (threads, howmany);
+}
+
+/**
+ * Same as parallelFor, but calls f(k, t) where t identifies the thread
+ * (t < parallelForThreads(howmany, threads)), so that each thread can
+ * have its own buffers or codec.
+ */
+template<class Function>
+void parallelForByThread(const size_t howmany, Function f, uint32_t threads = 0) {
+    const size_t howmanythreads = parallelForThreads(howmany, threads);
+    if (howmanythreads <= 1) {
+        for (size_t k = 0; k < howmany; ++k)
+            f(k, 0);
+        return;
+    }
+    atomic<size_t> next(0);
+    vector<exception_ptr> errors(howmanythreads);
+    auto work = [&](size_t t) {
+        try {
+            for (size_t k = next++; k < howmany; k = next++)
+                f(k, t);
+        } catch (...) {
+            errors[t] = current_exception();
+            next = howmany;
+        }
+    };
+    vector<thread> workers;
+    for (size_t t = 1; t < howmanythreads; ++t)
+        workers.push_back(thread(work, t));
+    work(0);
+    for (size_t t = 0; t < workers.size(); ++t)
+        workers[t].join();
+    for (size_t t = 0; t < howmanythreads; ++t)
+        if (errors[t])
+            rethrow_exception(errors[t]);
+}
+
+/**
+ * Calls f(k) for k = 0, 1, ..., howmany - 1 on several threads (by default,
+ * as many as there are cores) which take the values of k in order. The
+ * first exception is passed on to the caller.
+ */
+template<class Function>
+void parallelFor(const size_t howmany, Function f, uint32_t threads = 0) {
+    parallelForByThread(howmany, [&f](size_t k, size_t) {
+        f(k);
+    }, threads);
+}
+
 #endif
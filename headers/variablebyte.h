@@ -105,9 +105,27 @@ public:
         return reinterpret_cast<const uint32_t *> (inbyte);
     }
 
+    // at most 5 bytes per integer
+    size_t maxCompressedWords(const size_t length) const {
+        return (5 * length + 3) / 4;
+    }
+
+    // each integer ends with a byte having its most significant bit set
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        const uint8_t * inbyte = reinterpret_cast<const uint8_t *> (in);
+        const uint8_t * const endbyte = inbyte + length * sizeof(uint32_t);
+        size_t answer = 0;
+        for (; inbyte != endbyte; ++inbyte)
+            answer += *inbyte >> 7;
+        return answer;
+    }
+
     string name() const {
         return "VariableByte";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new VariableByte(*this));
+    }
 
 };
 
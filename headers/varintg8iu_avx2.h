@@ -0,0 +1,25 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+#ifndef VARINTG8IU_AVX2_H_
+#define VARINTG8IU_AVX2_H_
+
+#include "common.h"
+
+namespace avx2 {
+/**
+ * Decodes groups (9 bytes each) of VarIntG8IU data to out and returns the
+ * number of integers. mask and sizes are the VarIntG8IUTables. As with
+ * VarIntG8IU::decodeBlock, up to 8 integers are written for each group.
+ *
+ * The implementation (src/varintg8iu_avx2.cpp) is compiled with -mavx2,
+ * so it should only be called when cpuSupportsAVX2() is true.
+ */
+size_t varintg8iuDecode(const unsigned char * src, const size_t groups,
+        uint32_t * out, const char (*mask)[32], const int * sizes);
+}
+
+#endif /* VARINTG8IU_AVX2_H_ */
@@ -293,9 +293,15 @@ public:
 
     const uint32_t * decodeVS(uint32_t len, const uint32_t *in, uint32_t *out,
             uint32_t *aux);
+    size_t decodedLength(const uint32_t * in, const size_t /*length*/) {
+        return in[0];
+    }
     string name() const {
         return "VSEncoding";
     }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new VSEncodingBlocks(*this));
+    }
 
     /*
      * It assumes that values start form 0.
@@ -316,6 +322,7 @@ public:
 
 };
 
+#ifdef FASTPFOR_X86
 #define __vseblocks_copy16(src, dest)   \
 		__asm__ __volatile__(           \
 				"movdqu %4, %%xmm0\n\t"         \
@@ -344,6 +351,10 @@ public:
 				:"=m" (dest[0]), "=m" (dest[4]), "=m" (dest[8]), "=m" (dest[12]) ,               \
 				 "=m" (dest[16]), "=m" (dest[20]), "=m" (dest[24]), "=m" (dest[28])       \
 				 ::"memory", "%xmm0")
+#else
+#define __vseblocks_copy16(src, dest) memcpy(dest, src, 16 * sizeof(uint32_t))
+#define __vseblocks_zero32(dest) memset(dest, 0, 32 * sizeof(uint32_t))
+#endif
 
 /* A set of unpacking functions */
 static void
@@ -699,6 +710,8 @@ const uint32_t * VSEncodingBlocks::decodeArray(const uint32_t *in,
     nvalue = *(in++);
     uint32_t res;
     uint32_t sum;
+    // not the member: decoding does not modify the instance
+    vector<uint32_t> aux(min<size_t>(nvalue, VSENCODING_BLOCKSZ) * 4 + TAIL_MERGIN);
 
     // __validate(in, (len << 2));
     //__validate(out, ((nvalue + TAIL_MERGIN) << 2));
@@ -706,10 +719,10 @@ const uint32_t * VSEncodingBlocks::decodeArray(const uint32_t *in,
     for (res = nvalue; res > VSENCODING_BLOCKSZ; out += VSENCODING_BLOCKSZ, in
             += sum, res -= VSENCODING_BLOCKSZ) {
         sum = *in++;
-        decodeVS(VSENCODING_BLOCKSZ, in, out, &__tmp[0]);
+        decodeVS(VSENCODING_BLOCKSZ, in, out, &aux[0]);
     }
 
-    const uint32_t * ans = decodeVS(res, in, out, &__tmp[0]);
+    const uint32_t * ans = decodeVS(res, in, out, &aux[0]);
     assert(initin + len >= in);
     if (initout + orignvalue < out)
         cerr << "possible overrun" << endl;
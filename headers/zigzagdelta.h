@@ -0,0 +1,79 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+#ifndef ZIGZAGDELTA_H_
+#define ZIGZAGDELTA_H_
+
+#include "common.h"
+#include "codecs.h"
+#include "deltautil.h"
+
+/**
+ * Compresses the zigzag deltas (see Delta::zigzagDeltaSIMD) of the
+ * integers with another codec: for time series and other arrays that are
+ * not sorted, but where consecutive values are close. Signed integers
+ * (int32_t) are supported as well.
+ *
+ * The format is that of the other codec. The transform needs no alignment,
+ * but the other codec may (e.g., SIMDBinaryPacking).
+ */
+class ZigZagDeltaCodec: public IntegerCODEC {
+public:
+    ZigZagDeltaCodec(shared_ptr<IntegerCODEC> c) :
+        codec(c), buffer() {
+    }
+    ZigZagDeltaCodec(const ZigZagDeltaCodec & other) :
+        IntegerCODEC(other), codec(other.codec->clone()), buffer() {
+    }
+    ZigZagDeltaCodec & operator=(const ZigZagDeltaCodec & other) {
+        codec = other.codec->clone();
+        return *this;
+    }
+
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        buffer.assign(in, in + length);
+        Delta::zigzagDeltaSIMD(buffer.data(), length);
+        codec->encodeArray(buffer.data(), length, out, nvalue);
+    }
+
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue) {
+        const uint32_t * finalin = codec->decodeArray(in, length, out, nvalue);
+        Delta::inverseZigzagDeltaSIMD(out, nvalue);
+        return finalin;
+    }
+
+    void encodeArray(const int32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        encodeArray(reinterpret_cast<const uint32_t *> (in), length, out, nvalue);
+    }
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            int32_t *out, size_t &nvalue) {
+        return decodeArray(in, length, reinterpret_cast<uint32_t *> (out), nvalue);
+    }
+
+    size_t maxCompressedWords(const size_t length) const {
+        return codec->maxCompressedWords(length);
+    }
+    size_t decodedLength(const uint32_t * in, const size_t length) {
+        return codec->decodedLength(in, length);
+    }
+
+    string name() const {
+        return "ZigZagDelta+" + codec->name();
+    }
+    shared_ptr<IntegerCODEC> clone() const {
+        return shared_ptr<IntegerCODEC> (new ZigZagDeltaCodec(*this));
+    }
+
+private:
+    shared_ptr<IntegerCODEC> codec;
+    vector<uint32_t, cacheallocator> buffer;// the zigzag deltas being encoded
+};
+
+#endif /* ZIGZAGDELTA_H_ */
@@ -0,0 +1,142 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * Fused unpacking and reduction (see SIMD_aggregate_32 in aggregation.h):
+ * the steps of SIMD_fastunpack_32, unrolled by template recursion, feed
+ * the accumulators instead of memory.
+ *
+ * This file is compiled with -msse4.1 and, for the avx2 namespace, with
+ * -mavx2 (see aggregation_avx2.cpp). A function defined in a header and
+ * not inlined would be emitted with -mavx2 as well and the linker could
+ * keep that copy for baseline code: we only call what is defined in the
+ * namespace.
+ */
+#include "aggregation.h"
+
+#ifdef AGGREGATION_NAMESPACE
+namespace AGGREGATION_NAMESPACE {
+#endif
+
+namespace {
+
+struct Accumulators {
+    Accumulators() :
+        sum64(_mm_setzero_si128()), min(_mm_set1_epi32(-1)), max(_mm_setzero_si128()) {
+    }
+    __m128i sum64;// two 64-bit lanes
+    __m128i min;
+    __m128i max;
+};
+
+/**
+ * The sum of the 32 integers of a lane fits in 32 bits up to this width,
+ * beyond we widen every vector.
+ */
+enum {
+    MaxNarrowSumBits = 27
+};
+
+inline __m128i widen(const __m128i v) {
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_add_epi64(_mm_unpacklo_epi32(v, zero), _mm_unpackhi_epi32(v, zero));
+}
+
+// step j (out of 32), as in SIMD_fastunpack_32
+template<uint32_t bit, uint32_t j>
+struct AggregateStep {
+    enum {
+        word = j * bit / 32,
+        offset = j * bit % 32
+    };
+    static inline void run(const __m128i * in, const __m128i mask, __m128i & sum,
+            Accumulators & acc) {
+        __m128i v = _mm_srli_epi32(_mm_load_si128(in + word), offset);
+        if (offset + bit > 32)
+            v = _mm_or_si128(v, _mm_slli_epi32(_mm_load_si128(in + word + 1), 32 - offset));
+        if (offset + bit != 32)
+            v = _mm_and_si128(v, mask);
+        if (bit > MaxNarrowSumBits)
+            acc.sum64 = _mm_add_epi64(acc.sum64, widen(v));
+        else
+            sum = _mm_add_epi32(sum, v);
+        acc.min = _mm_min_epu32(acc.min, v);
+        acc.max = _mm_max_epu32(acc.max, v);
+        AggregateStep<bit, j + 1>::run(in, mask, sum, acc);
+    }
+};
+
+template<uint32_t bit>
+struct AggregateStep<bit, 32> {
+    static inline void run(const __m128i *, const __m128i, __m128i &, Accumulators &) {
+    }
+};
+
+// as Aggregate::operator+=, which we do not call here (see the top of the file)
+inline void merge(Aggregate & a, const uint64_t sum, const uint32_t min, const uint32_t max,
+        const uint64_t count) {
+    a.sum += sum;
+    a.min = min < a.min ? min : a.min;
+    a.max = max > a.max ? max : a.max;
+    a.count += count;
+}
+
+inline uint32_t horizontalMin(__m128i v) {
+    v = _mm_min_epu32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_min_epu32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32_t> (_mm_cvtsi128_si32(v));
+}
+
+inline uint32_t horizontalMax(__m128i v) {
+    v = _mm_max_epu32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_max_epu32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32_t> (_mm_cvtsi128_si32(v));
+}
+
+template<uint32_t bit>
+void aggregateBlocks(const __m128i * in, const size_t howmany, Aggregate & a) {
+    Accumulators acc;
+    const __m128i mask = _mm_set1_epi32(bit >= 32 ? -1 : static_cast<int> ((1U << (bit % 32))
+            - 1));
+    for (size_t k = 0; k < howmany; ++k, in += bit) {
+        __m128i sum = _mm_setzero_si128();
+        AggregateStep<bit, 0>::run(in, mask, sum, acc);
+        if (bit <= MaxNarrowSumBits)
+            acc.sum64 = _mm_add_epi64(acc.sum64, widen(sum));
+    }
+    uint64_t sums[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *> (sums), acc.sum64);
+    merge(a, sums[0] + sums[1], horizontalMin(acc.min), horizontalMax(acc.max), 128 * howmany);
+}
+
+template<>
+void aggregateBlocks<0>(const __m128i *, const size_t howmany, Aggregate & a) {
+    merge(a, 0, 0, 0, 128 * howmany);
+}
+
+typedef void (*BlocksAggregator)(const __m128i * in, const size_t howmany, Aggregate & a);
+
+const BlocksAggregator aggregators[33] = { &aggregateBlocks<0>, &aggregateBlocks<1>,
+        &aggregateBlocks<2>, &aggregateBlocks<3>, &aggregateBlocks<4>, &aggregateBlocks<5>,
+        &aggregateBlocks<6>, &aggregateBlocks<7>, &aggregateBlocks<8>, &aggregateBlocks<9>,
+        &aggregateBlocks<10>, &aggregateBlocks<11>, &aggregateBlocks<12>, &aggregateBlocks<13>,
+        &aggregateBlocks<14>, &aggregateBlocks<15>, &aggregateBlocks<16>, &aggregateBlocks<17>,
+        &aggregateBlocks<18>, &aggregateBlocks<19>, &aggregateBlocks<20>, &aggregateBlocks<21>,
+        &aggregateBlocks<22>, &aggregateBlocks<23>, &aggregateBlocks<24>, &aggregateBlocks<25>,
+        &aggregateBlocks<26>, &aggregateBlocks<27>, &aggregateBlocks<28>, &aggregateBlocks<29>,
+        &aggregateBlocks<30>, &aggregateBlocks<31>, &aggregateBlocks<32> };
+
+}// namespace
+
+void SIMD_aggregate_32(const __m128i * in, const uint32_t bit, const size_t howmany,
+        Aggregate & a) {
+    if (howmany > 0)
+        aggregators[bit](in, howmany, a);
+}
+
+#ifdef AGGREGATION_NAMESPACE
+}
+#endif
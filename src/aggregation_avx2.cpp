@@ -0,0 +1,12 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * The kernels of aggregation.cpp, compiled with -mavx2 (VEX encoding) in
+ * the avx2 namespace. SIMD_fastaggregate_32 selects them at runtime.
+ */
+#define AGGREGATION_NAMESPACE avx2
+#include "aggregation.cpp"
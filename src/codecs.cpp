@@ -38,14 +38,19 @@ static struct option long_options[] = { { "uniformsparseclassic", no_argument,
         "uniformdynamicpredelta", no_argument, 0, 0 }, { "sillyuniformdynamic",
         no_argument, 0, 0 }, { "codecs", required_argument, 0, 'c' }, {
         "splitlongarrays", no_argument, 0, 'S' }, { "short", no_argument, 0,
-        's' }, { 0, 0, 0, 0 } };
+        's' }, { "perfcounters", no_argument, 0, 'P' }, {
+        "latencies", no_argument, 0, 'L' }, { "seed", required_argument, 0, 'R' }, {
+        0, 0, 0, 0 } };
 
 void message() {
     int c = 0;
     cout << "You must select one of these options:" << endl;
     while (long_options[c].name != 0) {
         if ((strcmp(long_options[c].name, "codecs") == 0) or ((strcmp(
-                long_options[c].name, "short") == 0)))
+                long_options[c].name, "short") == 0)) or ((strcmp(
+                long_options[c].name, "perfcounters") == 0)) or ((strcmp(
+                long_options[c].name, "latencies") == 0)) or ((strcmp(
+                long_options[c].name, "seed") == 0)))
             ++c;
         else
             cout << "--" << long_options[c++].name << endl;
@@ -67,6 +72,12 @@ void message() {
             << endl;
     cout << "You can get a more concise output by using the --short flag."
             << endl;
+    cout << "The --perfcounters flag (before the other flags) adds hardware counters"
+            " (Linux) to the summary." << endl;
+    cout << "The --latencies flag (before the other flags) adds the percentiles"
+            " of the decoding time of each array, by array length." << endl;
+    cout << "The --seed flag (before the other flags) sets the seed of the"
+            " generators, to get the same arrays again." << endl;
 
 }
 
@@ -75,6 +86,10 @@ int main(int argc, char **argv) {
     bool fulldisplay = true;
     bool displayhistogram = false;
     bool computeentropy = false;
+    bool perfcounters = false;
+    bool latencies = false;
+    // the arrays are generated on all cores, but they only depend on the seed
+    uint32_t seed = static_cast<uint32_t> (time(NULL));
 
     bool splitlongarrays = true;
     vector < shared_ptr<IntegerCODEC> > tmp = CODECFactory::allSchemes();// the default
@@ -83,10 +98,11 @@ int main(int argc, char **argv) {
         myalgos.push_back(algostats(i));
         myalgos.push_back(algostats(i,true));// by default?
     }
+    cout << "# kernels selected for this processor: " << bestInstructionSet() << endl;
     int c;
     while (1) {
         int option_index = 0;
-        c = getopt_long(argc, argv, "Sfec:", long_options, &option_index);
+        c = getopt_long(argc, argv, "SfePLR:c:", long_options, &option_index);
         if (c == -1)
             break;
         switch (c) {
@@ -125,6 +141,15 @@ int main(int argc, char **argv) {
         case 's':
             fulldisplay = false;
             break;
+        case 'P':
+            perfcounters = true;
+            break;
+        case 'L':
+            latencies = true;
+            break;
+        case 'R':
+            seed = static_cast<uint32_t> (atol(optarg));
+            break;
         case 'f':
             fulldisplay = true;
             break;
@@ -136,16 +161,17 @@ int main(int argc, char **argv) {
             }
             const char * parameter = long_options[option_index].name;
             cout << "# found " << parameter << endl;
+            cout << "# seed = " << seed << endl;
             if (strcmp(parameter, "zipfian1") == 0) {
                 const uint32_t N = 4194304 * 16;
                 vector < vector<uint32_t, cacheallocator> > datas;
                 cout << "# zipfian 1 data generation..." << endl;
                 for (uint k = 0; k < (1U << 1); ++k)
-                    datas.push_back(generateZipfianArray32(N, 1.0, 1U << 20));
+                    datas.push_back(generateZipfianArray32(N, 1.0, 1U << 20, seed + k));
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(false, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
@@ -154,134 +180,124 @@ int main(int argc, char **argv) {
                 vector < vector<uint32_t, cacheallocator> > datas;
                 for (uint k = 0; k < (1U << 1); ++k)
                     cout << "# zipfian 2 data generation..." << endl;
-                datas.push_back(generateZipfianArray32(N, 2.0, 1U << 20));
+                datas.push_back(generateZipfianArray32(N, 2.0, 1U << 20, seed));
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(false, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformdenseclassic") == 0) {
                 cout << "# dense uniform data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                UniformDataGenerator clu;
-                for (uint k = 0; k < (1U << 5); ++k)
-                    datas.push_back(clu.generateUniform((1U << 18), 1U << 27));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<UniformDataGenerator> ((1U << 5), seed,
+                                [](UniformDataGenerator & clu) {return clu.generateUniform((1U << 18), 1U << 27);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformsparseclassic") == 0) {
                 cout << "# sparse uniform data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                UniformDataGenerator clu;
-                for (uint k = 0; k < (1U << 14); ++k)// by original paper should be 1U<<19
-                    datas.push_back(clu.generateUniform((1U << 9), 1U << 27));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<UniformDataGenerator> ((1U << 14), seed,// by original paper should be 1U<<19
+                                [](UniformDataGenerator & clu) {return clu.generateUniform((1U << 9), 1U << 27);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clusterdenseclassic") == 0) {
                 cout << "# dense cluster data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                ClusteredDataGenerator clu;
-                for (uint k = 0; k < (1U << 5); ++k)// by original paper should be 1U<<10
-                    datas.push_back(clu.generateClustered((1U << 18), 1U << 27));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<ClusteredDataGenerator> ((1U << 5), seed,// by original paper should be 1U<<10
+                                [](ClusteredDataGenerator & clu) {return clu.generateClustered((1U << 18), 1U << 27);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clustersparseclassic") == 0) {
                 cout << "# sparse cluster data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                ClusteredDataGenerator clu;
-                for (uint k = 0; k < (1U << 14); ++k)// by original paper should be 1U<<19
-                    datas.push_back(clu.generateClustered((1U << 9), 1U << 27));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<ClusteredDataGenerator> ((1U << 14), seed,// by original paper should be 1U<<19
+                                [](ClusteredDataGenerator & clu) {return clu.generateClustered((1U << 9), 1U << 27);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformdense") == 0) {
                 cout << "# dense uniform data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                UniformDataGenerator clu;
-                for (uint k = 0; k < (1U << 3); ++k)// by original paper should be 1U<<10
-                    datas.push_back(clu.generateUniform((1U << 22), 1U << 29));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<UniformDataGenerator> ((1U << 3), seed,// by original paper should be 1U<<10
+                                [](UniformDataGenerator & clu) {return clu.generateUniform((1U << 22), 1U << 29);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformsparse") == 0) {
                 cout << "# sparse uniform data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                UniformDataGenerator clu;
-                for (uint k = 0; k < (1U << 13); ++k)
-                    datas.push_back(clu.generateUniform((1U << 12), 1U << 29));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<UniformDataGenerator> ((1U << 13), seed,
+                                [](UniformDataGenerator & clu) {return clu.generateUniform((1U << 12), 1U << 29);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clusterdense") == 0) {
                 cout << "# dense cluster data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                ClusteredDataGenerator clu;
-                for (uint k = 0; k < 1; ++k)
-                    datas.push_back(clu.generateClustered((1U << 23), 1U << 26));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<ClusteredDataGenerator> (1, seed,
+                                [](ClusteredDataGenerator & clu) {return clu.generateClusteredParallel((1U << 23), 1U << 26);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clustersparse") == 0) {
                 cout << "# sparse cluster data generation..." << endl;
-                vector < vector<uint32_t, cacheallocator> > datas;
-                ClusteredDataGenerator clu;
-                for (uint k = 0; k < (1U << 13); ++k)
-                    datas.push_back(clu.generateClustered((1U << 12), 1U << 26));
+                vector < vector<uint32_t, cacheallocator> > datas =
+                        generateArrays<ClusteredDataGenerator> ((1U << 13), seed,
+                                [](ClusteredDataGenerator & clu) {return clu.generateClustered((1U << 12), 1U << 26);});
                 cout << "# generated " << datas.size() << " arrays" << endl;
                 if (splitlongarrays)
                     splitLongArrays( datas);
                 processparameters pp(true, fulldisplay, displayhistogram,
-                        computeentropy, false);
+                        computeentropy, false, perfcounters, latencies);
                 Delta::process(myalgos, datas, pp);
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clusterdynamic") == 0) {
                 cout << "# dynamic clustered data generation..." << endl;
-                ClusteredDataGenerator clu;
                 for (uint32_t K = 15; K <= 25; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (25 - K)); ++k)
-                        datas.push_back(
-                                clu.generateClustered((1U << K), 1U << 29));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<ClusteredDataGenerator> ((1U << (25 - K)), seed + K,
+                                    [=](ClusteredDataGenerator & clu) {return clu.generateClustered((1U << K), 1U << 29);});
                     cout << "# generated " << datas.size() << " arrays" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
                     const uint32_t p = 29 - K;
@@ -290,19 +306,17 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(true, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformdynamic") == 0) {
                 cout << "# sparse uniform data generation..." << endl;
-                UniformDataGenerator clu;
                 for (uint32_t K = 15; K <= 25; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (25 - K)); ++k)
-                        datas.push_back(
-                                clu.generateUniform((1U << K), 1U << 29));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<UniformDataGenerator> ((1U << (25 - K)), seed + K,
+                                    [=](UniformDataGenerator & clu) {return clu.generateUniform((1U << K), 1U << 29);});
                     cout << "# generated " << datas.size() << " arrays" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
                     const uint32_t p = 29 - K;
@@ -311,19 +325,17 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(true, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clusterdynamicsmall") == 0) {
                 cout << "# dynamic clustered data generation..." << endl;
-                ClusteredDataGenerator clu;
                 for (uint32_t K = 15; K <= 20; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (20 - K)); ++k)
-                        datas.push_back(
-                                clu.generateClustered((1U << K), 1U << 29));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<ClusteredDataGenerator> ((1U << (20 - K)), seed + K,
+                                    [=](ClusteredDataGenerator & clu) {return clu.generateClustered((1U << K), 1U << 29);});
                     cout << "# generated " << datas.size() << " arrays" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
                     const uint32_t p = 29 - K;
@@ -332,19 +344,17 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(true, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformdynamicsmall") == 0) {
                 cout << "# sparse uniform data generation..." << endl;
-                UniformDataGenerator clu;
                 for (uint32_t K = 15; K <= 20; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (20 - K)); ++k)
-                        datas.push_back(
-                                clu.generateUniform((1U << K), 1U << 29));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<UniformDataGenerator> ((1U << (20 - K)), seed + K,
+                                    [=](UniformDataGenerator & clu) {return clu.generateUniform((1U << K), 1U << 29);});
                     cout << "# generated " << datas.size() << " arrays" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
                     const uint32_t p = 29 - K;
@@ -353,21 +363,17 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(true, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "clusterdynamicpredelta") == 0) {
                 cout << "# dynamic clustered data generation..." << endl;
-                ClusteredDataGenerator clu;
                 for (uint32_t K = 15; K <= 25; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (25 - K)); ++k)
-                        datas.push_back(
-                                diffs(
-                                        clu.generateClustered((1U << K),
-                                                1U << 29), false));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<ClusteredDataGenerator> ((1U << (25 - K)), seed + K,
+                                    [=](ClusteredDataGenerator & clu) {return diffs(clu.generateClustered((1U << K), 1U << 29), false);});
                     cout << "# generated " << datas.size()
                             << " arrays and applied delta coding" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
@@ -377,20 +383,17 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(false, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
                 return 0;
             } else if (strcmp(parameter, "uniformdynamicpredelta") == 0) {
                 cout << "# sparse uniform data generation..." << endl;
-                UniformDataGenerator clu;
                 for (uint32_t K = 15; K <= 25; K += 5) {
-                    vector < vector<uint32_t, cacheallocator> > datas;
-                    for (uint k = 0; k < (1U << (25 - K)); ++k)
-                        datas.push_back(
-                                diffs(clu.generateUniform((1U << K), 1U << 29),
-                                        false));
+                    vector < vector<uint32_t, cacheallocator> > datas =
+                            generateArrays<UniformDataGenerator> ((1U << (25 - K)), seed + K,
+                                    [=](UniformDataGenerator & clu) {return diffs(clu.generateUniform((1U << K), 1U << 29), false);});
                     cout << "# generated " << datas.size()
                             << " arrays and applied delta coding" << endl;
                     cout << "# their size is  " << (1U << K) << endl;
@@ -400,7 +403,7 @@ int main(int argc, char **argv) {
                     if (splitlongarrays)
                         splitLongArrays( datas);
                     processparameters pp(false, fulldisplay, displayhistogram,
-                            computeentropy, false);
+                            computeentropy, false, perfcounters, latencies);
                     Delta::process(myalgos, datas, pp, convert.str());
                 }
                 summarize(myalgos, "#");
@@ -0,0 +1,102 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * CRC32C with the crc32 instruction (see crc32c.h). The instruction has
+ * a latency of 3 cycles and a throughput of one per cycle, so we split
+ * long inputs into three streams checksummed together and combine the
+ * three CRCs as zlib does (crc32_combine): appending n zeros multiplies
+ * a CRC by x^(8n) modulo the polynomial.
+ *
+ * This file is compiled with -msse4.2.
+ */
+#include "crc32c.h"
+#include <nmmintrin.h>
+
+namespace {
+
+const uint32_t Polynomial = 0x82F63B78U;// reflected
+
+// a * b modulo the polynomial (bit 31 is x^0)
+uint32_t multiplyModulo(uint32_t a, uint32_t b) {
+    uint32_t m = 1U << 31, product = 0;
+    for (;;) {
+        if ((a & m) != 0) {
+            product ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = (b & 1) != 0 ? (b >> 1) ^ Polynomial : b >> 1;
+    }
+    return product;
+}
+
+// x^(2^k) modulo the polynomial, for k < 64
+struct PowersOfX {
+    PowersOfX() {
+        values[0] = 1U << 30;// x
+        for (uint32_t k = 1; k < 64; ++k)
+            values[k] = multiplyModulo(values[k - 1], values[k - 1]);
+    }
+    uint32_t values[64];
+};
+
+const PowersOfX powers;
+
+// the CRC of a followed by bytes bytes whose CRC is b
+uint32_t combine(const uint32_t a, const uint32_t b, size_t bytes) {
+    uint32_t shift = 1U << 31;// x^0
+    for (uint32_t k = 3; bytes != 0; bytes >>= 1, ++k)
+        if ((bytes & 1) != 0)
+            shift = multiplyModulo(powers.values[k], shift);
+    return multiplyModulo(shift, a) ^ b;
+}
+
+// the crc32 instruction, state not inverted
+uint32_t update(uint32_t c, const uint8_t * p, size_t bytes) {
+    uint64_t c64 = c;
+    for (; bytes >= 8; bytes -= 8, p += 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        c64 = _mm_crc32_u64(c64, word);
+    }
+    c = static_cast<uint32_t> (c64);
+    for (; bytes > 0; --bytes, ++p)
+        c = _mm_crc32_u8(c, *p);
+    return c;
+}
+
+enum {
+    MinimumStreamBytes = 1024 // below, combining costs more than it saves
+};
+
+}// namespace
+
+uint32_t crc32cHardware(const void * data, const size_t bytes, const uint32_t crc) {
+    const uint8_t * p = static_cast<const uint8_t *> (data);
+    const size_t streambytes = bytes / 3 / 8 * 8;
+    if (streambytes < MinimumStreamBytes)
+        return ~update(~crc, p, bytes);
+    const uint8_t * const p1 = p + streambytes;
+    const uint8_t * const p2 = p1 + streambytes;
+    uint64_t c0 = ~crc, c1 = 0xFFFFFFFFU, c2 = 0xFFFFFFFFU;
+    for (size_t i = 0; i < streambytes; i += 8) {
+        uint64_t w0, w1, w2;
+        memcpy(&w0, p + i, sizeof(w0));
+        memcpy(&w1, p1 + i, sizeof(w1));
+        memcpy(&w2, p2 + i, sizeof(w2));
+        c0 = _mm_crc32_u64(c0, w0);
+        c1 = _mm_crc32_u64(c1, w1);
+        c2 = _mm_crc32_u64(c2, w2);
+    }
+    const size_t lastbytes = bytes - 2 * streambytes;
+    const uint32_t last = ~update(static_cast<uint32_t> (c2), p2 + streambytes,
+            lastbytes - streambytes);
+    const uint32_t first = combine(~static_cast<uint32_t> (c0),
+            ~static_cast<uint32_t> (c1), streambytes);
+    return combine(first, last, lastbytes);
+}
@@ -18,12 +18,61 @@ void print(externalvector &ev) {
     }
 }
 
+/**
+ * Reads the rows of the CSV file back, after sorting them lexicographically
+ * (first column first) with an external sort: the sorted rows compress
+ * better.
+ */
+class SortedRows {
+public:
+    SortedRows(CSVFlatFile & cvs, size_t c) :
+        ev(c), next(0), buffer(), current(0) {
+        ev.open();
+        vector < uint32_t > container(c);
+        while (cvs.nextRow(container))
+            ev.dangerouslyfastappend(container);
+        vector < size_t > columns(c);
+        for (size_t k = 0; k < c; ++k)
+            columns[k] = k;
+        Cmp cmp(columns);
+        ev.sort(cmp, externalvector::DEFAULTBLOCKSIZE, 0, true);
+    }
+    ~SortedRows() {
+        ev.close();
+    }
+    bool nextRow(vector<uint32_t> & container) {
+        if (current == buffer.size()) {
+            if (next == ev.size())
+                return false;
+            const size_t end = min<size_t> (ev.size(), next + 65536);
+            ev.loadACopy(buffer, next, end);
+            next = end;
+            current = 0;
+        }
+        container = buffer[current++];
+        return true;
+    }
+private:
+    externalvector ev;
+    size_t next;// the next row to load
+    vector < vector<uint32_t> > buffer;
+    size_t current;
+};
+
 int main(int argc, char **argv) {
+    bool sortrows = false;
+    if ((argc > 1) && (strcmp(argv[1], "--sort") == 0)) {
+        sortrows = true;
+        --argc;
+        ++argv;
+    }
     if (argc < 3) {
         cerr << " This will map a table (stored in a CSV file) to a row "
             " oriented flat file of frequency attributed 32-bit integers "
                 << endl;
-        cerr << " usage : cvs2maropu mycvsfile.cvs mymaropufile.bin " << endl;
+        cerr << " usage : cvs2maropu [--sort] mycvsfile.cvs mymaropufile.bin " << endl;
+        cerr << " With --sort, the rows are sorted first (external sort, on "
+            " all cores)." << endl;
         return -1;
     }
     string ifilename(argv[1]);
@@ -33,6 +82,10 @@ int main(int argc, char **argv) {
     const size_t N = cvs.getNumberOfRows();
     size_t integers = static_cast<uint32_t> (c * N);
     vector < uint32_t > container(c);
+    unique_ptr<SortedRows> sorted(sortrows ? new SortedRows(cvs, c) : NULL);
+    auto nextRow = [&](vector < uint32_t > & row) {
+        return sorted ? sorted->nextRow(row) : cvs.nextRow(row);
+    };
     FILE * fd = ::fopen(ofilename.c_str(), "w+b");
     if (fd == NULL) {
         cout << " could not open " << ofilename << " for writing..." << endl;
@@ -48,7 +101,7 @@ int main(int argc, char **argv) {
             return -1;
         }
         uint32_t counter = 0;
-        while (cvs.nextRow(container)) {
+        while (nextRow(container)) {
             if (fwrite(&container[0], c * sizeof(uint32_t), 1, fd) != 1) {
                 cerr << "aborting" << endl;
                 ::fclose(fd);
@@ -69,7 +122,7 @@ int main(int argc, char **argv) {
             cvs.close();
             return -1;
         }
-        while (cvs.nextRow(container)) {
+        while (nextRow(container)) {
             if (fwrite(&container[0], c * sizeof(uint32_t), 1, fd) != 1) {
                 cerr << "aborting" << endl;
                 ::fclose(fd);
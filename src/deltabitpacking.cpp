@@ -0,0 +1,1178 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * Unpacking of 32 integers (same layout as bitpacking.cpp) with a fused
+ * inverse delta: each value is added to base, which is updated.
+ */
+#include "deltabitpacking.h"
+
+using namespace std;
+
+static void __fastunpackd1_0(const uint32_t *  __restrict__ , uint32_t *  __restrict__  out, uint32_t & base) {
+    for (uint32_t k = 0; k < 32; ++k)
+        out[k] = base;
+}
+
+static void __fastunpackd1_1(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 1U);
+    *out++ = base += ((in[0] >> 1) & 1U);
+    *out++ = base += ((in[0] >> 2) & 1U);
+    *out++ = base += ((in[0] >> 3) & 1U);
+    *out++ = base += ((in[0] >> 4) & 1U);
+    *out++ = base += ((in[0] >> 5) & 1U);
+    *out++ = base += ((in[0] >> 6) & 1U);
+    *out++ = base += ((in[0] >> 7) & 1U);
+    *out++ = base += ((in[0] >> 8) & 1U);
+    *out++ = base += ((in[0] >> 9) & 1U);
+    *out++ = base += ((in[0] >> 10) & 1U);
+    *out++ = base += ((in[0] >> 11) & 1U);
+    *out++ = base += ((in[0] >> 12) & 1U);
+    *out++ = base += ((in[0] >> 13) & 1U);
+    *out++ = base += ((in[0] >> 14) & 1U);
+    *out++ = base += ((in[0] >> 15) & 1U);
+    *out++ = base += ((in[0] >> 16) & 1U);
+    *out++ = base += ((in[0] >> 17) & 1U);
+    *out++ = base += ((in[0] >> 18) & 1U);
+    *out++ = base += ((in[0] >> 19) & 1U);
+    *out++ = base += ((in[0] >> 20) & 1U);
+    *out++ = base += ((in[0] >> 21) & 1U);
+    *out++ = base += ((in[0] >> 22) & 1U);
+    *out++ = base += ((in[0] >> 23) & 1U);
+    *out++ = base += ((in[0] >> 24) & 1U);
+    *out++ = base += ((in[0] >> 25) & 1U);
+    *out++ = base += ((in[0] >> 26) & 1U);
+    *out++ = base += ((in[0] >> 27) & 1U);
+    *out++ = base += ((in[0] >> 28) & 1U);
+    *out++ = base += ((in[0] >> 29) & 1U);
+    *out++ = base += ((in[0] >> 30) & 1U);
+    *out++ = base += (in[0] >> 31);
+}
+
+static void __fastunpackd1_2(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 3U);
+    *out++ = base += ((in[0] >> 2) & 3U);
+    *out++ = base += ((in[0] >> 4) & 3U);
+    *out++ = base += ((in[0] >> 6) & 3U);
+    *out++ = base += ((in[0] >> 8) & 3U);
+    *out++ = base += ((in[0] >> 10) & 3U);
+    *out++ = base += ((in[0] >> 12) & 3U);
+    *out++ = base += ((in[0] >> 14) & 3U);
+    *out++ = base += ((in[0] >> 16) & 3U);
+    *out++ = base += ((in[0] >> 18) & 3U);
+    *out++ = base += ((in[0] >> 20) & 3U);
+    *out++ = base += ((in[0] >> 22) & 3U);
+    *out++ = base += ((in[0] >> 24) & 3U);
+    *out++ = base += ((in[0] >> 26) & 3U);
+    *out++ = base += ((in[0] >> 28) & 3U);
+    *out++ = base += (in[0] >> 30);
+    *out++ = base += ((in[1] >> 0) & 3U);
+    *out++ = base += ((in[1] >> 2) & 3U);
+    *out++ = base += ((in[1] >> 4) & 3U);
+    *out++ = base += ((in[1] >> 6) & 3U);
+    *out++ = base += ((in[1] >> 8) & 3U);
+    *out++ = base += ((in[1] >> 10) & 3U);
+    *out++ = base += ((in[1] >> 12) & 3U);
+    *out++ = base += ((in[1] >> 14) & 3U);
+    *out++ = base += ((in[1] >> 16) & 3U);
+    *out++ = base += ((in[1] >> 18) & 3U);
+    *out++ = base += ((in[1] >> 20) & 3U);
+    *out++ = base += ((in[1] >> 22) & 3U);
+    *out++ = base += ((in[1] >> 24) & 3U);
+    *out++ = base += ((in[1] >> 26) & 3U);
+    *out++ = base += ((in[1] >> 28) & 3U);
+    *out++ = base += (in[1] >> 30);
+}
+
+static void __fastunpackd1_3(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 7U);
+    *out++ = base += ((in[0] >> 3) & 7U);
+    *out++ = base += ((in[0] >> 6) & 7U);
+    *out++ = base += ((in[0] >> 9) & 7U);
+    *out++ = base += ((in[0] >> 12) & 7U);
+    *out++ = base += ((in[0] >> 15) & 7U);
+    *out++ = base += ((in[0] >> 18) & 7U);
+    *out++ = base += ((in[0] >> 21) & 7U);
+    *out++ = base += ((in[0] >> 24) & 7U);
+    *out++ = base += ((in[0] >> 27) & 7U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 7U);
+    *out++ = base += ((in[1] >> 1) & 7U);
+    *out++ = base += ((in[1] >> 4) & 7U);
+    *out++ = base += ((in[1] >> 7) & 7U);
+    *out++ = base += ((in[1] >> 10) & 7U);
+    *out++ = base += ((in[1] >> 13) & 7U);
+    *out++ = base += ((in[1] >> 16) & 7U);
+    *out++ = base += ((in[1] >> 19) & 7U);
+    *out++ = base += ((in[1] >> 22) & 7U);
+    *out++ = base += ((in[1] >> 25) & 7U);
+    *out++ = base += ((in[1] >> 28) & 7U);
+    *out++ = base += (((in[1] >> 31) | (in[2] << 1)) & 7U);
+    *out++ = base += ((in[2] >> 2) & 7U);
+    *out++ = base += ((in[2] >> 5) & 7U);
+    *out++ = base += ((in[2] >> 8) & 7U);
+    *out++ = base += ((in[2] >> 11) & 7U);
+    *out++ = base += ((in[2] >> 14) & 7U);
+    *out++ = base += ((in[2] >> 17) & 7U);
+    *out++ = base += ((in[2] >> 20) & 7U);
+    *out++ = base += ((in[2] >> 23) & 7U);
+    *out++ = base += ((in[2] >> 26) & 7U);
+    *out++ = base += (in[2] >> 29);
+}
+
+static void __fastunpackd1_4(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 15U);
+    *out++ = base += ((in[0] >> 4) & 15U);
+    *out++ = base += ((in[0] >> 8) & 15U);
+    *out++ = base += ((in[0] >> 12) & 15U);
+    *out++ = base += ((in[0] >> 16) & 15U);
+    *out++ = base += ((in[0] >> 20) & 15U);
+    *out++ = base += ((in[0] >> 24) & 15U);
+    *out++ = base += (in[0] >> 28);
+    *out++ = base += ((in[1] >> 0) & 15U);
+    *out++ = base += ((in[1] >> 4) & 15U);
+    *out++ = base += ((in[1] >> 8) & 15U);
+    *out++ = base += ((in[1] >> 12) & 15U);
+    *out++ = base += ((in[1] >> 16) & 15U);
+    *out++ = base += ((in[1] >> 20) & 15U);
+    *out++ = base += ((in[1] >> 24) & 15U);
+    *out++ = base += (in[1] >> 28);
+    *out++ = base += ((in[2] >> 0) & 15U);
+    *out++ = base += ((in[2] >> 4) & 15U);
+    *out++ = base += ((in[2] >> 8) & 15U);
+    *out++ = base += ((in[2] >> 12) & 15U);
+    *out++ = base += ((in[2] >> 16) & 15U);
+    *out++ = base += ((in[2] >> 20) & 15U);
+    *out++ = base += ((in[2] >> 24) & 15U);
+    *out++ = base += (in[2] >> 28);
+    *out++ = base += ((in[3] >> 0) & 15U);
+    *out++ = base += ((in[3] >> 4) & 15U);
+    *out++ = base += ((in[3] >> 8) & 15U);
+    *out++ = base += ((in[3] >> 12) & 15U);
+    *out++ = base += ((in[3] >> 16) & 15U);
+    *out++ = base += ((in[3] >> 20) & 15U);
+    *out++ = base += ((in[3] >> 24) & 15U);
+    *out++ = base += (in[3] >> 28);
+}
+
+static void __fastunpackd1_5(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 31U);
+    *out++ = base += ((in[0] >> 5) & 31U);
+    *out++ = base += ((in[0] >> 10) & 31U);
+    *out++ = base += ((in[0] >> 15) & 31U);
+    *out++ = base += ((in[0] >> 20) & 31U);
+    *out++ = base += ((in[0] >> 25) & 31U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 31U);
+    *out++ = base += ((in[1] >> 3) & 31U);
+    *out++ = base += ((in[1] >> 8) & 31U);
+    *out++ = base += ((in[1] >> 13) & 31U);
+    *out++ = base += ((in[1] >> 18) & 31U);
+    *out++ = base += ((in[1] >> 23) & 31U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 31U);
+    *out++ = base += ((in[2] >> 1) & 31U);
+    *out++ = base += ((in[2] >> 6) & 31U);
+    *out++ = base += ((in[2] >> 11) & 31U);
+    *out++ = base += ((in[2] >> 16) & 31U);
+    *out++ = base += ((in[2] >> 21) & 31U);
+    *out++ = base += ((in[2] >> 26) & 31U);
+    *out++ = base += (((in[2] >> 31) | (in[3] << 1)) & 31U);
+    *out++ = base += ((in[3] >> 4) & 31U);
+    *out++ = base += ((in[3] >> 9) & 31U);
+    *out++ = base += ((in[3] >> 14) & 31U);
+    *out++ = base += ((in[3] >> 19) & 31U);
+    *out++ = base += ((in[3] >> 24) & 31U);
+    *out++ = base += (((in[3] >> 29) | (in[4] << 3)) & 31U);
+    *out++ = base += ((in[4] >> 2) & 31U);
+    *out++ = base += ((in[4] >> 7) & 31U);
+    *out++ = base += ((in[4] >> 12) & 31U);
+    *out++ = base += ((in[4] >> 17) & 31U);
+    *out++ = base += ((in[4] >> 22) & 31U);
+    *out++ = base += (in[4] >> 27);
+}
+
+static void __fastunpackd1_6(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 63U);
+    *out++ = base += ((in[0] >> 6) & 63U);
+    *out++ = base += ((in[0] >> 12) & 63U);
+    *out++ = base += ((in[0] >> 18) & 63U);
+    *out++ = base += ((in[0] >> 24) & 63U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 63U);
+    *out++ = base += ((in[1] >> 4) & 63U);
+    *out++ = base += ((in[1] >> 10) & 63U);
+    *out++ = base += ((in[1] >> 16) & 63U);
+    *out++ = base += ((in[1] >> 22) & 63U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 63U);
+    *out++ = base += ((in[2] >> 2) & 63U);
+    *out++ = base += ((in[2] >> 8) & 63U);
+    *out++ = base += ((in[2] >> 14) & 63U);
+    *out++ = base += ((in[2] >> 20) & 63U);
+    *out++ = base += (in[2] >> 26);
+    *out++ = base += ((in[3] >> 0) & 63U);
+    *out++ = base += ((in[3] >> 6) & 63U);
+    *out++ = base += ((in[3] >> 12) & 63U);
+    *out++ = base += ((in[3] >> 18) & 63U);
+    *out++ = base += ((in[3] >> 24) & 63U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 63U);
+    *out++ = base += ((in[4] >> 4) & 63U);
+    *out++ = base += ((in[4] >> 10) & 63U);
+    *out++ = base += ((in[4] >> 16) & 63U);
+    *out++ = base += ((in[4] >> 22) & 63U);
+    *out++ = base += (((in[4] >> 28) | (in[5] << 4)) & 63U);
+    *out++ = base += ((in[5] >> 2) & 63U);
+    *out++ = base += ((in[5] >> 8) & 63U);
+    *out++ = base += ((in[5] >> 14) & 63U);
+    *out++ = base += ((in[5] >> 20) & 63U);
+    *out++ = base += (in[5] >> 26);
+}
+
+static void __fastunpackd1_7(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 127U);
+    *out++ = base += ((in[0] >> 7) & 127U);
+    *out++ = base += ((in[0] >> 14) & 127U);
+    *out++ = base += ((in[0] >> 21) & 127U);
+    *out++ = base += (((in[0] >> 28) | (in[1] << 4)) & 127U);
+    *out++ = base += ((in[1] >> 3) & 127U);
+    *out++ = base += ((in[1] >> 10) & 127U);
+    *out++ = base += ((in[1] >> 17) & 127U);
+    *out++ = base += ((in[1] >> 24) & 127U);
+    *out++ = base += (((in[1] >> 31) | (in[2] << 1)) & 127U);
+    *out++ = base += ((in[2] >> 6) & 127U);
+    *out++ = base += ((in[2] >> 13) & 127U);
+    *out++ = base += ((in[2] >> 20) & 127U);
+    *out++ = base += (((in[2] >> 27) | (in[3] << 5)) & 127U);
+    *out++ = base += ((in[3] >> 2) & 127U);
+    *out++ = base += ((in[3] >> 9) & 127U);
+    *out++ = base += ((in[3] >> 16) & 127U);
+    *out++ = base += ((in[3] >> 23) & 127U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 127U);
+    *out++ = base += ((in[4] >> 5) & 127U);
+    *out++ = base += ((in[4] >> 12) & 127U);
+    *out++ = base += ((in[4] >> 19) & 127U);
+    *out++ = base += (((in[4] >> 26) | (in[5] << 6)) & 127U);
+    *out++ = base += ((in[5] >> 1) & 127U);
+    *out++ = base += ((in[5] >> 8) & 127U);
+    *out++ = base += ((in[5] >> 15) & 127U);
+    *out++ = base += ((in[5] >> 22) & 127U);
+    *out++ = base += (((in[5] >> 29) | (in[6] << 3)) & 127U);
+    *out++ = base += ((in[6] >> 4) & 127U);
+    *out++ = base += ((in[6] >> 11) & 127U);
+    *out++ = base += ((in[6] >> 18) & 127U);
+    *out++ = base += (in[6] >> 25);
+}
+
+static void __fastunpackd1_8(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 255U);
+    *out++ = base += ((in[0] >> 8) & 255U);
+    *out++ = base += ((in[0] >> 16) & 255U);
+    *out++ = base += (in[0] >> 24);
+    *out++ = base += ((in[1] >> 0) & 255U);
+    *out++ = base += ((in[1] >> 8) & 255U);
+    *out++ = base += ((in[1] >> 16) & 255U);
+    *out++ = base += (in[1] >> 24);
+    *out++ = base += ((in[2] >> 0) & 255U);
+    *out++ = base += ((in[2] >> 8) & 255U);
+    *out++ = base += ((in[2] >> 16) & 255U);
+    *out++ = base += (in[2] >> 24);
+    *out++ = base += ((in[3] >> 0) & 255U);
+    *out++ = base += ((in[3] >> 8) & 255U);
+    *out++ = base += ((in[3] >> 16) & 255U);
+    *out++ = base += (in[3] >> 24);
+    *out++ = base += ((in[4] >> 0) & 255U);
+    *out++ = base += ((in[4] >> 8) & 255U);
+    *out++ = base += ((in[4] >> 16) & 255U);
+    *out++ = base += (in[4] >> 24);
+    *out++ = base += ((in[5] >> 0) & 255U);
+    *out++ = base += ((in[5] >> 8) & 255U);
+    *out++ = base += ((in[5] >> 16) & 255U);
+    *out++ = base += (in[5] >> 24);
+    *out++ = base += ((in[6] >> 0) & 255U);
+    *out++ = base += ((in[6] >> 8) & 255U);
+    *out++ = base += ((in[6] >> 16) & 255U);
+    *out++ = base += (in[6] >> 24);
+    *out++ = base += ((in[7] >> 0) & 255U);
+    *out++ = base += ((in[7] >> 8) & 255U);
+    *out++ = base += ((in[7] >> 16) & 255U);
+    *out++ = base += (in[7] >> 24);
+}
+
+static void __fastunpackd1_9(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 511U);
+    *out++ = base += ((in[0] >> 9) & 511U);
+    *out++ = base += ((in[0] >> 18) & 511U);
+    *out++ = base += (((in[0] >> 27) | (in[1] << 5)) & 511U);
+    *out++ = base += ((in[1] >> 4) & 511U);
+    *out++ = base += ((in[1] >> 13) & 511U);
+    *out++ = base += ((in[1] >> 22) & 511U);
+    *out++ = base += (((in[1] >> 31) | (in[2] << 1)) & 511U);
+    *out++ = base += ((in[2] >> 8) & 511U);
+    *out++ = base += ((in[2] >> 17) & 511U);
+    *out++ = base += (((in[2] >> 26) | (in[3] << 6)) & 511U);
+    *out++ = base += ((in[3] >> 3) & 511U);
+    *out++ = base += ((in[3] >> 12) & 511U);
+    *out++ = base += ((in[3] >> 21) & 511U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 511U);
+    *out++ = base += ((in[4] >> 7) & 511U);
+    *out++ = base += ((in[4] >> 16) & 511U);
+    *out++ = base += (((in[4] >> 25) | (in[5] << 7)) & 511U);
+    *out++ = base += ((in[5] >> 2) & 511U);
+    *out++ = base += ((in[5] >> 11) & 511U);
+    *out++ = base += ((in[5] >> 20) & 511U);
+    *out++ = base += (((in[5] >> 29) | (in[6] << 3)) & 511U);
+    *out++ = base += ((in[6] >> 6) & 511U);
+    *out++ = base += ((in[6] >> 15) & 511U);
+    *out++ = base += (((in[6] >> 24) | (in[7] << 8)) & 511U);
+    *out++ = base += ((in[7] >> 1) & 511U);
+    *out++ = base += ((in[7] >> 10) & 511U);
+    *out++ = base += ((in[7] >> 19) & 511U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 511U);
+    *out++ = base += ((in[8] >> 5) & 511U);
+    *out++ = base += ((in[8] >> 14) & 511U);
+    *out++ = base += (in[8] >> 23);
+}
+
+static void __fastunpackd1_10(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 1023U);
+    *out++ = base += ((in[0] >> 10) & 1023U);
+    *out++ = base += ((in[0] >> 20) & 1023U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 1023U);
+    *out++ = base += ((in[1] >> 8) & 1023U);
+    *out++ = base += ((in[1] >> 18) & 1023U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 1023U);
+    *out++ = base += ((in[2] >> 6) & 1023U);
+    *out++ = base += ((in[2] >> 16) & 1023U);
+    *out++ = base += (((in[2] >> 26) | (in[3] << 6)) & 1023U);
+    *out++ = base += ((in[3] >> 4) & 1023U);
+    *out++ = base += ((in[3] >> 14) & 1023U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 1023U);
+    *out++ = base += ((in[4] >> 2) & 1023U);
+    *out++ = base += ((in[4] >> 12) & 1023U);
+    *out++ = base += (in[4] >> 22);
+    *out++ = base += ((in[5] >> 0) & 1023U);
+    *out++ = base += ((in[5] >> 10) & 1023U);
+    *out++ = base += ((in[5] >> 20) & 1023U);
+    *out++ = base += (((in[5] >> 30) | (in[6] << 2)) & 1023U);
+    *out++ = base += ((in[6] >> 8) & 1023U);
+    *out++ = base += ((in[6] >> 18) & 1023U);
+    *out++ = base += (((in[6] >> 28) | (in[7] << 4)) & 1023U);
+    *out++ = base += ((in[7] >> 6) & 1023U);
+    *out++ = base += ((in[7] >> 16) & 1023U);
+    *out++ = base += (((in[7] >> 26) | (in[8] << 6)) & 1023U);
+    *out++ = base += ((in[8] >> 4) & 1023U);
+    *out++ = base += ((in[8] >> 14) & 1023U);
+    *out++ = base += (((in[8] >> 24) | (in[9] << 8)) & 1023U);
+    *out++ = base += ((in[9] >> 2) & 1023U);
+    *out++ = base += ((in[9] >> 12) & 1023U);
+    *out++ = base += (in[9] >> 22);
+}
+
+static void __fastunpackd1_11(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 2047U);
+    *out++ = base += ((in[0] >> 11) & 2047U);
+    *out++ = base += (((in[0] >> 22) | (in[1] << 10)) & 2047U);
+    *out++ = base += ((in[1] >> 1) & 2047U);
+    *out++ = base += ((in[1] >> 12) & 2047U);
+    *out++ = base += (((in[1] >> 23) | (in[2] << 9)) & 2047U);
+    *out++ = base += ((in[2] >> 2) & 2047U);
+    *out++ = base += ((in[2] >> 13) & 2047U);
+    *out++ = base += (((in[2] >> 24) | (in[3] << 8)) & 2047U);
+    *out++ = base += ((in[3] >> 3) & 2047U);
+    *out++ = base += ((in[3] >> 14) & 2047U);
+    *out++ = base += (((in[3] >> 25) | (in[4] << 7)) & 2047U);
+    *out++ = base += ((in[4] >> 4) & 2047U);
+    *out++ = base += ((in[4] >> 15) & 2047U);
+    *out++ = base += (((in[4] >> 26) | (in[5] << 6)) & 2047U);
+    *out++ = base += ((in[5] >> 5) & 2047U);
+    *out++ = base += ((in[5] >> 16) & 2047U);
+    *out++ = base += (((in[5] >> 27) | (in[6] << 5)) & 2047U);
+    *out++ = base += ((in[6] >> 6) & 2047U);
+    *out++ = base += ((in[6] >> 17) & 2047U);
+    *out++ = base += (((in[6] >> 28) | (in[7] << 4)) & 2047U);
+    *out++ = base += ((in[7] >> 7) & 2047U);
+    *out++ = base += ((in[7] >> 18) & 2047U);
+    *out++ = base += (((in[7] >> 29) | (in[8] << 3)) & 2047U);
+    *out++ = base += ((in[8] >> 8) & 2047U);
+    *out++ = base += ((in[8] >> 19) & 2047U);
+    *out++ = base += (((in[8] >> 30) | (in[9] << 2)) & 2047U);
+    *out++ = base += ((in[9] >> 9) & 2047U);
+    *out++ = base += ((in[9] >> 20) & 2047U);
+    *out++ = base += (((in[9] >> 31) | (in[10] << 1)) & 2047U);
+    *out++ = base += ((in[10] >> 10) & 2047U);
+    *out++ = base += (in[10] >> 21);
+}
+
+static void __fastunpackd1_12(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 4095U);
+    *out++ = base += ((in[0] >> 12) & 4095U);
+    *out++ = base += (((in[0] >> 24) | (in[1] << 8)) & 4095U);
+    *out++ = base += ((in[1] >> 4) & 4095U);
+    *out++ = base += ((in[1] >> 16) & 4095U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 4095U);
+    *out++ = base += ((in[2] >> 8) & 4095U);
+    *out++ = base += (in[2] >> 20);
+    *out++ = base += ((in[3] >> 0) & 4095U);
+    *out++ = base += ((in[3] >> 12) & 4095U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 4095U);
+    *out++ = base += ((in[4] >> 4) & 4095U);
+    *out++ = base += ((in[4] >> 16) & 4095U);
+    *out++ = base += (((in[4] >> 28) | (in[5] << 4)) & 4095U);
+    *out++ = base += ((in[5] >> 8) & 4095U);
+    *out++ = base += (in[5] >> 20);
+    *out++ = base += ((in[6] >> 0) & 4095U);
+    *out++ = base += ((in[6] >> 12) & 4095U);
+    *out++ = base += (((in[6] >> 24) | (in[7] << 8)) & 4095U);
+    *out++ = base += ((in[7] >> 4) & 4095U);
+    *out++ = base += ((in[7] >> 16) & 4095U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 4095U);
+    *out++ = base += ((in[8] >> 8) & 4095U);
+    *out++ = base += (in[8] >> 20);
+    *out++ = base += ((in[9] >> 0) & 4095U);
+    *out++ = base += ((in[9] >> 12) & 4095U);
+    *out++ = base += (((in[9] >> 24) | (in[10] << 8)) & 4095U);
+    *out++ = base += ((in[10] >> 4) & 4095U);
+    *out++ = base += ((in[10] >> 16) & 4095U);
+    *out++ = base += (((in[10] >> 28) | (in[11] << 4)) & 4095U);
+    *out++ = base += ((in[11] >> 8) & 4095U);
+    *out++ = base += (in[11] >> 20);
+}
+
+static void __fastunpackd1_13(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 8191U);
+    *out++ = base += ((in[0] >> 13) & 8191U);
+    *out++ = base += (((in[0] >> 26) | (in[1] << 6)) & 8191U);
+    *out++ = base += ((in[1] >> 7) & 8191U);
+    *out++ = base += (((in[1] >> 20) | (in[2] << 12)) & 8191U);
+    *out++ = base += ((in[2] >> 1) & 8191U);
+    *out++ = base += ((in[2] >> 14) & 8191U);
+    *out++ = base += (((in[2] >> 27) | (in[3] << 5)) & 8191U);
+    *out++ = base += ((in[3] >> 8) & 8191U);
+    *out++ = base += (((in[3] >> 21) | (in[4] << 11)) & 8191U);
+    *out++ = base += ((in[4] >> 2) & 8191U);
+    *out++ = base += ((in[4] >> 15) & 8191U);
+    *out++ = base += (((in[4] >> 28) | (in[5] << 4)) & 8191U);
+    *out++ = base += ((in[5] >> 9) & 8191U);
+    *out++ = base += (((in[5] >> 22) | (in[6] << 10)) & 8191U);
+    *out++ = base += ((in[6] >> 3) & 8191U);
+    *out++ = base += ((in[6] >> 16) & 8191U);
+    *out++ = base += (((in[6] >> 29) | (in[7] << 3)) & 8191U);
+    *out++ = base += ((in[7] >> 10) & 8191U);
+    *out++ = base += (((in[7] >> 23) | (in[8] << 9)) & 8191U);
+    *out++ = base += ((in[8] >> 4) & 8191U);
+    *out++ = base += ((in[8] >> 17) & 8191U);
+    *out++ = base += (((in[8] >> 30) | (in[9] << 2)) & 8191U);
+    *out++ = base += ((in[9] >> 11) & 8191U);
+    *out++ = base += (((in[9] >> 24) | (in[10] << 8)) & 8191U);
+    *out++ = base += ((in[10] >> 5) & 8191U);
+    *out++ = base += ((in[10] >> 18) & 8191U);
+    *out++ = base += (((in[10] >> 31) | (in[11] << 1)) & 8191U);
+    *out++ = base += ((in[11] >> 12) & 8191U);
+    *out++ = base += (((in[11] >> 25) | (in[12] << 7)) & 8191U);
+    *out++ = base += ((in[12] >> 6) & 8191U);
+    *out++ = base += (in[12] >> 19);
+}
+
+static void __fastunpackd1_14(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 16383U);
+    *out++ = base += ((in[0] >> 14) & 16383U);
+    *out++ = base += (((in[0] >> 28) | (in[1] << 4)) & 16383U);
+    *out++ = base += ((in[1] >> 10) & 16383U);
+    *out++ = base += (((in[1] >> 24) | (in[2] << 8)) & 16383U);
+    *out++ = base += ((in[2] >> 6) & 16383U);
+    *out++ = base += (((in[2] >> 20) | (in[3] << 12)) & 16383U);
+    *out++ = base += ((in[3] >> 2) & 16383U);
+    *out++ = base += ((in[3] >> 16) & 16383U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 16383U);
+    *out++ = base += ((in[4] >> 12) & 16383U);
+    *out++ = base += (((in[4] >> 26) | (in[5] << 6)) & 16383U);
+    *out++ = base += ((in[5] >> 8) & 16383U);
+    *out++ = base += (((in[5] >> 22) | (in[6] << 10)) & 16383U);
+    *out++ = base += ((in[6] >> 4) & 16383U);
+    *out++ = base += (in[6] >> 18);
+    *out++ = base += ((in[7] >> 0) & 16383U);
+    *out++ = base += ((in[7] >> 14) & 16383U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 16383U);
+    *out++ = base += ((in[8] >> 10) & 16383U);
+    *out++ = base += (((in[8] >> 24) | (in[9] << 8)) & 16383U);
+    *out++ = base += ((in[9] >> 6) & 16383U);
+    *out++ = base += (((in[9] >> 20) | (in[10] << 12)) & 16383U);
+    *out++ = base += ((in[10] >> 2) & 16383U);
+    *out++ = base += ((in[10] >> 16) & 16383U);
+    *out++ = base += (((in[10] >> 30) | (in[11] << 2)) & 16383U);
+    *out++ = base += ((in[11] >> 12) & 16383U);
+    *out++ = base += (((in[11] >> 26) | (in[12] << 6)) & 16383U);
+    *out++ = base += ((in[12] >> 8) & 16383U);
+    *out++ = base += (((in[12] >> 22) | (in[13] << 10)) & 16383U);
+    *out++ = base += ((in[13] >> 4) & 16383U);
+    *out++ = base += (in[13] >> 18);
+}
+
+static void __fastunpackd1_15(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 32767U);
+    *out++ = base += ((in[0] >> 15) & 32767U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 32767U);
+    *out++ = base += ((in[1] >> 13) & 32767U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 32767U);
+    *out++ = base += ((in[2] >> 11) & 32767U);
+    *out++ = base += (((in[2] >> 26) | (in[3] << 6)) & 32767U);
+    *out++ = base += ((in[3] >> 9) & 32767U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 32767U);
+    *out++ = base += ((in[4] >> 7) & 32767U);
+    *out++ = base += (((in[4] >> 22) | (in[5] << 10)) & 32767U);
+    *out++ = base += ((in[5] >> 5) & 32767U);
+    *out++ = base += (((in[5] >> 20) | (in[6] << 12)) & 32767U);
+    *out++ = base += ((in[6] >> 3) & 32767U);
+    *out++ = base += (((in[6] >> 18) | (in[7] << 14)) & 32767U);
+    *out++ = base += ((in[7] >> 1) & 32767U);
+    *out++ = base += ((in[7] >> 16) & 32767U);
+    *out++ = base += (((in[7] >> 31) | (in[8] << 1)) & 32767U);
+    *out++ = base += ((in[8] >> 14) & 32767U);
+    *out++ = base += (((in[8] >> 29) | (in[9] << 3)) & 32767U);
+    *out++ = base += ((in[9] >> 12) & 32767U);
+    *out++ = base += (((in[9] >> 27) | (in[10] << 5)) & 32767U);
+    *out++ = base += ((in[10] >> 10) & 32767U);
+    *out++ = base += (((in[10] >> 25) | (in[11] << 7)) & 32767U);
+    *out++ = base += ((in[11] >> 8) & 32767U);
+    *out++ = base += (((in[11] >> 23) | (in[12] << 9)) & 32767U);
+    *out++ = base += ((in[12] >> 6) & 32767U);
+    *out++ = base += (((in[12] >> 21) | (in[13] << 11)) & 32767U);
+    *out++ = base += ((in[13] >> 4) & 32767U);
+    *out++ = base += (((in[13] >> 19) | (in[14] << 13)) & 32767U);
+    *out++ = base += ((in[14] >> 2) & 32767U);
+    *out++ = base += (in[14] >> 17);
+}
+
+static void __fastunpackd1_16(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 65535U);
+    *out++ = base += (in[0] >> 16);
+    *out++ = base += ((in[1] >> 0) & 65535U);
+    *out++ = base += (in[1] >> 16);
+    *out++ = base += ((in[2] >> 0) & 65535U);
+    *out++ = base += (in[2] >> 16);
+    *out++ = base += ((in[3] >> 0) & 65535U);
+    *out++ = base += (in[3] >> 16);
+    *out++ = base += ((in[4] >> 0) & 65535U);
+    *out++ = base += (in[4] >> 16);
+    *out++ = base += ((in[5] >> 0) & 65535U);
+    *out++ = base += (in[5] >> 16);
+    *out++ = base += ((in[6] >> 0) & 65535U);
+    *out++ = base += (in[6] >> 16);
+    *out++ = base += ((in[7] >> 0) & 65535U);
+    *out++ = base += (in[7] >> 16);
+    *out++ = base += ((in[8] >> 0) & 65535U);
+    *out++ = base += (in[8] >> 16);
+    *out++ = base += ((in[9] >> 0) & 65535U);
+    *out++ = base += (in[9] >> 16);
+    *out++ = base += ((in[10] >> 0) & 65535U);
+    *out++ = base += (in[10] >> 16);
+    *out++ = base += ((in[11] >> 0) & 65535U);
+    *out++ = base += (in[11] >> 16);
+    *out++ = base += ((in[12] >> 0) & 65535U);
+    *out++ = base += (in[12] >> 16);
+    *out++ = base += ((in[13] >> 0) & 65535U);
+    *out++ = base += (in[13] >> 16);
+    *out++ = base += ((in[14] >> 0) & 65535U);
+    *out++ = base += (in[14] >> 16);
+    *out++ = base += ((in[15] >> 0) & 65535U);
+    *out++ = base += (in[15] >> 16);
+}
+
+static void __fastunpackd1_17(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 131071U);
+    *out++ = base += (((in[0] >> 17) | (in[1] << 15)) & 131071U);
+    *out++ = base += ((in[1] >> 2) & 131071U);
+    *out++ = base += (((in[1] >> 19) | (in[2] << 13)) & 131071U);
+    *out++ = base += ((in[2] >> 4) & 131071U);
+    *out++ = base += (((in[2] >> 21) | (in[3] << 11)) & 131071U);
+    *out++ = base += ((in[3] >> 6) & 131071U);
+    *out++ = base += (((in[3] >> 23) | (in[4] << 9)) & 131071U);
+    *out++ = base += ((in[4] >> 8) & 131071U);
+    *out++ = base += (((in[4] >> 25) | (in[5] << 7)) & 131071U);
+    *out++ = base += ((in[5] >> 10) & 131071U);
+    *out++ = base += (((in[5] >> 27) | (in[6] << 5)) & 131071U);
+    *out++ = base += ((in[6] >> 12) & 131071U);
+    *out++ = base += (((in[6] >> 29) | (in[7] << 3)) & 131071U);
+    *out++ = base += ((in[7] >> 14) & 131071U);
+    *out++ = base += (((in[7] >> 31) | (in[8] << 1)) & 131071U);
+    *out++ = base += (((in[8] >> 16) | (in[9] << 16)) & 131071U);
+    *out++ = base += ((in[9] >> 1) & 131071U);
+    *out++ = base += (((in[9] >> 18) | (in[10] << 14)) & 131071U);
+    *out++ = base += ((in[10] >> 3) & 131071U);
+    *out++ = base += (((in[10] >> 20) | (in[11] << 12)) & 131071U);
+    *out++ = base += ((in[11] >> 5) & 131071U);
+    *out++ = base += (((in[11] >> 22) | (in[12] << 10)) & 131071U);
+    *out++ = base += ((in[12] >> 7) & 131071U);
+    *out++ = base += (((in[12] >> 24) | (in[13] << 8)) & 131071U);
+    *out++ = base += ((in[13] >> 9) & 131071U);
+    *out++ = base += (((in[13] >> 26) | (in[14] << 6)) & 131071U);
+    *out++ = base += ((in[14] >> 11) & 131071U);
+    *out++ = base += (((in[14] >> 28) | (in[15] << 4)) & 131071U);
+    *out++ = base += ((in[15] >> 13) & 131071U);
+    *out++ = base += (((in[15] >> 30) | (in[16] << 2)) & 131071U);
+    *out++ = base += (in[16] >> 15);
+}
+
+static void __fastunpackd1_18(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 262143U);
+    *out++ = base += (((in[0] >> 18) | (in[1] << 14)) & 262143U);
+    *out++ = base += ((in[1] >> 4) & 262143U);
+    *out++ = base += (((in[1] >> 22) | (in[2] << 10)) & 262143U);
+    *out++ = base += ((in[2] >> 8) & 262143U);
+    *out++ = base += (((in[2] >> 26) | (in[3] << 6)) & 262143U);
+    *out++ = base += ((in[3] >> 12) & 262143U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 262143U);
+    *out++ = base += (((in[4] >> 16) | (in[5] << 16)) & 262143U);
+    *out++ = base += ((in[5] >> 2) & 262143U);
+    *out++ = base += (((in[5] >> 20) | (in[6] << 12)) & 262143U);
+    *out++ = base += ((in[6] >> 6) & 262143U);
+    *out++ = base += (((in[6] >> 24) | (in[7] << 8)) & 262143U);
+    *out++ = base += ((in[7] >> 10) & 262143U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 262143U);
+    *out++ = base += (in[8] >> 14);
+    *out++ = base += ((in[9] >> 0) & 262143U);
+    *out++ = base += (((in[9] >> 18) | (in[10] << 14)) & 262143U);
+    *out++ = base += ((in[10] >> 4) & 262143U);
+    *out++ = base += (((in[10] >> 22) | (in[11] << 10)) & 262143U);
+    *out++ = base += ((in[11] >> 8) & 262143U);
+    *out++ = base += (((in[11] >> 26) | (in[12] << 6)) & 262143U);
+    *out++ = base += ((in[12] >> 12) & 262143U);
+    *out++ = base += (((in[12] >> 30) | (in[13] << 2)) & 262143U);
+    *out++ = base += (((in[13] >> 16) | (in[14] << 16)) & 262143U);
+    *out++ = base += ((in[14] >> 2) & 262143U);
+    *out++ = base += (((in[14] >> 20) | (in[15] << 12)) & 262143U);
+    *out++ = base += ((in[15] >> 6) & 262143U);
+    *out++ = base += (((in[15] >> 24) | (in[16] << 8)) & 262143U);
+    *out++ = base += ((in[16] >> 10) & 262143U);
+    *out++ = base += (((in[16] >> 28) | (in[17] << 4)) & 262143U);
+    *out++ = base += (in[17] >> 14);
+}
+
+static void __fastunpackd1_19(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 524287U);
+    *out++ = base += (((in[0] >> 19) | (in[1] << 13)) & 524287U);
+    *out++ = base += ((in[1] >> 6) & 524287U);
+    *out++ = base += (((in[1] >> 25) | (in[2] << 7)) & 524287U);
+    *out++ = base += ((in[2] >> 12) & 524287U);
+    *out++ = base += (((in[2] >> 31) | (in[3] << 1)) & 524287U);
+    *out++ = base += (((in[3] >> 18) | (in[4] << 14)) & 524287U);
+    *out++ = base += ((in[4] >> 5) & 524287U);
+    *out++ = base += (((in[4] >> 24) | (in[5] << 8)) & 524287U);
+    *out++ = base += ((in[5] >> 11) & 524287U);
+    *out++ = base += (((in[5] >> 30) | (in[6] << 2)) & 524287U);
+    *out++ = base += (((in[6] >> 17) | (in[7] << 15)) & 524287U);
+    *out++ = base += ((in[7] >> 4) & 524287U);
+    *out++ = base += (((in[7] >> 23) | (in[8] << 9)) & 524287U);
+    *out++ = base += ((in[8] >> 10) & 524287U);
+    *out++ = base += (((in[8] >> 29) | (in[9] << 3)) & 524287U);
+    *out++ = base += (((in[9] >> 16) | (in[10] << 16)) & 524287U);
+    *out++ = base += ((in[10] >> 3) & 524287U);
+    *out++ = base += (((in[10] >> 22) | (in[11] << 10)) & 524287U);
+    *out++ = base += ((in[11] >> 9) & 524287U);
+    *out++ = base += (((in[11] >> 28) | (in[12] << 4)) & 524287U);
+    *out++ = base += (((in[12] >> 15) | (in[13] << 17)) & 524287U);
+    *out++ = base += ((in[13] >> 2) & 524287U);
+    *out++ = base += (((in[13] >> 21) | (in[14] << 11)) & 524287U);
+    *out++ = base += ((in[14] >> 8) & 524287U);
+    *out++ = base += (((in[14] >> 27) | (in[15] << 5)) & 524287U);
+    *out++ = base += (((in[15] >> 14) | (in[16] << 18)) & 524287U);
+    *out++ = base += ((in[16] >> 1) & 524287U);
+    *out++ = base += (((in[16] >> 20) | (in[17] << 12)) & 524287U);
+    *out++ = base += ((in[17] >> 7) & 524287U);
+    *out++ = base += (((in[17] >> 26) | (in[18] << 6)) & 524287U);
+    *out++ = base += (in[18] >> 13);
+}
+
+static void __fastunpackd1_20(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 1048575U);
+    *out++ = base += (((in[0] >> 20) | (in[1] << 12)) & 1048575U);
+    *out++ = base += ((in[1] >> 8) & 1048575U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 1048575U);
+    *out++ = base += (((in[2] >> 16) | (in[3] << 16)) & 1048575U);
+    *out++ = base += ((in[3] >> 4) & 1048575U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 1048575U);
+    *out++ = base += (in[4] >> 12);
+    *out++ = base += ((in[5] >> 0) & 1048575U);
+    *out++ = base += (((in[5] >> 20) | (in[6] << 12)) & 1048575U);
+    *out++ = base += ((in[6] >> 8) & 1048575U);
+    *out++ = base += (((in[6] >> 28) | (in[7] << 4)) & 1048575U);
+    *out++ = base += (((in[7] >> 16) | (in[8] << 16)) & 1048575U);
+    *out++ = base += ((in[8] >> 4) & 1048575U);
+    *out++ = base += (((in[8] >> 24) | (in[9] << 8)) & 1048575U);
+    *out++ = base += (in[9] >> 12);
+    *out++ = base += ((in[10] >> 0) & 1048575U);
+    *out++ = base += (((in[10] >> 20) | (in[11] << 12)) & 1048575U);
+    *out++ = base += ((in[11] >> 8) & 1048575U);
+    *out++ = base += (((in[11] >> 28) | (in[12] << 4)) & 1048575U);
+    *out++ = base += (((in[12] >> 16) | (in[13] << 16)) & 1048575U);
+    *out++ = base += ((in[13] >> 4) & 1048575U);
+    *out++ = base += (((in[13] >> 24) | (in[14] << 8)) & 1048575U);
+    *out++ = base += (in[14] >> 12);
+    *out++ = base += ((in[15] >> 0) & 1048575U);
+    *out++ = base += (((in[15] >> 20) | (in[16] << 12)) & 1048575U);
+    *out++ = base += ((in[16] >> 8) & 1048575U);
+    *out++ = base += (((in[16] >> 28) | (in[17] << 4)) & 1048575U);
+    *out++ = base += (((in[17] >> 16) | (in[18] << 16)) & 1048575U);
+    *out++ = base += ((in[18] >> 4) & 1048575U);
+    *out++ = base += (((in[18] >> 24) | (in[19] << 8)) & 1048575U);
+    *out++ = base += (in[19] >> 12);
+}
+
+static void __fastunpackd1_21(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 2097151U);
+    *out++ = base += (((in[0] >> 21) | (in[1] << 11)) & 2097151U);
+    *out++ = base += ((in[1] >> 10) & 2097151U);
+    *out++ = base += (((in[1] >> 31) | (in[2] << 1)) & 2097151U);
+    *out++ = base += (((in[2] >> 20) | (in[3] << 12)) & 2097151U);
+    *out++ = base += ((in[3] >> 9) & 2097151U);
+    *out++ = base += (((in[3] >> 30) | (in[4] << 2)) & 2097151U);
+    *out++ = base += (((in[4] >> 19) | (in[5] << 13)) & 2097151U);
+    *out++ = base += ((in[5] >> 8) & 2097151U);
+    *out++ = base += (((in[5] >> 29) | (in[6] << 3)) & 2097151U);
+    *out++ = base += (((in[6] >> 18) | (in[7] << 14)) & 2097151U);
+    *out++ = base += ((in[7] >> 7) & 2097151U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 2097151U);
+    *out++ = base += (((in[8] >> 17) | (in[9] << 15)) & 2097151U);
+    *out++ = base += ((in[9] >> 6) & 2097151U);
+    *out++ = base += (((in[9] >> 27) | (in[10] << 5)) & 2097151U);
+    *out++ = base += (((in[10] >> 16) | (in[11] << 16)) & 2097151U);
+    *out++ = base += ((in[11] >> 5) & 2097151U);
+    *out++ = base += (((in[11] >> 26) | (in[12] << 6)) & 2097151U);
+    *out++ = base += (((in[12] >> 15) | (in[13] << 17)) & 2097151U);
+    *out++ = base += ((in[13] >> 4) & 2097151U);
+    *out++ = base += (((in[13] >> 25) | (in[14] << 7)) & 2097151U);
+    *out++ = base += (((in[14] >> 14) | (in[15] << 18)) & 2097151U);
+    *out++ = base += ((in[15] >> 3) & 2097151U);
+    *out++ = base += (((in[15] >> 24) | (in[16] << 8)) & 2097151U);
+    *out++ = base += (((in[16] >> 13) | (in[17] << 19)) & 2097151U);
+    *out++ = base += ((in[17] >> 2) & 2097151U);
+    *out++ = base += (((in[17] >> 23) | (in[18] << 9)) & 2097151U);
+    *out++ = base += (((in[18] >> 12) | (in[19] << 20)) & 2097151U);
+    *out++ = base += ((in[19] >> 1) & 2097151U);
+    *out++ = base += (((in[19] >> 22) | (in[20] << 10)) & 2097151U);
+    *out++ = base += (in[20] >> 11);
+}
+
+static void __fastunpackd1_22(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 4194303U);
+    *out++ = base += (((in[0] >> 22) | (in[1] << 10)) & 4194303U);
+    *out++ = base += (((in[1] >> 12) | (in[2] << 20)) & 4194303U);
+    *out++ = base += ((in[2] >> 2) & 4194303U);
+    *out++ = base += (((in[2] >> 24) | (in[3] << 8)) & 4194303U);
+    *out++ = base += (((in[3] >> 14) | (in[4] << 18)) & 4194303U);
+    *out++ = base += ((in[4] >> 4) & 4194303U);
+    *out++ = base += (((in[4] >> 26) | (in[5] << 6)) & 4194303U);
+    *out++ = base += (((in[5] >> 16) | (in[6] << 16)) & 4194303U);
+    *out++ = base += ((in[6] >> 6) & 4194303U);
+    *out++ = base += (((in[6] >> 28) | (in[7] << 4)) & 4194303U);
+    *out++ = base += (((in[7] >> 18) | (in[8] << 14)) & 4194303U);
+    *out++ = base += ((in[8] >> 8) & 4194303U);
+    *out++ = base += (((in[8] >> 30) | (in[9] << 2)) & 4194303U);
+    *out++ = base += (((in[9] >> 20) | (in[10] << 12)) & 4194303U);
+    *out++ = base += (in[10] >> 10);
+    *out++ = base += ((in[11] >> 0) & 4194303U);
+    *out++ = base += (((in[11] >> 22) | (in[12] << 10)) & 4194303U);
+    *out++ = base += (((in[12] >> 12) | (in[13] << 20)) & 4194303U);
+    *out++ = base += ((in[13] >> 2) & 4194303U);
+    *out++ = base += (((in[13] >> 24) | (in[14] << 8)) & 4194303U);
+    *out++ = base += (((in[14] >> 14) | (in[15] << 18)) & 4194303U);
+    *out++ = base += ((in[15] >> 4) & 4194303U);
+    *out++ = base += (((in[15] >> 26) | (in[16] << 6)) & 4194303U);
+    *out++ = base += (((in[16] >> 16) | (in[17] << 16)) & 4194303U);
+    *out++ = base += ((in[17] >> 6) & 4194303U);
+    *out++ = base += (((in[17] >> 28) | (in[18] << 4)) & 4194303U);
+    *out++ = base += (((in[18] >> 18) | (in[19] << 14)) & 4194303U);
+    *out++ = base += ((in[19] >> 8) & 4194303U);
+    *out++ = base += (((in[19] >> 30) | (in[20] << 2)) & 4194303U);
+    *out++ = base += (((in[20] >> 20) | (in[21] << 12)) & 4194303U);
+    *out++ = base += (in[21] >> 10);
+}
+
+static void __fastunpackd1_23(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 8388607U);
+    *out++ = base += (((in[0] >> 23) | (in[1] << 9)) & 8388607U);
+    *out++ = base += (((in[1] >> 14) | (in[2] << 18)) & 8388607U);
+    *out++ = base += ((in[2] >> 5) & 8388607U);
+    *out++ = base += (((in[2] >> 28) | (in[3] << 4)) & 8388607U);
+    *out++ = base += (((in[3] >> 19) | (in[4] << 13)) & 8388607U);
+    *out++ = base += (((in[4] >> 10) | (in[5] << 22)) & 8388607U);
+    *out++ = base += ((in[5] >> 1) & 8388607U);
+    *out++ = base += (((in[5] >> 24) | (in[6] << 8)) & 8388607U);
+    *out++ = base += (((in[6] >> 15) | (in[7] << 17)) & 8388607U);
+    *out++ = base += ((in[7] >> 6) & 8388607U);
+    *out++ = base += (((in[7] >> 29) | (in[8] << 3)) & 8388607U);
+    *out++ = base += (((in[8] >> 20) | (in[9] << 12)) & 8388607U);
+    *out++ = base += (((in[9] >> 11) | (in[10] << 21)) & 8388607U);
+    *out++ = base += ((in[10] >> 2) & 8388607U);
+    *out++ = base += (((in[10] >> 25) | (in[11] << 7)) & 8388607U);
+    *out++ = base += (((in[11] >> 16) | (in[12] << 16)) & 8388607U);
+    *out++ = base += ((in[12] >> 7) & 8388607U);
+    *out++ = base += (((in[12] >> 30) | (in[13] << 2)) & 8388607U);
+    *out++ = base += (((in[13] >> 21) | (in[14] << 11)) & 8388607U);
+    *out++ = base += (((in[14] >> 12) | (in[15] << 20)) & 8388607U);
+    *out++ = base += ((in[15] >> 3) & 8388607U);
+    *out++ = base += (((in[15] >> 26) | (in[16] << 6)) & 8388607U);
+    *out++ = base += (((in[16] >> 17) | (in[17] << 15)) & 8388607U);
+    *out++ = base += ((in[17] >> 8) & 8388607U);
+    *out++ = base += (((in[17] >> 31) | (in[18] << 1)) & 8388607U);
+    *out++ = base += (((in[18] >> 22) | (in[19] << 10)) & 8388607U);
+    *out++ = base += (((in[19] >> 13) | (in[20] << 19)) & 8388607U);
+    *out++ = base += ((in[20] >> 4) & 8388607U);
+    *out++ = base += (((in[20] >> 27) | (in[21] << 5)) & 8388607U);
+    *out++ = base += (((in[21] >> 18) | (in[22] << 14)) & 8388607U);
+    *out++ = base += (in[22] >> 9);
+}
+
+static void __fastunpackd1_24(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 16777215U);
+    *out++ = base += (((in[0] >> 24) | (in[1] << 8)) & 16777215U);
+    *out++ = base += (((in[1] >> 16) | (in[2] << 16)) & 16777215U);
+    *out++ = base += (in[2] >> 8);
+    *out++ = base += ((in[3] >> 0) & 16777215U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 16777215U);
+    *out++ = base += (((in[4] >> 16) | (in[5] << 16)) & 16777215U);
+    *out++ = base += (in[5] >> 8);
+    *out++ = base += ((in[6] >> 0) & 16777215U);
+    *out++ = base += (((in[6] >> 24) | (in[7] << 8)) & 16777215U);
+    *out++ = base += (((in[7] >> 16) | (in[8] << 16)) & 16777215U);
+    *out++ = base += (in[8] >> 8);
+    *out++ = base += ((in[9] >> 0) & 16777215U);
+    *out++ = base += (((in[9] >> 24) | (in[10] << 8)) & 16777215U);
+    *out++ = base += (((in[10] >> 16) | (in[11] << 16)) & 16777215U);
+    *out++ = base += (in[11] >> 8);
+    *out++ = base += ((in[12] >> 0) & 16777215U);
+    *out++ = base += (((in[12] >> 24) | (in[13] << 8)) & 16777215U);
+    *out++ = base += (((in[13] >> 16) | (in[14] << 16)) & 16777215U);
+    *out++ = base += (in[14] >> 8);
+    *out++ = base += ((in[15] >> 0) & 16777215U);
+    *out++ = base += (((in[15] >> 24) | (in[16] << 8)) & 16777215U);
+    *out++ = base += (((in[16] >> 16) | (in[17] << 16)) & 16777215U);
+    *out++ = base += (in[17] >> 8);
+    *out++ = base += ((in[18] >> 0) & 16777215U);
+    *out++ = base += (((in[18] >> 24) | (in[19] << 8)) & 16777215U);
+    *out++ = base += (((in[19] >> 16) | (in[20] << 16)) & 16777215U);
+    *out++ = base += (in[20] >> 8);
+    *out++ = base += ((in[21] >> 0) & 16777215U);
+    *out++ = base += (((in[21] >> 24) | (in[22] << 8)) & 16777215U);
+    *out++ = base += (((in[22] >> 16) | (in[23] << 16)) & 16777215U);
+    *out++ = base += (in[23] >> 8);
+}
+
+static void __fastunpackd1_25(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 33554431U);
+    *out++ = base += (((in[0] >> 25) | (in[1] << 7)) & 33554431U);
+    *out++ = base += (((in[1] >> 18) | (in[2] << 14)) & 33554431U);
+    *out++ = base += (((in[2] >> 11) | (in[3] << 21)) & 33554431U);
+    *out++ = base += ((in[3] >> 4) & 33554431U);
+    *out++ = base += (((in[3] >> 29) | (in[4] << 3)) & 33554431U);
+    *out++ = base += (((in[4] >> 22) | (in[5] << 10)) & 33554431U);
+    *out++ = base += (((in[5] >> 15) | (in[6] << 17)) & 33554431U);
+    *out++ = base += (((in[6] >> 8) | (in[7] << 24)) & 33554431U);
+    *out++ = base += ((in[7] >> 1) & 33554431U);
+    *out++ = base += (((in[7] >> 26) | (in[8] << 6)) & 33554431U);
+    *out++ = base += (((in[8] >> 19) | (in[9] << 13)) & 33554431U);
+    *out++ = base += (((in[9] >> 12) | (in[10] << 20)) & 33554431U);
+    *out++ = base += ((in[10] >> 5) & 33554431U);
+    *out++ = base += (((in[10] >> 30) | (in[11] << 2)) & 33554431U);
+    *out++ = base += (((in[11] >> 23) | (in[12] << 9)) & 33554431U);
+    *out++ = base += (((in[12] >> 16) | (in[13] << 16)) & 33554431U);
+    *out++ = base += (((in[13] >> 9) | (in[14] << 23)) & 33554431U);
+    *out++ = base += ((in[14] >> 2) & 33554431U);
+    *out++ = base += (((in[14] >> 27) | (in[15] << 5)) & 33554431U);
+    *out++ = base += (((in[15] >> 20) | (in[16] << 12)) & 33554431U);
+    *out++ = base += (((in[16] >> 13) | (in[17] << 19)) & 33554431U);
+    *out++ = base += ((in[17] >> 6) & 33554431U);
+    *out++ = base += (((in[17] >> 31) | (in[18] << 1)) & 33554431U);
+    *out++ = base += (((in[18] >> 24) | (in[19] << 8)) & 33554431U);
+    *out++ = base += (((in[19] >> 17) | (in[20] << 15)) & 33554431U);
+    *out++ = base += (((in[20] >> 10) | (in[21] << 22)) & 33554431U);
+    *out++ = base += ((in[21] >> 3) & 33554431U);
+    *out++ = base += (((in[21] >> 28) | (in[22] << 4)) & 33554431U);
+    *out++ = base += (((in[22] >> 21) | (in[23] << 11)) & 33554431U);
+    *out++ = base += (((in[23] >> 14) | (in[24] << 18)) & 33554431U);
+    *out++ = base += (in[24] >> 7);
+}
+
+static void __fastunpackd1_26(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 67108863U);
+    *out++ = base += (((in[0] >> 26) | (in[1] << 6)) & 67108863U);
+    *out++ = base += (((in[1] >> 20) | (in[2] << 12)) & 67108863U);
+    *out++ = base += (((in[2] >> 14) | (in[3] << 18)) & 67108863U);
+    *out++ = base += (((in[3] >> 8) | (in[4] << 24)) & 67108863U);
+    *out++ = base += ((in[4] >> 2) & 67108863U);
+    *out++ = base += (((in[4] >> 28) | (in[5] << 4)) & 67108863U);
+    *out++ = base += (((in[5] >> 22) | (in[6] << 10)) & 67108863U);
+    *out++ = base += (((in[6] >> 16) | (in[7] << 16)) & 67108863U);
+    *out++ = base += (((in[7] >> 10) | (in[8] << 22)) & 67108863U);
+    *out++ = base += ((in[8] >> 4) & 67108863U);
+    *out++ = base += (((in[8] >> 30) | (in[9] << 2)) & 67108863U);
+    *out++ = base += (((in[9] >> 24) | (in[10] << 8)) & 67108863U);
+    *out++ = base += (((in[10] >> 18) | (in[11] << 14)) & 67108863U);
+    *out++ = base += (((in[11] >> 12) | (in[12] << 20)) & 67108863U);
+    *out++ = base += (in[12] >> 6);
+    *out++ = base += ((in[13] >> 0) & 67108863U);
+    *out++ = base += (((in[13] >> 26) | (in[14] << 6)) & 67108863U);
+    *out++ = base += (((in[14] >> 20) | (in[15] << 12)) & 67108863U);
+    *out++ = base += (((in[15] >> 14) | (in[16] << 18)) & 67108863U);
+    *out++ = base += (((in[16] >> 8) | (in[17] << 24)) & 67108863U);
+    *out++ = base += ((in[17] >> 2) & 67108863U);
+    *out++ = base += (((in[17] >> 28) | (in[18] << 4)) & 67108863U);
+    *out++ = base += (((in[18] >> 22) | (in[19] << 10)) & 67108863U);
+    *out++ = base += (((in[19] >> 16) | (in[20] << 16)) & 67108863U);
+    *out++ = base += (((in[20] >> 10) | (in[21] << 22)) & 67108863U);
+    *out++ = base += ((in[21] >> 4) & 67108863U);
+    *out++ = base += (((in[21] >> 30) | (in[22] << 2)) & 67108863U);
+    *out++ = base += (((in[22] >> 24) | (in[23] << 8)) & 67108863U);
+    *out++ = base += (((in[23] >> 18) | (in[24] << 14)) & 67108863U);
+    *out++ = base += (((in[24] >> 12) | (in[25] << 20)) & 67108863U);
+    *out++ = base += (in[25] >> 6);
+}
+
+static void __fastunpackd1_27(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 134217727U);
+    *out++ = base += (((in[0] >> 27) | (in[1] << 5)) & 134217727U);
+    *out++ = base += (((in[1] >> 22) | (in[2] << 10)) & 134217727U);
+    *out++ = base += (((in[2] >> 17) | (in[3] << 15)) & 134217727U);
+    *out++ = base += (((in[3] >> 12) | (in[4] << 20)) & 134217727U);
+    *out++ = base += (((in[4] >> 7) | (in[5] << 25)) & 134217727U);
+    *out++ = base += ((in[5] >> 2) & 134217727U);
+    *out++ = base += (((in[5] >> 29) | (in[6] << 3)) & 134217727U);
+    *out++ = base += (((in[6] >> 24) | (in[7] << 8)) & 134217727U);
+    *out++ = base += (((in[7] >> 19) | (in[8] << 13)) & 134217727U);
+    *out++ = base += (((in[8] >> 14) | (in[9] << 18)) & 134217727U);
+    *out++ = base += (((in[9] >> 9) | (in[10] << 23)) & 134217727U);
+    *out++ = base += ((in[10] >> 4) & 134217727U);
+    *out++ = base += (((in[10] >> 31) | (in[11] << 1)) & 134217727U);
+    *out++ = base += (((in[11] >> 26) | (in[12] << 6)) & 134217727U);
+    *out++ = base += (((in[12] >> 21) | (in[13] << 11)) & 134217727U);
+    *out++ = base += (((in[13] >> 16) | (in[14] << 16)) & 134217727U);
+    *out++ = base += (((in[14] >> 11) | (in[15] << 21)) & 134217727U);
+    *out++ = base += (((in[15] >> 6) | (in[16] << 26)) & 134217727U);
+    *out++ = base += ((in[16] >> 1) & 134217727U);
+    *out++ = base += (((in[16] >> 28) | (in[17] << 4)) & 134217727U);
+    *out++ = base += (((in[17] >> 23) | (in[18] << 9)) & 134217727U);
+    *out++ = base += (((in[18] >> 18) | (in[19] << 14)) & 134217727U);
+    *out++ = base += (((in[19] >> 13) | (in[20] << 19)) & 134217727U);
+    *out++ = base += (((in[20] >> 8) | (in[21] << 24)) & 134217727U);
+    *out++ = base += ((in[21] >> 3) & 134217727U);
+    *out++ = base += (((in[21] >> 30) | (in[22] << 2)) & 134217727U);
+    *out++ = base += (((in[22] >> 25) | (in[23] << 7)) & 134217727U);
+    *out++ = base += (((in[23] >> 20) | (in[24] << 12)) & 134217727U);
+    *out++ = base += (((in[24] >> 15) | (in[25] << 17)) & 134217727U);
+    *out++ = base += (((in[25] >> 10) | (in[26] << 22)) & 134217727U);
+    *out++ = base += (in[26] >> 5);
+}
+
+static void __fastunpackd1_28(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 268435455U);
+    *out++ = base += (((in[0] >> 28) | (in[1] << 4)) & 268435455U);
+    *out++ = base += (((in[1] >> 24) | (in[2] << 8)) & 268435455U);
+    *out++ = base += (((in[2] >> 20) | (in[3] << 12)) & 268435455U);
+    *out++ = base += (((in[3] >> 16) | (in[4] << 16)) & 268435455U);
+    *out++ = base += (((in[4] >> 12) | (in[5] << 20)) & 268435455U);
+    *out++ = base += (((in[5] >> 8) | (in[6] << 24)) & 268435455U);
+    *out++ = base += (in[6] >> 4);
+    *out++ = base += ((in[7] >> 0) & 268435455U);
+    *out++ = base += (((in[7] >> 28) | (in[8] << 4)) & 268435455U);
+    *out++ = base += (((in[8] >> 24) | (in[9] << 8)) & 268435455U);
+    *out++ = base += (((in[9] >> 20) | (in[10] << 12)) & 268435455U);
+    *out++ = base += (((in[10] >> 16) | (in[11] << 16)) & 268435455U);
+    *out++ = base += (((in[11] >> 12) | (in[12] << 20)) & 268435455U);
+    *out++ = base += (((in[12] >> 8) | (in[13] << 24)) & 268435455U);
+    *out++ = base += (in[13] >> 4);
+    *out++ = base += ((in[14] >> 0) & 268435455U);
+    *out++ = base += (((in[14] >> 28) | (in[15] << 4)) & 268435455U);
+    *out++ = base += (((in[15] >> 24) | (in[16] << 8)) & 268435455U);
+    *out++ = base += (((in[16] >> 20) | (in[17] << 12)) & 268435455U);
+    *out++ = base += (((in[17] >> 16) | (in[18] << 16)) & 268435455U);
+    *out++ = base += (((in[18] >> 12) | (in[19] << 20)) & 268435455U);
+    *out++ = base += (((in[19] >> 8) | (in[20] << 24)) & 268435455U);
+    *out++ = base += (in[20] >> 4);
+    *out++ = base += ((in[21] >> 0) & 268435455U);
+    *out++ = base += (((in[21] >> 28) | (in[22] << 4)) & 268435455U);
+    *out++ = base += (((in[22] >> 24) | (in[23] << 8)) & 268435455U);
+    *out++ = base += (((in[23] >> 20) | (in[24] << 12)) & 268435455U);
+    *out++ = base += (((in[24] >> 16) | (in[25] << 16)) & 268435455U);
+    *out++ = base += (((in[25] >> 12) | (in[26] << 20)) & 268435455U);
+    *out++ = base += (((in[26] >> 8) | (in[27] << 24)) & 268435455U);
+    *out++ = base += (in[27] >> 4);
+}
+
+static void __fastunpackd1_29(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 536870911U);
+    *out++ = base += (((in[0] >> 29) | (in[1] << 3)) & 536870911U);
+    *out++ = base += (((in[1] >> 26) | (in[2] << 6)) & 536870911U);
+    *out++ = base += (((in[2] >> 23) | (in[3] << 9)) & 536870911U);
+    *out++ = base += (((in[3] >> 20) | (in[4] << 12)) & 536870911U);
+    *out++ = base += (((in[4] >> 17) | (in[5] << 15)) & 536870911U);
+    *out++ = base += (((in[5] >> 14) | (in[6] << 18)) & 536870911U);
+    *out++ = base += (((in[6] >> 11) | (in[7] << 21)) & 536870911U);
+    *out++ = base += (((in[7] >> 8) | (in[8] << 24)) & 536870911U);
+    *out++ = base += (((in[8] >> 5) | (in[9] << 27)) & 536870911U);
+    *out++ = base += ((in[9] >> 2) & 536870911U);
+    *out++ = base += (((in[9] >> 31) | (in[10] << 1)) & 536870911U);
+    *out++ = base += (((in[10] >> 28) | (in[11] << 4)) & 536870911U);
+    *out++ = base += (((in[11] >> 25) | (in[12] << 7)) & 536870911U);
+    *out++ = base += (((in[12] >> 22) | (in[13] << 10)) & 536870911U);
+    *out++ = base += (((in[13] >> 19) | (in[14] << 13)) & 536870911U);
+    *out++ = base += (((in[14] >> 16) | (in[15] << 16)) & 536870911U);
+    *out++ = base += (((in[15] >> 13) | (in[16] << 19)) & 536870911U);
+    *out++ = base += (((in[16] >> 10) | (in[17] << 22)) & 536870911U);
+    *out++ = base += (((in[17] >> 7) | (in[18] << 25)) & 536870911U);
+    *out++ = base += (((in[18] >> 4) | (in[19] << 28)) & 536870911U);
+    *out++ = base += ((in[19] >> 1) & 536870911U);
+    *out++ = base += (((in[19] >> 30) | (in[20] << 2)) & 536870911U);
+    *out++ = base += (((in[20] >> 27) | (in[21] << 5)) & 536870911U);
+    *out++ = base += (((in[21] >> 24) | (in[22] << 8)) & 536870911U);
+    *out++ = base += (((in[22] >> 21) | (in[23] << 11)) & 536870911U);
+    *out++ = base += (((in[23] >> 18) | (in[24] << 14)) & 536870911U);
+    *out++ = base += (((in[24] >> 15) | (in[25] << 17)) & 536870911U);
+    *out++ = base += (((in[25] >> 12) | (in[26] << 20)) & 536870911U);
+    *out++ = base += (((in[26] >> 9) | (in[27] << 23)) & 536870911U);
+    *out++ = base += (((in[27] >> 6) | (in[28] << 26)) & 536870911U);
+    *out++ = base += (in[28] >> 3);
+}
+
+static void __fastunpackd1_30(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 1073741823U);
+    *out++ = base += (((in[0] >> 30) | (in[1] << 2)) & 1073741823U);
+    *out++ = base += (((in[1] >> 28) | (in[2] << 4)) & 1073741823U);
+    *out++ = base += (((in[2] >> 26) | (in[3] << 6)) & 1073741823U);
+    *out++ = base += (((in[3] >> 24) | (in[4] << 8)) & 1073741823U);
+    *out++ = base += (((in[4] >> 22) | (in[5] << 10)) & 1073741823U);
+    *out++ = base += (((in[5] >> 20) | (in[6] << 12)) & 1073741823U);
+    *out++ = base += (((in[6] >> 18) | (in[7] << 14)) & 1073741823U);
+    *out++ = base += (((in[7] >> 16) | (in[8] << 16)) & 1073741823U);
+    *out++ = base += (((in[8] >> 14) | (in[9] << 18)) & 1073741823U);
+    *out++ = base += (((in[9] >> 12) | (in[10] << 20)) & 1073741823U);
+    *out++ = base += (((in[10] >> 10) | (in[11] << 22)) & 1073741823U);
+    *out++ = base += (((in[11] >> 8) | (in[12] << 24)) & 1073741823U);
+    *out++ = base += (((in[12] >> 6) | (in[13] << 26)) & 1073741823U);
+    *out++ = base += (((in[13] >> 4) | (in[14] << 28)) & 1073741823U);
+    *out++ = base += (in[14] >> 2);
+    *out++ = base += ((in[15] >> 0) & 1073741823U);
+    *out++ = base += (((in[15] >> 30) | (in[16] << 2)) & 1073741823U);
+    *out++ = base += (((in[16] >> 28) | (in[17] << 4)) & 1073741823U);
+    *out++ = base += (((in[17] >> 26) | (in[18] << 6)) & 1073741823U);
+    *out++ = base += (((in[18] >> 24) | (in[19] << 8)) & 1073741823U);
+    *out++ = base += (((in[19] >> 22) | (in[20] << 10)) & 1073741823U);
+    *out++ = base += (((in[20] >> 20) | (in[21] << 12)) & 1073741823U);
+    *out++ = base += (((in[21] >> 18) | (in[22] << 14)) & 1073741823U);
+    *out++ = base += (((in[22] >> 16) | (in[23] << 16)) & 1073741823U);
+    *out++ = base += (((in[23] >> 14) | (in[24] << 18)) & 1073741823U);
+    *out++ = base += (((in[24] >> 12) | (in[25] << 20)) & 1073741823U);
+    *out++ = base += (((in[25] >> 10) | (in[26] << 22)) & 1073741823U);
+    *out++ = base += (((in[26] >> 8) | (in[27] << 24)) & 1073741823U);
+    *out++ = base += (((in[27] >> 6) | (in[28] << 26)) & 1073741823U);
+    *out++ = base += (((in[28] >> 4) | (in[29] << 28)) & 1073741823U);
+    *out++ = base += (in[29] >> 2);
+}
+
+static void __fastunpackd1_31(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += ((in[0] >> 0) & 2147483647U);
+    *out++ = base += (((in[0] >> 31) | (in[1] << 1)) & 2147483647U);
+    *out++ = base += (((in[1] >> 30) | (in[2] << 2)) & 2147483647U);
+    *out++ = base += (((in[2] >> 29) | (in[3] << 3)) & 2147483647U);
+    *out++ = base += (((in[3] >> 28) | (in[4] << 4)) & 2147483647U);
+    *out++ = base += (((in[4] >> 27) | (in[5] << 5)) & 2147483647U);
+    *out++ = base += (((in[5] >> 26) | (in[6] << 6)) & 2147483647U);
+    *out++ = base += (((in[6] >> 25) | (in[7] << 7)) & 2147483647U);
+    *out++ = base += (((in[7] >> 24) | (in[8] << 8)) & 2147483647U);
+    *out++ = base += (((in[8] >> 23) | (in[9] << 9)) & 2147483647U);
+    *out++ = base += (((in[9] >> 22) | (in[10] << 10)) & 2147483647U);
+    *out++ = base += (((in[10] >> 21) | (in[11] << 11)) & 2147483647U);
+    *out++ = base += (((in[11] >> 20) | (in[12] << 12)) & 2147483647U);
+    *out++ = base += (((in[12] >> 19) | (in[13] << 13)) & 2147483647U);
+    *out++ = base += (((in[13] >> 18) | (in[14] << 14)) & 2147483647U);
+    *out++ = base += (((in[14] >> 17) | (in[15] << 15)) & 2147483647U);
+    *out++ = base += (((in[15] >> 16) | (in[16] << 16)) & 2147483647U);
+    *out++ = base += (((in[16] >> 15) | (in[17] << 17)) & 2147483647U);
+    *out++ = base += (((in[17] >> 14) | (in[18] << 18)) & 2147483647U);
+    *out++ = base += (((in[18] >> 13) | (in[19] << 19)) & 2147483647U);
+    *out++ = base += (((in[19] >> 12) | (in[20] << 20)) & 2147483647U);
+    *out++ = base += (((in[20] >> 11) | (in[21] << 21)) & 2147483647U);
+    *out++ = base += (((in[21] >> 10) | (in[22] << 22)) & 2147483647U);
+    *out++ = base += (((in[22] >> 9) | (in[23] << 23)) & 2147483647U);
+    *out++ = base += (((in[23] >> 8) | (in[24] << 24)) & 2147483647U);
+    *out++ = base += (((in[24] >> 7) | (in[25] << 25)) & 2147483647U);
+    *out++ = base += (((in[25] >> 6) | (in[26] << 26)) & 2147483647U);
+    *out++ = base += (((in[26] >> 5) | (in[27] << 27)) & 2147483647U);
+    *out++ = base += (((in[27] >> 4) | (in[28] << 28)) & 2147483647U);
+    *out++ = base += (((in[28] >> 3) | (in[29] << 29)) & 2147483647U);
+    *out++ = base += (((in[29] >> 2) | (in[30] << 30)) & 2147483647U);
+    *out++ = base += (in[30] >> 1);
+}
+
+static void __fastunpackd1_32(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, uint32_t & base) {
+    *out++ = base += in[0];
+    *out++ = base += in[1];
+    *out++ = base += in[2];
+    *out++ = base += in[3];
+    *out++ = base += in[4];
+    *out++ = base += in[5];
+    *out++ = base += in[6];
+    *out++ = base += in[7];
+    *out++ = base += in[8];
+    *out++ = base += in[9];
+    *out++ = base += in[10];
+    *out++ = base += in[11];
+    *out++ = base += in[12];
+    *out++ = base += in[13];
+    *out++ = base += in[14];
+    *out++ = base += in[15];
+    *out++ = base += in[16];
+    *out++ = base += in[17];
+    *out++ = base += in[18];
+    *out++ = base += in[19];
+    *out++ = base += in[20];
+    *out++ = base += in[21];
+    *out++ = base += in[22];
+    *out++ = base += in[23];
+    *out++ = base += in[24];
+    *out++ = base += in[25];
+    *out++ = base += in[26];
+    *out++ = base += in[27];
+    *out++ = base += in[28];
+    *out++ = base += in[29];
+    *out++ = base += in[30];
+    *out++ = base += in[31];
+}
+
+void fastunpackd1(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit, uint32_t & base) {
+    switch(bit) {
+        case 0: __fastunpackd1_0(in,out,base); return;
+        case 1: __fastunpackd1_1(in,out,base); return;
+        case 2: __fastunpackd1_2(in,out,base); return;
+        case 3: __fastunpackd1_3(in,out,base); return;
+        case 4: __fastunpackd1_4(in,out,base); return;
+        case 5: __fastunpackd1_5(in,out,base); return;
+        case 6: __fastunpackd1_6(in,out,base); return;
+        case 7: __fastunpackd1_7(in,out,base); return;
+        case 8: __fastunpackd1_8(in,out,base); return;
+        case 9: __fastunpackd1_9(in,out,base); return;
+        case 10: __fastunpackd1_10(in,out,base); return;
+        case 11: __fastunpackd1_11(in,out,base); return;
+        case 12: __fastunpackd1_12(in,out,base); return;
+        case 13: __fastunpackd1_13(in,out,base); return;
+        case 14: __fastunpackd1_14(in,out,base); return;
+        case 15: __fastunpackd1_15(in,out,base); return;
+        case 16: __fastunpackd1_16(in,out,base); return;
+        case 17: __fastunpackd1_17(in,out,base); return;
+        case 18: __fastunpackd1_18(in,out,base); return;
+        case 19: __fastunpackd1_19(in,out,base); return;
+        case 20: __fastunpackd1_20(in,out,base); return;
+        case 21: __fastunpackd1_21(in,out,base); return;
+        case 22: __fastunpackd1_22(in,out,base); return;
+        case 23: __fastunpackd1_23(in,out,base); return;
+        case 24: __fastunpackd1_24(in,out,base); return;
+        case 25: __fastunpackd1_25(in,out,base); return;
+        case 26: __fastunpackd1_26(in,out,base); return;
+        case 27: __fastunpackd1_27(in,out,base); return;
+        case 28: __fastunpackd1_28(in,out,base); return;
+        case 29: __fastunpackd1_29(in,out,base); return;
+        case 30: __fastunpackd1_30(in,out,base); return;
+        case 31: __fastunpackd1_31(in,out,base); return;
+        case 32: __fastunpackd1_32(in,out,base); return;
+        default: break;
+    }
+    throw logic_error("number of bits is unsupported");
+}
@@ -19,6 +19,9 @@ void message(const char * prog) {
     cerr << "The -nodelta flag disables delta coding." << endl;
     cerr << "The -minlength ignores all arrays smaller than a threshold."
             << endl;
+    cerr << "The -exact flag counts every distinct value (EntropyRecorder) "
+        "instead of estimating the entropy in bounded memory (EntropySketch)."
+            << endl;
 }
 
 int main(int argc, char **argv) {
@@ -30,6 +33,7 @@ int main(int argc, char **argv) {
     enum{DELTA,NODELTA};
     int mode = DELTA;
     uint32_t MINLENGTH = 2;
+    bool exact = false;
     int argindex = 1;
     while (true) {
         if (strcmp(argv[argindex], "-minlength") == 0) {
@@ -38,6 +42,9 @@ int main(int argc, char **argv) {
         } else if (strcmp(argv[argindex], "-nodelta") == 0) {
             mode = NODELTA;
             ++argindex;
+        } else if (strcmp(argv[argindex], "-exact") == 0) {
+            exact = true;
+            ++argindex;
         } else
             break;
     }
@@ -52,12 +59,16 @@ int main(int argc, char **argv) {
     size_t counter = 0;
     size_t integers = 0;
     EntropyRecorder er;
+    EntropySketch es;
     while (reader.loadIntegers(rawdata)) {
         if (rawdata.size() < MINLENGTH)
             continue;
         if(mode == DELTA)
             Delta::delta(&rawdata[0],rawdata.size());
-        er.eat(&rawdata[0],rawdata.size());
+        if (exact)
+            er.eat(&rawdata[0],rawdata.size());
+        else
+            es.eat(&rawdata[0],rawdata.size());
         ++counter;
         integers += rawdata.size();
         if (counter >= MAXCOUNTER) {
@@ -69,7 +80,14 @@ int main(int argc, char **argv) {
     cout << "# integers = " << integers << endl;
     cout << "# arrays = " << counter << endl;
     cout << "# next line is shannon entropy and data bits" << endl;
-    cout << er.computeShannon() << "\t" << er.computeDataBits() <<endl;
+    if (exact) {
+        cout << er.computeShannon() << "\t" << er.computeDataBits() <<endl;
+    } else {
+        cout << es.computeShannon() << "\t" << es.computeDataBits() <<endl;
+        if (es.samplingLevel() > 0)
+            cout << "# estimated, the standard error of the entropy is "
+                    << es.shannonStandardError() << endl;
+    }
 }
 
 
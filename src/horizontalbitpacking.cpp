@@ -15,7 +15,7 @@
  * Optimized for a recent Intel core i7 processor by D. Lemire on Oct. 2012.
  */
 
-#ifndef __SSE4_1__
+#if !defined(__SSE4_1__) && !defined(__aarch64__)
 #pragma message "Disabling horizontal bit unpacking due to lack of SSSE4.1 support, try adding -msse4.1"
 #else
 #include "horizontalbitpacking.h"
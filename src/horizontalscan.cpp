@@ -0,0 +1,320 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * Scans of horizontally packed integers (see HorizontalScanCodec in
+ * horizontalscan.h), after
+ *
+ * Willhalm T, Popovici N, Boshmaf Y, Plattner H, Zeier A, Schaffner J.
+ * SIMD-scan: ultra fast in-memory table scan using on-chip vector processing units.
+ * Proceedings of the VLDB Endowment Aug 2009; 2(1):385-394.
+ *
+ * Eight consecutive integers of bit bits take exactly bit bytes. We load
+ * the 16 bytes holding the first four and the 16 bytes holding the last
+ * four, move the 4 bytes holding each integer to its own 32-bit lane
+ * (pshufb), shift each lane by its own amount (a multiplication by a
+ * power of two with SSE4.1, vpsrlvd with AVX2: then all eight integers
+ * are in one 256-bit register) and mask. The predicate is evaluated on
+ * the lanes with compares and movemask gives the eight bits of the bitmap.
+ * As 4 bytes hold at most 25 bits past a shift of up to 7, wider integers
+ * are scanned one at a time.
+ *
+ * This file is compiled with -msse4.1 and, for the avx2 namespace, with
+ * -mavx2 (see horizontalscan_avx2.cpp). A function defined in a header
+ * and not inlined would be emitted with -mavx2 as well and the linker
+ * could keep that copy for baseline code: we only call what is defined in
+ * the namespace and static functions (horizontalExtract); the predicate
+ * comes as ScanConstants rather than with its std::vector.
+ */
+#include "scanpredicate.h"
+
+#ifdef HORIZONTALSCAN_NAMESPACE
+namespace HORIZONTALSCAN_NAMESPACE {
+#endif
+
+namespace {
+
+enum {
+    MaxSIMDBits = 25
+};
+
+/**
+ * Where the integers of a group of eight are: the second half starts
+ * hibyte bytes after the first one, lane k of half h gets the bytes
+ * shuffle[h] selects and is shifted right by shift[h] (for SSE4.1, we
+ * multiply by 2^(7 - shift) and shift right by 7).
+ */
+struct GroupLayout {
+    explicit GroupLayout(const uint32_t b) :
+        hibyte(4 * b / 8), shuffle(), shift(), multiplier() {
+        for (uint32_t h = 0; h < 2; ++h) {
+            const uint32_t r = h == 0 ? 0 : 4 * b % 8;
+            uint8_t bytes[16];
+            uint32_t shifts[4], multipliers[4];
+            for (uint32_t k = 0; k < 4; ++k) {
+                const uint32_t bitpos = k * b + r;
+                for (uint32_t t = 0; t < 4; ++t)
+                    bytes[4 * k + t] = static_cast<uint8_t> (bitpos / 8 + t);
+                shifts[k] = bitpos % 8;
+                multipliers[k] = 1U << (7 - bitpos % 8);
+            }
+            memcpy(&shuffle[h], bytes, sizeof(bytes));
+            memcpy(&shift[h], shifts, sizeof(shifts));
+            memcpy(&multiplier[h], multipliers, sizeof(multipliers));
+        }
+    }
+    uint32_t hibyte;
+    __m128i shuffle[2];
+    __m128i shift[2];
+    __m128i multiplier[2];
+};
+
+#ifdef __AVX2__
+// the eight integers of a group
+typedef __m256i Group;
+
+inline Group loadGroup(const uint8_t * p, const GroupLayout & L, const __m256i shuffle,
+        const __m256i shift, const __m256i mask) {
+    __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(
+            reinterpret_cast<const __m128i *> (p))), _mm_loadu_si128(
+            reinterpret_cast<const __m128i *> (p + L.hibyte)), 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    return _mm256_and_si256(_mm256_srlv_epi32(v, shift), mask);
+}
+
+inline Group set1(const int32_t x) {
+    return _mm256_set1_epi32(x);
+}
+inline Group cmpeq(const Group a, const Group b) {
+    return _mm256_cmpeq_epi32(a, b);
+}
+inline Group cmpgt(const Group a, const Group b) {
+    return _mm256_cmpgt_epi32(a, b);
+}
+inline Group andGroups(const Group a, const Group b) {
+    return _mm256_and_si256(a, b);
+}
+inline Group orGroups(const Group a, const Group b) {
+    return _mm256_or_si256(a, b);
+}
+inline uint32_t movemask(const Group a) {
+    return static_cast<uint32_t> (_mm256_movemask_ps(_mm256_castsi256_ps(a)));
+}
+inline void storeGroup(uint32_t * out, const Group a) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *> (out), a);
+}
+
+// what loadGroup needs, in registers
+struct GroupDecoder {
+    GroupDecoder(const uint32_t b) :
+        L(b), shuffle(_mm256_setr_m128i(L.shuffle[0], L.shuffle[1])), shift(
+                _mm256_setr_m128i(L.shift[0], L.shift[1])), mask(_mm256_set1_epi32(
+                static_cast<int> ((1U << b) - 1))) {
+    }
+    Group operator()(const uint8_t * p) const {
+        return loadGroup(p, L, shuffle, shift, mask);
+    }
+    GroupLayout L;
+    __m256i shuffle;
+    __m256i shift;
+    __m256i mask;
+};
+#else
+struct Group {
+    __m128i lo;
+    __m128i hi;
+};
+
+inline Group set1(const int32_t x) {
+    const Group answer = { _mm_set1_epi32(x), _mm_set1_epi32(x) };
+    return answer;
+}
+inline Group cmpeq(const Group a, const Group b) {
+    const Group answer = { _mm_cmpeq_epi32(a.lo, b.lo), _mm_cmpeq_epi32(a.hi, b.hi) };
+    return answer;
+}
+inline Group cmpgt(const Group a, const Group b) {
+    const Group answer = { _mm_cmpgt_epi32(a.lo, b.lo), _mm_cmpgt_epi32(a.hi, b.hi) };
+    return answer;
+}
+inline Group andGroups(const Group a, const Group b) {
+    const Group answer = { _mm_and_si128(a.lo, b.lo), _mm_and_si128(a.hi, b.hi) };
+    return answer;
+}
+inline Group orGroups(const Group a, const Group b) {
+    const Group answer = { _mm_or_si128(a.lo, b.lo), _mm_or_si128(a.hi, b.hi) };
+    return answer;
+}
+inline uint32_t movemask(const Group a) {
+    return static_cast<uint32_t> (_mm_movemask_ps(_mm_castsi128_ps(a.lo)) | (_mm_movemask_ps(
+            _mm_castsi128_ps(a.hi)) << 4));
+}
+inline void storeGroup(uint32_t * out, const Group a) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *> (out), a.lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *> (out + 4), a.hi);
+}
+
+struct GroupDecoder {
+    GroupDecoder(const uint32_t b) :
+        L(b), mask(_mm_set1_epi32(static_cast<int> ((1U << b) - 1))) {
+    }
+    __m128i half(const uint8_t * p, const uint32_t h) const {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *> (p)),
+                L.shuffle[h]);
+        return _mm_and_si128(_mm_srli_epi32(_mm_mullo_epi32(v, L.multiplier[h]), 7), mask);
+    }
+    Group operator()(const uint8_t * p) const {
+        const Group answer = { half(p, 0), half(p + L.hibyte, 1) };
+        return answer;
+    }
+    GroupLayout L;
+    __m128i mask;
+};
+#endif
+
+// as std::min, which we do not instantiate here (see the top of the file)
+inline uint32_t smaller(const uint32_t x, const uint32_t y) {
+    return x < y ? x : y;
+}
+
+/**
+ * The predicate with its constants clamped to [0, 2^b], so that the
+ * signed compares are right (the integers are below 2^MaxSIMDBits).
+ * The values of In are compared as they are: a value of b bits or more
+ * never equals a lane.
+ */
+struct GroupPredicate {
+    GroupPredicate(const ScanConstants & p, const uint32_t b) :
+        a(), c(), values(p.values), howmany(p.howmany) {
+        const uint32_t top = 1U << b;
+        switch (p.op) {
+        case ScanPredicate::Equal:
+            a = set1(p.lo < top ? static_cast<int32_t> (p.lo) : -1);
+            break;
+        case ScanPredicate::Less:
+            a = set1(static_cast<int32_t> (smaller(p.lo, top)));
+            break;
+        case ScanPredicate::Between:
+            if (p.lo > p.hi) {// nothing
+                a = set1(0);
+                c = set1(0);
+            } else {// lo - 1 < value < hi + 1
+                a = set1(static_cast<int32_t> (smaller(p.lo, top)) - 1);
+                c = set1(static_cast<int32_t> (smaller(p.hi, top - 1)) + 1);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    Group a;
+    Group c;
+    const uint32_t * values;// broadcast as we go (a load, at worst)
+    size_t howmany;
+private:
+    GroupPredicate(const GroupPredicate &);
+    GroupPredicate & operator=(const GroupPredicate &);
+};
+
+template<int OP>
+inline uint32_t evaluate(const Group v, const GroupPredicate & g) {
+    if (OP == ScanPredicate::Equal)
+        return movemask(cmpeq(v, g.a));
+    if (OP == ScanPredicate::Less)
+        return movemask(cmpgt(g.a, v));
+    if (OP == ScanPredicate::Between)
+        return movemask(andGroups(cmpgt(v, g.a), cmpgt(g.c, v)));
+    Group m = set1(0);
+    for (size_t k = 0; k < g.howmany; ++k)
+        m = orGroups(m, cmpeq(v, set1(static_cast<int32_t> (g.values[k]))));
+    return movemask(m);
+}
+
+// one byte of the bitmap per group of eight integers
+template<int OP>
+void scanGroups(const uint8_t * packed, const size_t groups, const uint32_t b,
+        const GroupPredicate & g, uint8_t * bitmap) {
+    const GroupDecoder decode(b);
+    for (size_t j = 0; j < groups; ++j, packed += b)
+        bitmap[j] = static_cast<uint8_t> (evaluate<OP> (decode(packed), g));
+}
+
+// ScanPredicate::matches, for the integers past the groups
+bool matches(const ScanConstants & p, const uint32_t v) {
+    switch (p.op) {
+    case ScanPredicate::Equal:
+        return v == p.lo;
+    case ScanPredicate::Less:
+        return v < p.lo;
+    case ScanPredicate::Between:
+        return (p.lo <= v) && (v <= p.hi);
+    default:
+        for (size_t k = 0; k < p.howmany; ++k)
+            if (p.values[k] == v)
+                return true;
+        return false;
+    }
+}
+
+}// namespace
+
+void horizontalScan(const uint32_t * packed, const size_t length, const uint32_t bit,
+        const ScanConstants & p, uint64_t * bitmap) {
+    const size_t words = (length + 63) / 64;
+    uint8_t * const bytes = reinterpret_cast<uint8_t *> (bitmap);
+    size_t done = 0;
+    if (bit == 0) {
+        memset(bitmap, matches(p, 0) ? 0xFF : 0, words * sizeof(uint64_t));
+        done = length;
+    } else if (bit <= MaxSIMDBits) {
+        const size_t groups = length / 8;
+        const GroupPredicate g(p, bit);
+        const uint8_t * const in = reinterpret_cast<const uint8_t *> (packed);
+        switch (p.op) {
+        case ScanPredicate::Equal:
+            scanGroups<ScanPredicate::Equal> (in, groups, bit, g, bytes);
+            break;
+        case ScanPredicate::Less:
+            scanGroups<ScanPredicate::Less> (in, groups, bit, g, bytes);
+            break;
+        case ScanPredicate::Between:
+            scanGroups<ScanPredicate::Between> (in, groups, bit, g, bytes);
+            break;
+        default:
+            scanGroups<ScanPredicate::In> (in, groups, bit, g, bytes);
+        }
+        memset(bytes + groups, 0, words * sizeof(uint64_t) - groups);
+        done = 8 * groups;
+    } else {
+        memset(bitmap, 0, words * sizeof(uint64_t));
+    }
+    for (size_t i = done; i < length; ++i)
+        if (matches(p, horizontalExtract(packed, bit, i)))
+            bitmap[i / 64] |= static_cast<uint64_t> (1) << (i % 64);
+    // the padding of the last word
+    if ((bit == 0) && (length % 64 != 0))
+        bitmap[words - 1] &= (static_cast<uint64_t> (1) << (length % 64)) - 1;
+}
+
+void horizontalUnpack(const uint32_t * packed, const size_t length, const uint32_t bit,
+        uint32_t * out) {
+    size_t done = 0;
+    if (bit == 0) {
+        memset(out, 0, length * sizeof(uint32_t));
+        done = length;
+    } else if (bit <= MaxSIMDBits) {
+        const GroupDecoder decode(bit);
+        const uint8_t * in = reinterpret_cast<const uint8_t *> (packed);
+        for (; done + 8 <= length; done += 8, in += bit)
+            storeGroup(out + done, decode(in));
+    }
+    for (size_t i = done; i < length; ++i)
+        out[i] = horizontalExtract(packed, bit, i);
+}
+
+#ifdef HORIZONTALSCAN_NAMESPACE
+}
+#endif
@@ -0,0 +1,13 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * The scans of horizontalscan.cpp, compiled with -mavx2 in the avx2
+ * namespace: the eight integers of a group go to one 256-bit register.
+ * HorizontalScanCodec selects them at runtime.
+ */
+#define HORIZONTALSCAN_NAMESPACE avx2
+#include "horizontalscan.cpp"
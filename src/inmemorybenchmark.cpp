@@ -13,19 +13,35 @@
 #include "cpubenchmark.h"
 #include "deltautil.h"
 #include "stringutil.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 
 
 using namespace std;
 
 static struct option long_options[] = {
-        { "codecs", required_argument, 0, 'c' },{ "minlength", required_argument, 0, 'm' },{ "maxlength", required_argument, 0, 'M' }, { "splitlongarrays", no_argument, 0, 'S' },{ 0, 0, 0, 0 } };
+        { "codecs", required_argument, 0, 'c' },{ "minlength", required_argument, 0, 'm' },{ "maxlength", required_argument, 0, 'M' }, { "splitlongarrays", no_argument, 0, 'S' },{ "perfcounters", no_argument, 0, 'P' },{ "latencies", no_argument, 0, 'L' },{ "threads", required_argument, 0, 'T' },{ "pin", no_argument, 0, 'p' },{ "hugepages", required_argument, 0, 'H' },{ "numa", required_argument, 0, 'N' },{ 0, 0, 0, 0 } };
 
 void message(const char * prog) {
     cerr << " usage : " << prog << " scheme  maropubinaryfile " << endl;
     cerr << "By default, it assumes that the original data is made of "
         "sorted distinct integers." << endl;
     cerr << "Use the --codecs flag to specify the schemes." << endl;
+    cerr << "Use the --perfcounters flag to get hardware counters (Linux)." << endl;
+    cerr << "Use the --latencies flag to get the percentiles of the decoding time"
+            " of each array, by array length." << endl;
+    cerr << "Use the --threads N flag to code on N threads at once, each with its own"
+            " arrays and codec (add --pin to pin thread t to core t, Linux); the arrays"
+            " must then be sorted, without --perfcounters and --latencies." << endl;
+    cerr << "Use the --hugepages thp|2mb|1gb flag to put the blocks on huge pages and"
+            " the --numa local|interleave|N flag to place them on NUMA nodes (Linux,"
+            " see MemoryPolicy)." << endl;
     cerr << " schemes include:" << endl;
     vector < string > all = CODECFactory::allNames();
     for (auto i = all.begin(); i != all.end(); ++i) {
@@ -34,6 +50,201 @@ void message(const char * prog) {
 
 }
 
+/**
+ * Lets the threads start each phase at the same time.
+ */
+class Barrier {
+public:
+    Barrier(size_t n) :
+        mutex_(), cond(), count(n), waiting(0), generation(0) {
+    }
+    void wait() {
+        unique_lock<mutex> lock(mutex_);
+        const size_t gen = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            ++generation;
+            cond.notify_all();
+        } else
+            cond.wait(lock, [&] {return gen != generation;});
+    }
+private:
+    mutex mutex_;
+    condition_variable cond;
+    const size_t count;
+    size_t waiting;
+    size_t generation;
+};
+
+/**
+ * Results of the --threads mode for one scheme, summed over the blocks: the
+ * elapsed time of each thread (microseconds) and its number of integers.
+ * The wall clock times go from the start to the last thread to finish.
+ */
+struct threadedstats {
+    threadedstats(size_t threads) :
+        comptime(threads), decomptime(threads), integers(threads),
+                wallcomptime(0), walldecomptime(0), output(0) {
+    }
+    vector<double> comptime, decomptime, integers;
+    double wallcomptime, walldecomptime;
+    double output;// compressed words
+};
+
+void pinThread(size_t t) {
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(t % max<size_t> (1, thread::hardware_concurrency()), &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0)
+        cerr << "# could not pin thread " << t << endl;
+#else
+    (void) t;
+#endif
+}
+
+/**
+ * The arrays are dealt to the threads (largest first, to the thread with the
+ * fewest integers) and each thread copies its own arrays, so that, pinned,
+ * its memory is allocated on its NUMA node (first touch). Then all threads
+ * encode at the same time, and decode at the same time, each with its own
+ * clone of the codec. The arrays must be sorted (delta coding): there is no
+ * zigzag fallback, and no hardware counters or latencies, in this mode.
+ */
+void processThreads(vector<algostats> & myalgos, vector<threadedstats> & stats,
+        const vector<vector<uint32_t, cacheallocator> > & datas,
+        const size_t threads, const bool pin) {
+    typedef vector<uint32_t, cacheallocator> container;
+    vector<size_t> order(datas.size());
+    for (size_t k = 0; k < order.size(); ++k)
+        order[k] = k;
+    sort(order.begin(), order.end(), [&](size_t x, size_t y) {
+        return datas[x].size() > datas[y].size();});
+    vector<vector<size_t> > partitions(threads);
+    vector<size_t> load(threads);
+    for (size_t k : order) {
+        if (datas[k].empty())
+            continue;
+        const size_t t = min_element(load.begin(), load.end()) - load.begin();
+        partitions[t].push_back(k);
+        load[t] += datas[k].size();
+    }
+    // for each scheme and each thread
+    vector<vector<double> > comptime(myalgos.size(), vector<double> (threads));
+    vector<vector<double> > decomptime(myalgos.size(), vector<double> (threads));
+    vector<vector<size_t> > compressed(myalgos.size(), vector<size_t> (threads));
+    vector<exception_ptr> errors(threads);
+    Barrier barrier(threads);
+    auto work = [&](size_t t) {
+        // on error, the thread keeps meeting the others at the barrier
+        vector<container> mydatas;
+        try {
+            if (pin)
+                pinThread(t);
+            for (size_t k : partitions[t])
+                mydatas.push_back(datas[k]);
+        } catch (...) {
+            errors[t] = current_exception();
+        }
+        vector<container> outs(mydatas.size());
+        vector<size_t> nvalues(mydatas.size());
+        // all arrays are decoded, then checked, so that the checks are not timed
+        vector<container> recovereds(mydatas.size());
+        try {
+            for (size_t k = 0; k < mydatas.size(); ++k)
+                recovereds[k].resize(mydatas[k].size() + 2048);
+        } catch (...) {
+            errors[t] = current_exception();
+        }
+        WallClockTimer z;
+        for (size_t a = 0; a < myalgos.size(); ++a) {
+            shared_ptr<IntegerCODEC> codec;
+            const bool SIMDDeltas = myalgos[a].SIMDDeltas;
+            try {
+                if (!errors[t]) {
+                    codec = myalgos[a].algo->clone();
+                    for (size_t k = 0; k < mydatas.size(); ++k)
+                        outs[k].resize(codec->maxCompressedWords(mydatas[k].size()));
+                }
+            } catch (...) {
+                errors[t] = current_exception();
+            }
+            barrier.wait();
+            z.reset();
+            try {
+                for (size_t k = 0; (k < mydatas.size()) && !errors[t]; ++k) {
+                    nvalues[k] = outs[k].size();
+                    const uint32_t * const in = mydatas[k].data();// not modified
+                    Delta::encode(*codec, SIMDDeltas, in, mydatas[k].size(),
+                            outs[k].data(), nvalues[k]);
+                    compressed[a][t] += nvalues[k];
+                }
+            } catch (...) {
+                errors[t] = current_exception();
+            }
+            comptime[a][t] = static_cast<double> (z.split());
+            barrier.wait();
+            z.reset();
+            vector<size_t> recoveredsizes(mydatas.size());
+            try {
+                for (size_t k = 0; (k < mydatas.size()) && !errors[t]; ++k) {
+                    recoveredsizes[k] = recovereds[k].size();
+                    Delta::decode(*codec, SIMDDeltas, outs[k].data(), nvalues[k],
+                            recovereds[k].data(), recoveredsizes[k]);
+                }
+            } catch (...) {
+                errors[t] = current_exception();
+            }
+            decomptime[a][t] = static_cast<double> (z.split());
+            for (size_t k = 0; (k < mydatas.size()) && !errors[t]; ++k)
+                if ((recoveredsizes[k] != mydatas[k].size()) || !equal(mydatas[k].begin(),
+                        mydatas[k].end(), recovereds[k].begin()))
+                    errors[t] = make_exception_ptr(logic_error("we have a bug with "
+                            + myalgos[a].name()));
+        }
+    };
+    vector<thread> workers;
+    for (size_t t = 1; t < threads; ++t)
+        workers.push_back(thread(work, t));
+    work(0);
+    for (size_t t = 0; t < workers.size(); ++t)
+        workers[t].join();
+    for (size_t t = 0; t < threads; ++t)
+        if (errors[t])
+            rethrow_exception(errors[t]);
+    for (size_t a = 0; a < myalgos.size(); ++a) {
+        stats[a].wallcomptime += *max_element(comptime[a].begin(), comptime[a].end());
+        stats[a].walldecomptime += *max_element(decomptime[a].begin(), decomptime[a].end());
+        for (size_t t = 0; t < threads; ++t) {
+            stats[a].comptime[t] += comptime[a][t];
+            stats[a].decomptime[t] += decomptime[a][t];
+            stats[a].integers[t] += static_cast<double> (load[t]);
+            stats[a].output += static_cast<double> (compressed[a][t]);
+        }
+    }
+}
+
+/**
+ * Aggregate speeds (all integers over the wall clock time) and, for each
+ * thread, its own decompression speed, in millions of integers per second.
+ */
+void summarizeThreads(vector<algostats> & myalgos, const vector<threadedstats> & stats) {
+    const size_t threads = stats.empty() ? 0 : stats[0].integers.size();
+    cout << "# aggregate compression speed, decompression speed and bits per integer "
+            "on " << threads << " threads, then the decompression speed of each thread"
+            << endl;
+    for (size_t a = 0; a < myalgos.size(); ++a) {
+        const threadedstats & s = stats[a];
+        const double input = accumulate(s.integers.begin(), s.integers.end(), 0.0);
+        cout << " " << std::setprecision(4) << myalgos[a].name(40) << " \t " << input
+                / s.wallcomptime << " \t " << input / s.walldecomptime << " \t "
+                << s.output * 32.0 / input;
+        for (size_t t = 0; t < threads; ++t)
+            cout << " \t " << s.integers[t] / s.decomptime[t];
+        cout << endl;
+    }
+}
+
 int main(int argc, char **argv) {
     size_t MAXCOUNTER = std::numeric_limits<std::size_t>::max();
     if (argc < 2) {
@@ -41,6 +252,10 @@ int main(int argc, char **argv) {
         return -1;
     }
     bool splitlongarrays = true;
+    bool perfcounters = false;
+    bool latencies = false;
+    size_t threads = 0;// 0: the single-threaded benchmark
+    bool pin = false;
     size_t MINLENGTH = 1;
     size_t MAXLENGTH =  std::numeric_limits<uint32_t>::max();
     vector < shared_ptr<IntegerCODEC> > tmp = CODECFactory::allSchemes();// the default
@@ -52,7 +267,7 @@ int main(int argc, char **argv) {
     int c;
     while (1) {
         int option_index = 0;
-        c = getopt_long(argc, argv, "Sc:", long_options, &option_index);
+        c = getopt_long(argc, argv, "SPLpT:c:H:N:", long_options, &option_index);
         if (c == -1)
             break;
         switch (c) {
@@ -60,6 +275,47 @@ int main(int argc, char **argv) {
              cout<<"#\n# disabling partition of big arrays. Performance may suffer.#\n"<<endl;
              splitlongarrays = false;
              break;
+        case 'P' :
+             perfcounters = true;
+             break;
+        case 'L' :
+             latencies = true;
+             break;
+        case 'T' :
+            istringstream ( optarg ) >> threads;
+             cout<<"# threads = "<<threads<<endl;
+             break;
+        case 'p' :
+             pin = true;
+             break;
+        case 'H' :
+        {   const string pages(optarg);
+            if (pages == "thp")
+                memoryPolicy().pages = MemoryPolicy::TransparentHugePages;
+            else if (pages == "2mb")
+                memoryPolicy().pages = MemoryPolicy::HugePages2MB;
+            else if (pages == "1gb")
+                memoryPolicy().pages = MemoryPolicy::HugePages1GB;
+            else {
+                cerr << "unrecognized huge pages: " << pages << endl;
+                return -1;
+            }
+            cout << "# huge pages = " << pages << endl;
+        }
+             break;
+        case 'N' :
+        {   const string placement(optarg);
+            if (placement == "local")
+                memoryPolicy().placement = MemoryPolicy::LocalNode;
+            else if (placement == "interleave")
+                memoryPolicy().placement = MemoryPolicy::Interleaved;
+            else {
+                memoryPolicy().placement = MemoryPolicy::BoundNode;
+                istringstream ( placement ) >> memoryPolicy().node;
+            }
+            cout << "# NUMA placement = " << placement << endl;
+        }
+             break;
         case 'm' :
             istringstream ( optarg ) >> MINLENGTH;
              cout<<"# MINLENGTH = "<<MINLENGTH<<endl;
@@ -100,41 +356,43 @@ int main(int argc, char **argv) {
         return -1;
     }
     string filename = argv[optind];
+    if ((threads > 0) && (perfcounters || latencies)) {
+        cerr << "--perfcounters and --latencies are not supported with --threads" << endl;
+        return -1;
+    }
 
     cout << "# parsing " << filename << endl;
-    MaropuGapReader reader(filename);
-
-    vector<uint32_t, cacheallocator> rawdata;
-    reader.open();
-    size_t counter = 0;
     const size_t MAXBLOCKSIZE = 104857600;// 400 MB
-    while (counter < MAXCOUNTER) {
-        // collecting the data up to MAXBLOCKSIZE integers
-        vector < vector<uint32_t, cacheallocator> > datas;
+    // the next block is read (from the mapped file) while we process this one
+    MaropuBlockReader reader(filename, MAXBLOCKSIZE, MINLENGTH, MAXLENGTH, MAXCOUNTER);
+    vector < vector<uint32_t, cacheallocator> > datas;
+    vector<threadedstats> stats(myalgos.size(), threadedstats(threads));
+    while (reader.nextBlock(datas)) {
         size_t datastotalsize = 0;
-	    cout<<"# Filling up a block "<<endl;
-        while (reader.loadIntegers(rawdata)) {
-            if ((rawdata.size() < MINLENGTH) or (rawdata.size() > MAXLENGTH))
-                continue;
-            ++counter;
-            datastotalsize += rawdata.size();
-            datas.push_back(rawdata);
-            if (counter >= MAXCOUNTER) {
-                cout << "#breaking early" << endl;
-                break;
-            }
-            if (datastotalsize >= MAXBLOCKSIZE)
-                break;
-        }
-        if(datastotalsize == 0) break;
+        for (size_t k = 0; k < datas.size(); ++k)
+            datastotalsize += datas[k].size();
         cout<<"# read "<<  std::setprecision(3)  << datastotalsize * 4 / (1024.0 * 1024.0) << " MB "<<endl;
 	cout<<"# processing block"<<endl;
 	    if(splitlongarrays) splitLongArrays(datas);
-	    processparameters pp(true,false, false, false, true);
+	    if(threads > 0) {
+	        for (size_t k = 0; k < datas.size(); ++k)
+	            if (!is_sorted(datas[k].begin(), datas[k].end())) {
+	                cerr << "the arrays must be sorted with --threads" << endl;
+	                return -1;
+	            }
+	        processThreads(myalgos, stats, datas, threads, pin);
+	        continue;
+	    }
+	    processparameters pp(true,false, false, false, true, perfcounters, latencies);
 	    Delta::process(myalgos, datas, pp);        // done collecting data, now allocating memory
     }
-    reader.close();
     cout<<"# build summary..."<<endl;
-    summarize(myalgos);
-
+    if(threads > 0)
+        summarizeThreads(myalgos, stats);
+    else
+        summarize(myalgos);
+#ifdef CODEC_STATS
+    cout << "# codec statistics (all the schemes together)" << endl;
+    codeccounters::snapshot().display("# ");
+#endif
 }
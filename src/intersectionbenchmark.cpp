@@ -0,0 +1,161 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+#include <getopt.h>
+#include "common.h"
+#include "intersection.h"
+#include "maropuparser.h"
+#include "synthetic.h"
+#include "ztimer.h"
+
+using namespace std;
+
+static struct option long_options[] = {
+        { "codec", required_argument, 0, 'c' }, { "pairs", required_argument, 0, 'p' },
+        { "length", required_argument, 0, 'N' },{ 0, 0, 0, 0 } };
+
+void message(const char * prog) {
+    cerr << " usage : " << prog << " [--codec simdbinarypacking|simdfastpfor]"
+        " [--pairs 100] [--length 1000000] [maropubinaryfile]" << endl;
+    cerr << "Compares intersection strategies over compressed sorted lists." << endl;
+    cerr << "Lists are read from the maropu file (consecutive pairs are "
+        "intersected), or generated with ClusteredDataGenerator." << endl;
+}
+
+typedef vector<uint32_t, cacheallocator> list_t;
+
+template<class CODEC>
+void benchmark(const vector<pair<list_t, list_t> > & pairs) {
+    typedef DeltaSkipIndex<CODEC> SkipIndex;
+    SkipIndex dsi;
+    CompressedIntersection<CODEC> ci(dsi);
+    vector<list_t> compressed;
+    size_t maxlength = 0;
+    for (size_t k = 0; k < pairs.size(); ++k) {
+        const list_t * both[2] = { &pairs[k].first, &pairs[k].second };
+        for (int w = 0; w < 2; ++w) {
+            list_t out(both[w]->size() * 2 + 1024);
+            size_t nvalue = out.size();
+            dsi.encodeArray(both[w]->data(), both[w]->size(), out.data(), nvalue);
+            out.resize(nvalue);
+            compressed.push_back(out);
+            maxlength = max(maxlength, both[w]->size());
+        }
+    }
+    list_t A(maxlength + 4), B(maxlength + 4), result(maxlength + 4);
+    size_t checksum[3] = { 0, 0, 0 };
+    uint64_t timings[3] = { 0, 0, 0 };
+    WallClockTimer z;
+    for (size_t k = 0; k < pairs.size(); ++k) {
+        const uint32_t * ca = compressed[2 * k].data();
+        const uint32_t * cb = compressed[2 * k + 1].data();
+        size_t na = A.size(), nb = B.size();
+        // decode everything, then std::set_intersection
+        z.reset();
+        dsi.decodeArray(ca, 0, A.data(), na);
+        dsi.decodeArray(cb, 0, B.data(), nb);
+        const size_t c0 = set_intersection(A.begin(), A.begin() + na, B.begin(),
+                B.begin() + nb, result.begin()) - result.begin();
+        timings[0] += z.split();
+        checksum[0] += c0;
+        // decode everything, then SIMD intersection
+        z.reset();
+        na = A.size();
+        nb = B.size();
+        dsi.decodeArray(ca, 0, A.data(), na);
+        dsi.decodeArray(cb, 0, B.data(), nb);
+        const size_t c1 = intersectArrays(A.data(), na, B.data(), nb, result.data());
+        timings[1] += z.split();
+        checksum[1] += c1;
+        // intersection in the compressed domain
+        z.reset();
+        const size_t c2 = ci.intersect(ca, cb, result.data());
+        timings[2] += z.split();
+        checksum[2] += c2;
+        if ((c0 != c1) || (c0 != c2))
+            throw runtime_error("bug: the intersections do not match");
+    }
+    size_t totalin = 0;
+    for (size_t k = 0; k < pairs.size(); ++k)
+        totalin += pairs[k].first.size() + pairs[k].second.size();
+    const char * names[3] = { "decode+std::set_intersection",
+            "decode+SIMD intersection", "compressed intersection" };
+    cout << "# " << dsi.name() << " total input integers = " << totalin
+            << " total output = " << checksum[0] << endl;
+    for (int m = 0; m < 3; ++m)
+        cout << setw(30) << names[m] << "\t" << setw(10) << timings[m] << " us\t"
+                << setprecision(4) << static_cast<double> (totalin)
+                / static_cast<double> (timings[m] + 1) << " mis" << endl;
+}
+
+int main(int argc, char **argv) {
+    string codec("simdbinarypacking");
+    size_t numberofpairs = 100;
+    uint32_t N = 1000000;
+    int c;
+    while (1) {
+        int option_index = 0;
+        c = getopt_long(argc, argv, "c:p:N:", long_options, &option_index);
+        if (c == -1)
+            break;
+        switch (c) {
+        case 'c':
+            codec = optarg;
+            break;
+        case 'p':
+            istringstream(optarg) >> numberofpairs;
+            break;
+        case 'N':
+            istringstream(optarg) >> N;
+            break;
+        default:
+            message(argv[0]);
+            return -1;
+        }
+    }
+    vector<vector<pair<list_t, list_t> > > workloads;
+    vector<string> labels;
+    if (optind < argc) {
+        MaropuGapReader reader(argv[optind]);
+        reader.open();
+        vector<pair<list_t, list_t> > pairs;
+        list_t first, second;
+        while ((pairs.size() < numberofpairs) && reader.loadIntegers(first)
+                && reader.loadIntegers(second)) {
+            pairs.push_back(make_pair(first, second));
+        }
+        reader.close();
+        labels.push_back(string("pairs from ") + argv[optind]);
+        workloads.push_back(pairs);
+    } else {
+        ClusteredDataGenerator cdg;
+        const uint32_t Max = 1U << 26;
+        const uint32_t ratios[] = { 1, 10, 100, 1000 };
+        for (size_t r = 0; r < sizeof(ratios) / sizeof(ratios[0]); ++r) {
+            vector<pair<list_t, list_t> > pairs;
+            const size_t howmany = max<size_t>(1, numberofpairs / 10);
+            for (size_t k = 0; k < howmany; ++k)
+                pairs.push_back(make_pair(cdg.generateClustered(max<uint32_t>(1, N / ratios[r]), Max),
+                        cdg.generateClustered(N, Max)));
+            ostringstream label;
+            label << "clustered, size ratio 1:" << ratios[r];
+            labels.push_back(label.str());
+            workloads.push_back(pairs);
+        }
+    }
+    for (size_t w = 0; w < workloads.size(); ++w) {
+        cout << "# " << labels[w] << endl;
+        if (codec == "simdbinarypacking")
+            benchmark<SIMDBinaryPacking> (workloads[w]);
+        else if (codec == "simdfastpfor")
+            benchmark<SIMDFastPFor> (workloads[w]);
+        else {
+            message(argv[0]);
+            return -1;
+        }
+    }
+    return 0;
+}
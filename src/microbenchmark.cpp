@@ -0,0 +1,316 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+
+/**
+ * Micro-benchmarks meant to be compared from one compiler or processor
+ * to the next: the cost in cycles per integer (CPUBenchmark) of
+ *
+ *    - the bit packing kernels, for each bit width (0 to 32),
+ *    - each codec of CODECFactory on each generator of synthetic.h.
+ *
+ * Each measure is repeated (after some warmup runs) and we report the
+ * median and the standard deviation, as CSV (default) or JSON. The sorted
+ * arrays (uniform, clustered) are delta coded first, except for the codecs
+ * that do the delta coding themselves (IntegerCODEC::codesDeltas), and
+ * only the codec is timed. The arrays are small enough (--length) to stay in cache.
+ */
+
+#include <getopt.h>
+#include <fstream>
+#include "codecfactory.h"
+#include "bitpackinghelpers.h"
+#include "simdbitpacking.h"
+#include "synthetic.h"
+#include "cpubenchmark.h"
+#include "stringutil.h"
+#include "deltautil.h"
+
+using namespace std;
+
+struct Measurement {
+    string kind;// "kernel" or "codec"
+    string name;
+    string dataset;
+    int bitwidth;// -1 for codecs
+    double bitsperint;
+    vector<double> encode;// cycles per integer, one per repetition
+    vector<double> decode;
+};
+
+struct Settings {
+    Settings() :
+        length(1U << 16), warmup(2), repetitions(11) {
+    }
+    uint32_t length;
+    uint32_t warmup;
+    uint32_t repetitions;
+};
+
+double median(vector<double> v) {
+    if (v.empty())
+        return 0;
+    sort(v.begin(), v.end());
+    const size_t h = v.size() / 2;
+    return v.size() % 2 == 1 ? v[h] : (v[h - 1] + v[h]) / 2;
+}
+
+double stddev(const vector<double> & v) {
+    if (v.size() < 2)
+        return 0;
+    const double mean = accumulate(v.begin(), v.end(), 0.0) / v.size();
+    double sum = 0;
+    for (double x : v)
+        sum += (x - mean) * (x - mean);
+    return sqrt(sum / (v.size() - 1));
+}
+
+// cycles per integer of f() over length integers, for each repetition
+template<class F>
+vector<double> cyclesPerInt(F f, const size_t length, const Settings & s) {
+    vector<double> answer;
+    for (uint32_t t = 0; t < s.warmup + s.repetitions; ++t) {
+        CPUBenchmark timer;
+        f();
+        const unsigned long long cycles = timer.stop();
+        if (t >= s.warmup)
+            answer.push_back(static_cast<double> (cycles) / length);
+    }
+    return answer;
+}
+
+void benchmarkKernels(const Settings & s, vector<Measurement> & results) {
+    const uint32_t N = s.length / 128 * 128;
+    vector<uint32_t, cacheallocator> data = generateArray32(N);
+    // one more word so that we can test the unaligned kernels on unaligned data
+    vector<uint32_t, cacheallocator> compressed(N + 1), recovered(N + 1);
+    for (uint32_t bit = 0; bit <= 32; ++bit) {
+        vector<uint32_t, cacheallocator> masked(data);
+        if (bit < 32)
+            for (uint32_t & x : masked)
+                x &= (1U << bit) - 1;
+        const uint32_t * const in = masked.data();
+        Measurement scalar { "kernel", "fastpack", "random", static_cast<int> (bit), 1.0 * bit, {}, {} };
+        scalar.encode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 32)
+                fastpack(in + k, compressed.data() + k / 32 * bit, bit);
+        }, N, s);
+        scalar.decode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 32)
+                fastunpack(compressed.data() + k / 32 * bit, recovered.data() + k, bit);
+        }, N, s);
+        if (!equal(masked.begin(), masked.end(), recovered.begin()))
+            throw logic_error("bug in fastpack/fastunpack");
+        results.push_back(scalar);
+
+        Measurement simd { "kernel", "simdpack", "random", static_cast<int> (bit), 1.0 * bit, {}, {} };
+        simd.encode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 128)
+                SIMD_fastpack_32(in + k, reinterpret_cast<__m128i *> (compressed.data() + k / 32 * bit), bit);
+        }, N, s);
+        simd.decode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 128)
+                SIMD_fastunpack_32(reinterpret_cast<const __m128i *> (compressed.data() + k / 32 * bit),
+                        recovered.data() + k, bit);
+        }, N, s);
+        if (!equal(masked.begin(), masked.end(), recovered.begin()))
+            throw logic_error("bug in SIMD_fastpack_32/SIMD_fastunpack_32");
+        results.push_back(simd);
+
+        Measurement unaligned { "kernel", "simdpackunaligned", "random", static_cast<int> (bit), 1.0 * bit, {}, {} };
+        unaligned.encode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 128)
+                SIMD_fastpack_32_unaligned(in + k, compressed.data() + 1 + k / 32 * bit, bit);
+        }, N, s);
+        unaligned.decode = cyclesPerInt([&]() {
+            for (uint32_t k = 0; k < N; k += 128)
+                SIMD_fastunpack_32_unaligned(compressed.data() + 1 + k / 32 * bit,
+                        recovered.data() + 1 + k, bit);
+        }, N, s);
+        if (!equal(masked.begin(), masked.end(), recovered.begin() + 1))
+            throw logic_error("bug in the unaligned SIMD kernels");
+        results.push_back(unaligned);
+    }
+}
+
+struct Dataset {
+    string name;
+    vector<uint32_t, cacheallocator> data;
+    // before delta coding, for the codecs that do it (empty if not sorted)
+    vector<uint32_t, cacheallocator> sorted;
+};
+
+// the generators of synthetic.h, with fixed seeds
+vector<Dataset> generateDatasets(const Settings & s) {
+    const uint32_t N = s.length;
+    vector<Dataset> answer;
+    UniformDataGenerator uniform(1);
+    ClusteredDataGenerator clustered(1);
+    answer.push_back(Dataset { "uniformsparse", uniform.generateUniform(N, 1U << 29), {} });
+    answer.push_back(Dataset { "uniformdense", uniform.generateUniform(N, 4 * N), {} });
+    answer.push_back(Dataset { "clustersparse", clustered.generateClustered(N, 1U << 29), {} });
+    answer.push_back(Dataset { "clusterdense", clustered.generateClustered(N, 4 * N), {} });
+    for (Dataset & d : answer) {
+        d.sorted = d.data;
+        Delta::delta(d.data.data(), d.data.size());
+    }
+    for (uint32_t power = 1; power <= 2; ++power) {
+        ZipfianGenerator zipf(1U << 20, power, 1);
+        vector<uint32_t, cacheallocator> v(N);
+        for (uint32_t & x : v)
+            x = zipf.nextInt();
+        answer.push_back(Dataset { "zipfian" + to_string(power), v, {} });
+    }
+    srand(1);
+    answer.push_back(Dataset { "random12bits", generateArray(N, (1U << 12) - 1), {} });
+    return answer;
+}
+
+void benchmarkCodecs(const Settings & s, const vector<string> & names,
+        vector<Measurement> & results) {
+    const vector<Dataset> datasets = generateDatasets(s);
+    for (const string & name : names) {
+        shared_ptr<IntegerCODEC> codec = CODECFactory::getFromName(name);
+        for (const Dataset & d : datasets) {
+            const vector<uint32_t, cacheallocator> & input = codec->codesDeltas()
+                    && !d.sorted.empty() ? d.sorted : d.data;
+            const size_t N = input.size();
+            vector<uint32_t, cacheallocator> compressed(codec->maxCompressedWords(N) + 1024);
+            vector<uint32_t, cacheallocator> recovered(N + 1024);
+            Measurement m { "codec", name, d.name, -1, 0, {}, {} };
+            size_t nvalue = 0;
+            m.encode = cyclesPerInt([&]() {
+                nvalue = compressed.size();
+                codec->encodeArray(input.data(), N, compressed.data(), nvalue);
+            }, N, s);
+            size_t recoveredsize = 0;
+            m.decode = cyclesPerInt([&]() {
+                recoveredsize = recovered.size();
+                codec->decodeArray(compressed.data(), nvalue, recovered.data(), recoveredsize);
+            }, N, s);
+            if ((recoveredsize != N) || !equal(input.begin(), input.end(), recovered.begin()))
+                throw logic_error("bug in " + codec->name() + " on " + d.name);
+            m.bitsperint = 32.0 * nvalue / N;
+            results.push_back(m);
+            cerr << "# " << name << " " << d.name << endl;
+        }
+    }
+}
+
+string machine() {
+    ostringstream convert;
+#ifdef __VERSION__
+    convert << "compiler " << __VERSION__ << ", ";
+#endif
+    convert << "kernels " << bestInstructionSet();
+    return convert.str();
+}
+
+void writeCSV(ostream & out, const vector<Measurement> & results) {
+    out << "# " << machine() << endl;
+    out << "# cycles per integer" << endl;
+    out << "kind,name,dataset,bitwidth,bitsperint,encode_median,encode_stddev,"
+            "decode_median,decode_stddev" << endl;
+    for (const Measurement & m : results)
+        out << m.kind << "," << m.name << "," << m.dataset << "," << m.bitwidth
+                << "," << m.bitsperint << "," << median(m.encode) << ","
+                << stddev(m.encode) << "," << median(m.decode) << ","
+                << stddev(m.decode) << endl;
+}
+
+void writeJSON(ostream & out, const vector<Measurement> & results) {
+    out << "{" << endl;
+    out << "  \"machine\": \"" << machine() << "\"," << endl;
+    out << "  \"unit\": \"cycles per integer\"," << endl;
+    out << "  \"results\": [" << endl;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Measurement & m = results[i];
+        out << "    {\"kind\": \"" << m.kind << "\", \"name\": \"" << m.name
+                << "\", \"dataset\": \"" << m.dataset << "\", \"bitwidth\": "
+                << m.bitwidth << ", \"bitsperint\": " << m.bitsperint
+                << ", \"encode_median\": " << median(m.encode)
+                << ", \"encode_stddev\": " << stddev(m.encode)
+                << ", \"decode_median\": " << median(m.decode)
+                << ", \"decode_stddev\": " << stddev(m.decode) << "}"
+                << (i + 1 < results.size() ? "," : "") << endl;
+    }
+    out << "  ]" << endl << "}" << endl;
+}
+
+void message(const char * prog) {
+    cerr << "usage: " << prog << " [--json] [--output file] [--length N]"
+            " [--warmup W] [--repetitions R] [--codecs a,b,...]"
+            " [--nokernels] [--nocodecs]" << endl;
+    cerr << "By default, all kernels and codecs are benchmarked and the"
+            " results are written as CSV to the standard output." << endl;
+}
+
+int main(int argc, char **argv) {
+    static struct option long_options[] = { { "json", no_argument, 0, 'j' }, {
+            "output", required_argument, 0, 'o' }, { "length", required_argument, 0, 'n' }, {
+            "warmup", required_argument, 0, 'w' }, { "repetitions", required_argument, 0, 'r' }, {
+            "codecs", required_argument, 0, 'c' }, { "nokernels", no_argument, 0, 'K' }, {
+            "nocodecs", no_argument, 0, 'C' }, { "help", no_argument, 0, 'h' }, { 0, 0, 0, 0 } };
+    Settings s;
+    bool json = false, kernels = true, codecs = true;
+    string output;
+    vector<string> names = CODECFactory::allNames();
+    int c;
+    while ((c = getopt_long(argc, argv, "jo:n:w:r:c:KCh", long_options, NULL)) != -1) {
+        switch (c) {
+        case 'j':
+            json = true;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'n':
+            s.length = atoi(optarg);
+            break;
+        case 'w':
+            s.warmup = atoi(optarg);
+            break;
+        case 'r':
+            s.repetitions = atoi(optarg);
+            break;
+        case 'c':
+            names = split(optarg, ",:;");
+            break;
+        case 'K':
+            kernels = false;
+            break;
+        case 'C':
+            codecs = false;
+            break;
+        default:
+            message(argv[0]);
+            return c == 'h' ? 0 : -1;
+        }
+    }
+    if ((s.length < 128) || (s.repetitions == 0)) {
+        message(argv[0]);
+        return -1;
+    }
+    vector<Measurement> results;
+    if (kernels)
+        benchmarkKernels(s, results);
+    if (codecs)
+        benchmarkCodecs(s, names, results);
+    ofstream file;
+    if (!output.empty()) {
+        file.open(output.c_str());
+        if (!file) {
+            cerr << "cannot open " << output << endl;
+            return -1;
+        }
+    }
+    ostream & out = output.empty() ? cout : file;
+    if (json)
+        writeJSON(out, results);
+    else
+        writeCSV(out, results);
+    return 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * Unpacking to uint16_t and uint8_t (see narrowunpacking.h): the steps
+ * of SIMD_fastunpack_32 (and of fastunpack), unrolled by template
+ * recursion, are narrowed in registers before they are stored.
+ *
+ * This file is compiled with -msse4.1 (_mm_packus_epi32) and, for the
+ * avx2 namespace, with -mavx2 (see narrowunpacking_avx2.cpp).
+ */
+#include "narrowunpacking.h"
+
+#ifdef NARROWUNPACKING_NAMESPACE
+namespace NARROWUNPACKING_NAMESPACE {
+#endif
+
+namespace {
+
+// integers 4j to 4j + 3 of a block packed by SIMD_fastpack_32
+template<uint32_t bit, uint32_t j>
+inline __m128i simdStep(const __m128i * in, const __m128i mask) {
+    const uint32_t word = j * bit / 32, offset = j * bit % 32;
+    __m128i v = _mm_srli_epi32(_mm_load_si128(in + word), offset);
+    if (offset + bit > 32)
+        v = _mm_or_si128(v, _mm_slli_epi32(_mm_load_si128(in + word + 1), 32 - offset));
+    if (offset + bit != 32)
+        v = _mm_and_si128(v, mask);
+    return v;
+}
+
+inline __m128i simdMask(const uint32_t bit) {
+    return _mm_set1_epi32(static_cast<int> ((1U << bit) - 1));
+}
+
+// 8 integers at a time, steps 2k and 2k + 1
+template<uint32_t bit, uint32_t k>
+struct SIMDUnpack16 {
+    static inline void run(const __m128i * in, const __m128i mask, uint16_t * out) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *> (out + 8 * k), _mm_packus_epi32(
+                simdStep<bit, 2 * k> (in, mask), simdStep<bit, 2 * k + 1> (in, mask)));
+        SIMDUnpack16<bit, k + 1>::run(in, mask, out);
+    }
+};
+
+template<uint32_t bit>
+struct SIMDUnpack16<bit, 16> {
+    static inline void run(const __m128i *, const __m128i, uint16_t *) {
+    }
+};
+
+// 16 integers at a time, steps 4k to 4k + 3 (they fit in 8 bits, so the signed packs do)
+template<uint32_t bit, uint32_t k>
+struct SIMDUnpack8 {
+    static inline void run(const __m128i * in, const __m128i mask, uint8_t * out) {
+        const __m128i low = _mm_packs_epi32(simdStep<bit, 4 * k> (in, mask),
+                simdStep<bit, 4 * k + 1> (in, mask));
+        const __m128i high = _mm_packs_epi32(simdStep<bit, 4 * k + 2> (in, mask),
+                simdStep<bit, 4 * k + 3> (in, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i *> (out + 16 * k), _mm_packus_epi16(low,
+                high));
+        SIMDUnpack8<bit, k + 1>::run(in, mask, out);
+    }
+};
+
+template<uint32_t bit>
+struct SIMDUnpack8<bit, 8> {
+    static inline void run(const __m128i *, const __m128i, uint8_t *) {
+    }
+};
+
+template<uint32_t bit>
+void simdUnpack16(const __m128i * in, uint16_t * out) {
+    SIMDUnpack16<bit, 0>::run(in, simdMask(bit), out);
+}
+
+template<uint32_t bit>
+void simdUnpack8(const __m128i * in, uint8_t * out) {
+    SIMDUnpack8<bit, 0>::run(in, simdMask(bit), out);
+}
+
+template<class T>
+void zeros(T * out, const size_t howmany) {
+    memset(out, 0, howmany * sizeof(T));
+}
+
+typedef void (*Unpacker16)(const __m128i * in, uint16_t * out);
+typedef void (*Unpacker8)(const __m128i * in, uint8_t * out);
+
+// bit = 0 is handled by the callers
+const Unpacker16 unpackers16[17] = { NULL, &simdUnpack16<1>, &simdUnpack16<2>,
+        &simdUnpack16<3>, &simdUnpack16<4>, &simdUnpack16<5>, &simdUnpack16<6>,
+        &simdUnpack16<7>, &simdUnpack16<8>, &simdUnpack16<9>, &simdUnpack16<10>,
+        &simdUnpack16<11>, &simdUnpack16<12>, &simdUnpack16<13>, &simdUnpack16<14>,
+        &simdUnpack16<15>, &simdUnpack16<16> };
+
+const Unpacker8 unpackers8[9] = { NULL, &simdUnpack8<1>, &simdUnpack8<2>, &simdUnpack8<3>,
+        &simdUnpack8<4>, &simdUnpack8<5>, &simdUnpack8<6>, &simdUnpack8<7>, &simdUnpack8<8> };
+
+#ifndef NARROWUNPACKING_NAMESPACE
+// integer j of 32 integers packed by fastpack
+template<uint32_t bit, uint32_t j, class T>
+struct ScalarUnpack {
+    static inline void run(const uint32_t * in, T * out) {
+        const uint32_t word = j * bit / 32, offset = j * bit % 32;
+        uint32_t v = in[word] >> offset;
+        if (offset + bit > 32)
+            v |= in[word + 1] << (32 - offset);
+        out[j] = static_cast<T> (v & ((1U << bit) - 1));
+        ScalarUnpack<bit, j + 1, T>::run(in, out);
+    }
+};
+
+template<uint32_t bit, class T>
+struct ScalarUnpack<bit, 32, T> {
+    static inline void run(const uint32_t *, T *) {
+    }
+};
+
+template<uint32_t bit, class T>
+void scalarUnpack(const uint32_t * in, T * out) {
+    ScalarUnpack<bit, 0, T>::run(in, out);
+}
+
+typedef void (*ScalarUnpacker16)(const uint32_t * in, uint16_t * out);
+typedef void (*ScalarUnpacker8)(const uint32_t * in, uint8_t * out);
+
+const ScalarUnpacker16 scalarunpackers16[17] = { NULL, &scalarUnpack<1, uint16_t>,
+        &scalarUnpack<2, uint16_t>, &scalarUnpack<3, uint16_t>, &scalarUnpack<4, uint16_t>,
+        &scalarUnpack<5, uint16_t>, &scalarUnpack<6, uint16_t>, &scalarUnpack<7, uint16_t>,
+        &scalarUnpack<8, uint16_t>, &scalarUnpack<9, uint16_t>, &scalarUnpack<10, uint16_t>,
+        &scalarUnpack<11, uint16_t>, &scalarUnpack<12, uint16_t>,
+        &scalarUnpack<13, uint16_t>, &scalarUnpack<14, uint16_t>,
+        &scalarUnpack<15, uint16_t>, &scalarUnpack<16, uint16_t> };
+
+const ScalarUnpacker8 scalarunpackers8[9] = { NULL, &scalarUnpack<1, uint8_t>,
+        &scalarUnpack<2, uint8_t>, &scalarUnpack<3, uint8_t>, &scalarUnpack<4, uint8_t>,
+        &scalarUnpack<5, uint8_t>, &scalarUnpack<6, uint8_t>, &scalarUnpack<7, uint8_t>,
+        &scalarUnpack<8, uint8_t> };
+#endif
+
+}// namespace
+
+void SIMD_unpack_32to16(const __m128i * in, uint16_t * out, const uint32_t bit) {
+    if (bit == 0)
+        zeros(out, 128);
+    else
+        unpackers16[bit](in, out);
+}
+
+void SIMD_unpack_32to8(const __m128i * in, uint8_t * out, const uint32_t bit) {
+    if (bit == 0)
+        zeros(out, 128);
+    else
+        unpackers8[bit](in, out);
+}
+
+#ifndef NARROWUNPACKING_NAMESPACE
+void fastunpack_narrow(const uint32_t * in, uint16_t * out, const uint32_t bit) {
+    if (bit == 0)
+        zeros(out, 32);
+    else
+        scalarunpackers16[bit](in, out);
+}
+
+void fastunpack_narrow(const uint32_t * in, uint8_t * out, const uint32_t bit) {
+    if (bit == 0)
+        zeros(out, 32);
+    else
+        scalarunpackers8[bit](in, out);
+}
+#endif
+
+#ifdef NARROWUNPACKING_NAMESPACE
+}
+#endif
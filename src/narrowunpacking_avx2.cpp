@@ -0,0 +1,13 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire, http://lemire.me/en/
+ */
+/**
+ * The SIMD kernels of narrowunpacking.cpp, compiled with -mavx2 (VEX
+ * encoding) in the avx2 namespace. SIMD_fastunpack_narrow selects them
+ * at runtime.
+ */
+#define NARROWUNPACKING_NAMESPACE avx2
+#include "narrowunpacking.cpp"
@@ -10,24 +10,42 @@
  * integer logarithm of the length so that arrays
  * having length from 2^L to 2^L-1 will be stored
  * together.
+ *
+ * With --codec, each partition is compressed as it is written, as an
+ * index file (see indexfile.h) that can be memory mapped and decoded
+ * in place. The input is then processed by chunks of arrays, compressed
+ * on all cores (--threads) and written in their original order.
  */
 
+#include <getopt.h>
 #include <sstream>
 #include <vector>
 #include "maropuparser.h"
 #include "util.h"
+#include "indexfile.h"
+#include "deltautil.h"
 
 using namespace std;
 
-int main(int argc, char **argv) {
-    if (argc < 2) {
-        cerr << "please provide an input file name" << endl;
-        return -1;
-    }
-    int argindex = 1;
+enum {
+    ChunkIntegers = 1 << 24// integers compressed in parallel at a time
+};
 
-    string filename = argv[argindex++];
-    cout << "# parsing " << filename << endl;
+void message(const char * prog) {
+    cerr << " usage : " << prog << " [--codec name [--delta] [--threads N]] maropubinaryfile"
+            << endl;
+    cerr << "The arrays go to maropubinaryfile.L where L is the number of bits of their "
+        "length." << endl;
+    cerr << "With --codec, the partitions are index files (indexfile.h) compressed "
+        "with this codec of CODECFactory, named maropubinaryfile.L.codec." << endl;
+    cerr << "With --delta, the arrays are delta coded before they are compressed "
+        "(and the names end with .delta)." << endl;
+    cerr << "The --threads flag sets the number of threads compressing (all cores "
+        "by default)." << endl;
+}
+
+// raw partitions, in the format of the input
+int partitionRaw(const string & filename) {
     MaropuGapReader reader(filename);
     vector < uint32_t > rawdata;
     reader.open();
@@ -46,7 +64,7 @@ int main(int argc, char **argv) {
                 cerr << "can't open " << o.str().c_str() << endl;
                 break;
             }
-            setvbuf (fd , NULL , _IOFBF , 1024*4 ); // large buffer
+            setvbuf (fd , NULL , _IOFBF , WriteBufferBytes ); // large buffer
             output[lengthinbits] = fd;
             counter[lengthinbits] = 0;
             name[lengthinbits] = o.str();
@@ -73,3 +91,122 @@ int main(int argc, char **argv) {
     return 0;
 }
 
+// compressed partitions: index files compressed with codecname
+int partitionCompressed(const string & filename, const string & codecname,
+        const bool delta, uint32_t threads) {
+    if (threads == 0)
+        threads = max<uint32_t> (1, thread::hardware_concurrency());
+    MaropuMappedReader reader(filename);
+    reader.open();
+    // one codec and one buffer (for the deltas) per thread
+    vector<shared_ptr<IntegerCODEC> > codecs;
+    vector<vector<uint32_t, cacheallocator> > scratch(threads);
+    for (uint32_t t = 0; t < threads; ++t)
+        codecs.push_back(CODECFactory::getFromName(codecname)->clone());
+    map<uint32_t, shared_ptr<IndexFileWriter> > output;
+    map<uint32_t, string> name;
+    vector<const uint32_t *> datas;
+    vector<size_t> lengths;
+    vector<vector<uint32_t, cacheallocator> > compressed;
+    vector<size_t> nvalues;
+    size_t integers = 0, words = 0;
+    bool more = true;
+    while (more) {
+        datas.clear();
+        lengths.clear();
+        size_t chunkintegers = 0;
+        const uint32_t * data;
+        size_t length;
+        while ((chunkintegers < ChunkIntegers) && (more = reader.nextList(data, length))) {
+            datas.push_back(data);
+            lengths.push_back(length);
+            chunkintegers += length;
+        }
+        if (compressed.size() < datas.size())
+            compressed.resize(datas.size());
+        nvalues.resize(datas.size());
+        // thread t compresses the arrays t, t + threads, t + 2 * threads...
+        parallelFor(threads, [&](size_t t) {
+            IntegerCODEC & codec = *codecs[t];
+            for (size_t i = t; i < datas.size(); i += threads) {
+                const uint32_t * in = datas[i];
+                if (delta) {
+                    scratch[t].assign(in, in + lengths[i]);
+                    Delta::delta(scratch[t].data(), lengths[i]);
+                    in = scratch[t].data();
+                }
+                compressed[i].resize(codec.maxCompressedWords(lengths[i]) + 1024);
+                nvalues[i] = compressed[i].size();
+                codec.encodeArray(in, lengths[i], compressed[i].data(), nvalues[i]);
+            }
+        }, threads);
+        for (size_t i = 0; i < datas.size(); ++i) {
+            const uint32_t lengthinbits = gccbits(lengths[i]);
+            if (output.find(lengthinbits) == output.end()) {
+                ostringstream o;
+                o << filename << "." << lengthinbits << "." << codecname << (delta ? ".delta"
+                        : "");
+                cout << "creating output file " << o.str() << endl;
+                output[lengthinbits] = shared_ptr<IndexFileWriter> (new IndexFileWriter(o.str()));
+                name[lengthinbits] = o.str();
+            }
+            output[lengthinbits]->addCompressed(codecname, compressed[i].data(),
+                    nvalues[i], lengths[i]);
+            integers += lengths[i];
+            words += nvalues[i];
+        }
+    }
+    for (auto i = output.begin(); i != output.end(); ++i) {
+        cout << "file " << name[i->first] << " contains " << i->second->size() << " arrays"
+                << endl;
+        i->second->close();
+    }
+    reader.close();
+    if (integers > 0)
+        cout << "# " << codecname << ": " << words * 32.0 / integers << " bits per integer"
+                << endl;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    static struct option long_options[] = { { "codec", required_argument, 0, 'c' }, {
+            "delta", no_argument, 0, 'd' }, { "threads", required_argument, 0, 'T' }, {
+            "help", no_argument, 0, 'h' }, { 0, 0, 0, 0 } };
+    string codecname;
+    bool delta = false;
+    uint32_t threads = 0;
+    int c;
+    while ((c = getopt_long(argc, argv, "c:dT:h", long_options, NULL)) != -1) {
+        switch (c) {
+        case 'c':
+            codecname = optarg;
+            break;
+        case 'd':
+            delta = true;
+            break;
+        case 'T':
+            threads = atoi(optarg);
+            break;
+        default:
+            message(argv[0]);
+            return c == 'h' ? 0 : -1;
+        }
+    }
+    if (optind >= argc) {
+        cerr << "please provide an input file name" << endl;
+        message(argv[0]);
+        return -1;
+    }
+    string filename = argv[optind];
+    cout << "# parsing " << filename << endl;
+    if (codecname.empty())
+        return partitionRaw(filename);
+    if (CODECFactory::scodecmap.find(codecname) == CODECFactory::scodecmap.end()) {
+        cerr << "unknown codec " << codecname << ", the choices are:" << endl;
+        for (const string & n : CODECFactory::allNames())
+            cerr << " " << n;
+        cerr << endl;
+        return -1;
+    }
+    return partitionCompressed(filename, codecname, delta, threads);
+}
@@ -0,0 +1,34 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * This file must be compiled with -mavx512f -mavx512bw -mavx512vl. The functions it exports
+ * should only be called on processors supporting AVX-512 (see
+ * cpuSupportsAVX512() in cpufeatures.h).
+ */
+#include "patching.h"
+
+namespace avx512 {
+
+void patchExceptions(uint32_t * out, const uint8_t * positions,
+        const uint32_t * exceptions, const uint32_t cexcept, const uint32_t b) {
+    const __m512i shift = _mm512_set1_epi32(static_cast<int> (b));
+    for (uint32_t k = 0; k < cexcept; k += 16) {
+        const uint32_t n = std::min<uint32_t> (16, cexcept - k);
+        const __mmask16 mask = static_cast<__mmask16> ((1U << n) - 1);
+        // masked loads: there may not be 16 exceptions left (the maskz
+        // forms also spare us the uninitialized operands of the others)
+        const __m512i where = _mm512_maskz_cvtepu8_epi32(mask,
+                _mm_maskz_loadu_epi8(mask, positions + k));
+        const __m512i high = _mm512_maskz_sllv_epi32(mask,
+                _mm512_maskz_loadu_epi32(mask, exceptions + k), shift);
+        const __m512i low = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                mask, where, out, 4);
+        _mm512_mask_i32scatter_epi32(out, mask, where, _mm512_or_si512(low, high), 4);
+    }
+}
+
+}
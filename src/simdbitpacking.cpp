@@ -8,6 +8,10 @@
 
 using namespace std;
 
+#ifdef SIMDBITPACKING_NAMESPACE
+// we are being compiled again for another instruction set, see simdbitpacking_avx2.cpp
+namespace SIMDBITPACKING_NAMESPACE {
+#endif
 
 
 static void SIMD_nullunpacker32(const __m128i *  __restrict__ , uint32_t *  __restrict__  out) {
@@ -14009,12 +14013,38 @@ void simdpack(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, c
   
 
 
+#ifdef SIMDBITPACKING_NAMESPACE
+} // namespace SIMDBITPACKING_NAMESPACE
+#else
+
+typedef void (*simdunpackfnc)(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit);
+typedef void (*simdpackfnc)(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, const uint32_t bit);
+
+// the fastest build of the kernels for this processor is picked once, on first use
 void SIMD_fastunpack_32(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) {
-    simdunpack(in,out, bit);
+    static const simdunpackfnc unpacker = cpuSupportsAVX2() ? avx2::simdunpack : simdunpack;
+    unpacker(in,out, bit);
 }
 void SIMD_fastpackwithoutmask_32(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, const uint32_t bit) {
-    simdpackwithoutmask(in,out, bit);
+    static const simdpackfnc packer = cpuSupportsAVX2() ? avx2::simdpackwithoutmask : simdpackwithoutmask;
+    packer(in,out, bit);
 }
 void SIMD_fastpack_32(const uint32_t *  __restrict__ in, __m128i *  __restrict__  out, const uint32_t bit) {
-    simdpack(in,out, bit);
+    static const simdpackfnc packer = cpuSupportsAVX2() ? avx2::simdpack : simdpack;
+    packer(in,out, bit);
+}
+
+void SIMD_fastunpack_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) {
+    static const simdunpackfnc unpacker = cpuSupportsAVX2() ? avx2_unaligned::simdunpack : unaligned::simdunpack;
+    unpacker(reinterpret_cast<const __m128i *>(in),out, bit);
 }
+void SIMD_fastpackwithoutmask_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) {
+    static const simdpackfnc packer = cpuSupportsAVX2() ? avx2_unaligned::simdpackwithoutmask : unaligned::simdpackwithoutmask;
+    packer(in,reinterpret_cast<__m128i *>(out), bit);
+}
+void SIMD_fastpack_32_unaligned(const uint32_t *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit) {
+    static const simdpackfnc packer = cpuSupportsAVX2() ? avx2_unaligned::simdpack : unaligned::simdpack;
+    packer(in,reinterpret_cast<__m128i *>(out), bit);
+}
+
+#endif
@@ -0,0 +1,13 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * The 128-bit kernels of simdbitpacking.cpp, compiled with -mavx2 (VEX encoding)
+ * in the avx2 namespace. The dispatching functions (SIMD_fastunpack_32...)
+ * select them at runtime.
+ */
+#define SIMDBITPACKING_NAMESPACE avx2
+#include "simdbitpacking.cpp"
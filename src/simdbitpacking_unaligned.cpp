@@ -0,0 +1,20 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * The kernels of simdbitpacking.cpp with unaligned loads and stores, in
+ * the unaligned namespace (see SIMD_fastunpack_32_unaligned...). The
+ * kernels only access memory through _mm_load_si128 and _mm_store_si128,
+ * so we substitute the unaligned versions before compiling them again.
+ */
+#include "simdbitpacking.h"
+
+#ifndef SIMDBITPACKING_NAMESPACE
+#define SIMDBITPACKING_NAMESPACE unaligned
+#endif
+#define _mm_load_si128 _mm_loadu_si128
+#define _mm_store_si128 _mm_storeu_si128
+#include "simdbitpacking.cpp"
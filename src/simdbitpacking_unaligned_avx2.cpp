@@ -0,0 +1,12 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * The unaligned kernels (simdbitpacking_unaligned.cpp), compiled with
+ * -mavx2 in the avx2_unaligned namespace.
+ */
+#define SIMDBITPACKING_NAMESPACE avx2_unaligned
+#include "simdbitpacking_unaligned.cpp"
@@ -0,0 +1,6433 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * Unpacking with a fused inverse delta (prefix sum): the same layout as
+ * simdbitpacking.cpp, but the deltas are added to the running values
+ * while they are still in registers. initOffset holds the last 4 values
+ * (one per lane) and is updated.
+ */
+#include "deltabitpacking.h"
+
+using namespace std;
+
+#ifdef SIMDBITPACKING_NAMESPACE
+// we are being compiled again for another instruction set, see simddeltabitpacking_avx2.cpp
+namespace SIMDBITPACKING_NAMESPACE {
+#endif
+
+static void SIMD_nullunpackerd4_32(const __m128i *  __restrict__ , uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    for (uint32_t k = 0; k < 32; ++k)
+        _mm_store_si128(out++, initOffset);
+}
+
+static void __SIMD_fastunpackd41_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(1U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,21), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,23), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,25), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,26), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,27), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,28), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,29), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,30), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd42_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(3U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,26), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,28), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,26), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,28), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd43_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(7U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,21), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,27), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,25), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,28), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,23), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,26), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd44_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(15U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd45_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(31U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,25), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,23), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,21), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,26), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd46_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(63U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd47_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(127U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,21), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,24), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,23), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd48_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(255U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd49_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(511U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,22), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,21), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd410_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(1023U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd411_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(2047U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,19), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,20), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd412_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(4095U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd413_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(8191U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,17), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,18), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd414_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(16383U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd415_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(32767U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,15), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,16), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd416_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(65535U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd417_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(131071U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,14), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,13), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd418_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(262143U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd419_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(524287U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,12), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,11), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd420_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(1048575U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd421_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(2097151U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,10), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,9), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd422_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(4194303U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd423_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(8388607U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 21), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,7), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,8), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,9);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd424_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(16777215U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd425_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(33554431U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 21), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,5), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,9);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 23), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,6), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,7);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd426_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(67108863U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd427_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(134217727U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,7);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 25), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,9);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 23), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,4), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 21), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 26), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,3), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,5);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd428_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(268435455U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd429_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(536870911U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 21), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,5);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 27), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,2), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,7);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 25), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 28), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(_mm_srli_epi32(InReg,1), mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,9);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 23), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 26), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,3);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd430_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(1073741823U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 26), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 28), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,2);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 26), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 28), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,2);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd431_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+    const __m128i mask =  _mm_set1_epi32(2147483647U);
+
+    OutReg = _mm_and_si128(InReg, mask);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,31);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 1), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,30);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 2), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,29);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 3), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,28);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 4), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,27);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 5), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,26);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 6), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,25);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 7), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,24);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 8), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,23);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 9), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,22);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 10), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,21);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 11), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,20);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 12), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,19);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 13), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,18);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 14), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,17);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 15), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,16);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 16), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,15);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 17), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,14);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 18), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,13);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 19), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,12);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 20), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,11);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 21), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,10);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 22), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,9);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 23), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,8);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 24), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,7);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 25), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,6);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 26), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,5);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 27), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,4);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 28), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,3);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 29), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,2);
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_or_si128(OutReg, _mm_and_si128(_mm_slli_epi32(InReg, 30), mask));
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = _mm_srli_epi32(InReg,1);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+static void __SIMD_fastunpackd432_32(const  __m128i*  __restrict__ in, uint32_t *  __restrict__  _out, __m128i & initOffset) {
+    __m128i*   out = reinterpret_cast<__m128i*>(_out);
+    __m128i    InReg = _mm_load_si128(in);
+    __m128i    OutReg;
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    InReg = _mm_load_si128(++in);
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+    OutReg = InReg;
+    OutReg = _mm_add_epi32(OutReg, initOffset);
+    initOffset = OutReg;
+    _mm_store_si128(out++, OutReg);
+
+}
+
+
+void simdunpackd4(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit, __m128i & initOffset) {
+    switch(bit) {
+        case 0: SIMD_nullunpackerd4_32(in,out,initOffset); return;
+
+        case 1: __SIMD_fastunpackd41_32(in,out,initOffset); return;
+
+        case 2: __SIMD_fastunpackd42_32(in,out,initOffset); return;
+
+        case 3: __SIMD_fastunpackd43_32(in,out,initOffset); return;
+
+        case 4: __SIMD_fastunpackd44_32(in,out,initOffset); return;
+
+        case 5: __SIMD_fastunpackd45_32(in,out,initOffset); return;
+
+        case 6: __SIMD_fastunpackd46_32(in,out,initOffset); return;
+
+        case 7: __SIMD_fastunpackd47_32(in,out,initOffset); return;
+
+        case 8: __SIMD_fastunpackd48_32(in,out,initOffset); return;
+
+        case 9: __SIMD_fastunpackd49_32(in,out,initOffset); return;
+
+        case 10: __SIMD_fastunpackd410_32(in,out,initOffset); return;
+
+        case 11: __SIMD_fastunpackd411_32(in,out,initOffset); return;
+
+        case 12: __SIMD_fastunpackd412_32(in,out,initOffset); return;
+
+        case 13: __SIMD_fastunpackd413_32(in,out,initOffset); return;
+
+        case 14: __SIMD_fastunpackd414_32(in,out,initOffset); return;
+
+        case 15: __SIMD_fastunpackd415_32(in,out,initOffset); return;
+
+        case 16: __SIMD_fastunpackd416_32(in,out,initOffset); return;
+
+        case 17: __SIMD_fastunpackd417_32(in,out,initOffset); return;
+
+        case 18: __SIMD_fastunpackd418_32(in,out,initOffset); return;
+
+        case 19: __SIMD_fastunpackd419_32(in,out,initOffset); return;
+
+        case 20: __SIMD_fastunpackd420_32(in,out,initOffset); return;
+
+        case 21: __SIMD_fastunpackd421_32(in,out,initOffset); return;
+
+        case 22: __SIMD_fastunpackd422_32(in,out,initOffset); return;
+
+        case 23: __SIMD_fastunpackd423_32(in,out,initOffset); return;
+
+        case 24: __SIMD_fastunpackd424_32(in,out,initOffset); return;
+
+        case 25: __SIMD_fastunpackd425_32(in,out,initOffset); return;
+
+        case 26: __SIMD_fastunpackd426_32(in,out,initOffset); return;
+
+        case 27: __SIMD_fastunpackd427_32(in,out,initOffset); return;
+
+        case 28: __SIMD_fastunpackd428_32(in,out,initOffset); return;
+
+        case 29: __SIMD_fastunpackd429_32(in,out,initOffset); return;
+
+        case 30: __SIMD_fastunpackd430_32(in,out,initOffset); return;
+
+        case 31: __SIMD_fastunpackd431_32(in,out,initOffset); return;
+
+        case 32: __SIMD_fastunpackd432_32(in,out,initOffset); return;
+
+        default: break;
+    }
+    throw logic_error("number of bits is unsupported");
+}
+
+
+#ifdef SIMDBITPACKING_NAMESPACE
+} // namespace SIMDBITPACKING_NAMESPACE
+#else
+
+typedef void (*simdunpackd4fnc)(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit, __m128i & initOffset);
+
+// the fastest build of the kernels for this processor is picked once, on first use
+void SIMD_fastunpackd4_32(const __m128i *  __restrict__ in, uint32_t *  __restrict__  out, const uint32_t bit, __m128i & initOffset) {
+    static const simdunpackd4fnc unpacker = cpuSupportsAVX2() ? avx2::simdunpackd4 : simdunpackd4;
+    unpacker(in,out, bit, initOffset);
+}
+
+#endif
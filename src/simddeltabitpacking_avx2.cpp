@@ -0,0 +1,12 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * The kernels of simddeltabitpacking.cpp, compiled with -mavx2 (VEX encoding)
+ * in the avx2 namespace. SIMD_fastunpackd4_32 selects them at runtime.
+ */
+#define SIMDBITPACKING_NAMESPACE avx2
+#include "simddeltabitpacking.cpp"
@@ -0,0 +1,187 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * This file must be compiled with -mavx2. The functions it exports
+ * should only be called on processors supporting AVX2 (see
+ * cpuSupportsAVX2() in cpufeatures.h).
+ *
+ * Instead of one unpacking function per selector, we broadcast the word
+ * to all lanes and shift each lane by its own amount (vpsrlvd, vpsrlvq)
+ * before masking: the shifts and the masks of each selector come from
+ * tables built from the layouts of the selectors.
+ */
+#include "simple_avx2.h"
+
+using namespace std;
+
+namespace avx2 {
+
+namespace {
+
+struct Simple16Tables {
+    Simple16Tables() :
+        shifts(), masks(), counts() {
+        // (bits, how many) from the most significant bits, as in Simple16
+        static const uint32_t layouts[16][6] = { { 1, 28 }, { 2, 7, 1, 14 }, {
+                1, 7, 2, 7, 1, 7 }, { 1, 14, 2, 7 }, { 2, 14 }, { 4, 1, 3, 8 },
+                { 3, 1, 4, 4, 3, 3 }, { 4, 7 }, { 5, 4, 4, 2 }, { 4, 2, 5, 4 },
+                { 6, 3, 5, 2 }, { 5, 2, 6, 3 }, { 7, 4 }, { 10, 1, 9, 2 }, {
+                        14, 2 }, { 28, 1 } };
+        for (uint32_t s = 0; s < 16; ++s) {
+            uint32_t k = 0, used = 0;
+            for (uint32_t f = 0; (f < 6) && (layouts[s][f] > 0); f += 2)
+                for (uint32_t j = 0; j < layouts[s][f + 1]; ++j, ++k) {
+                    used += layouts[s][f];
+                    shifts[s][k] = 28 - used;
+                    masks[s][k] = (1U << layouts[s][f]) - 1;
+                }
+            counts[s] = k;
+        }
+    }
+    __attribute__ ((aligned (32))) uint32_t shifts[16][32];
+    __attribute__ ((aligned (32))) uint32_t masks[16][32];
+    uint32_t counts[16];
+
+    static const Simple16Tables & get() {
+        static const Simple16Tables tables;
+        return tables;
+    }
+};
+
+struct Simple8bTables {
+    Simple8bTables() :
+        shifts(), masks(), counts(), chunks() {
+        static const uint32_t howmany[16] = { 240, 120, 60, 30, 20, 15, 12, 10,
+                8, 7, 6, 5, 4, 3, 2, 1 };
+        static const uint32_t bits[16] = { 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 10,
+                12, 15, 20, 30, 60 };
+        for (uint32_t s = 0; s < 16; ++s) {
+            counts[s] = howmany[s];
+            chunks[s] = (howmany[s] + 7) / 8;
+            if (bits[s] == 0)
+                continue;
+            for (uint32_t k = 0; k < howmany[s]; ++k) {
+                shifts[s][k] = 60 - bits[s] * (k + 1);
+                masks[s][k] = (1ULL << bits[s]) - 1;
+            }
+        }
+    }
+    __attribute__ ((aligned (32))) uint64_t shifts[16][64];
+    __attribute__ ((aligned (32))) uint64_t masks[16][64];
+    uint32_t counts[16];
+    uint32_t chunks[16];// groups of 8 integers
+
+    static const Simple8bTables & get() {
+        static const Simple8bTables tables;
+        return tables;
+    }
+};
+
+}
+
+const uint32_t * simple16Decode(const uint32_t * in, uint32_t * & out,
+        const uint32_t * end) {
+    const Simple16Tables & t = Simple16Tables::get();
+    uint32_t * o = out;
+    while (end - o >= 32) {
+        const uint32_t s = *in >> 28;
+        const __m256i word = _mm256_set1_epi32(static_cast<int> (*in++));
+        const __m256i * shifts = reinterpret_cast<const __m256i *> (t.shifts[s]);
+        const __m256i * masks = reinterpret_cast<const __m256i *> (t.masks[s]);
+        __m256i * vout = reinterpret_cast<__m256i *> (o);
+        _mm256_storeu_si256(vout, _mm256_and_si256(_mm256_srlv_epi32(word,
+                _mm256_load_si256(shifts)), _mm256_load_si256(masks)));
+        if (t.counts[s] > 8) {// the selectors with at least 9 integers
+            for (uint32_t c = 1; c < 4; ++c)
+                _mm256_storeu_si256(vout + c, _mm256_and_si256(_mm256_srlv_epi32(
+                        word, _mm256_load_si256(shifts + c)),
+                        _mm256_load_si256(masks + c)));
+        }
+        o += t.counts[s];
+    }
+    out = o;
+    return in;
+}
+
+// for the selectors with few integers, shifting a 64-bit register is faster
+template<uint32_t num, uint32_t log>
+static inline uint32_t * scalarUnpack(const uint64_t w, uint32_t * out) {
+    const uint64_t mask = (1ULL << log) - 1;
+    for (uint32_t k = 0; k < num; ++k)
+        out[k] = static_cast<uint32_t> ((w >> (60 - log * (k + 1))) & mask);
+    return out + num;
+}
+
+const uint32_t * simple8bDecode(const uint32_t * in, uint32_t * & out,
+        const uint32_t * end) {
+    const Simple8bTables & t = Simple8bTables::get();
+    uint32_t * o = out;
+    while (end - o > 240) {
+        uint64_t w;
+        memcpy(&w, in, sizeof(w));
+        in += 2;
+        const uint32_t s = static_cast<uint32_t> (w >> 60);
+        __m256i * vout = reinterpret_cast<__m256i *> (o);
+        switch (s) {
+        case 0:
+        case 1:// only zeros
+            for (uint32_t c = 0; c < t.chunks[s]; ++c)
+                _mm256_storeu_si256(vout + c, _mm256_setzero_si256());
+            o += t.counts[s];
+            continue;
+        case 7:
+            o = scalarUnpack<10, 6> (w, o);
+            continue;
+        case 8:
+            o = scalarUnpack<8, 7> (w, o);
+            continue;
+        case 9:
+            o = scalarUnpack<7, 8> (w, o);
+            continue;
+        case 10:
+            o = scalarUnpack<6, 10> (w, o);
+            continue;
+        case 11:
+            o = scalarUnpack<5, 12> (w, o);
+            continue;
+        case 12:
+            o = scalarUnpack<4, 15> (w, o);
+            continue;
+        case 13:
+            o = scalarUnpack<3, 20> (w, o);
+            continue;
+        case 14:
+            o = scalarUnpack<2, 30> (w, o);
+            continue;
+        case 15:
+            o = scalarUnpack<1, 60> (w, o);
+            continue;
+        default:// 12 to 60 integers
+            break;
+        }
+        const __m256i word = _mm256_set1_epi64x(static_cast<long long> (w));
+        const __m256i * shifts = reinterpret_cast<const __m256i *> (t.shifts[s]);
+        const __m256i * masks = reinterpret_cast<const __m256i *> (t.masks[s]);
+        for (uint32_t c = 0; c < t.chunks[s]; ++c) {
+            const __m256i lo = _mm256_and_si256(_mm256_srlv_epi64(word,
+                    _mm256_load_si256(shifts + 2 * c)), _mm256_load_si256(masks + 2 * c));
+            const __m256i hi = _mm256_and_si256(_mm256_srlv_epi64(word,
+                    _mm256_load_si256(shifts + 2 * c + 1)), _mm256_load_si256(masks
+                    + 2 * c + 1));
+            // the low halves of the 8 integers, in order
+            const __m256i packed = _mm256_castps_si256(_mm256_shuffle_ps(
+                    _mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm256_storeu_si256(vout + c, _mm256_permute4x64_epi64(packed,
+                    _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+        o += t.counts[s];
+    }
+    out = o;
+    return in;
+}
+
+}
@@ -12,11 +12,2316 @@
 #include "ztimer.h"
 #include "bitpacking.h"
 #include "synthetic.h"
+#include "externalvector.h"
+#include "csv.h"
+#include "entropy.h"
 #include "cpubenchmark.h"
+#include "avxbitpacking.h"
+#include "simdbitpackingtemplates.h"
+#include "skipindex.h"
+#include "blockcache.h"
+#include "intersection.h"
+#include "compressedmerge.h"
+#include "streamcodec.h"
+#include "parallelcodec.h"
+#include "checksumcodec.h"
+#include "indexfile.h"
+#include "postingstore.h"
+#include "appendablelist.h"
+#include "shortlistcodec.h"
+#include "maropuparser.h"
+#include "deltautil.h"
+#include "codecs64.h"
+#include "simdbinarypacking64.h"
+#include "fastpfor64.h"
+#include "simple8b64.h"
 
 using namespace std;
 
+// checks the 256-bit kernels for all bit widths (the codec tests below stop at 28 bits)
+void testAVXBitPacking() {
+#ifdef FASTPFOR_X86
+    if (!cpuSupportsAVX2()) {
+        cout << "AVX2 not supported, skipping the 256-bit kernels" << endl;
+        return;
+    }
+    cout << "testing the 256-bit kernels..." << endl;
+    const uint32_t N = 256;
+    vector<uint32_t> data(N), compressed(N + 8), recovered(N);
+    for (uint32_t bit = 0; bit <= 32; ++bit) {
+        const uint32_t mask = bit == 32 ? 0xFFFFFFFFU : (1U << bit) - 1;
+        for (uint32_t k = 0; k < N; ++k)
+            data[k] = static_cast<uint32_t>(rand() * 2654435761U + k);
+        compressed[8 * bit] = 0xDEADBEEF; // canary
+        avxpack(&data[0], reinterpret_cast<__m256i *>(&compressed[0]), bit);
+        if (compressed[8 * bit] != 0xDEADBEEF)
+            throw logic_error("avxpack wrote too much");
+        avxunpack(reinterpret_cast<const __m256i *>(&compressed[0]), &recovered[0], bit);
+        for (uint32_t k = 0; k < N; ++k) {
+            if (recovered[k] != (data[k] & mask)) {
+                cerr << "bit = " << bit << " k = " << k << endl;
+                throw logic_error("avxpack/avxunpack bug");
+            }
+            data[k] &= mask;
+        }
+        avxpackwithoutmask(&data[0], reinterpret_cast<__m256i *>(&compressed[0]), bit);
+        avxunpack(reinterpret_cast<const __m256i *>(&compressed[0]), &recovered[0], bit);
+        if (recovered != data) {
+            cerr << "bit = " << bit << endl;
+            throw logic_error("avxpackwithoutmask/avxunpack bug");
+        }
+    }
+#endif
+}
+
+template <class CODEC>
+void testSelect(CODEC & c, const size_t length) {
+    vector<uint32_t, cacheallocator> data(length);
+    for (size_t i = 0; i < length; ++i) // mostly small values, a few large ones
+        data[i] = (rand() % 16 == 0) ? static_cast<uint32_t>(rand()) : i % 61;
+    vector<uint32_t, cacheallocator> out(2 * length + 1024);
+    size_t nvalue = out.size();
+    c.encodeArray(&data[0], length, &out[0], nvalue);
+    for (size_t i = 0; i < length; i += 1 + rand() % 7) {
+        if (c.select(&out[0], i) != data[i]) {
+            cerr << c.name() << " select(" << i << ") = " << c.select(&out[0], i)
+                    << " expected " << data[i] << endl;
+            throw logic_error("select bug");
+        }
+    }
+    vector<uint32_t> range(length);
+    for (int t = 0; t < 100; ++t) {
+        const size_t begin = rand() % length;
+        const size_t end = begin + rand() % (length - begin + 1);
+        c.decodeRange(&out[0], begin, end, &range[0]);
+        if (!equal(range.begin(), range.begin() + (end - begin), data.begin() + begin)) {
+            cerr << c.name() << " decodeRange(" << begin << "," << end << ")" << endl;
+            throw logic_error("decodeRange bug");
+        }
+    }
+}
+
+void testSelect() {
+    cout << "testing select and decodeRange..." << endl;
+    BP32 bp32;
+    testSelect(bp32, 128 * 37);
+    SIMDBinaryPacking sbp;
+    testSelect(sbp, 2048 * 5);
+    FastPFor fastpfor(1024); // small pages so that we have many of them
+    testSelect(fastpfor, 128 * 37);
+    SIMDFastPFor simdfastpfor(1024);
+    testSelect(simdfastpfor, 128 * 37);
+}
+
+template <class CODEC>
+void testBlockSummaries(CODEC & c, const size_t length) {
+    vector<uint32_t, cacheallocator> data(length), impacts(length);
+    uint32_t docid = 0;
+    for (size_t i = 0; i < length; ++i) {
+        docid += 1 + rand() % 100;
+        data[i] = docid;
+        impacts[i] = rand() % 1000;
+    }
+    for (uint32_t withimpacts = 0; withimpacts < 2; ++withimpacts) {
+        vector<uint32_t, cacheallocator> out(2 * length + 1024);
+        size_t nvalue = out.size();
+        c.encodeWithSummaries(data.data(), length, out.data(), nvalue, 1, true,
+                withimpacts ? impacts.data() : NULL);
+        BlockSummaryView view(out.data());
+        if (view.empty() || (view.size() != length / BlockSummaryView::blockSize())
+                || (view.hasImpacts() != (withimpacts == 1)))
+            throw logic_error(c.name() + " block summaries are missing");
+        for (size_t k = 0; k < view.size(); ++k) {
+            const size_t end = (k + 1) * BlockSummaryView::blockSize();
+            if ((view.maxValue(k) != data[end - 1]) || (withimpacts && (view.maxImpact(k)
+                    != *max_element(impacts.begin() + end - BlockSummaryView::blockSize(),
+                            impacts.begin() + end))))
+                throw logic_error(c.name() + " block summaries bug");
+        }
+        for (int t = 0; t < 100; ++t) {
+            const uint32_t target = rand() % (docid + 10);
+            const size_t from = rand() % (view.size() + 1);
+            size_t expected = from;
+            while ((expected < view.size()) && (view.maxValue(expected) < target))
+                ++expected;
+            if (view.nextGEQ(target, from) != expected)
+                throw logic_error("BlockSummaryView::nextGEQ bug");
+        }
+        // the blocks are unchanged
+        vector<uint32_t, cacheallocator> recovered(length + 1024);
+        size_t recoveredsize = recovered.size();
+        c.decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+        Delta::inverseDelta(recovered.data(), recoveredsize);
+        if ((recoveredsize != length) || !equal(data.begin(), data.end(), recovered.begin()))
+            throw logic_error(c.name() + " with block summaries: decoding bug");
+        const size_t i = rand() % length;
+        if (c.select(out.data(), i) != (i == 0 ? data[0] : data[i] - data[i - 1]))
+            throw logic_error(c.name() + " with block summaries: select bug");
+    }
+    vector<uint32_t, cacheallocator> out(2 * length + 1024);
+    size_t nvalue = out.size();
+    c.encodeArray(data.data(), length, out.data(), nvalue);
+    if (!BlockSummaryView(out.data()).empty())
+        throw logic_error(c.name() + " writes block summaries unasked");
+    // empty arrays
+    nvalue = out.size();
+    c.encodeWithSummaries(data.data(), 0, out.data(), nvalue, 1, true, impacts.data());
+    if (!BlockSummaryView(out.data()).empty())
+        throw logic_error(c.name() + " writes block summaries for an empty array");
+    vector<uint32_t, cacheallocator> recovered(1024);
+    size_t recoveredsize = recovered.size();
+    if ((c.decodeArray(out.data(), nvalue, recovered.data(), recoveredsize)
+            != out.data() + nvalue) || (recoveredsize != 0))
+        throw logic_error(c.name() + " with block summaries: empty array bug");
+}
+
+void testBlockSummaries() {
+    cout << "testing block summaries..." << endl;
+    SIMDBinaryPacking sbp;
+    testBlockSummaries(sbp, 2048 * 5);
+    SIMDFastPFor simdfastpfor(1024);
+    testBlockSummaries(simdfastpfor, 128 * 37);
+}
+
+template<class CODEC>
+void testDecodeMany(CODEC & c) {
+    const size_t lengths[] = { 0, 5, 128, 2048 * 3 + 7, 1000, 70000 * 2 + 129, 2048 };
+    const size_t howmany = sizeof(lengths) / sizeof(lengths[0]);
+    vector<vector<uint32_t, cacheallocator> > data(howmany), compressed(howmany), out(howmany);
+    vector<const uint32_t *> in(howmany);
+    vector<uint32_t *> outs(howmany);
+    vector<size_t> clength(howmany), nvalue(howmany);
+    for (size_t i = 0; i < howmany; ++i) {
+        for (size_t j = 0; j < lengths[i]; ++j)
+            data[i].push_back(rand() % 50 == 0 ? rand() : rand() % (1U << (i + 3)));
+        compressed[i].resize(c.maxCompressedWords(lengths[i]) + 1024);
+        clength[i] = compressed[i].size();
+        c.encodeArray(data[i].data(), lengths[i], compressed[i].data(), clength[i]);
+        out[i].resize(lengths[i] + 1024);
+        in[i] = compressed[i].data();
+        outs[i] = out[i].data();
+        nvalue[i] = out[i].size();
+    }
+    c.decodeMany(in.data(), clength.data(), outs.data(), nvalue.data(), howmany);
+    for (size_t i = 0; i < howmany; ++i)
+        if ((nvalue[i] != lengths[i]) || !equal(data[i].begin(), data[i].end(), out[i].begin()))
+            throw logic_error("decodeMany bug with " + c.name());
+}
+
+void testDecodeMany() {
+    cout << "testing decodeMany..." << endl;
+    CompositeCodec<SIMDBinaryPacking, VariableByte> sbp;
+    testDecodeMany(sbp);
+    CompositeCodec<SIMDFastPFor, VariableByte> sfp;
+    testDecodeMany(sfp);
+}
+
+template<class CODEC>
+void testAggregate(CODEC & c, const size_t length, const uint32_t maxbit) {
+    vector<uint32_t, cacheallocator> data(length);
+    for (size_t j = 0; j < length; ++j) {
+        const uint32_t v = static_cast<uint32_t> (rand()) ^ (static_cast<uint32_t> (rand()) << 16);
+        data[j] = rand() % 20 == 0 ? v : (maxbit == 32 ? v : v % (1U << maxbit)) + 3;
+    }
+    vector<uint32_t, cacheallocator> compressed(c.maxCompressedWords(length) + 1024);
+    size_t clength = compressed.size();
+    c.encodeArray(data.data(), length, compressed.data(), clength);
+    Aggregate expected, answer;
+    expected.add(data.data(), length);
+    c.aggregate(compressed.data(), clength, answer);
+    if (!(answer == expected))
+        throw logic_error("aggregate bug with " + c.name());
+}
+
+void testAggregate() {
+    cout << "testing aggregate..." << endl;
+    CompositeCodec<SIMDBinaryPacking, VariableByte> sbp;
+    CompositeCodec<SIMDGlobalBinaryPacking, VariableByte> sgbp;
+    CompositeCodec<SIMDFastPFor, VariableByte> sfp;
+    const size_t lengths[] = { 0, 5, 128, 2048 * 3 + 7, 70000 * 2 + 129 };
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+        for (uint32_t maxbit = 0; maxbit <= 32; maxbit += 4) {
+            testAggregate(sbp, lengths[i], maxbit);
+            testAggregate(sgbp, lengths[i], maxbit);
+            testAggregate(sfp, lengths[i], maxbit);
+        }
+    // blocks where the smallest low bits are those of exceptions
+    vector<uint32_t, cacheallocator> data(128 * 4, 5);
+    for (size_t j = 0; j < data.size(); j += 2)
+        data[j] = j % 8 == 0 ? (1U << 20) : 6;
+    vector<uint32_t, cacheallocator> compressed(sfp.maxCompressedWords(data.size()) + 1024);
+    size_t clength = compressed.size();
+    sfp.encodeArray(data.data(), data.size(), compressed.data(), clength);
+    Aggregate expected, answer;
+    expected.add(data.data(), data.size());
+    sfp.aggregate(compressed.data(), clength, answer);
+    if (!(answer == expected))
+        throw logic_error("aggregate bug with exceptions");
+    // the kernels of each build
+    __attribute__ ((aligned (16))) uint32_t packed[4 * 32 * 3];
+    for (uint32_t bit = 0; bit <= 32; ++bit) {
+        uint32_t block[128 * 3];
+        for (size_t j = 0; j < 128 * 3; ++j)
+            block[j] = bit == 32 ? static_cast<uint32_t> (rand()) * 7 : static_cast<uint32_t> (rand()) % (1U << bit);
+        for (size_t k = 0; k < 3; ++k)
+            SIMD_fastpack_32(block + 128 * k, reinterpret_cast<__m128i *> (packed + 4 * bit * k), bit);
+        Aggregate expectedblocks, sse, avx;
+        expectedblocks.add(block, 128 * 3);
+        if (cpuSupportsSSE41()) {
+            SIMD_aggregate_32(reinterpret_cast<const __m128i *> (packed), bit, 3, sse);
+            if (!(sse == expectedblocks))
+                throw logic_error("SIMD_aggregate_32 bug");
+        }
+        if (cpuSupportsAVX2()) {
+            avx2::SIMD_aggregate_32(reinterpret_cast<const __m128i *> (packed), bit, 3, avx);
+            if (!(avx == expectedblocks))
+                throw logic_error("avx2::SIMD_aggregate_32 bug");
+        }
+    }
+}
+
+// the SIMD narrow kernels, by output type
+void narrowTo(const __m128i * in, uint16_t * out, const uint32_t bit) {
+    SIMD_unpack_32to16(in, out, bit);
+}
+void narrowTo(const __m128i * in, uint8_t * out, const uint32_t bit) {
+    SIMD_unpack_32to8(in, out, bit);
+}
+void narrowToAVX2(const __m128i * in, uint16_t * out, const uint32_t bit) {
+    avx2::SIMD_unpack_32to16(in, out, bit);
+}
+void narrowToAVX2(const __m128i * in, uint8_t * out, const uint32_t bit) {
+    avx2::SIMD_unpack_32to8(in, out, bit);
+}
+
+template<class T, class CODEC>
+void testDecodeNarrow(CODEC & c, const size_t length, const uint32_t maxbit) {
+    vector<uint32_t, cacheallocator> data(length);
+    for (size_t j = 0; j < length; ++j)
+        data[j] = rand() % 20 == 0 ? (1U << maxbit) - 1 : static_cast<uint32_t> (rand())
+                % (1U << (maxbit / 2 + 1));
+    vector<uint32_t, cacheallocator> compressed(c.maxCompressedWords(length) + 1024);
+    size_t clength = compressed.size();
+    c.encodeArray(data.data(), length, compressed.data(), clength);
+    vector<T> out(length + 1, 77);
+    size_t nvalue = length;
+    c.decodeNarrow(compressed.data(), clength, out.data() + 1, nvalue);
+    if (nvalue != length)
+        throw logic_error("decodeNarrow length bug with " + c.name());
+    for (size_t j = 0; j < length; ++j)
+        if (out[j + 1] != data[j])
+            throw logic_error("decodeNarrow bug with " + c.name());
+    if (length == 0)
+        return;
+    // one integer too large for T
+    data[length / 2] = 1U << narrowBits<T>();
+    clength = compressed.size();
+    c.encodeArray(data.data(), length, compressed.data(), clength);
+    nvalue = length;
+    bool thrown = false;
+    try {
+        c.decodeNarrow(compressed.data(), clength, out.data(), nvalue);
+    } catch (const logic_error &) {
+        thrown = true;
+    }
+    if (!thrown)
+        throw logic_error("decodeNarrow should not accept wide integers with " + c.name());
+}
+
+template<class T>
+void testDecodeNarrow() {
+    CompositeCodec<SIMDBinaryPacking, VariableByte> sbp;
+    CompositeCodec<BP32, VariableByte> bp32;
+    CompositeCodec<FastPFor, VariableByte> fp;
+    const size_t lengths[] = { 0, 5, 128, 2048 * 3 + 7, 70000 * 2 + 129 };
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+        for (uint32_t maxbit = 1; maxbit <= narrowBits<T>(); ++maxbit) {
+            testDecodeNarrow<T>(sbp, lengths[i], maxbit);
+            testDecodeNarrow<T>(bp32, lengths[i], maxbit);
+            testDecodeNarrow<T>(fp, lengths[i], maxbit);
+        }
+    // the kernels of each build
+    for (uint32_t bit = 0; bit <= narrowBits<T>(); ++bit) {
+        __attribute__ ((aligned (16))) uint32_t block[128];
+        __attribute__ ((aligned (16))) uint32_t packed[4 * 32];
+        for (size_t j = 0; j < 128; ++j)
+            block[j] = static_cast<uint32_t> (rand()) % (1U << bit);
+        T sse[128], avx[128], scalar[128];
+        SIMD_fastpack_32(block, reinterpret_cast<__m128i *> (packed), bit);
+        if (cpuSupportsSSE41()) {
+            narrowTo(reinterpret_cast<const __m128i *> (packed), sse, bit);
+            if (!equal(sse, sse + 128, block))
+                throw logic_error("SIMD narrow unpacking bug");
+        }
+        if (cpuSupportsAVX2()) {
+            narrowToAVX2(reinterpret_cast<const __m128i *> (packed), avx, bit);
+            if (!equal(avx, avx + 128, block))
+                throw logic_error("avx2 narrow unpacking bug");
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            fastpack(block + 32 * k, packed, bit);
+            fastunpack_narrow(packed, scalar + 32 * k, bit);
+        }
+        if (!equal(scalar, scalar + 128, block))
+            throw logic_error("fastunpack_narrow bug");
+    }
+}
+
+void testDecodeNarrow() {
+    cout << "testing decodeNarrow..." << endl;
+    testDecodeNarrow<uint16_t>();
+    testDecodeNarrow<uint8_t>();
+}
+
+void testSkipIndex() {
+    cout << "testing DeltaSkipIndex..." << endl;
+    for (uint32_t blocksperskip = 1; blocksperskip <= 2; ++blocksperskip) {
+        DeltaSkipIndex<> dsi(blocksperskip);
+        const size_t length = 2048 * 7 + 1000;
+        vector<uint32_t, cacheallocator> data(length);
+        uint32_t v = 0;
+        for (size_t i = 0; i < length; ++i)
+            data[i] = v += rand() % 20; // with repeated values
+        vector<uint32_t, cacheallocator> out(2 * length + 1024);
+        size_t nvalue = out.size();
+        dsi.encodeArray(&data[0], length, &out[0], nvalue);
+        vector<uint32_t, cacheallocator> recover(length);
+        size_t recoveredsize = recover.size();
+        dsi.decodeArray(&out[0], nvalue, &recover[0], recoveredsize);
+        if ((recoveredsize != length) || (recover != data))
+            throw logic_error("DeltaSkipIndex decoding bug");
+        DeltaSkipIndex<>::Cursor c(dsi, &out[0]);
+        uint32_t target = 0, value;
+        while (c.nextGEQ(target, value)) {
+            const size_t expected = lower_bound(data.begin(), data.end(), target) - data.begin();
+            if ((c.position() != expected) || (value != data[expected]))
+                throw logic_error("DeltaSkipIndex nextGEQ bug");
+            target = value + 1 + rand() % 500;
+        }
+        if (target <= data.back())
+            throw logic_error("DeltaSkipIndex nextGEQ ended early");
+        if (!c.seek(data[5000], value) || (value != data[5000]))
+            throw logic_error("DeltaSkipIndex seek bug");
+    }
+}
+
+void testDecodedBlockCache() {
+    cout << "testing DecodedBlockCache..." << endl;
+    // room for about 10 blocks of 128 integers in each of 2 shards
+    DecodedBlockCache cache(2 * 10 * (128 * sizeof(uint32_t) + DecodedBlockCache::EntryOverhead), 2);
+    vector<uint32_t> block(128), out(128);
+    size_t decodes = 0;
+    for (uint32_t round = 0; round < 3; ++round) {
+        for (uint32_t b = 0; b < 5; ++b) {
+            const size_t n = cache.fetch(7, b, out.data(), [&](uint32_t * o) {
+                ++decodes;
+                for (uint32_t j = 0; j < 100 + b; ++j)
+                    o[j] = 1000 * b + j;
+                return 100 + b;
+            });
+            if (n != 100 + b)
+                throw logic_error("DecodedBlockCache: bad length");
+            for (uint32_t j = 0; j < n; ++j)
+                if (out[j] != 1000 * b + j)
+                    throw logic_error("DecodedBlockCache: bad block");
+        }
+    }
+    if ((decodes != 5) || (cache.misses() != 5) || (cache.hits() != 10))
+        throw logic_error("DecodedBlockCache: bad counters");
+    // many more blocks than we can hold
+    for (uint32_t list = 0; list < 100; ++list)
+        cache.insert(list, 0, block.data(), block.size());
+    if ((cache.evictions() == 0) || (cache.size() > 20)
+            || (cache.memoryUsage() > 2 * 10 * (128 * sizeof(uint32_t)
+                    + DecodedBlockCache::EntryOverhead)))
+        throw logic_error("DecodedBlockCache: over budget");
+    size_t nvalue;
+    if (!cache.lookup(99, 0, out.data(), nvalue) || (nvalue != 128))
+        throw logic_error("DecodedBlockCache: lost the last block");
+    cache.clear();
+    if ((cache.size() != 0) || cache.lookup(99, 0, out.data(), nvalue))
+        throw logic_error("DecodedBlockCache: clear failed");
+    // with cursors
+    DeltaSkipIndex<> dsi;
+    const size_t length = 128 * 50 + 7;
+    vector<uint32_t, cacheallocator> data(length);
+    uint32_t v = 0;
+    for (size_t i = 0; i < length; ++i)
+        data[i] = v += 1 + rand() % 20;
+    vector<uint32_t, cacheallocator> compressed(2 * length + 1024);
+    size_t nc = compressed.size();
+    dsi.encodeArray(data.data(), length, compressed.data(), nc);
+    DecodedBlockCache bigcache(1 << 20);
+    for (int round = 0; round < 2; ++round) {
+        DeltaSkipIndex<>::Cursor c(dsi, compressed.data(), &bigcache, 3);
+        uint32_t target = 0, value;
+        while (c.nextGEQ(target, value)) {
+            const size_t expected = lower_bound(data.begin(), data.end(), target) - data.begin();
+            if ((c.position() != expected) || (value != data[expected]))
+                throw logic_error("DeltaSkipIndex nextGEQ bug with a cache");
+            target = value + 1 + rand() % 100;
+        }
+    }
+    if (bigcache.hits() == 0)
+        throw logic_error("DecodedBlockCache: the cursor does not use the cache");
+}
+
+void testIntersection() {
+    cout << "testing intersections..." << endl;
+    const size_t lengths[] = {0, 3, 100, 1000, 20000, 70000};
+    DeltaSkipIndex<> dsi;
+    CompressedIntersection<> ci(dsi);
+    for (size_t la : lengths) {
+        for (size_t lb : lengths) {
+            vector<uint32_t, cacheallocator> A(la), B(lb);
+            uint32_t v = 0;
+            for (size_t i = 0; i < la; ++i)
+                A[i] = v += 1 + rand() % 10;
+            v = 0;
+            for (size_t i = 0; i < lb; ++i)
+                B[i] = v += 1 + rand() % 300;
+            vector<uint32_t> expected;
+            set_intersection(A.begin(), A.end(), B.begin(), B.end(), back_inserter(expected));
+            vector<uint32_t, cacheallocator> out(min(la, lb) + 4);
+            size_t count = intersectSIMD(A.data(), la, B.data(), lb, out.data());
+            if (!equal(expected.begin(), expected.end(), out.begin()) || (count != expected.size()))
+                throw logic_error("intersectSIMD bug");
+            count = intersectGalloping(A.data(), la, B.data(), lb, out.data());
+            if (!equal(expected.begin(), expected.end(), out.begin()) || (count != expected.size()))
+                throw logic_error("intersectGalloping bug");
+            vector<uint32_t, cacheallocator> ca(2 * la + 1024), cb(2 * lb + 1024);
+            size_t na = ca.size(), nb = cb.size();
+            dsi.encodeArray(A.data(), la, ca.data(), na);
+            dsi.encodeArray(B.data(), lb, cb.data(), nb);
+            count = ci.intersect(A.data(), la, cb.data(), out.data());
+            if (!equal(expected.begin(), expected.end(), out.begin()) || (count != expected.size()))
+                throw logic_error("intersection with a compressed list bug");
+            count = ci.intersect(ca.data(), cb.data(), out.data());
+            if (!equal(expected.begin(), expected.end(), out.begin()) || (count != expected.size()))
+                throw logic_error("intersection of compressed lists bug");
+            vector<const uint32_t *> lists;
+            lists.push_back(cb.data());
+            lists.push_back(ca.data());
+            lists.push_back(cb.data());
+            count = ci.intersect(lists, out.data());
+            if (!equal(expected.begin(), expected.end(), out.begin()) || (count != expected.size()))
+                throw logic_error("intersection of many compressed lists bug");
+        }
+    }
+}
+
+// sorted distinct integers: runs starting at starts[k] (runs of length each, apart by gap)
+vector<uint32_t, cacheallocator> mergeInput(const vector<uint32_t> & starts, const size_t length,
+        const uint32_t gap) {
+    vector<uint32_t, cacheallocator> answer;
+    for (uint32_t start : starts) {
+        uint32_t v = start;
+        for (size_t i = 0; i < length; ++i, v += 1 + rand() % gap)
+            answer.push_back(v);
+    }
+    return answer;
+}
+
+template<class CODEC>
+void testCompressedMerge(const uint32_t blocksperskip) {
+    typedef DeltaSkipIndex<CODEC> SkipIndex;
+    SkipIndex dsi(blocksperskip);
+    CompressedMerge<CODEC> cm(dsi);
+    const size_t chunk = dsi.ChunkSize;
+    // overlapping, disjoint (A then B, B then A), alternating ranges, empty, near 2^32
+    const vector<uint32_t> startsA[] = { {0}, {0}, {1U << 30}, {0, 1U << 24, 1U << 26}, {},
+            {0xF0000000} };
+    const vector<uint32_t> startsB[] = { {0}, {1U << 30}, {0}, {1U << 23, 1U << 25}, {0},
+            {0xF0000000} };
+    for (size_t t = 0; t < sizeof(startsA) / sizeof(startsA[0]); ++t) {
+        const vector<uint32_t, cacheallocator> A = mergeInput(startsA[t], 3 * chunk + 100, t == 0 ? 5 : 20);
+        const vector<uint32_t, cacheallocator> B = mergeInput(startsB[t], 5 * chunk + 7, 20);
+        vector<uint32_t, cacheallocator> expected;
+        set_union(A.begin(), A.end(), B.begin(), B.end(), back_inserter(expected));
+        vector<uint32_t, cacheallocator> ca(2 * A.size() + 1024), cb(2 * B.size() + 1024);
+        size_t na = ca.size(), nb = cb.size();
+        dsi.encodeArray(A.data(), A.size(), ca.data(), na);
+        dsi.encodeArray(B.data(), B.size(), cb.data(), nb);
+        // a misaligned output: the SIMD codecs pad the copied chunks again
+        vector<uint32_t, cacheallocator> merged(2 * expected.size() + 1024);
+        size_t nm = merged.size() - 1;
+        cm.merge(ca.data(), cb.data(), merged.data() + 1, nm);
+        const uint32_t * const m = merged.data() + 1;
+        vector<uint32_t, cacheallocator> recover(expected.size() + 1);
+        size_t recovered = recover.size();
+        dsi.decodeArray(m, nm, recover.data(), recovered);
+        if ((recovered != expected.size()) || !equal(expected.begin(), expected.end(),
+                recover.begin()))
+            throw logic_error("CompressedMerge bug");
+        if ((t == 1) || (t == 2)) {
+            // the full chunks are copied, only the last chunk of each list might be encoded again
+            if ((cm.copiedChunks() < A.size() / chunk + B.size() / chunk)
+                    || (cm.encodedChunks() > 2))
+                throw logic_error("CompressedMerge did not copy the chunks");
+        }
+        typename SkipIndex::Cursor c(dsi, m);
+        uint32_t target = expected.empty() ? 0 : expected[0], value;
+        while (c.nextGEQ(target, value)) {
+            const size_t where = lower_bound(expected.begin(), expected.end(), target)
+                    - expected.begin();
+            if ((c.position() != where) || (value != expected[where]))
+                throw logic_error("CompressedMerge: nextGEQ bug on the merged list");
+            target = value + 1 + rand() % 1000;
+        }
+        // the merged list merges again (its chunks may be short)
+        vector<uint32_t, cacheallocator> again(2 * expected.size() + 1024);
+        size_t nagain = again.size();
+        cm.merge(m, ca.data(), again.data(), nagain);
+        recovered = recover.size();
+        dsi.decodeArray(again.data(), nagain, recover.data(), recovered);
+        if ((recovered != expected.size()) || !equal(expected.begin(), expected.end(),
+                recover.begin()))
+            throw logic_error("CompressedMerge bug with a merged list");
+        size_t small = 10;
+        try {
+            cm.merge(ca.data(), cb.data(), again.data(), small);
+            if (!expected.empty())
+                throw logic_error("CompressedMerge: overflow not detected");
+        } catch (NotEnoughStorage &) {
+        }
+    }
+}
+
+void testCompressedMerge() {
+    cout << "testing CompressedMerge..." << endl;
+    const size_t lengths[] = {0, 3, 4, 7, 100, 1000};
+    for (size_t la : lengths) {
+        for (size_t lb : lengths) {
+            for (uint32_t gap = 1; gap <= 64; gap *= 8) {
+                vector<uint32_t> A(la), B(lb);
+                uint32_t v = 0xFFFFFFFF - 64 * 1000;
+                for (size_t i = 0; i < la; ++i)
+                    A[i] = v += 1 + rand() % gap;
+                v = 0xFFFFFFFF - 64 * 1000;
+                for (size_t i = 0; i < lb; ++i)
+                    B[i] = v += 1 + rand() % gap;
+                vector<uint32_t> expected;
+                set_union(A.begin(), A.end(), B.begin(), B.end(), back_inserter(expected));
+                vector<uint32_t> out(la + lb + 4);
+                const size_t count = unionSIMD(A.data(), la, B.data(), lb, out.data());
+                if ((count != expected.size()) || !equal(expected.begin(), expected.end(),
+                        out.begin()))
+                    throw logic_error("unionSIMD bug");
+            }
+        }
+    }
+    testCompressedMerge<SIMDBinaryPacking> (1);
+    testCompressedMerge<FastPFor> (4);
+}
+
+template<class CODEC>
+void testStreamCodec() {
+    const size_t lengths[] = {0, 1000, 65536 * 3 + 17};
+    for (size_t length : lengths) {
+        for (int differential = 0; differential < 2; ++differential) {
+            vector<uint32_t, cacheallocator> data(length);
+            uint32_t v = 0;
+            for (size_t i = 0; i < length; ++i)
+                data[i] = differential ? v += rand() % 100 : rand() % 1000;
+            stringstream ss;
+            StreamEncoder<CODEC> se(ss, differential);
+            for (size_t i = 0; i < length;) {
+                const size_t n = min<size_t>(length - i, rand() % 5000);
+                se.push(&data[i], n);
+                i += n;
+            }
+            se.finish();
+            if (se.integersPushed() != length)
+                throw logic_error("StreamEncoder bug");
+            StreamDecoder<CODEC> sd(ss, differential);
+            vector<uint32_t, cacheallocator> recover(length + 5000);
+            size_t count = 0;
+            while (size_t n = sd.next(&recover[count], 1 + rand() % 5000))
+                count += n;
+            recover.resize(count);
+            if (recover != data) {
+                cerr << se.name() << " length = " << length << endl;
+                throw logic_error("StreamDecoder bug");
+            }
+        }
+    }
+}
+
+void testStreamCodecs() {
+    cout << "testing StreamEncoder and StreamDecoder..." << endl;
+    testStreamCodec<SIMDFastPFor> ();
+    testStreamCodec<FastPFor> ();
+    testStreamCodec<SIMDBinaryPacking> ();
+}
+
+// a codec written before IntegerCODEC::clone existed
+class CloneLessCodec: public IntegerCODEC {
+public:
+    void encodeArray(const uint32_t *in, const size_t length, uint32_t *out,
+            size_t &nvalue) {
+        copy(in, in + length, out);
+        nvalue = length;
+    }
+    const uint32_t * decodeArray(const uint32_t *in, const size_t length,
+            uint32_t *out, size_t &nvalue) {
+        copy(in, in + length, out);
+        nvalue = length;
+        return in + length;
+    }
+    string name() const {
+        return "CloneLessCodec";
+    }
+};
+
+// a clone should behave like the original, the Workspace overloads like decodeArray
+void testClone() {
+    cout << "testing clone and decoding workspaces..." << endl;
+    vector < shared_ptr<IntegerCODEC> > myalgos = CODECFactory::allSchemes();
+    const size_t length = 65536 * 2 + 1000;
+    vector<uint32_t, cacheallocator> data(length);
+    for (size_t i = 0; i < length; ++i)
+        data[i] = rand() % 1000 + (i % 100 == 0 ? 1U << 20 : 0);// with exceptions
+    for (auto & c : myalgos) {
+        shared_ptr<IntegerCODEC> copy = c->clone();
+        if ((copy.get() == c.get()) || (copy->name() != c->name()))
+            throw logic_error("clone bug");
+        vector<uint32_t, cacheallocator> out1(2 * length + 1024), out2(2 * length + 1024);
+        size_t nvalue1 = out1.size(), nvalue2 = out2.size();
+        c->encodeArray(&data[0], length, &out1[0], nvalue1);
+        copy->encodeArray(&data[0], length, &out2[0], nvalue2);
+        out1.resize(nvalue1);
+        out2.resize(nvalue2);
+        if (out1 != out2)
+            throw logic_error("clone encoding bug");
+    }
+    bool caught = false;
+    try {
+        CloneLessCodec().clone();
+    } catch (const logic_error &) {
+        caught = true;
+    }
+    if (!caught)
+        throw logic_error("the default clone should throw");
+    vector<uint32_t, cacheallocator> out(2 * length + 1024), recover(length);
+    SIMDFastPFor simdfastpfor;
+    SIMDFastPFor::Workspace simdws;
+    FastPFor fastpfor;
+    FastPFor::Workspace ws;
+    const size_t rounded = length / 128 * 128;
+    for (int run = 0; run < 2; ++run) {// the workspaces are reused
+        size_t nvalue = out.size(), recovered = recover.size();
+        simdfastpfor.encodeArray(&data[0], rounded, &out[0], nvalue);
+        simdfastpfor.decodeArray(&out[0], nvalue, &recover[0], recovered, simdws);
+        if ((recovered != rounded) || !equal(recover.begin(), recover.begin() + rounded, data.begin()))
+            throw logic_error("SIMDFastPFor workspace bug");
+        nvalue = out.size();
+        recovered = recover.size();
+        fastpfor.encodeArray(&data[0], rounded, &out[0], nvalue);
+        fastpfor.decodeArray(&out[0], nvalue, &recover[0], recovered, ws);
+        if ((recovered != rounded) || !equal(recover.begin(), recover.begin() + rounded, data.begin()))
+            throw logic_error("FastPFor workspace bug");
+    }
+}
+
+// several threads decode different arrays at once through the shared instances of CODECFactory
+void testSharedDecoding() {
+    cout << "testing decoding from several threads through shared codecs..." << endl;
+    const size_t threads = 4;
+    for (const string name : {"fastpfor", "simdfastpfor", "simplepfor"}) {
+        shared_ptr<IntegerCODEC> & codec = CODECFactory::getFromName(name);
+        vector<vector<uint32_t, cacheallocator> > datas(threads), outs(threads);
+        for (size_t t = 0; t < threads; ++t) {
+            const size_t length = 65536 * (t + 1) + 1000 * t + 17;// several pages, a tail
+            datas[t].resize(length);
+            for (size_t i = 0; i < length; ++i)
+                datas[t][i] = rand() % (1U << (4 + 3 * t)) + (i % 97 == 0 ? 1U << 24 : 0);
+            outs[t].resize(codec->maxCompressedWords(length));
+            size_t nvalue = outs[t].size();
+            codec->clone()->encodeArray(datas[t].data(), length, outs[t].data(), nvalue);
+            outs[t].resize(nvalue);
+        }
+        vector<int> ok(threads, 0);
+        vector<thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+            workers.push_back(thread([&, t]() {
+                vector<uint32_t, cacheallocator> recovered(datas[t].size() + 1024);
+                ok[t] = 1;
+                for (int run = 0; run < 20; ++run) {
+                    size_t recoveredsize = recovered.size();
+                    codec->decodeArray(outs[t].data(), outs[t].size(), recovered.data(),
+                            recoveredsize);
+                    if ((recoveredsize != datas[t].size()) || !equal(datas[t].begin(),
+                            datas[t].end(), recovered.begin()))
+                        ok[t] = 0;
+                }
+            }));
+        for (thread & w : workers)
+            w.join();
+        if (count(ok.begin(), ok.end(), 1) != static_cast<int> (threads))
+            throw logic_error(name + ": decoding from several threads is broken");
+    }
+}
+
+// PageParallelCodec should decode what it encodes, whatever the number of threads
+template<class CODEC>
+void testPageParallelCodec() {
+    // enough pages (MinPagesPerThread each) for 4 threads
+    const size_t lengths[] = {0, 1000, 65536 * 5 + 17, 65536 * 17 + 17};
+    for (size_t length : lengths) {
+        vector<uint32_t, cacheallocator> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = rand() % 1000 + (i % 100 == 0 ? 1U << 20 : 0);
+        vector<uint32_t, cacheallocator> reference;
+        for (uint32_t threads = 1; threads <= 4; threads *= 2) {
+            PageParallelCodec<CODEC> ppc(threads);
+            vector<uint32_t, cacheallocator> out(ppc.maxCompressedWords(length)), recover(length);
+            size_t nvalue = out.size(), recovered = recover.size();
+            ppc.encodeArray(data.data(), length, out.data(), nvalue);
+            out.resize(nvalue);
+            if (threads == 1)
+                reference = out;
+            else if (out != reference)
+                throw logic_error("PageParallelCodec output depends on the number of threads");
+            ppc.decodeArray(out.data(), nvalue, recover.data(), recovered);
+            if ((recovered != length) || (recover != data)) {
+                cerr << ppc.name() << " length = " << length << endl;
+                throw logic_error("PageParallelCodec bug");
+            }
+            if (length < 65536)
+                continue;
+            // not enough room for the last page: the threads must not hang
+            bool caught = false;
+            try {
+                vector<uint32_t, cacheallocator> small(nvalue - 8);
+                size_t smallnvalue = small.size();
+                ppc.encodeArray(data.data(), length, small.data(), smallnvalue);
+            } catch (const NotEnoughStorage &) {
+                caught = true;
+            }
+            if (!caught)
+                throw logic_error("PageParallelCodec overflows its output");
+        }
+    }
+}
+
+void testPageParallelCodecs() {
+    cout << "testing PageParallelCodec..." << endl;
+    testPageParallelCodec<SIMDFastPFor> ();
+    testPageParallelCodec<FastPFor> ();
+    testPageParallelCodec<SIMDBinaryPacking> ();
+}
+
+void testCRC32C() {
+    const char digits[] = "123456789";
+    if ((crc32cSoftware(digits, 9, 0) != 0xE3069283U) || (crc32c(digits, 9) != 0xE3069283U))
+        throw logic_error("CRC32C bug");
+    vector<uint8_t> bytes(100000);
+    for (size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<uint8_t> (rand());
+    const size_t lengths[] = { 0, 1, 7, 3071, 3072, 3079, 5000, 65539, 100000 };
+    for (size_t length : lengths) {
+        const uint32_t expected = crc32cSoftware(bytes.data(), length, 12345);
+        if (cpuSupportsSSE42() && (crc32cHardware(bytes.data(), length, 12345) != expected))
+            throw logic_error("crc32cHardware bug");
+        // continuing from the CRC of a prefix
+        const size_t half = length / 3;
+        if (crc32c(bytes.data() + half, length - half, crc32c(bytes.data(), half, 12345))
+                != expected)
+            throw logic_error("CRC32C continuation bug");
+    }
+}
+
+void testChecksumCodec() {
+    cout << "testing CRC32C and ChecksumCodec..." << endl;
+    testCRC32C();
+    const size_t lengths[] = { 0, 1000, 65536 * 3 + 17 };
+    for (size_t length : lengths) {
+        vector<uint32_t, cacheallocator> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = rand() % 1000 + (i % 100 == 0 ? 1U << 20 : 0);
+        ChecksumCodec<SIMDFastPFor> codec;
+        vector<uint32_t, cacheallocator> out(codec.maxCompressedWords(length)), recover(length);
+        size_t nvalue = out.size(), recovered = recover.size();
+        codec.encodeArray(data.data(), length, out.data(), nvalue);
+        codec.decodeArray(out.data(), nvalue, recover.data(), recovered);
+        if ((recovered != length) || (recover != data) || !codec.verify(out.data(), nvalue))
+            throw logic_error("ChecksumCodec bug");
+        // a flipped bit in each word of the header
+        for (size_t w = 0; w < ChecksumCodec<SIMDFastPFor>::HeaderSize; ++w) {
+            out[w] ^= 1U << 4;
+            bool caught = false;
+            try {
+                recovered = recover.size();
+                codec.decodeArray(out.data(), nvalue, recover.data(), recovered);
+            } catch (const CorruptedHeader &) {
+                caught = true;
+            }
+            if (!caught || codec.verify(out.data(), nvalue))
+                throw logic_error("ChecksumCodec does not catch a corrupted header");
+            out[w] ^= 1U << 4;
+        }
+        if (length < 65536)
+            continue;
+        // a flipped bit in the second page, then a truncated array
+        out[nvalue / 2] ^= 1U << 7;
+        bool caught = false;
+        try {
+            recovered = recover.size();
+            codec.decodeArray(out.data(), nvalue, recover.data(), recovered);
+        } catch (const CorruptedPage & e) {
+            caught = (e.page == 1);
+        }
+        if (!caught || codec.verify(out.data(), nvalue) || codec.verify(out.data(), nvalue / 3))
+            throw logic_error("ChecksumCodec does not catch corruption");
+        out[nvalue / 2] ^= 1U << 7;
+        // verified on first touch only
+        ChecksumCodec<SIMDFastPFor> lazy(ChecksumCodec<SIMDFastPFor>::OnFirstTouch);
+        recovered = recover.size();
+        lazy.decodeArray(out.data(), nvalue, recover.data(), recovered);
+        out[nvalue / 2] ^= 1U << 7;
+        recovered = recover.size();
+        lazy.decodeArray(out.data(), nvalue, recover.data(), recovered);
+        lazy.forgetVerifiedPages();
+        caught = false;
+        try {
+            recovered = recover.size();
+            lazy.decodeArray(out.data(), nvalue, recover.data(), recovered);
+        } catch (const CorruptedPage &) {
+            caught = true;
+        }
+        if (!caught)
+            throw logic_error("ChecksumCodec::OnFirstTouch bug");
+    }
+}
+
+void testBatch() {
+    cout << "testing encodeBatch and decodeBatch..." << endl;
+    vector < shared_ptr<IntegerCODEC> > myalgos = CODECFactory::allSchemes();
+    const size_t howmany = 300;
+    vector<vector<uint32_t, cacheallocator> > arrays(howmany);
+    vector<ListDescriptor> lists(howmany);
+    size_t total = 0;
+    for (size_t i = 0; i < howmany; ++i) {
+        const size_t length = (i % 10 == 0) ? rand() % 5000 : rand() % 300;
+        for (size_t j = 0; j < length; ++j)
+            arrays[i].push_back(rand() % 1000);
+        lists[i].data = arrays[i].data();
+        lists[i].length = length;
+        total += length;
+    }
+    for (auto & c : myalgos) {
+        if (c->name() == "VSEncoding") // VSEncoding is fragile on short arrays
+            continue;
+        vector<uint32_t, cacheallocator> out(2 * total + 1024 * howmany);
+        size_t nvalue = out.size();
+        c->encodeBatch(lists.data(), howmany, out.data(), nvalue);
+        if (IntegerCODEC::batchSize(out.data()) != howmany)
+            throw logic_error("encodeBatch bug");
+        vector<uint32_t, cacheallocator> recover(total + 1024);
+        size_t recovered = recover.size();
+        c->decodeBatch(out.data(), recover.data(), recovered);
+        if (recovered != total)
+            throw logic_error("decodeBatch length bug");
+        size_t pos = 0;
+        for (size_t i = 0; i < howmany; ++i) {
+            if (!equal(arrays[i].begin(), arrays[i].end(), recover.begin() + pos)) {
+                cerr << c->name() << " array " << i << endl;
+                throw logic_error("decodeBatch bug");
+            }
+            pos += IntegerCODEC::batchLength(out.data(), i);
+        }
+        for (size_t t = 0; t < 20; ++t) {
+            const size_t i = rand() % howmany;
+            size_t n = recover.size();
+            c->decodeFromBatch(out.data(), i, recover.data(), n);
+            if ((n != arrays[i].size()) || !equal(arrays[i].begin(), arrays[i].end(), recover.begin()))
+                throw logic_error("decodeFromBatch bug");
+        }
+    }
+}
+
+// an index file with one array, a header field or an entry field overwritten
+template<class T>
+bool indexFileRejects(const vector<char> & file, const size_t where, const T value) {
+    char filename[] = "/tmp/fastpforindexXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0)
+        throw runtime_error("could not create a temporary file");
+    vector<char> corrupted(file);
+    memcpy(&corrupted[where], &value, sizeof(value));
+    const bool written = ::write(fd, corrupted.data(), corrupted.size())
+            == static_cast<ssize_t> (corrupted.size());
+    close(fd);
+    bool caught = false;
+    try {
+        IndexFileReader reader(filename);
+    } catch (const runtime_error &) {
+        caught = true;
+    }
+    remove(filename);
+    return written && caught;
+}
+
+void testCorruptedIndexFile() {
+    char filename[] = "/tmp/fastpforindexXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0)
+        throw runtime_error("could not create a temporary file");
+    close(fd);
+    {
+        vector<uint32_t> data(100, 7);
+        IndexFileWriter writer(filename);
+        writer.add("vbyte", data.data(), data.size());
+    }
+    vector<char> file;
+    {
+        ifstream in(filename, ios::binary);
+        file.assign(istreambuf_iterator<char> (in), istreambuf_iterator<char> ());
+    }
+    remove(filename);
+    IndexFileHeader header;
+    memcpy(&header, file.data(), sizeof(header));
+    const size_t entry = static_cast<size_t> (header.directoryoffset);
+    const bool rejected =
+            // the codec name without its zero byte
+            indexFileRejects(file, file.size() - 1, 'x')
+            // numberofarrays * sizeof(IndexFileEntry) wraps around to 8
+            && indexFileRejects(file, offsetof(IndexFileHeader, numberofarrays),
+                    uint64_t(0x0AAAAAAAAAAAAAABULL))
+            && indexFileRejects(file, offsetof(IndexFileHeader, directoryoffset),
+                    header.directoryoffset + 4)
+            && indexFileRejects(file, offsetof(IndexFileHeader, codecnamesbytes),
+                    header.codecnamesbytes - 1)
+            // offset + 4 * length wraps around
+            && indexFileRejects(file, entry + offsetof(IndexFileEntry, length),
+                    uint64_t(1) << 62)
+            && indexFileRejects(file, entry + offsetof(IndexFileEntry, offset), uint64_t(0))
+            && indexFileRejects(file, entry + offsetof(IndexFileEntry, offset),
+                    uint64_t(sizeof(IndexFileHeader) + 4));
+    if (!rejected)
+        throw logic_error("IndexFileReader accepts a corrupted file");
+}
+
+void testIndexFile() {
+    cout << "testing IndexFileWriter and IndexFileReader..." << endl;
+    char filename[] = "/tmp/fastpforindexXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0)
+        throw runtime_error("could not create a temporary file");
+    close(fd);
+    const char * names[] = {"simdbinarypacking", "simdfastpfor", "fastpfor", "vbyte", "copy"};
+    vector<vector<uint32_t, cacheallocator> > arrays;
+    {
+        IndexFileWriter writer(filename);
+        for (size_t i = 0; i < 50; ++i) {
+            vector<uint32_t, cacheallocator> data(rand() % 5000);
+            for (size_t j = 0; j < data.size(); ++j)
+                data[j] = rand() % 1000;
+            if (i % 3 == 0) {// compressed beforehand
+                shared_ptr<IntegerCODEC> codec = CODECFactory::getFromName(names[i % 5])->clone();
+                vector<uint32_t, cacheallocator> compressed(codec->maxCompressedWords(data.size()));
+                size_t nvalue = compressed.size();
+                codec->encodeArray(data.data(), data.size(), compressed.data(), nvalue);
+                writer.addCompressed(names[i % 5], compressed.data(), nvalue, data.size());
+            } else
+                writer.add(names[i % 5], data.data(), data.size());
+            arrays.push_back(data);
+        }
+    }
+    IndexFileReader reader(filename);
+    if (reader.size() != arrays.size())
+        throw logic_error("IndexFileReader size bug");
+    for (size_t i = 0; i < reader.size(); ++i) {
+        if ((reader.count(i) != arrays[i].size()) || (reader.codecName(i) != names[i % 5])
+                || (reinterpret_cast<uintptr_t> (reader.compressed(i)) % 16 != 0))
+            throw logic_error("IndexFileReader directory bug");
+        vector<uint32_t, cacheallocator> recover(arrays[i].size() + 1024);
+        size_t nvalue = recover.size();
+        reader.decode(i, recover.data(), nvalue);
+        recover.resize(nvalue);
+        if (recover != arrays[i])
+            throw logic_error("IndexFileReader decoding bug");
+    }
+    reader.close();
+    bool caught = false;
+    try {// the count would not fit
+        IndexFileWriter writer(filename);
+        writer.addCompressed("copy", arrays[0].data(), 0, size_t(1) << 32);
+    } catch (const invalid_argument &) {
+        caught = true;
+    }
+    if (!caught)
+        throw logic_error("IndexFileWriter takes 2^32 integers");
+    testCorruptedIndexFile();
+    remove(filename);
+}
+
+void testPostingStore() {
+    cout << "testing PostingStore..." << endl;
+    vector<vector<uint32_t> > lists(3000);
+    for (size_t i = 0; i < lists.size(); ++i) {
+        // mostly short lists, some empty, a few long ones
+        const size_t length = i % 97 == 0 ? 0 : i % 500 == 1 ? 20000 + rand() % 1000
+                : rand() % 40;
+        uint32_t x = 0;
+        for (size_t j = 0; j < length; ++j)
+            lists[i].push_back(x += 1 + (i % 3 == 0 ? 0 : rand() % (1 + i % 300)));
+    }
+    const string names[] = { "auto", "simdfastpfor", "simdbinarypacking", "vbyte" };
+    for (const string & name : names) {
+        for (uint32_t threads = 1; threads <= 3; threads += 2) {
+            PostingStore store(name);
+            store.load(vector<vector<uint32_t> > (lists.begin(), lists.begin() + 1000),
+                    threads);
+            store.load(vector<vector<uint32_t> > (lists.begin() + 1000, lists.end()), threads);
+            if (store.size() != lists.size())
+                throw logic_error("PostingStore: bad size");
+            vector<uint32_t, cacheallocator> out;
+            size_t term = 0;
+            for (PostingStore::const_iterator i = store.begin(); i != store.end(); ++i, ++term) {
+                if (((*i).id() != term) || ((*i).count() != lists[term].size()))
+                    throw logic_error("PostingStore: bad iterator");
+                if ((reinterpret_cast<uintptr_t> ((*i).compressed()) & 15) != 0)
+                    throw logic_error("PostingStore: misaligned array");
+                store.get(term, out);
+                if ((out.size() != lists[term].size()) || !equal(out.begin(), out.end(),
+                        lists[term].begin()))
+                    throw logic_error("PostingStore: bad decoding");
+                if ((name != "auto") && (store.codecName(term) != name))
+                    throw logic_error("PostingStore: bad codec");
+            }
+        }
+    }
+    bool threw = false;
+    try {
+        PostingStore store("nosuchcodec");
+    } catch (invalid_argument &) {
+        threw = true;
+    }
+    if (!threw)
+        throw logic_error("PostingStore should reject unknown codecs");
+}
+
+template<class CODEC>
+void testAppendableList() {
+    AppendableList<CODEC> list;
+    vector<uint32_t, cacheallocator> reference;
+    for (size_t round = 0; round < 200; ++round) {
+        const size_t n = round % 10 == 0 ? rand() % 5000 : rand() % 50;
+        vector<uint32_t> values(n);
+        for (size_t j = 0; j < n; ++j)
+            values[j] = rand() % (1U << (round % 20));
+        if (n == 1)
+            list.push_back(values[0]);
+        else
+            list.append(values.data(), n);
+        reference.insert(reference.end(), values.begin(), values.end());
+        if (round % 50 != 49)
+            continue;
+        vector<uint32_t, cacheallocator> out(list.size());
+        list.decode(out.data());
+        if ((list.size() != reference.size()) || (out != reference) || (AppendableList<
+                CODEC>::decodedLength(list.data(), list.compressedWords()) != reference.size()))
+            throw logic_error("AppendableList bug");
+        // the sealed pages are kept as they are
+        AppendableList<CODEC> copy;
+        copy.load(list.data(), list.compressedWords());
+        if (!equal(list.data(), list.data() + list.compressedWords(), copy.data()) || (copy.size()
+                != list.size()))
+            throw logic_error("AppendableList::load bug");
+        copy.push_back(7);
+        list.push_back(7);
+        reference.push_back(7);
+        if (!equal(list.data(), list.data() + list.compressedWords(), copy.data()))
+            throw logic_error("AppendableList::load bug");
+    }
+    list.clear();
+    if ((list.size() != 0) || (list.compressedWords() != AppendableList<CODEC>::HeaderSize))
+        throw logic_error("AppendableList::clear bug");
+}
+
+void testAppendableLists() {
+    cout << "testing AppendableList..." << endl;
+    testAppendableList<SIMDBinaryPacking> ();
+    testAppendableList<SIMDFastPFor> ();
+}
+
+void testMemoryPolicy() {
+    cout << "testing MemoryPolicy..." << endl;
+    const MemoryPolicy initial = memoryPolicy();
+    const MemoryPolicy::Pages pages[] = { MemoryPolicy::SmallPages,
+            MemoryPolicy::TransparentHugePages, MemoryPolicy::HugePages2MB };
+    const MemoryPolicy::Placement placements[] = { MemoryPolicy::FirstTouch,
+            MemoryPolicy::LocalNode, MemoryPolicy::Interleaved, MemoryPolicy::BoundNode };
+    for (size_t i = 0; i < sizeof(pages) / sizeof(pages[0]); ++i)
+        for (size_t j = 0; j < sizeof(placements) / sizeof(placements[0]); ++j) {
+            memoryPolicy().pages = pages[i];
+            memoryPolicy().placement = placements[j];
+            memoryPolicy().minimumBytes = 1 << 20;
+            // small and large blocks, resized across the threshold
+            vector<uint32_t, cacheallocator> small(1000, 3), large(1 << 20);
+            for (size_t k = 0; k < large.size(); ++k)
+                large[k] = static_cast<uint32_t> (k);
+            if (needPaddingTo64bytes(large.data()) || needPaddingTo64bytes(small.data()))
+                throw logic_error("MemoryPolicy: misaligned block");
+            small.resize(1 << 19, 5);
+            large.resize(100);
+            large.shrink_to_fit();
+            if ((small[999] != 3) || (small.back() != 5) || (large[99] != 99))
+                throw logic_error("MemoryPolicy bug");
+            SIMDFastPFor codec;
+            vector<uint32_t, cacheallocator> compressed(codec.maxCompressedWords(small.size()));
+            size_t nvalue = compressed.size();
+            codec.encodeArray(small.data(), small.size(), compressed.data(), nvalue);
+            vector<uint32_t, cacheallocator> recovered(small.size());
+            size_t recoveredsize = recovered.size();
+            codec.decodeArray(compressed.data(), nvalue, recovered.data(), recoveredsize);
+            if (recovered != small)
+                throw logic_error("MemoryPolicy: decoding bug");
+        }
+    memoryPolicy() = initial;
+}
+
+void testCodecCounters() {
+    cout << "testing CodecCounters..." << endl;
+    typedef CodecCounters<true> counters;
+    counters::reset();
+    // the counters of threads that have exited are kept
+    parallelFor(8, [](size_t k) {
+        counters::encodedBlock(static_cast<uint32_t> (k), 2);
+        counters::decodedBlocks(3, 5);
+        counters::tail(7);
+    }, 4);
+    counters::storageRetry();
+    CodecStats s = counters::snapshot();
+    if ((s.encodedblocks != 8) || (s.encodedexceptions != 16) || (s.decodedblocks != 24)
+            || (s.patchedexceptions != 40) || (s.tailarrays != 8) || (s.tailintegers != 56)
+            || (s.storageretries != 1) || (s.bitwidths.histo[7] != 1)
+            || (s.bitwidths.histo[8] != 0))
+        throw logic_error("CodecCounters bug");
+    counters::reset();
+    s = counters::snapshot();
+    if ((s.encodedblocks != 0) || (s.storageretries != 0) || (s.bitwidths.histo[7] != 0))
+        throw logic_error("CodecCounters::reset bug");
+    // compiled out
+    CodecCounters<false>::encodedBlock(3, 1);
+    if (CodecCounters<false>::snapshot().encodedblocks != 0)
+        throw logic_error("CodecCounters<false> should count nothing");
+}
+
+void testMaropuReaders() {
+    cout << "testing MaropuMappedReader and MaropuBlockReader..." << endl;
+    char filename[] = "/tmp/fastpformaropuXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0)
+        throw runtime_error("could not create a temporary file");
+    close(fd);
+    vector<vector<uint32_t, cacheallocator> > arrays(100);
+    FILE * f = fopen(filename, "wb");
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        arrays[i].resize(rand() % 3000);
+        for (size_t j = 0; j < arrays[i].size(); ++j)
+            arrays[i][j] = rand();
+        const uint32_t length = static_cast<uint32_t> (arrays[i].size());
+        fwrite(&length, sizeof(length), 1, f);
+        fwrite(arrays[i].data(), sizeof(uint32_t), length, f);
+    }
+    fclose(f);
+    MaropuMappedReader mapped(filename);
+    mapped.open();
+    const uint32_t * data;
+    size_t length;
+    for (size_t i = 0; i < arrays.size(); ++i)
+        if (!mapped.nextList(data, length) || !equal(data, data + length, arrays[i].begin())
+                || (length != arrays[i].size()))
+            throw logic_error("MaropuMappedReader bug");
+    if (mapped.nextList(data, length))
+        throw logic_error("MaropuMappedReader does not stop");
+    mapped.close();
+    // small blocks, skipping lists with fewer than 10 integers, at most 90 lists
+    MaropuBlockReader reader(filename, 10000, 10, 100000, 90);
+    vector<vector<uint32_t, cacheallocator> > datas;
+    size_t i = 0, seen = 0;
+    while (reader.nextBlock(datas)) {
+        for (size_t k = 0; k < datas.size(); ++k, ++i, ++seen) {
+            while (arrays[i].size() < 10)
+                ++i;
+            if (datas[k] != arrays[i])
+                throw logic_error("MaropuBlockReader bug");
+        }
+    }
+    if (seen != 90)
+        throw logic_error("MaropuBlockReader does not stop");
+    remove(filename);
+}
+
+// the scratch buffers are reused from call to call until trim frees them
+template<class CODEC>
+void testTrim(CODEC & codec) {
+    const size_t length = 65536 * 2 + 128 * 10;
+    vector<uint32_t, cacheallocator> data(length);
+    for (size_t i = 0; i < length; ++i)
+        data[i] = rand() % 1000 + (i % 50 == 0 ? 1U << 24 : 0);
+    vector<uint32_t, cacheallocator> out(2 * length + 1024), recover(length);
+    for (int run = 0; run < 3; ++run) {
+        size_t nvalue = out.size(), recovered = recover.size();
+        codec.encodeArray(&data[0], length, &out[0], nvalue);
+        codec.decodeArray(&out[0], nvalue, &recover[0], recovered);
+        if ((recovered != length) || (recover != data))
+            throw logic_error(codec.name() + " trim bug");
+        if (run == 1)
+            codec.trim();
+    }
+}
+
+void testTrims() {
+    cout << "testing trim..." << endl;
+    FastPFor fastpfor;
+    testTrim(fastpfor);
+    SIMDFastPFor simdfastpfor;
+    testTrim(simdfastpfor);
+#ifdef FASTPFOR_X86
+    SIMDFastPFor256 simdfastpfor256;
+    testTrim(simdfastpfor256);
+#endif
+    SimplePFor<> simplepfor;
+    testTrim(simplepfor);
+    PFor pfor;
+    testTrim(pfor);
+    PFor2008 pfor2008;
+    testTrim(pfor2008);
+    fastpfor.trim();
+    for (size_t k = 0; k < FastPFor::threadWorkspace().datatobepacked.size(); ++k)
+        if (FastPFor::threadWorkspace().datatobepacked[k].capacity() != 0)
+            throw logic_error("FastPFor::trim bug");
+}
+
+// random integers, hard to compress: each block of 128 has its own bit
+// width and a random proportion of (possibly very large) exceptions
+void fillAdversarial(vector<uint32_t, cacheallocator> & data, const uint32_t maxbits = 32) {
+    for (size_t i = 0; i < data.size(); i += 128) {
+        const uint32_t b = rand() % (maxbits + 1);
+        const uint32_t exceptbits = rand() % (maxbits + 1);
+        const int exceptrate = rand() % 64;
+        for (size_t j = i; j < min<size_t>(i + 128, data.size()); ++j) {
+            const uint32_t r = (static_cast<uint32_t> (rand()) << 16) ^ rand();
+            const uint32_t bits = rand() % 64 < exceptrate ? exceptbits : b;
+            data[j] = bits == 32 ? r : r & ((1U << bits) - 1);
+        }
+    }
+}
+
+// encoding never writes past maxCompressedWords, decodedLength is never too small
+void testMaxCompressedWords(IntegerCODEC & c, const size_t length, const bool exact) {
+    const uint32_t canary = 0xDEADBEEF;
+    // Simple9 and Simple16 only support 28-bit integers
+    const uint32_t maxbits = (c.name().find("Simple9") != string::npos)
+            || (c.name().find("Simple16") != string::npos) ? 28 : 32;
+    for (int run = 0; run < 10; ++run) {
+        vector<uint32_t, cacheallocator> data(length);
+        if (run == 0)
+            fill(data.begin(), data.end(), maxbits == 32 ? 0xFFFFFFFF : (1U << maxbits) - 1);
+        else
+            fillAdversarial(data, maxbits);
+        const size_t bound = c.maxCompressedWords(length);
+        vector<uint32_t, cacheallocator> out(bound + 256, canary);
+        size_t nvalue = bound;
+        c.encodeArray(data.data(), length, out.data(), nvalue);
+        if ((nvalue > bound) || (out[bound] != canary)) {
+            cerr << c.name() << " length " << length << " used " << nvalue
+                    << " bound " << bound << endl;
+            throw logic_error("maxCompressedWords bug");
+        }
+        const size_t decodedlength = c.decodedLength(out.data(), nvalue);
+        if ((decodedlength < length) || (exact && (decodedlength != length))) {
+            cerr << c.name() << " length " << length << " decodedLength "
+                    << decodedlength << endl;
+            throw logic_error("decodedLength bug");
+        }
+    }
+}
+
+void testMaxCompressedWords() {
+    cout << "testing maxCompressedWords and decodedLength..." << endl;
+    const size_t lengths[] = {0, 1, 127, 128, 1000, 2048, 65536 + 2048 * 3 + 17};
+    for (auto & c : CODECFactory::allSchemes()) {
+        if (c->name() == "VSEncoding") // VSEncoding is fragile on short arrays
+            continue;
+        const bool exact = c->name().find('+') == string::npos;// not a CompositeCodec
+        for (size_t length : lengths)
+            testMaxCompressedWords(*c, length, exact);
+    }
+    // codecs not in the factory, on whole blocks
+    vector < shared_ptr<IntegerCODEC> > others = {
+            shared_ptr<IntegerCODEC> (new BinaryPacking<32> ()),
+            shared_ptr<IntegerCODEC> (new ByteAlignedPacking<32, true> ()),
+            shared_ptr<IntegerCODEC> (new SIMDGlobalBinaryPacking ()),
+            shared_ptr<IntegerCODEC> (new FastPFor ()),
+            shared_ptr<IntegerCODEC> (new SIMDFastPFor ()),
+            shared_ptr<IntegerCODEC> (new PFor ()),
+            shared_ptr<IntegerCODEC> (new Simple16<true> ()),
+            shared_ptr<IntegerCODEC> (new Simple9<true> ()),
+            shared_ptr<IntegerCODEC> (new PageParallelCodec<> (2)) };
+    for (auto & c : others) {
+        testMaxCompressedWords(*c, 2048 * 40, true);
+        testMaxCompressedWords(*c, 0, true);
+    }
+    // without MarkLength, the selectors give an upper bound
+    Simple8b<false> simple8b;
+    testMaxCompressedWords(simple8b, 1000, false);
+    Simple16<false> simple16;
+    vector<uint32_t, cacheallocator> small(1000, 7), out(simple16.maxCompressedWords(1000));
+    size_t nvalue = out.size();
+    simple16.encodeArray(small.data(), small.size(), out.data(), nvalue);
+    if (simple16.decodedLength(out.data(), nvalue) < small.size())
+        throw logic_error("Simple16 decodedLength bug");
+    // uncompress no longer needs a hint
+    vector<uint32_t> data(5000);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = rand() % 10000;
+    for (const char * name : {"vbyte", "simple8b", "varintg8iu"}) {
+        shared_ptr<IntegerCODEC> c = CODECFactory::getFromName(name);
+        if (c->uncompress(c->compress(data)) != data)
+            throw logic_error("uncompress bug");
+    }
+}
+
+// blocks that favor each scheme in turn: HybridCodec should use all four
+void testHybridCodec() {
+    cout << "testing HybridCodec..." << endl;
+    HybridCodec hybrid;
+    const size_t numberofblocks = 64;
+    vector<uint32_t, cacheallocator> data(numberofblocks * HybridCodec::BlockSize);
+    for (size_t k = 0; k < numberofblocks; ++k) {
+        uint32_t * block = &data[k * HybridCodec::BlockSize];
+        for (uint32_t j = 0; j < HybridCodec::BlockSize; ++j) {
+            switch (k % 4) {
+            case 0: // uniform gaps
+                block[j] = rand() % 1000;
+                break;
+            case 1: // small values and a few outliers
+                block[j] = j % 16 == 0 ? 1U << 30 : rand() % 8;
+                break;
+            case 2: // a long run of zeros, then larger values
+                block[j] = j < 120 ? 0 : rand() % (1U << 20);
+                break;
+            case 3: // mostly 7-bit values and a few 27-bit ones
+                block[j] = j % 3 == 0 ? rand() % (1U << 27) : rand() % (1U << 7);
+                break;
+            }
+        }
+    }
+    vector<uint32_t, cacheallocator> out(hybrid.maxCompressedWords(data.size()));
+    size_t nvalue = out.size();
+    hybrid.encodeArray(data.data(), data.size(), out.data(), nvalue);
+    vector<uint32_t> used(4, 0);
+    for (size_t k = 0; k < numberofblocks; ++k)
+        used[(out[HybridCodec::HeaderSize + k / HybridCodec::SchemesPerWord]
+                >> (2 * (k % HybridCodec::SchemesPerWord))) & 3]++;
+    for (uint32_t scheme = 0; scheme < 4; ++scheme)
+        if (used[scheme] == 0)
+            throw logic_error("HybridCodec should use all of its schemes here");
+    vector<uint32_t, cacheallocator> recovered(data.size());
+    size_t recoveredsize = recovered.size();
+    const uint32_t * end = hybrid.decodeArray(out.data(), nvalue, recovered.data(),
+            recoveredsize);
+    if ((recovered != data) || (end != out.data() + nvalue))
+        throw logic_error("HybridCodec bug");
+    // no worse than packing each block
+    SIMDBinaryPacking packing;
+    vector<uint32_t, cacheallocator> packed(packing.maxCompressedWords(data.size()));
+    size_t packedsize = packed.size();
+    packing.encodeArray(data.data(), data.size(), packed.data(), packedsize);
+    if (nvalue > packedsize + 8)
+        throw logic_error("HybridCodec compresses badly");
+}
+
+// runs of constant gaps, within and across blocks, between packed blocks
+void testRunLengthCodec() {
+    cout << "testing RunLengthCodec..." << endl;
+    RunLengthCodec rle;
+    const size_t numberofblocks = 64;
+    vector<uint32_t, cacheallocator> data(numberofblocks * RunLengthCodec::BlockSize);
+    for (size_t k = 0; k < data.size(); ++k) {
+        const size_t block = k / RunLengthCodec::BlockSize;
+        if (block < 10)// one run of 1s over 10 blocks
+            data[k] = 1;
+        else if (block < 12)// stride 1, 2 blocks
+            data[k] = static_cast<uint32_t> (1000 + k);
+        else if (block < 14)// the same stride, but not the same progression
+            data[k] = static_cast<uint32_t> (block * 1000000 + k);
+        else if (block < 16)// wrapping around 2^32
+            data[k] = static_cast<uint32_t> (0xFFFFFF00U - 3 * k);
+        else if (block % 3 == 0)
+            data[k] = 0;
+        else
+            data[k] = rand() % 1000;
+    }
+    vector<uint32_t, cacheallocator> out(rle.maxCompressedWords(data.size()));
+    size_t nvalue = out.size();
+    rle.encodeArray(data.data(), data.size(), out.data(), nvalue);
+    // the runs over blocks 0-9, 10-11, 12, 13, 14-15, and the blocks of zeros
+    if (out[1] != 5 + 16)
+        throw logic_error("RunLengthCodec misses runs");
+    vector<uint32_t, cacheallocator> recovered(data.size());
+    size_t recoveredsize = recovered.size();
+    const uint32_t * end = rle.decodeArray(out.data(), nvalue, recovered.data(),
+            recoveredsize);
+    if ((recovered != data) || (end != out.data() + nvalue))
+        throw logic_error("RunLengthCodec bug");
+    // no worse than packing each block
+    SIMDBinaryPacking packing;
+    vector<uint32_t, cacheallocator> packed(packing.maxCompressedWords(data.size()));
+    size_t packedsize = packed.size();
+    packing.encodeArray(data.data(), data.size(), packed.data(), packedsize);
+    if (nvalue > packedsize)
+        throw logic_error("RunLengthCodec compresses badly");
+}
+
+void testShortListCodec() {
+    cout << "testing ShortListCodec..." << endl;
+    ShortListCodec shortlist;
+    LengthAwareCodec<SIMDFastPFor> lengthaware;
+    CompositeCodec<SIMDFastPFor, VariableByte> composite;
+    for (size_t length = 0; length < 300; length += 1 + length / 8)
+        for (uint32_t bit = 0; bit <= 32; bit += 4) {
+            vector<uint32_t, cacheallocator> data(length);
+            for (size_t j = 0; j < length; ++j)
+                data[j] = bit == 32 ? static_cast<uint32_t> (rand()) * 3 : static_cast<uint32_t> (rand()) % (1U << bit);
+            if ((length > 0) && (bit > 0))
+                data[length / 2] |= 1U << (bit - 1);
+            vector<uint32_t, cacheallocator> out(lengthaware.maxCompressedWords(length));
+            size_t nvalue = out.size();
+            shortlist.encodeArray(data.data(), length, out.data(), nvalue);
+            if (nvalue != 1 + (length * bit + 31) / 32)
+                throw logic_error("ShortListCodec does not pack tightly");
+            vector<uint32_t, cacheallocator> recovered(length);
+            size_t recoveredsize = length;
+            // the exact number of words: we should not read past them
+            vector<uint32_t> exact(out.begin(), out.begin() + nvalue);
+            const uint32_t * end = shortlist.decodeArray(exact.data(), nvalue, recovered.data(),
+                    recoveredsize);
+            if ((recovered != data) || (end != exact.data() + nvalue))
+                throw logic_error("ShortListCodec bug");
+            nvalue = out.size();
+            lengthaware.encodeArray(data.data(), length, out.data(), nvalue);
+            recoveredsize = length;
+            end = lengthaware.decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+            if ((recovered != data) || (end != out.data() + nvalue) || (recoveredsize != length))
+                throw logic_error("LengthAwareCodec bug");
+            // short arrays cost no more than with VariableByte for the tail
+            vector<uint32_t, cacheallocator> vb(composite.maxCompressedWords(length));
+            size_t vbsize = vb.size();
+            composite.encodeArray(data.data(), length, vb.data(), vbsize);
+            if ((length < SIMDFastPFor::BlockSize) && (nvalue > vbsize))
+                throw logic_error("LengthAwareCodec compresses badly");
+        }
+}
+
+// the estimates should be close to the actual sizes, and the recommended
+// codec close to the best one
+void testRecommend() {
+    cout << "testing CODECFactory::recommend..." << endl;
+    const size_t length = 100000;
+    for (int run = 0; run < 4; ++run) {
+        vector<uint32_t, cacheallocator> data(length);
+        for (size_t i = 0; i < length; ++i) {
+            if (run == 0) // small integers and rare outliers
+                data[i] = rand() % 100 == 0 ? 1U << 30 : rand() % 16;
+            else if (run == 1) // uniform
+                data[i] = rand() % (1U << 12);
+            else if (run == 2) // mostly 1s (dense runs)
+                data[i] = rand() % 32 == 0 ? rand() % 1000 : 1;
+            else // unsorted, around a large value
+                data[i] = 2000000000U + rand() % 5000;
+        }
+        size_t bestsize = numeric_limits<size_t>::max();
+        for (const CodecEstimate & e : CODECFactory::estimate(data.data(), length)) {
+            IntegerCODEC & c = *CODECFactory::getFromName(e.name);
+            vector<uint32_t, cacheallocator> out(c.maxCompressedWords(length));
+            size_t nvalue = out.size();
+            c.encodeArray(data.data(), length, out.data(), nvalue);
+            bestsize = min(bestsize, nvalue);
+            const double actual = 32.0 * nvalue / length;
+            if (fabs(e.bitsperint - actual) > 0.15 * actual + 0.5) {
+                cerr << e.name << " estimated " << e.bitsperint << " actual " << actual << endl;
+                throw logic_error("CODECFactory::estimate is off");
+            }
+        }
+        IntegerCODEC & c = *CODECFactory::recommend(data.data(), length);
+        vector<uint32_t, cacheallocator> out(c.maxCompressedWords(length));
+        size_t nvalue = out.size();
+        c.encodeArray(data.data(), length, out.data(), nvalue);
+        if (nvalue > bestsize * 11 / 10)
+            throw logic_error("CODECFactory::recommend picked a poor codec");
+    }
+    // if decoding speed is all that matters
+    vector<uint32_t> data(1000, 1);
+    if (CODECFactory::recommend(data.data(), data.size(), 1000)->name() != "JustCopy")
+        throw logic_error("CODECFactory::recommend should pick the fastest codec");
+}
+
+// unsorted integers around a large value
+void testSIMDFrameOfReference() {
+    cout << "testing SIMDFrameOfReference..." << endl;
+    shared_ptr<IntegerCODEC> c = CODECFactory::getFromName("simdframeofreference");
+    for (size_t length : {0, 100, 128 * 50, 128 * 50 + 77}) {
+        vector<uint32_t, cacheallocator> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = 3000000000U + (i / 1000) * 100000 + rand() % 1000;
+        if (length > 300)
+            data[300] = 0xFFFFFFFF;// a block with the full range
+        vector<uint32_t, cacheallocator> out(c->maxCompressedWords(length));
+        size_t nvalue = out.size();
+        c->encodeArray(data.data(), length, out.data(), nvalue);
+        vector<uint32_t, cacheallocator> recovered(length + 1024);
+        size_t recoveredsize = recovered.size();
+        c->decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+        recovered.resize(recoveredsize);
+        if (recovered != data)
+            throw logic_error("SIMDFrameOfReference bug");
+        if ((length == 128 * 50) && (nvalue * 32 > 12 * length))
+            throw logic_error("SIMDFrameOfReference compresses badly");
+    }
+}
+
+// zigzag deltas of a random walk going up and down (signed)
+void testZigZagDelta() {
+    cout << "testing zigzag deltas..." << endl;
+    for (size_t length : {0, 1, 3, 4, 5, 7, 100, 1024, 128 * 40 + 3}) {
+        vector<int32_t> walk(length + 1);
+        int32_t value = -5;
+        for (size_t i = 0; i < length; ++i) {
+            value += rand() % 201 - 100;
+            walk[i + 1] = value;
+        }
+        if (length > 7)
+            walk[7] = numeric_limits<int32_t>::min();
+        for (int SIMDmode = 0; SIMDmode < 2; ++SIMDmode) {
+            vector<int32_t> copy(walk);
+            int32_t * data = copy.data() + 1;// not aligned
+            if (SIMDmode)
+                Delta::zigzagDeltaSIMD(data, length);
+            else
+                Delta::zigzagDelta(data, length);
+            for (size_t i = 12; i < length; ++i)
+                if (static_cast<uint32_t> (data[i]) > 4 * 201)
+                    throw logic_error("zigzag deltas should be small");
+            if (SIMDmode)
+                Delta::inverseZigzagDeltaSIMD(data, length);
+            else
+                Delta::inverseZigzagDelta(data, length);
+            if (copy != walk)
+                throw logic_error("zigzag delta bug");
+        }
+        for (string name : {"zigzag-simdbinarypacking", "zigzag-vbyte"}) {
+            shared_ptr<IntegerCODEC> c = CODECFactory::getFromName(name);
+            ZigZagDeltaCodec & zz = dynamic_cast<ZigZagDeltaCodec &> (*c);
+            vector<uint32_t, cacheallocator> out(zz.maxCompressedWords(length));
+            size_t nvalue = out.size();
+            zz.encodeArray(walk.data() + 1, length, out.data(), nvalue);
+            vector<uint32_t, cacheallocator> recovered(length + 1024);
+            int32_t * signedrecovered = reinterpret_cast<int32_t *> (recovered.data());
+            size_t recoveredsize = recovered.size();
+            zz.decodeArray(out.data(), nvalue, signedrecovered, recoveredsize);
+            if ((recoveredsize != length) || !equal(signedrecovered,
+                    signedrecovered + length, walk.begin() + 1))
+                throw logic_error("ZigZagDeltaCodec bug");
+            if ((length == 1024) && (name == "zigzag-simdbinarypacking")
+                    && (nvalue * 32 > 16 * length))// 32 bits without zigzag
+                throw logic_error("ZigZagDeltaCodec compresses badly");
+        }
+    }
+}
+
+// every byte length, and every size of the last group
+void testStreamVByte() {
+    cout << "testing StreamVByte..." << endl;
+    StreamVByte svb;
+    for (size_t length = 0; length < 300; length += (length < 20 ? 1 : 37)) {
+        vector<uint32_t> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = static_cast<uint32_t> (rand()) >> (8 * (rand() % 4));
+        vector<uint32_t> out(svb.maxCompressedWords(length) + 1, 0xFFFFFFFF);
+        size_t nvalue = out.size() - 1;
+        svb.encodeArray(data.data(), length, out.data() + 1, nvalue);// not aligned
+        size_t exactnvalue = nvalue;// enough room, without the bound
+        svb.encodeArray(data.data(), length, out.data() + 1, exactnvalue);
+        if (exactnvalue != nvalue)
+            throw logic_error("StreamVByte should fit in what it needs");
+        vector<uint32_t> recovered(length + 1);
+        size_t recoveredsize = length;
+        const uint32_t * end = svb.decodeArray(out.data() + 1, nvalue,
+                recovered.data() + 1, recoveredsize);
+        if ((end != out.data() + 1 + nvalue) || (recoveredsize != length)
+                || !equal(data.begin(), data.end(), recovered.begin() + 1))
+            throw logic_error("StreamVByte bug");
+    }
+    // as a tail codec
+    shared_ptr<IntegerCODEC> c = CODECFactory::getFromName("simdfastpfor+streamvbyte");
+    vector<uint32_t, cacheallocator> data(128 * 3 + 77);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint32_t> (rand()) % (1U << (i % 20));
+    vector<uint32_t, cacheallocator> out(c->maxCompressedWords(data.size()));
+    size_t nvalue = out.size();
+    c->encodeArray(data.data(), data.size(), out.data(), nvalue);
+    vector<uint32_t, cacheallocator> recovered(data.size() + 1024);
+    size_t recoveredsize = recovered.size();
+    c->decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+    recovered.resize(recoveredsize);
+    if (recovered != data)
+        throw logic_error("SIMDFastPFor+StreamVByte bug");
+}
+
+#ifdef VARINTG8IU_H__
+// the AVX2 decoder should agree with decodeBlock
+void testVarIntG8IU() {
+    cout << "testing VarIntG8IU..." << endl;
+    VarIntG8IU codec;
+    for (size_t length = 0; length < 200; length += (length < 20 ? 1 : 29)) {
+        vector<uint32_t> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = static_cast<uint32_t> (rand()) >> (8 * (rand() % 4));
+        vector<uint32_t> out(codec.maxCompressedWords(length) + 1);
+        size_t nvalue = out.size();
+        codec.encodeArray(data.data(), length, out.data(), nvalue);
+        vector<uint32_t> recovered(length + 8), slow(length + 8);
+        size_t recoveredsize = recovered.size();
+        codec.decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+        const unsigned char * src = reinterpret_cast<const unsigned char *> (out.data());
+        size_t srclength = nvalue * 4, slowsize = 0, dstlength = slow.size() * 4;
+        uint32_t * dst = slow.data();
+        while (srclength >= 9)
+            slowsize += codec.decodeBlock(src, srclength, dst, dstlength);
+        recovered.resize(recoveredsize);
+        slow.resize(slowsize);
+        if ((recovered != data) || (slow != data))
+            throw logic_error("VarIntG8IU bug");
+    }
+    vector<uint32_t> data(100, 12345);
+    vector<uint32_t> out(4);
+    size_t nvalue = out.size();
+    try {
+        codec.encodeArray(data.data(), data.size(), out.data(), nvalue);
+    } catch (NotEnoughStorage &) {
+        return;
+    }
+    throw logic_error("VarIntG8IU should not write past the output");
+}
+#endif
+
+// mixes of selectors, so that the SIMD decoding meets all of them
+template<class CODEC>
+void testSimpleDecoding(CODEC & codec) {
+    for (size_t length : {10, 33, 300, 1000, 5000}) {
+        vector<uint32_t> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = static_cast<uint32_t> (rand()) % (1U << ((i / 50) % 29));
+        vector<uint32_t> out(codec.maxCompressedWords(length));
+        size_t nvalue = out.size();
+        codec.encodeArray(data.data(), length, out.data(), nvalue);
+        vector<uint32_t> recovered(length + 240);
+        size_t recoveredsize = length;// needed without MarkLength
+        codec.decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+        if ((recoveredsize != length) || !equal(data.begin(), data.end(), recovered.begin()))
+            throw logic_error("bug in " + codec.name());
+    }
+}
+
+void testSimpleDecoding() {
+    cout << "testing the decoding of Simple8b and Simple16..." << endl;
+    Simple8b<true> simple8b;
+    Simple8b<false> simple8bnolength;
+    Simple16<true> simple16;
+    Simple16<false> simple16nolength;
+    testSimpleDecoding(simple8b);
+    testSimpleDecoding(simple8bnolength);
+    testSimpleDecoding(simple16);
+    testSimpleDecoding(simple16nolength);
+}
+
+// the estimated bit widths should compress about as well as the exact search
+void testOPTPForEstimate() {
+    cout << "testing OPTPFor with estimated bit widths..." << endl;
+    ClusteredDataGenerator cdg;
+    shared_ptr<IntegerCODEC> exact = CODECFactory::getFromName("optpfor");
+    shared_ptr<IntegerCODEC> estimated = CODECFactory::getFromName("fastoptpfor");
+    size_t exactwords = 0, estimatedwords = 0;
+    for (uint32_t bits = 12; bits < 26; ++bits) {
+        vector<uint32_t, cacheallocator> data = cdg.generateClustered(128 * 16, 1U << bits);
+        Delta::delta(data.data(), data.size());
+        vector<uint32_t, cacheallocator> out(exact->maxCompressedWords(data.size()));
+        size_t nvalue = out.size();
+        exact->encodeArray(data.data(), data.size(), out.data(), nvalue);
+        exactwords += nvalue;
+        nvalue = out.size();
+        estimated->encodeArray(data.data(), data.size(), out.data(), nvalue);
+        estimatedwords += nvalue;
+        vector<uint32_t, cacheallocator> recovered(data.size() + 1024);
+        size_t recoveredsize = recovered.size();
+        exact->decodeArray(out.data(), nvalue, recovered.data(), recoveredsize);
+        recovered.resize(recoveredsize);
+        if (recovered != data)
+            throw logic_error("OPTPFor with estimates: bug");
+    }
+    if (estimatedwords > exactwords * 1.02)
+        throw logic_error("OPTPFor estimates are off");
+}
+
+// the SIMD scans of FastPFor against asmbits, on every bit width
+void testBitWidthHistogram() {
+    cout << "testing the bit width histogram..." << endl;
+    vector<uint32_t> data;
+    for (uint32_t b = 0; b < 32; ++b) {
+        data.push_back(1U << b);
+        data.push_back((1U << b) - 1);
+        data.push_back((1U << b) + 1);
+        data.push_back((1U << b) | (1U << b >> 1));
+        data.push_back(rand() & ((1U << b) - 1));
+    }
+    data.push_back(0xFFFFFFFF);
+    data.push_back(0x80000000);
+    data.push_back(0);
+    while (data.size() < 256)
+        data.push_back(static_cast<uint32_t> (rand()) >> (rand() % 32));
+    for (uint32_t length = 0; length <= 256; length += 4) {
+        uint32_t freqs[33], expected[33] = { 0 };
+        bitWidthHistogram(data.data(), length, freqs);
+        for (uint32_t k = 0; k < length; ++k)
+            expected[asmbits(data[k])]++;
+        if (!equal(freqs, freqs + 33, expected))
+            throw logic_error("bug in bitWidthHistogram");
+    }
+    for (uint32_t b = 0; b < 32; ++b) {
+        uint8_t positions[256];
+        const uint32_t cexcept = exceptionPositions(data.data(), 256, b, positions);
+        vector<uint8_t> expected;
+        for (uint32_t k = 0; k < 256; ++k)
+            if (data[k] >= (1U << b))
+                expected.push_back(static_cast<uint8_t> (k));
+        if ((cexcept != expected.size()) || !equal(expected.begin(), expected.end(), positions))
+            throw logic_error("bug in exceptionPositions");
+    }
+}
+
+// patchExceptions (AVX-512 from 16 exceptions on) against the scalar loop
+void testPatchExceptions() {
+    cout << "testing the patching of exceptions..." << endl;
+    for (uint32_t cexcept = 0; cexcept <= 128; ++cexcept) {
+        const uint32_t b = cexcept % 32;
+        vector<uint8_t> positions(128);
+        for (uint32_t k = 0; k < 128; ++k)
+            positions[k] = static_cast<uint8_t> (k);
+        random_shuffle(positions.begin(), positions.end());
+        positions.resize(cexcept);
+        vector<uint32_t> exceptions(cexcept), out(128), expected(128);
+        for (uint32_t k = 0; k < cexcept; ++k)
+            exceptions[k] = rand();
+        for (uint32_t k = 0; k < 128; ++k)
+            out[k] = expected[k] = rand() & ((1U << b) - 1);
+        for (uint32_t k = 0; k < cexcept; ++k)
+            expected[positions[k]] |= exceptions[k] << b;
+        patchExceptions(out.data(), positions.data(), exceptions.data(), cexcept, b);
+        if (out != expected)
+            throw logic_error("bug in patchExceptions");
+    }
+}
+
+// the compressed data can be moved to any word and decoded to any word
+// the templated kernels should produce the format of the generated ones
+void testSIMDTemplatedKernels() {
+    cout << "testing the templated SIMD kernels..." << endl;
+    const size_t blocks = 3;
+    vector<uint32_t, cacheallocator> data(128 * blocks), dirty(128 * blocks);
+    vector<uint32_t, cacheallocator> expected(128 * blocks), packed(128 * blocks),
+            recovered(128 * blocks);
+    for (uint32_t bit = 0; bit <= 32; ++bit) {
+        for (size_t k = 0; k < data.size(); ++k) {
+            data[k] = bit == 32 ? static_cast<uint32_t> (rand()) << 1 ^ rand()
+                    : rand() & ((1U << bit) - 1);
+            dirty[k] = bit == 32 ? data[k] : data[k] | (static_cast<uint32_t> (rand()) << bit);
+        }
+        for (size_t b = 0; b < blocks; ++b)
+            SIMD_fastpackwithoutmask_32(&data[128 * b],
+                    reinterpret_cast<__m128i *> (&expected[4 * bit * b]), bit);
+        SIMD_packBlocksTable(bit)(data.data(), reinterpret_cast<__m128i *> (packed.data()),
+                blocks);
+        if (!equal(expected.begin(), expected.begin() + 4 * bit * blocks, packed.begin()))
+            throw logic_error("bug in SIMD_packBlocksWithoutMask");
+        fill(packed.begin(), packed.end(), 0);
+        for (size_t b = 0; b < blocks; ++b)
+            switch (bit) {// a few widths known at compile time
+            case 5:
+                SIMD_pack<5> (&dirty[128 * b], reinterpret_cast<__m128i *> (&packed[4 * bit * b]));
+                break;
+            case 17:
+                SIMD_pack<17> (&dirty[128 * b], reinterpret_cast<__m128i *> (&packed[4 * bit * b]));
+                break;
+            default:
+                SIMD_fastpack_32(&dirty[128 * b], reinterpret_cast<__m128i *> (&packed[4 * bit * b]),
+                        bit);
+            }
+        if (!equal(expected.begin(), expected.begin() + 4 * bit * blocks, packed.begin()))
+            throw logic_error("bug in SIMD_pack");
+        SIMD_unpackBlocksTable(bit)(reinterpret_cast<const __m128i *> (expected.data()),
+                recovered.data(), blocks);
+        if (recovered != data)
+            throw logic_error("bug in SIMD_unpackBlocks");
+    }
+}
+
+void testHorizontalScan() {
+    cout << "testing HorizontalScanCodec..." << endl;
+    HorizontalScanCodec codec;
+    const uint32_t bits[] = { 0, 1, 3, 7, 8, 13, 20, 25, 26, 31, 32 };
+    for (uint32_t b : bits) {
+        for (size_t length : { size_t(0), size_t(7), size_t(1000), size_t(3 * 4096 + 77) }) {
+            vector<uint32_t> data(length);
+            for (size_t i = 0; i < length; ++i)
+                data[i] = b == 32 ? static_cast<uint32_t> (rand()) << 1 ^ rand()
+                        : b == 0 ? 0 : rand() & ((1U << b) - 1);
+            if ((b > 0) && (length > 0))
+                data[0] = b == 32 ? 0xFFFFFFFF : (1U << b) - 1;// the bit width is b
+            vector<uint32_t> compressed(codec.maxCompressedWords(length));
+            size_t nvalue = compressed.size();
+            codec.encodeArray(data.data(), length, compressed.data(), nvalue);
+            vector<uint32_t> recovered(length + 1);
+            size_t recoveredsize = recovered.size();
+            codec.decodeArray(compressed.data(), nvalue, recovered.data(), recoveredsize);
+            if ((recoveredsize != length) || !equal(data.begin(), data.end(), recovered.begin()))
+                throw logic_error("bug in HorizontalScanCodec::decodeArray");
+            const uint32_t pivot = length > 0 ? data[length / 2] : 5;
+            vector<uint32_t> in;
+            in.push_back(pivot);
+            in.push_back(3);
+            in.push_back(0xFFFFFFFF);
+            const ScanPredicate predicates[] = { ScanPredicate::equal(pivot),
+                    ScanPredicate::equal(0xFFFFFFFF), ScanPredicate::less(pivot),
+                    ScanPredicate::less(0xFFFFFFFF), ScanPredicate::between(pivot / 2, pivot),
+                    ScanPredicate::between(0, 0xFFFFFFFF), ScanPredicate::between(10, 3),
+                    ScanPredicate::in(in) };
+            for (const ScanPredicate & p : predicates) {
+                vector<uint64_t> bitmap(HorizontalScanCodec::bitmapWords(compressed.data()) + 1,
+                        0xAAAAAAAAAAAAAAAAULL);
+                HorizontalScanCodec::scanToBitmap(compressed.data(), p, bitmap.data());
+                vector<uint32_t> selection(length);
+                const size_t howmany = HorizontalScanCodec::scanToSelection(compressed.data(), p,
+                        selection.data());
+                size_t expected = 0;
+                for (size_t i = 0; i < length; ++i) {
+                    const bool m = p.matches(data[i]);
+                    if (m != ((bitmap[i / 64] >> (i % 64)) & 1))
+                        throw logic_error("bug in HorizontalScanCodec::scanToBitmap");
+                    if (m && ((expected >= howmany) || (selection[expected++] != i)))
+                        throw logic_error("bug in HorizontalScanCodec::scanToSelection");
+                }
+                if ((length % 64 != 0) && ((bitmap[length / 64] >> (length % 64)) != 0))
+                    throw logic_error("HorizontalScanCodec: bad bitmap padding");
+                if ((expected != howmany) || (HorizontalScanCodec::count(compressed.data(), p)
+                        != howmany))
+                    throw logic_error("HorizontalScanCodec: bad count");
+            }
+        }
+    }
+}
+
+void testUnalignedSIMDBinaryPacking() {
+    cout << "testing UnalignedSIMDBinaryPacking..." << endl;
+    shared_ptr<IntegerCODEC> codec = CODECFactory::getFromName("unalignedsimdbinarypacking");
+    vector<uint32_t> data(3 * UnalignedSIMDBinaryPacking::BlockSize + 77);
+    for (size_t k = 0; k < data.size(); ++k)
+        data[k] = static_cast<uint32_t> (rand()) >> (k % 32);
+    vector<uint32_t, cacheallocator> compressed(codec->maxCompressedWords(data.size()) + 8);
+    vector<uint32_t, cacheallocator> recovered(data.size() + 8);
+    for (uint32_t offset = 0; offset < 4; ++offset) {
+        size_t nvalue = compressed.size() - 4;
+        codec->encodeArray(data.data(), data.size(), compressed.data() + offset, nvalue);
+        // move the compressed data by one word
+        memmove(compressed.data() + 4 - offset, compressed.data() + offset,
+                nvalue * sizeof(uint32_t));
+        size_t recoveredsize = data.size();
+        codec->decodeArray(compressed.data() + 4 - offset, nvalue,
+                recovered.data() + offset, recoveredsize);
+        if ((recoveredsize != data.size()) || !equal(data.begin(), data.end(),
+                recovered.begin() + offset))
+            throw logic_error("bug in UnalignedSIMDBinaryPacking");
+        // unaligned deltas as well
+        Delta::deltaSIMD(recovered.data() + offset, recoveredsize);
+        Delta::inverseDeltaSIMD(recovered.data() + offset, recoveredsize);
+        if (!equal(data.begin(), data.end(), recovered.begin() + offset))
+            throw logic_error("bug in the unaligned deltas");
+    }
+}
+
+// the percentiles are within 1/16 of the exact ones
+void testLatencyHistogram() {
+    cout << "testing LatencyHistogram..." << endl;
+    for (uint32_t v = 0; v < (1U << 16); ++v)
+        if (LatencyHistogram::lowerBound(LatencyHistogram::bucket(v)) > v
+                || LatencyHistogram::lowerBound(LatencyHistogram::bucket(v) + 1) <= v)
+            throw logic_error("bug in LatencyHistogram::bucket");
+    LatencyHistogram h, other;
+    vector<uint64_t> samples;
+    for (uint32_t k = 0; k < 10000; ++k) {
+        samples.push_back(static_cast<uint64_t> (rand()) * (k % 7 + 1));
+        (k % 2 == 0 ? h : other).add(samples.back());
+    }
+    h += other;
+    if (h.count() != samples.size())
+        throw logic_error("bug in LatencyHistogram::count");
+    sort(samples.begin(), samples.end());
+    const double ps[] = { 0.5, 0.99, 0.999 };
+    for (double p : ps) {
+        const double exact = static_cast<double> (samples[static_cast<size_t> (ceil(p
+                * samples.size())) - 1]);
+        if (fabs(static_cast<double> (h.percentile(p)) - exact) > exact / 16)
+            throw logic_error("bug in LatencyHistogram::percentile");
+    }
+    if (LatencyHistogram().percentile(0.5) != 0)
+        throw logic_error("bug in LatencyHistogram::percentile");
+}
+
+// the generated arrays depend on the seed, not on the number of threads
+void testSyntheticGenerators() {
+    cout << "testing the synthetic generators..." << endl;
+    for (uint32_t t = 0; t < 100; ++t) {
+        UniformDataGenerator g(t);
+        const uint32_t Max = 1 + rand() % 100000;
+        const uint32_t N = t % 2 == 0 ? rand() % (Max + 1) : Max - rand() % (Max / 64 + 1);
+        vector<uint32_t, cacheallocator> v = g.generateUniform(N, Max);
+        if ((v.size() != N) || ((N > 0) && (v.back() >= Max)))
+            throw logic_error("bug in generateUniform");
+        for (size_t k = 1; k < v.size(); ++k)
+            if (v[k] <= v[k - 1])
+                throw logic_error("generateUniform should give distinct sorted values");
+    }
+    ClusteredDataGenerator one(5), many(5);
+    vector<uint32_t, cacheallocator> a = one.generateClusteredParallel(1U << 19, 1U << 26, 1);
+    if (a != many.generateClusteredParallel(1U << 19, 1U << 26, 4))
+        throw logic_error("bug in generateClusteredParallel");
+    for (size_t k = 1; k < a.size(); ++k)
+        if (a[k] <= a[k - 1])
+            throw logic_error("generateClusteredParallel should give distinct sorted values");
+    if (generateZipfianArray32(1U << 18, 1.0, 1U << 20, 3, 1)
+            != generateZipfianArray32(1U << 18, 1.0, 1U << 20, 3, 4))
+        throw logic_error("bug in generateZipfianArray32");
+    auto generate = [](ClusteredDataGenerator & g) {return g.generateClustered(1000, 1U << 20);};
+    if (generateArrays<ClusteredDataGenerator> (10, 7, generate, 1)
+            != generateArrays<ClusteredDataGenerator> (10, 7, generate, 3))
+        throw logic_error("bug in generateArrays");
+    ZipfianGenerator zipf(1000, 1.0, 9);
+    ZRandom r1(4), r2(4);
+    for (uint32_t k = 0; k < 100000; ++k)
+        if (zipf.nextInt(r2) != lower_bound(zipf.proba.begin(), zipf.proba.end(),
+                r1.getDouble()) - zipf.proba.begin())
+            throw logic_error("bug in ZipfianGenerator::nextInt");
+}
+
+// several runs, merged, with and without compression
+void testExternalSort() {
+    cout << "testing externalvector::sort..." << endl;
+    for (uint32_t compress = 0; compress < 2; ++compress)
+        for (size_t blocksize : { 100000, 1000, 777, 1 }) {
+            const size_t N = blocksize == 1 ? 100 : 10000;
+            externalvector ev(3);
+            ev.open();
+            vector < vector<uint32_t> > expected;
+            for (size_t k = 0; k < N; ++k) {
+                vector<uint32_t> row = { static_cast<uint32_t> (rand() % 10),
+                        static_cast<uint32_t> (rand() % 1000), static_cast<uint32_t> (rand()) };
+                ev.append(row);
+                expected.push_back(row);
+            }
+            // many ties on the first two columns: the sort must be stable
+            vector<size_t> columns = { 0, 1 };
+            Cmp cmp(columns);
+            ev.sort(cmp, blocksize, 3, compress == 1);
+            stable_sort(expected.begin(), expected.end(), cmp);
+            if (ev.size() != N)
+                throw logic_error("externalvector::sort lost rows");
+            for (size_t k = 0; k < N; ++k)
+                if (ev.get(k) != expected[k])
+                    throw logic_error("bug in externalvector::sort");
+            ev.close();
+        }
+}
+
+void testCSVFlatFile() {
+    cout << "testing CSVFlatFile..." << endl;
+    char filename[] = "/tmp/fastpforcsvXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0)
+        throw runtime_error("could not create a temporary file");
+    close(fd);
+    ofstream out(filename);
+    out << "# a comment, to be skipped" << endl;
+    for (size_t k = 0; k < 5000; ++k) {
+        if (k % 100 == 0)
+            out << endl;
+        out << "a" << rand() % 7 << ",," << rand() % 300 << "," << string(rand() % 40, 'x')
+                << rand() % 2 << (k % 3 == 0 ? "  " : "") << endl;
+    }
+    out.close();
+    for (int normtype : { CSVFlatFile::FREQNORMALISATION, CSVFlatFile::DOMAINNORMALISATION })
+        for (uint32_t threads : { 1, 3 }) {
+            // what the istream-based CSVReader gives us
+            ifstream in(filename);
+            CSVReader reader(&in);
+            vector<vector<string> > rows;
+            while (reader.hasNext())
+                rows.push_back(reader.nextRow());
+            vector<map<string, size_t> > counts(rows[0].size());
+            for (const vector<string> & row : rows)
+                for (size_t c = 0; c < row.size(); ++c)
+                    ++counts[c][row[c]];
+            CSVFlatFile csv(filename, normtype, threads);
+            if ((csv.getNumberOfRows() != rows.size()) || (csv.getNumberOfColumns() != 3))
+                throw logic_error("CSVFlatFile does not count the lines or the columns");
+            vector<map<string, uint32_t> > ids(counts.size());
+            for (size_t c = 0; c < counts.size(); ++c) {
+                vector<pair<size_t, string> > values;
+                for (auto & v : counts[c])
+                    values.push_back(make_pair(normtype == CSVFlatFile::FREQNORMALISATION
+                            ? v.second : 0, v.first));
+                if (normtype == CSVFlatFile::FREQNORMALISATION)
+                    sort(values.rbegin(), values.rend());
+                for (size_t i = 0; i < values.size(); ++i)
+                    ids[c][values[i].second] = static_cast<uint32_t> (i);
+            }
+            vector<uint32_t> container(3);
+            for (const vector<string> & row : rows) {
+                if (!csv.nextRow(container))
+                    throw logic_error("CSVFlatFile lost rows");
+                for (size_t c = 0; c < 3; ++c)
+                    if (container[c] != ids[c][row[c]])
+                        throw logic_error("bug in CSVFlatFile");
+            }
+            if (csv.nextRow(container))
+                throw logic_error("CSVFlatFile does not stop");
+            csv.close();
+        }
+    remove(filename);
+}
+
+void testEntropySketch() {
+    cout << "testing EntropySketch..." << endl;
+    // few distinct values: the sketch is exact
+    vector<uint32_t> data(300000);
+    for (size_t k = 0; k < data.size(); ++k)
+        data[k] = k % 3 == 0 ? rand() % 100 : (rand() % 5000) << (rand() % 17);
+    EntropyRecorder er;
+    EntropySketch es;
+    er.eat(data.data(), 1000);
+    er.eat(data.data() + 1000, data.size() - 1000);
+    es.eat(data.data(), 1000);
+    es.eat(data.data() + 1000, data.size() - 1000);
+    if ((es.samplingLevel() != 0) || (fabs(es.computeShannon() - er.computeShannon()) > 1e-9)
+            || (fabs(es.computeDataBits() - er.computeDataBits()) > 1e-9)
+            || (es.distinctValues() != er.counter.size()))
+        throw logic_error("EntropySketch is not exact");
+    // too many distinct values: we sample, within the error bound
+    UniformDataGenerator gen(1);
+    vector<uint32_t, cacheallocator> large = gen.generateUniform(1U << 20, 1U << 30);
+    er.clear();
+    es.clear();
+    er.eat(large.data(), large.size());
+    es.eat(large.data(), large.size());
+    if ((es.samplingLevel() == 0) || (fabs(es.computeDataBits() - er.computeDataBits()) > 1e-9))
+        throw logic_error("EntropySketch does not sample");
+    if (fabs(es.computeShannon() - er.computeShannon()) > 5 * es.shannonStandardError())
+        throw logic_error("EntropySketch is beyond its error bound");
+}
+
+uint64_t rand64() {
+    return (static_cast<uint64_t> (rand()) << 62) ^ (static_cast<uint64_t> (rand()) << 31) ^ rand();
+}
+
+// as fillAdversarial, with bit widths up to 64
+void fillAdversarial64(vector<uint64_t> & data) {
+    for (size_t i = 0; i < data.size(); i += 128) {
+        const uint32_t b = rand() % 65;
+        const uint32_t exceptbits = rand() % 65;
+        const int exceptrate = rand() % 64;
+        for (size_t j = i; j < min<size_t>(i + 128, data.size()); ++j) {
+            const uint32_t bits = rand() % 64 < exceptrate ? exceptbits : b;
+            data[j] = bits == 64 ? rand64() : rand64() & ((1ULL << bits) - 1);
+        }
+    }
+}
+
+void testCodecs64() {
+    cout << "testing the 64-bit codecs..." << endl;
+    for (uint32_t bit = 0; bit <= 64; ++bit) {
+        vector<uint64_t> data(200), recovered(200);
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = bit == 64 ? rand64() : rand64() & ((1ULL << bit) - 1);
+        vector<uint32_t> packed(4 * 64 + 1);
+        SIMD_fastpack_64(data.data(), packed.data() + 1, bit);// unaligned
+        SIMD_fastunpack_64(packed.data() + 1, recovered.data(), bit);
+        if (!equal(data.begin(), data.begin() + 128, recovered.begin()))
+            throw logic_error("SIMD_fastpack_64 bug");
+        vector<uint32_t> stream(2 * data.size());
+        for (size_t count : {1, 3, 31, 200}) {
+            uint32_t * end = packStream64(data.data(), count, stream.data(), bit);
+            if (static_cast<size_t> (end - stream.data()) != (count * bit + 31) / 32)
+                throw logic_error("packStream64 uses the wrong number of words");
+            if (unpackStream64(stream.data(), count, recovered.data(), bit) != end)
+                throw logic_error("unpackStream64 bug");
+            if (!equal(data.begin(), data.begin() + count, recovered.begin()))
+                throw logic_error("packStream64 bug");
+        }
+    }
+    vector<shared_ptr<IntegerCODEC64> > codecs = {
+            shared_ptr<IntegerCODEC64> (new JustCopy64()),
+            shared_ptr<IntegerCODEC64> (new VariableByte64()),
+            shared_ptr<IntegerCODEC64> (new Simple8b64()),
+            shared_ptr<IntegerCODEC64> (new CompositeCodec64<SIMDBinaryPacking64, VariableByte64> ()),
+            shared_ptr<IntegerCODEC64> (new CompositeCodec64<FastPFor64, VariableByte64> ()) };
+    const uint32_t canary = 0xDEADBEEF;
+    for (size_t length : {0, 1, 127, 128, 513, 1000, 65536 + 2048 + 129}) {
+        for (int run = 0; run < 4; ++run) {
+            vector<uint64_t> data(length);
+            if (run == 0) // timestamps, delta coded
+                for (size_t i = 0; i < length; ++i)
+                    data[i] = (i == 0 ? 1600000000000000000ULL : data[i - 1]) + rand() % 1000;
+            else if (run == 1)
+                fill(data.begin(), data.end(), ~0ULL);
+            else
+                fillAdversarial64(data);
+            if ((run == 0) && (length > 0))
+                Delta::delta(data.data(), length);
+            for (auto & c : codecs) {
+                const size_t bound = c->maxCompressedWords(length);
+                vector<uint32_t> out(bound + 64, canary);
+                size_t nvalue = bound;
+                c->encodeArray(data.data(), length, out.data(), nvalue);
+                if ((nvalue > bound) || (out[bound] != canary)) {
+                    cerr << c->name() << " length " << length << " used " << nvalue
+                            << " bound " << bound << endl;
+                    throw logic_error("maxCompressedWords bug (64 bits)");
+                }
+                vector<uint64_t> recovered(length + 1);
+                size_t recoveredlength = recovered.size();
+                const uint32_t * end = c->decodeArray(out.data(), nvalue,
+                        recovered.data(), recoveredlength);
+                recovered.resize(recoveredlength);
+                if ((recovered != data) || (end != out.data() + nvalue)) {
+                    cerr << c->name() << " length " << length << " run " << run << endl;
+                    throw logic_error("64-bit codec bug");
+                }
+            }
+        }
+    }
+    // the delta helpers
+    for (size_t length : {1, 2, 3, 4, 5, 1001}) {
+        vector<uint64_t> data(length);
+        for (size_t i = 0; i < length; ++i)
+            data[i] = (i == 0 ? 0 : data[i - 1]) + rand64() % 1000000;
+        vector<uint64_t> copy(data);
+        Delta::deltaSIMD(copy.data(), length);
+        Delta::inverseDeltaSIMD(copy.data(), length);
+        if (copy != data)
+            throw logic_error("64-bit deltaSIMD bug");
+        Delta::delta(copy.data(), length);
+        Delta::fastinverseDelta(copy.data(), length);
+        if (copy != data)
+            throw logic_error("64-bit fastinverseDelta bug");
+    }
+}
+
+// encodeDeltaArray should produce the same output as delta coding followed by encodeArray
+// (or encodeArray alone for the codecs that do the delta coding), and Delta::decode undoes it
+void testEncodeDeltaArray() {
+    cout << "testing encodeDeltaArray..." << endl;
+    vector < shared_ptr<IntegerCODEC> > myalgos = CODECFactory::allSchemes();
+    const size_t lengths[] = {3, 129, 2048 + 129, 65536 * 2 + 1000};
+    for (size_t length : lengths) {
+        vector<uint32_t, cacheallocator> data(length);
+        uint32_t v = 0;
+        for (size_t i = 0; i < length; ++i)
+            data[i] = v += rand() % 100;
+        for (int SIMDmode = 0; SIMDmode < 2; ++SIMDmode) {
+            vector<uint32_t, cacheallocator> deltas(data);
+            if (SIMDmode)
+                Delta::deltaSIMD(&deltas[0], length);
+            else
+                Delta::delta(&deltas[0], length);
+            for (auto & c : myalgos) {
+                if (c->name() == "VSEncoding") // VSEncoding is fragile, output must be zero
+                    continue;
+                vector<uint32_t, cacheallocator> out1(2 * length + 1024), out2(2 * length + 1024);
+                size_t nvalue1 = out1.size(), nvalue2 = out2.size();
+                c->encodeArray(c->codesDeltas() ? &data[0] : &deltas[0], length, &out1[0],
+                        nvalue1);
+                c->encodeDeltaArray(&data[0], length, &out2[0], nvalue2, SIMDmode);
+                out1.resize(nvalue1);
+                out2.resize(nvalue2);
+                if (out1 != out2) {
+                    cerr << c->name() << " length = " << length << endl;
+                    throw logic_error("encodeDeltaArray bug");
+                }
+                vector<uint32_t, cacheallocator> recovered(length + 1024);
+                size_t recoveredsize = recovered.size();
+                Delta::decode(*c, SIMDmode, &out2[0], nvalue2, &recovered[0], recoveredsize);
+                if ((recoveredsize != length) || !equal(data.begin(), data.end(),
+                        recovered.begin())) {
+                    cerr << c->name() << " length = " << length << endl;
+                    throw logic_error("Delta::decode bug");
+                }
+            }
+        }
+    }
+}
+
 int main() {
+    testAVXBitPacking();
+    testEncodeDeltaArray();
+    testSelect();
+    testSkipIndex();
+    testDecodedBlockCache();
+    testIntersection();
+    testCompressedMerge();
+    testStreamCodecs();
+    testClone();
+    testPageParallelCodecs();
+    testChecksumCodec();
+    testBatch();
+    testIndexFile();
+    testPostingStore();
+    testAppendableLists();
+    testMemoryPolicy();
+    testCodecCounters();
+    testMaropuReaders();
+    testTrims();
+    testMaxCompressedWords();
+    testHybridCodec();
+    testRunLengthCodec();
+    testShortListCodec();
+    testBlockSummaries();
+    testSharedDecoding();
+    testDecodeMany();
+    testAggregate();
+    testDecodeNarrow();
+    testRecommend();
+    testCodecs64();
+    testSIMDFrameOfReference();
+    testZigZagDelta();
+    testSimpleDecoding();
+    testOPTPForEstimate();
+    testStreamVByte();
+#ifdef VARINTG8IU_H__
+    testVarIntG8IU();
+#endif
+    testBitWidthHistogram();
+    testPatchExceptions();
+    testUnalignedSIMDBinaryPacking();
+    testSIMDTemplatedKernels();
+    testHorizontalScan();
+    testLatencyHistogram();
+    testSyntheticGenerators();
+    testExternalSort();
+    testCSVFlatFile();
+    testEntropySketch();
     vector < shared_ptr<IntegerCODEC> > myalgos = CODECFactory::allSchemes();
     for (uint32_t b = 0; b <= 28; ++b) {
 
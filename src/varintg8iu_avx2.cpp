@@ -0,0 +1,46 @@
+/**
+ * This is code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ *
+ * (c) Daniel Lemire
+ */
+/**
+ * This file must be compiled with -mavx2. The functions it exports
+ * should only be called on processors supporting AVX2 (see
+ * cpuSupportsAVX2() in cpufeatures.h).
+ */
+#include "varintg8iu_avx2.h"
+
+using namespace std;
+
+namespace avx2 {
+
+/**
+ * The 8 data bytes of a group are broadcast to both 128-bit lanes, so the
+ * 32-byte mask of the descriptor gives the (up to) 8 integers with one
+ * shuffle. We do two groups per iteration.
+ */
+static inline uint32_t * decodeGroup(const unsigned char * src, uint32_t * out,
+        const char (*mask)[32], const int * sizes) {
+    const unsigned char desc = src[0];
+    const __m256i data = _mm256_broadcastq_epi64(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i *> (src + 1)));
+    const __m256i shf = _mm256_load_si256(reinterpret_cast<const __m256i *> (mask[desc]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *> (out), _mm256_shuffle_epi8(data, shf));
+    return out + sizes[desc];
+}
+
+size_t varintg8iuDecode(const unsigned char * src, const size_t groups,
+        uint32_t * out, const char (*mask)[32], const int * sizes) {
+    uint32_t * const initout = out;
+    size_t g = 0;
+    for (; g + 2 <= groups; g += 2, src += 2 * 9) {
+        out = decodeGroup(src, out, mask, sizes);
+        out = decodeGroup(src + 9, out, mask, sizes);
+    }
+    if (g < groups)
+        out = decodeGroup(src, out, mask, sizes);
+    return out - initout;
+}
+
+}